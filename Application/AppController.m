@@ -360,6 +360,13 @@ void *kAppControllerContext = &kAppControllerContext;
 	DLog(@"Saving expanded nodes: %@", [expandedNodes description]);
 
 	[[NSUserDefaults standardUserDefaults] setValue:[expandedNodes allObjects] forKey:@"fileTreeViewExpandedNodes"];
+
+	// Rendered MIDI is only kept while the cache is enabled
+	if(![[NSUserDefaults standardUserDefaults] boolForKey:@"midi.renderCache"]) {
+		NSArray *cachePaths = NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES);
+		NSString *cachePath = [[[cachePaths firstObject] stringByAppendingPathComponent:[[NSBundle mainBundle] bundleIdentifier]] stringByAppendingPathComponent:@"MIDIRenderCache"];
+		[fileManager removeItemAtPath:cachePath error:nil];
+	}
 	// Workaround window not restoring it's size and position.
 	[miniWindow setContentSize:NSMakeSize(miniWindow.frame.size.width, 1)];
 	[miniWindow saveFrameUsingName:@"Mini Window"];
@@ -456,6 +463,9 @@ void *kAppControllerContext = &kAppControllerContext;
 
 	[userDefaultsValuesDict setObject:@"default" forKey:@"midi.flavor"];
 
+	[userDefaultsValuesDict setObject:[NSNumber numberWithBool:NO] forKey:@"midi.renderCache"];
+	[userDefaultsValuesDict setObject:[NSNumber numberWithInteger:1024] forKey:@"midi.renderCacheSize"];
+
 	[userDefaultsValuesDict setObject:[NSNumber numberWithBool:NO] forKey:@"resumePlaybackOnStartup"];
 
 	[userDefaultsValuesDict setObject:[NSNumber numberWithBool:NO] forKey:@"quitOnNaturalStop"];
@@ -137,6 +137,12 @@ static const uint32_t AudioChannelConfigTable[] = {
 	if(formatAssigned) {
 		const size_t bytesPerPacket = format.mBytesPerPacket;
 		const size_t byteCount = bytesPerPacket * frameCount;
+		if(byteCount >= [chunkData length]) {
+			// Everything goes, so hand over the data instead of copying it
+			NSData *ret = chunkData;
+			chunkData = [[NSMutableData alloc] init];
+			return ret;
+		}
 		NSData *ret = [chunkData subdataWithRange:NSMakeRange(0, byteCount)];
 		[chunkData replaceBytesInRange:NSMakeRange(0, byteCount) withBytes:NULL length:0];
 		return ret;
@@ -15,10 +15,14 @@
 NS_ASSUME_NONNULL_BEGIN
 
 @interface ChunkList : NSObject {
-	NSMutableArray<AudioChunk *> *chunkList;
-	double listDuration;
+	void *ring;
 	double maxDuration;
 
+	AudioStreamBasicDescription lastFormat;
+	uint32_t lastChannelConfig;
+	BOOL lastLossless;
+	BOOL formatWritten;
+
 	BOOL inAdder;
 	BOOL inRemover;
 	BOOL inPeeker;
@@ -35,9 +39,16 @@ NS_ASSUME_NONNULL_BEGIN
 - (BOOL)isEmpty;
 - (BOOL)isFull;
 
+// Changes whenever the remover frees room, including by skipping what a reset dropped
+- (uint64_t)readPosition;
+
 - (void)addChunk:(AudioChunk *)chunk;
 - (AudioChunk *)removeSamples:(size_t)maxFrameCount;
 
+// Room for frameCount frames to be written in place, or NULL if there is none yet
+- (void *_Nullable)reserveFrames:(size_t)frameCount format:(AudioStreamBasicDescription)format channelConfig:(uint32_t)config lossless:(BOOL)lossless;
+- (void)commitFrames:(size_t)frameCount;
+
 - (BOOL)peekFormat:(nonnull AudioStreamBasicDescription *)format channelConfig:(nonnull uint32_t *)config;
 
 @end
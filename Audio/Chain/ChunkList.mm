@@ -0,0 +1,176 @@
+//
+//  ChunkList.m
+//  CogAudio Framework
+//
+//  Created by Christopher Snowhill on 2/5/22.
+//
+
+#import "ChunkList.h"
+
+#import "AudioRingBuffer.h"
+
+typedef struct {
+	AudioStreamBasicDescription format;
+	uint32_t channelConfig;
+	BOOL lossless;
+} ChunkListFormat;
+
+// Enough for the whole duration and a couple of chunks, as writers only
+// wait for room after going over it
+static size_t ringCapacity(double duration, AudioStreamBasicDescription format, size_t frameCount) {
+	const double bytesPerSecond = format.mSampleRate * format.mBytesPerPacket;
+	return (size_t)(bytesPerSecond * duration * 1.25) + frameCount * format.mBytesPerPacket * 2 + 65536;
+}
+
+@implementation ChunkList
+
+@synthesize maxDuration;
+
+- (id)initWithMaximumDuration:(double)duration {
+	self = [super init];
+
+	if(self) {
+		ring = new AudioRingBuffer(0);
+		maxDuration = duration;
+
+		formatWritten = NO;
+
+		inAdder = NO;
+		inRemover = NO;
+		inPeeker = NO;
+		stopping = NO;
+	}
+
+	return self;
+}
+
+- (void)dealloc {
+	stopping = YES;
+	while(inAdder || inRemover || inPeeker) {
+		usleep(500);
+	}
+	delete(AudioRingBuffer *)ring;
+}
+
+// Only to be called from the thread adding to the list, the remover catches up on its next read
+- (void)reset {
+	((AudioRingBuffer *)ring)->discard();
+	formatWritten = NO;
+}
+
+- (double)listDuration {
+	return ((AudioRingBuffer *)ring)->duration();
+}
+
+- (BOOL)isEmpty {
+	return ((AudioRingBuffer *)ring)->empty();
+}
+
+- (uint64_t)readPosition {
+	return ((AudioRingBuffer *)ring)->readPosition();
+}
+
+- (BOOL)isFull {
+	return (maxDuration - [self listDuration]) < 0.05;
+}
+
+- (void *)reserveFrames:(size_t)frameCount format:(AudioStreamBasicDescription)format channelConfig:(uint32_t)config lossless:(BOOL)lossless {
+	if(stopping || !format.mBytesPerPacket || format.mSampleRate <= 0.0) return NULL;
+
+	AudioRingBuffer *_ring = (AudioRingBuffer *)ring;
+
+	if(!config) {
+		config = [AudioChunk guessChannelConfig:format.mChannelsPerFrame];
+	}
+
+	// Frames already buffered stay in the old storage, and the remover moves
+	// on to the new one when it reaches them
+	const size_t capacity = ringCapacity(maxDuration, format, frameCount);
+	if(_ring->capacity() < capacity && !_ring->resize(capacity))
+		return NULL;
+
+	if(!formatWritten || config != lastChannelConfig || lossless != lastLossless || memcmp(&format, &lastFormat, sizeof(format)) != 0) {
+		ChunkListFormat listFormat = { format, config, lossless };
+		if(!_ring->writeFormat(&listFormat, sizeof(listFormat), format.mBytesPerPacket, format.mSampleRate))
+			return NULL;
+
+		lastFormat = format;
+		lastChannelConfig = config;
+		lastLossless = lossless;
+		formatWritten = YES;
+	}
+
+	return _ring->reserve(frameCount);
+}
+
+- (void)commitFrames:(size_t)frameCount {
+	((AudioRingBuffer *)ring)->commit(frameCount);
+}
+
+- (void)addChunk:(AudioChunk *)chunk {
+	if(stopping) return;
+
+	inAdder = YES;
+
+	const size_t frameCount = [chunk frameCount];
+
+	if(frameCount) {
+		void *dest;
+		while(!(dest = [self reserveFrames:frameCount format:[chunk format] channelConfig:[chunk channelConfig] lossless:[chunk lossless]]) && !stopping) {
+			usleep(500);
+		}
+		if(dest) {
+			NSData *samples = [chunk removeSamples:frameCount];
+			memcpy(dest, [samples bytes], [samples length]);
+			[self commitFrames:frameCount];
+		}
+	}
+
+	inAdder = NO;
+}
+
+- (AudioChunk *)removeSamples:(size_t)maxFrameCount {
+	AudioChunk *ret = [[AudioChunk alloc] init];
+
+	if(stopping) {
+		return ret;
+	}
+
+	inRemover = YES;
+
+	AudioRingBuffer *_ring = (AudioRingBuffer *)ring;
+
+	size_t frameCount;
+	const void *format;
+	const void *samples = _ring->read(maxFrameCount, &frameCount, &format);
+	if(samples && frameCount) {
+		const ChunkListFormat *listFormat = (const ChunkListFormat *)format;
+		[ret setFormat:listFormat->format];
+		[ret setChannelConfig:listFormat->channelConfig];
+		[ret setLossless:listFormat->lossless];
+		[ret assignSamples:samples frameCount:frameCount];
+		_ring->consume(frameCount);
+	}
+
+	inRemover = NO;
+
+	return ret;
+}
+
+- (BOOL)peekFormat:(AudioStreamBasicDescription *)format channelConfig:(uint32_t *)config {
+	if(stopping) return NO;
+
+	inPeeker = YES;
+
+	const ChunkListFormat *listFormat = (const ChunkListFormat *)((AudioRingBuffer *)ring)->peekFormat();
+	if(listFormat) {
+		*format = listFormat->format;
+		*config = listFormat->channelConfig;
+	}
+
+	inPeeker = NO;
+
+	return listFormat != NULL;
+}
+
+@end
@@ -16,10 +16,15 @@
 
 #import "HeadphoneFilter.h"
 
+#import "SampleConverter.h"
+
 @interface ConverterNode : Node {
 	NSDictionary *rgInfo;
 
-	void *_r8bstate;
+	void *resampler;
+
+	void *rawBuffer;
+	size_t rawBufferSize;
 
 	void *inputBuffer;
 	size_t inputBufferSize;
@@ -52,8 +57,7 @@
 	void *extrapolateBuffer;
 	size_t extrapolateBufferSize;
 
-	void **dsd2pcm;
-	size_t dsd2pcmCount;
+	void *dsd2pcm;
 	int dsd2pcmLatency;
 
 	BOOL rememberedLossless;
@@ -74,6 +78,10 @@
 
 	void *hdcd_decoder;
 
+	SampleConverterFunc sampleConverter;
+	SampleConverterInt32Func hdcdConverter;
+	SampleConverterFunc hdcdOutputConverter;
+
 	HeadphoneFilter *hFilter;
 }
 
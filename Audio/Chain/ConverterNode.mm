@@ -13,6 +13,10 @@
 
 #import "Logging.h"
 
+#import "DSDDecimator.h"
+#import "Resampler.h"
+#import "SampleConverter.h"
+
 #import "lpc.h"
 #import "util.h"
 
@@ -22,8 +26,6 @@
 #import "BadSampleCleaner.h"
 #endif
 
-#import "r8bstate.h"
-
 void PrintStreamDesc(AudioStreamBasicDescription *inDesc) {
 	if(!inDesc) {
 		DLog(@"Can't print a NULL desc!\n");
@@ -50,7 +52,7 @@ void PrintStreamDesc(AudioStreamBasicDescription *inDesc) {
 	if(self) {
 		rgInfo = nil;
 
-		_r8bstate = 0;
+		resampler = NULL;
 		inputBuffer = NULL;
 		inputBufferSize = 0;
 		floatBuffer = NULL;
@@ -66,7 +68,6 @@ void PrintStreamDesc(AudioStreamBasicDescription *inDesc) {
 		extrapolateBufferSize = 0;
 
 		dsd2pcm = NULL;
-		dsd2pcmCount = 0;
 
 		hdcd_decoder = NULL;
 
@@ -94,329 +95,6 @@ extern "C" void scale_by_volume(float *buffer, size_t count, float volume) {
 	}
 }
 
-/**
- * DSD 2 PCM: Stage 1:
- * Decimate by factor 8
- * (one byte (8 samples) -> one float sample)
- * The bits are processed from least signicifant to most signicicant.
- * @author Sebastian Gesemann
- */
-
-#define dsd2pcm_FILTER_COEFFS_COUNT 64
-static const float dsd2pcm_FILTER_COEFFS[64] = {
-	0.09712411121659f, 0.09613438994044f, 0.09417884216316f, 0.09130441727307f,
-	0.08757947648990f, 0.08309142055179f, 0.07794369263673f, 0.07225228745463f,
-	0.06614191680338f, 0.05974199351302f, 0.05318259916599f, 0.04659059631228f,
-	0.04008603356890f, 0.03377897290478f, 0.02776684382775f, 0.02213240062966f,
-	0.01694232798846f, 0.01224650881275f, 0.00807793792573f, 0.00445323755944f,
-	0.00137370697215f, -0.00117318019994f, -0.00321193033831f, -0.00477694265140f,
-	-0.00591028841335f, -0.00665946056286f, -0.00707518873201f, -0.00720940203988f,
-	-0.00711340642819f, -0.00683632603227f, -0.00642384017266f, -0.00591723006715f,
-	-0.00535273320457f, -0.00476118922548f, -0.00416794965654f, -0.00359301524813f,
-	-0.00305135909510f, -0.00255339111833f, -0.00210551956895f, -0.00171076760278f,
-	-0.00136940723130f, -0.00107957856005f, -0.00083786862365f, -0.00063983084245f,
-	-0.00048043272086f, -0.00035442550015f, -0.00025663481039f, -0.00018217573430f,
-	-0.00012659899635f, -0.00008597726991f, -0.00005694188820f, -0.00003668060332f,
-	-0.00002290670286f, -0.00001380895679f, -0.00000799057558f, -0.00000440385083f,
-	-0.00000228567089f, -0.00000109760778f, -0.00000047286430f, -0.00000017129652f,
-	-0.00000004282776f, 0.00000000119422f, 0.00000000949179f, 0.00000000747450f
-};
-
-struct dsd2pcm_state {
-	/*
-	 * This is the 2nd half of an even order symmetric FIR
-	 * lowpass filter (to be used on a signal sampled at 44100*64 Hz)
-	 * Passband is 0-24 kHz (ripples +/- 0.025 dB)
-	 * Stopband starts at 176.4 kHz (rejection: 170 dB)
-	 * The overall gain is 2.0
-	 */
-
-	/* These remain constant for the duration */
-	int FILT_LOOKUP_PARTS;
-	float *FILT_LOOKUP_TABLE;
-	uint8_t *REVERSE_BITS;
-	int FIFO_LENGTH;
-	int FIFO_OFS_MASK;
-
-	/* These are altered */
-	int *fifo;
-	int fpos;
-};
-
-static void dsd2pcm_free(void *);
-static void dsd2pcm_reset(void *);
-
-static void *dsd2pcm_alloc() {
-	struct dsd2pcm_state *state = (struct dsd2pcm_state *)calloc(1, sizeof(struct dsd2pcm_state));
-
-	float *FILT_LOOKUP_TABLE;
-	double *temp;
-	uint8_t *REVERSE_BITS;
-
-	if(!state)
-		return NULL;
-
-	state->FILT_LOOKUP_PARTS = (dsd2pcm_FILTER_COEFFS_COUNT + 7) / 8;
-	const int FILT_LOOKUP_PARTS = state->FILT_LOOKUP_PARTS;
-	// The current 128 tap FIR leads to an 8 KB lookup table
-	state->FILT_LOOKUP_TABLE = (float *)calloc(sizeof(float), FILT_LOOKUP_PARTS << 8);
-	if(!state->FILT_LOOKUP_TABLE)
-		goto fail;
-	FILT_LOOKUP_TABLE = state->FILT_LOOKUP_TABLE;
-	temp = (double *)calloc(sizeof(double), 0x100);
-	if(!temp)
-		goto fail;
-	for(int part = 0, sofs = 0, dofs = 0; part < FILT_LOOKUP_PARTS;) {
-		memset(temp, 0, 0x100 * sizeof(double));
-		for(int bit = 0, bitmask = 0x80; bit < 8 && sofs + bit < dsd2pcm_FILTER_COEFFS_COUNT;) {
-			double coeff = dsd2pcm_FILTER_COEFFS[sofs + bit];
-			for(int bite = 0; bite < 0x100; bite++) {
-				if((bite & bitmask) == 0) {
-					temp[bite] -= coeff;
-				} else {
-					temp[bite] += coeff;
-				}
-			}
-			bit++;
-			bitmask >>= 1;
-		}
-		for(int s = 0; s < 0x100;) {
-			FILT_LOOKUP_TABLE[dofs++] = (float)temp[s++];
-		}
-		part++;
-		sofs += 8;
-	}
-	free(temp);
-	{ // calculate FIFO stuff
-		int k = 1;
-		while(k < FILT_LOOKUP_PARTS * 2) k <<= 1;
-		state->FIFO_LENGTH = k;
-		state->FIFO_OFS_MASK = k - 1;
-	}
-	state->REVERSE_BITS = (uint8_t *)calloc(1, 0x100);
-	if(!state->REVERSE_BITS)
-		goto fail;
-	REVERSE_BITS = state->REVERSE_BITS;
-	for(int i = 0, j = 0; i < 0x100; i++) {
-		REVERSE_BITS[i] = (uint8_t)j;
-		// "reverse-increment" of j
-		for(int bitmask = 0x80;;) {
-			if(((j ^= bitmask) & bitmask) != 0) break;
-			if(bitmask == 1) break;
-			bitmask >>= 1;
-		}
-	}
-
-	state->fifo = (int *)calloc(sizeof(int), state->FIFO_LENGTH);
-	if(!state->fifo)
-		goto fail;
-
-	dsd2pcm_reset(state);
-
-	return (void *)state;
-
-fail:
-	dsd2pcm_free(state);
-	return NULL;
-}
-
-static void *dsd2pcm_dup(void *_state) {
-	struct dsd2pcm_state *state = (struct dsd2pcm_state *)_state;
-	if(state) {
-		struct dsd2pcm_state *newstate = (struct dsd2pcm_state *)calloc(1, sizeof(struct dsd2pcm_state));
-		if(newstate) {
-			newstate->FILT_LOOKUP_PARTS = state->FILT_LOOKUP_PARTS;
-			newstate->FIFO_LENGTH = state->FIFO_LENGTH;
-			newstate->FIFO_OFS_MASK = state->FIFO_OFS_MASK;
-			newstate->fpos = state->fpos;
-
-			newstate->FILT_LOOKUP_TABLE = (float *)calloc(sizeof(float), state->FILT_LOOKUP_PARTS << 8);
-			if(!newstate->FILT_LOOKUP_TABLE)
-				goto fail;
-
-			memcpy(newstate->FILT_LOOKUP_TABLE, state->FILT_LOOKUP_TABLE, sizeof(float) * (state->FILT_LOOKUP_PARTS << 8));
-
-			newstate->REVERSE_BITS = (uint8_t *)calloc(1, 0x100);
-			if(!newstate->REVERSE_BITS)
-				goto fail;
-
-			memcpy(newstate->REVERSE_BITS, state->REVERSE_BITS, 0x100);
-
-			newstate->fifo = (int *)calloc(sizeof(int), state->FIFO_LENGTH);
-			if(!newstate->fifo)
-				goto fail;
-
-			memcpy(newstate->fifo, state->fifo, sizeof(int) * state->FIFO_LENGTH);
-
-			return (void *)newstate;
-		}
-
-	fail:
-		dsd2pcm_free(newstate);
-		return NULL;
-	}
-
-	return NULL;
-}
-
-static void dsd2pcm_free(void *_state) {
-	struct dsd2pcm_state *state = (struct dsd2pcm_state *)_state;
-	if(state) {
-		free(state->fifo);
-		free(state->REVERSE_BITS);
-		free(state->FILT_LOOKUP_TABLE);
-		free(state);
-	}
-}
-
-static void dsd2pcm_reset(void *_state) {
-	struct dsd2pcm_state *state = (struct dsd2pcm_state *)_state;
-	const int FILT_LOOKUP_PARTS = state->FILT_LOOKUP_PARTS;
-	int *fifo = state->fifo;
-	for(int i = 0; i < FILT_LOOKUP_PARTS; i++) {
-		fifo[i] = 0x55;
-		fifo[i + FILT_LOOKUP_PARTS] = 0xAA;
-	}
-	state->fpos = FILT_LOOKUP_PARTS;
-}
-
-static int dsd2pcm_latency(void *_state) {
-	struct dsd2pcm_state *state = (struct dsd2pcm_state *)_state;
-	if(state)
-		return state->FIFO_LENGTH;
-	else
-		return 0;
-}
-
-static void dsd2pcm_process(void *_state, const uint8_t *src, size_t sofs, size_t sinc, float *dest, size_t dofs, size_t dinc, size_t len) {
-	struct dsd2pcm_state *state = (struct dsd2pcm_state *)_state;
-	int bite1, bite2, temp;
-	float sample;
-	int *fifo = state->fifo;
-	const uint8_t *REVERSE_BITS = state->REVERSE_BITS;
-	const float *FILT_LOOKUP_TABLE = state->FILT_LOOKUP_TABLE;
-	const int FILT_LOOKUP_PARTS = state->FILT_LOOKUP_PARTS;
-	const int FIFO_OFS_MASK = state->FIFO_OFS_MASK;
-	int fpos = state->fpos;
-	while(len > 0) {
-		fifo[fpos] = REVERSE_BITS[fifo[fpos]] & 0xFF;
-		fifo[(fpos + FILT_LOOKUP_PARTS) & FIFO_OFS_MASK] = src[sofs] & 0xFF;
-		sofs += sinc;
-		temp = (fpos + 1) & FIFO_OFS_MASK;
-		sample = 0;
-		for(int k = 0, lofs = 0; k < FILT_LOOKUP_PARTS;) {
-			bite1 = fifo[(fpos - k) & FIFO_OFS_MASK];
-			bite2 = fifo[(temp + k) & FIFO_OFS_MASK];
-			sample += FILT_LOOKUP_TABLE[lofs + bite1] + FILT_LOOKUP_TABLE[lofs + bite2];
-			k++;
-			lofs += 0x100;
-		}
-		fpos = temp;
-		dest[dofs] = sample;
-		dofs += dinc;
-		len--;
-	}
-	state->fpos = fpos;
-}
-
-static void convert_dsd_to_f32(float *output, const uint8_t *input, size_t count, size_t channels, void **dsd2pcm) {
-	for(size_t channel = 0; channel < channels; ++channel) {
-		dsd2pcm_process(dsd2pcm[channel], input, channel, channels, output, channel, channels, count);
-	}
-}
-
-static void convert_u8_to_s16(int16_t *output, const uint8_t *input, size_t count) {
-	for(size_t i = 0; i < count; ++i) {
-		uint16_t sample = (input[i] << 8) | input[i];
-		sample ^= 0x8080;
-		output[i] = (int16_t)(sample);
-	}
-}
-
-static void convert_s8_to_s16(int16_t *output, const uint8_t *input, size_t count) {
-	for(size_t i = 0; i < count; ++i) {
-		uint16_t sample = (input[i] << 8) | input[i];
-		output[i] = (int16_t)(sample);
-	}
-}
-
-static void convert_u16_to_s16(int16_t *buffer, size_t count) {
-	for(size_t i = 0; i < count; ++i) {
-		buffer[i] ^= 0x8000;
-	}
-}
-
-static void convert_s16_to_hdcd_input(int32_t *output, const int16_t *input, size_t count) {
-	for(size_t i = 0; i < count; ++i) {
-		output[i] = input[i];
-	}
-}
-
-static void convert_s24_to_s32(int32_t *output, const uint8_t *input, size_t count) {
-	for(size_t i = 0; i < count; ++i) {
-		int32_t sample = (input[i * 3] << 8) | (input[i * 3 + 1] << 16) | (input[i * 3 + 2] << 24);
-		output[i] = sample;
-	}
-}
-
-static void convert_u24_to_s32(int32_t *output, const uint8_t *input, size_t count) {
-	for(size_t i = 0; i < count; ++i) {
-		int32_t sample = (input[i * 3] << 8) | (input[i * 3 + 1] << 16) | (input[i * 3 + 2] << 24);
-		output[i] = sample ^ 0x80000000;
-	}
-}
-
-static void convert_u32_to_s32(int32_t *buffer, size_t count) {
-	for(size_t i = 0; i < count; ++i) {
-		buffer[i] ^= 0x80000000;
-	}
-}
-
-static void convert_f64_to_f32(float *output, const double *input, size_t count) {
-	vDSP_vdpsp(input, 1, output, 1, count);
-}
-
-static void convert_be_to_le(uint8_t *buffer, size_t bitsPerSample, size_t bytes) {
-	size_t i;
-	bitsPerSample = (bitsPerSample + 7) / 8;
-	switch(bitsPerSample) {
-		case 2:
-			for(i = 0; i < bytes; i += 2) {
-				*(int16_t *)buffer = __builtin_bswap16(*(int16_t *)buffer);
-				buffer += 2;
-			}
-			break;
-
-		case 3: {
-			union {
-				vDSP_int24 int24;
-				uint32_t int32;
-			} intval;
-			intval.int32 = 0;
-			for(i = 0; i < bytes; i += 3) {
-				intval.int24 = *(vDSP_int24 *)buffer;
-				intval.int32 = __builtin_bswap32(intval.int32 << 8);
-				*(vDSP_int24 *)buffer = intval.int24;
-				buffer += 3;
-			}
-		} break;
-
-		case 4:
-			for(i = 0; i < bytes; i += 4) {
-				*(uint32_t *)buffer = __builtin_bswap32(*(uint32_t *)buffer);
-				buffer += 4;
-			}
-			break;
-
-		case 8:
-			for(i = 0; i < bytes; i += 8) {
-				*(uint64_t *)buffer = __builtin_bswap64(*(uint64_t *)buffer);
-				buffer += 8;
-			}
-			break;
-	}
-}
-
 - (void)process {
 	char writeBuf[CHUNK_SIZE];
 
@@ -468,9 +146,6 @@ tryagain:
 		while(inpOffset == inpSize) {
 			size_t samplesRead = 0;
 
-			BOOL isFloat = !!(inputFormat.mFormatFlags & kAudioFormatFlagIsFloat);
-			BOOL isUnsigned = !isFloat && !(inputFormat.mFormatFlags & kAudioFormatFlagIsSignedInteger);
-
 			// Approximately the most we want on input
 			ioNumberPackets = CHUNK_SIZE;
 			if(!skipResampler && ioNumberPackets < PRIME_LEN_)
@@ -487,6 +162,16 @@ tryagain:
 
 			ssize_t amountToWrite = ioNumberPackets * inputFormat.mBytesPerPacket;
 
+			// Anything but native float is read aside, then converted into the input buffer
+			const BOOL convertInput = sampleConverter || hdcd_decoder || dsd2pcm;
+			if(convertInput) {
+				size_t rawSize = amountToWrite;
+				if(dsd2pcm) rawSize += dsd2pcmLatency * ((DSDDecimator *)dsd2pcm)->ratio() * inputFormat.mBytesPerPacket;
+				if(!rawBuffer || rawBufferSize < rawSize)
+					rawBuffer = realloc(rawBuffer, rawBufferSize = rawSize);
+			}
+			uint8_t *readBuffer = (uint8_t *)(convertInput ? rawBuffer : inputBuffer);
+
 			ssize_t bytesReadFromInput = 0;
 
 			while(bytesReadFromInput < amountToWrite && !stopping && !paused && !streamFormatChanged && [self shouldContinue] == YES && [self endOfStream] == NO) {
@@ -513,7 +198,7 @@ tryagain:
 				size_t bytesRead = frameCount * inf.mBytesPerPacket;
 				if(frameCount) {
 					NSData *samples = [chunk removeSamples:frameCount];
-					memcpy(((uint8_t *)inputBuffer) + bytesReadFromInput, [samples bytes], bytesRead);
+					memcpy(readBuffer + bytesReadFromInput, [samples bytes], bytesRead);
 					lastChunkIn = [[AudioChunk alloc] init];
 					[lastChunkIn setFormat:inf];
 					[lastChunkIn setChannelConfig:config];
@@ -529,21 +214,19 @@ tryagain:
 			// Pad end of track with input format silence
 
 			if(stopping || paused || streamFormatChanged || [self shouldContinue] == NO || [self endOfStream] == YES) {
+				if(!is_postextrapolated_ && dsd2pcm) {
+					// Flush the decimator
+					size_t amountToSkip = dsd2pcmLatency * ((DSDDecimator *)dsd2pcm)->ratio() * inputFormat.mBytesPerPacket;
+					memset(readBuffer + bytesReadFromInput, 0x55, amountToSkip);
+					bytesReadFromInput += amountToSkip;
+				}
 				if(!skipResampler && !is_postextrapolated_) {
-					if(dsd2pcm) {
-						uint32_t amountToSkip = dsd2pcmLatency * inputFormat.mBytesPerPacket;
-						memset(((uint8_t *)inputBuffer) + bytesReadFromInput, 0x55, amountToSkip);
-						bytesReadFromInput += amountToSkip;
-					}
 					is_postextrapolated_ = 1;
 				} else if(!is_postextrapolated_ && dsd2pcm) {
 					is_postextrapolated_ = 3;
 				}
 			}
 
-			size_t bitsPerSample = inputFormat.mBitsPerChannel;
-			BOOL isBigEndian = !!(inputFormat.mFormatFlags & kAudioFormatFlagIsBigEndian);
-
 			if(!bytesReadFromInput && streamFormatChanged && !skipResampler && is_postextrapolated_ < 2) {
 				AudioChunk *chunk = lastChunkIn;
 				lastChunkIn = nil;
@@ -553,7 +236,7 @@ tryagain:
 				if(frameCount) {
 					amountToIgnorePostExtrapolated = (int)frameCount;
 					NSData *samples = [chunk removeSamples:frameCount];
-					memcpy(inputBuffer, [samples bytes], bytesRead);
+					memcpy(readBuffer, [samples bytes], bytesRead);
 				}
 				bytesReadFromInput += bytesRead;
 			}
@@ -563,96 +246,26 @@ tryagain:
 				return amountRead;
 			}
 
-			if(bytesReadFromInput && isBigEndian) {
-				// Time for endian swap!
-				convert_be_to_le((uint8_t *)inputBuffer, inputFormat.mBitsPerChannel, bytesReadFromInput);
-			}
-
-			if(bytesReadFromInput && isFloat && inputFormat.mBitsPerChannel == 64) {
-				// Time for precision loss from weird inputs
-				samplesRead = bytesReadFromInput / sizeof(double);
-				convert_f64_to_f32((float *)(((uint8_t *)inputBuffer) + bytesReadFromInput), (const double *)inputBuffer, samplesRead);
-				memmove(inputBuffer, ((uint8_t *)inputBuffer) + bytesReadFromInput, samplesRead * sizeof(float));
-				bytesReadFromInput = samplesRead * sizeof(float);
-			}
-
-			if(bytesReadFromInput && !isFloat) {
-				float gain = 1.0;
-				if(bitsPerSample == 1) {
-					samplesRead = bytesReadFromInput / inputFormat.mBytesPerPacket;
-					size_t buffer_adder = (bytesReadFromInput + 15) & ~15;
-					convert_dsd_to_f32((float *)(((uint8_t *)inputBuffer) + buffer_adder), (const uint8_t *)inputBuffer, samplesRead, inputFormat.mChannelsPerFrame, dsd2pcm);
-					memmove(inputBuffer, ((const uint8_t *)inputBuffer) + buffer_adder, samplesRead * inputFormat.mChannelsPerFrame * sizeof(float));
-					bitsPerSample = 32;
-					bytesReadFromInput = samplesRead * inputFormat.mChannelsPerFrame * sizeof(float);
-					isFloat = YES;
-				} else if(bitsPerSample <= 8) {
-					samplesRead = bytesReadFromInput;
-					size_t buffer_adder = (bytesReadFromInput + 1) & ~1;
-					if(!isUnsigned)
-						convert_s8_to_s16((int16_t *)(((uint8_t *)inputBuffer) + buffer_adder), (const uint8_t *)inputBuffer, samplesRead);
-					else
-						convert_u8_to_s16((int16_t *)(((uint8_t *)inputBuffer) + buffer_adder), (const uint8_t *)inputBuffer, samplesRead);
-					memmove(inputBuffer, ((uint8_t *)inputBuffer) + buffer_adder, samplesRead * 2);
-					bitsPerSample = 16;
-					bytesReadFromInput = samplesRead * 2;
-					isUnsigned = NO;
-				}
-				if(hdcd_decoder) { // implied bits per sample is 16, produces 32 bit int scale
-					samplesRead = bytesReadFromInput / 2;
-					if(isUnsigned)
-						convert_u16_to_s16((int16_t *)inputBuffer, samplesRead);
-					size_t buffer_adder = (bytesReadFromInput + 3) & ~3;
-					convert_s16_to_hdcd_input((int32_t *)(((uint8_t *)inputBuffer) + buffer_adder), (int16_t *)inputBuffer, samplesRead);
-					memmove(inputBuffer, ((uint8_t *)inputBuffer) + buffer_adder, samplesRead * 4);
+			if(bytesReadFromInput && convertInput) {
+				size_t framesRead = bytesReadFromInput / inputFormat.mBytesPerPacket;
+				samplesRead = framesRead * inputFormat.mChannelsPerFrame;
+				if(dsd2pcm) {
+					framesRead = ((DSDDecimator *)dsd2pcm)->process((const uint8_t *)rawBuffer, framesRead, (float *)inputBuffer);
+					samplesRead = framesRead * inputFormat.mChannelsPerFrame;
+				} else if(hdcd_decoder && !(sampleConverter && hdcd_scan_idle_stereo((hdcd_state_stereo_t *)hdcd_decoder, (const int16_t *)rawBuffer, (int)(samplesRead / 2)))) { // implied bits per sample is 16, produces 32 bit int scale
+					hdcdConverter((int32_t *)inputBuffer, rawBuffer, samplesRead);
 					hdcd_process_stereo((hdcd_state_stereo_t *)hdcd_decoder, (int32_t *)inputBuffer, (int)(samplesRead / 2));
 					if(((hdcd_state_stereo_t *)hdcd_decoder)->channel[0].sustain &&
 					   ((hdcd_state_stereo_t *)hdcd_decoder)->channel[1].sustain) {
 						[controller sustainHDCD];
 					}
-					gain = 2.0;
-					bitsPerSample = 32;
-					bytesReadFromInput = samplesRead * 4;
-					isUnsigned = NO;
-				} else if(bitsPerSample <= 16) {
-					samplesRead = bytesReadFromInput / 2;
-					if(isUnsigned)
-						convert_u16_to_s16((int16_t *)inputBuffer, samplesRead);
-					size_t buffer_adder = (bytesReadFromInput + 15) & ~15; // vDSP functions expect aligned to four elements
-					vDSP_vflt16((const short *)inputBuffer, 1, (float *)(((uint8_t *)inputBuffer) + buffer_adder), 1, samplesRead);
-					float scale = 1ULL << 15;
-					vDSP_vsdiv((const float *)(((uint8_t *)inputBuffer) + buffer_adder), 1, &scale, (float *)(((uint8_t *)inputBuffer) + buffer_adder), 1, samplesRead);
-					memmove(inputBuffer, ((uint8_t *)inputBuffer) + buffer_adder, samplesRead * sizeof(float));
-					bitsPerSample = 32;
-					bytesReadFromInput = samplesRead * sizeof(float);
-					isUnsigned = NO;
-					isFloat = YES;
-				} else if(bitsPerSample <= 24) {
-					samplesRead = bytesReadFromInput / 3;
-					size_t buffer_adder = (bytesReadFromInput + 3) & ~3;
-					if(isUnsigned)
-						convert_u24_to_s32((int32_t *)(((uint8_t *)inputBuffer) + buffer_adder), (uint8_t *)inputBuffer, samplesRead);
-					else
-						convert_s24_to_s32((int32_t *)(((uint8_t *)inputBuffer) + buffer_adder), (uint8_t *)inputBuffer, samplesRead);
-					memmove(inputBuffer, ((uint8_t *)inputBuffer) + buffer_adder, samplesRead * 4);
-					bitsPerSample = 32;
-					bytesReadFromInput = samplesRead * 4;
-					isUnsigned = NO;
-				}
-				if(!isFloat && bitsPerSample <= 32) {
-					samplesRead = bytesReadFromInput / 4;
-					if(isUnsigned)
-						convert_u32_to_s32((int32_t *)inputBuffer, samplesRead);
-					size_t buffer_adder = (bytesReadFromInput + 31) & ~31; // vDSP functions expect aligned to four elements
-					vDSP_vflt32((const int *)inputBuffer, 1, (float *)(((uint8_t *)inputBuffer) + buffer_adder), 1, samplesRead);
-					float scale = (1ULL << 31) / gain;
-					vDSP_vsdiv((const float *)(((uint8_t *)inputBuffer) + buffer_adder), 1, &scale, (float *)(((uint8_t *)inputBuffer) + buffer_adder), 1, samplesRead);
-					memmove(inputBuffer, ((uint8_t *)inputBuffer) + buffer_adder, samplesRead * sizeof(float));
-					bitsPerSample = 32;
-					bytesReadFromInput = samplesRead * sizeof(float);
-					isUnsigned = NO;
-					isFloat = YES;
+					hdcdOutputConverter((float *)inputBuffer, inputBuffer, samplesRead);
+					float gain = 2.0;
+					vDSP_vsmul((const float *)inputBuffer, 1, &gain, (float *)inputBuffer, 1, samplesRead);
+				} else {
+					sampleConverter((float *)inputBuffer, rawBuffer, samplesRead);
 				}
+				bytesReadFromInput = samplesRead * sizeof(float);
 
 #ifdef _DEBUG
 				[BadSampleCleaner cleanSamples:(float *)inputBuffer
@@ -755,14 +368,14 @@ tryagain:
 
 		if(!skipResampler) {
 			// This is needed at least for the flush, or else there won't be room for it
-			ioNumberPackets += ((r8bstate *)_r8bstate)->latency();
+			ioNumberPackets += ((Resampler *)resampler)->latency();
 
 #ifdef _DEBUG
 			[BadSampleCleaner cleanSamples:(float *)(((uint8_t *)inputBuffer) + inpOffset)
 			                        amount:inputSamples * floatFormat.mChannelsPerFrame
 			                      location:@"resampler input"];
 #endif
-			outputDone = ((r8bstate *)_r8bstate)->resample((float *)(((uint8_t *)inputBuffer) + inpOffset), inputSamples, &inputDone, (float *)floatBuffer, ioNumberPackets);
+			outputDone = ((Resampler *)resampler)->resample((float *)(((uint8_t *)inputBuffer) + inpOffset), inputSamples, &inputDone, (float *)floatBuffer, ioNumberPackets);
 #ifdef _DEBUG
 			[BadSampleCleaner cleanSamples:(float *)floatBuffer
 			                        amount:outputDone * floatFormat.mChannelsPerFrame
@@ -774,7 +387,7 @@ tryagain:
 				size_t odone = 0;
 
 				do {
-					odone = ((r8bstate *)_r8bstate)->flush((float *)(((uint8_t *)floatBuffer) + outputDone * floatFormat.mBytesPerPacket), ioNumberPackets - outputDone);
+					odone = ((Resampler *)resampler)->flush((float *)(((uint8_t *)floatBuffer) + outputDone * floatFormat.mBytesPerPacket), ioNumberPackets - outputDone);
 #ifdef _DEBUG
 					[BadSampleCleaner cleanSamples:(float *)(floatBuffer + outputDone * floatFormat.mBytesPerPacket)
 					                        amount:odone * floatFormat.mChannelsPerFrame
@@ -921,6 +534,23 @@ static float db_to_scale(float db) {
 		hdcd_reset_stereo((hdcd_state_stereo_t *)hdcd_decoder, 44100);
 	}
 
+	// Picked once here, native float needs no conversion and DSD has its own
+	BOOL isUnsigned = !isFloat && !(inputFormat.mFormatFlags & kAudioFormatFlagIsSignedInteger);
+	BOOL isBigEndian = !!(inputFormat.mFormatFlags & kAudioFormatFlagIsBigEndian);
+	sampleConverter = NULL;
+	hdcdConverter = NULL;
+	hdcdOutputConverter = NULL;
+	if(hdcd_decoder) {
+		hdcdConverter = sampleConverterInt32ForFormat(inputFormat.mBitsPerChannel, isUnsigned, isBigEndian);
+		hdcdOutputConverter = sampleConverterForFormat(32, false, false, false);
+		// Until a packet turns up, decoding is a plain conversion, so blocks
+		// the decoder can skip take that instead. The scan reads native order.
+		if(!isBigEndian)
+			sampleConverter = sampleConverterForFormat(inputFormat.mBitsPerChannel, false, isUnsigned, false);
+	} else if(inputFormat.mBitsPerChannel != 1 && !(isFloat && inputFormat.mBitsPerChannel == 32 && !isBigEndian)) {
+		sampleConverter = sampleConverterForFormat(inputFormat.mBitsPerChannel, isFloat, isUnsigned, isBigEndian);
+	}
+
 	floatFormat = inputFormat;
 	floatFormat.mFormatFlags = kAudioFormatFlagsNativeFloatPacked;
 	floatFormat.mBitsPerChannel = 32;
@@ -928,15 +558,11 @@ static float db_to_scale(float db) {
 	floatFormat.mBytesPerPacket = floatFormat.mBytesPerFrame * floatFormat.mFramesPerPacket;
 
 	if(inputFormat.mBitsPerChannel == 1) {
-		// Decimate this for speed
-		floatFormat.mSampleRate *= 1.0 / 8.0;
-		dsd2pcmCount = floatFormat.mChannelsPerFrame;
-		dsd2pcm = (void **)calloc(dsd2pcmCount, sizeof(void *));
-		dsd2pcm[0] = dsd2pcm_alloc();
-		dsd2pcmLatency = dsd2pcm_latency(dsd2pcm[0]);
-		for(size_t i = 1; i < dsd2pcmCount; ++i) {
-			dsd2pcm[i] = dsd2pcm_dup(dsd2pcm[0]);
-		}
+		// Decimate this for speed, straight to the output rate if it is a related one
+		DSDDecimator *decimator = new DSDDecimator(floatFormat.mChannelsPerFrame, inputFormat.mSampleRate, outputFormat.mSampleRate);
+		floatFormat.mSampleRate = decimator->outputRate();
+		dsd2pcmLatency = (int)decimator->latency();
+		dsd2pcm = (void *)decimator;
 	}
 
 	inpOffset = 0;
@@ -960,7 +586,12 @@ static float db_to_scale(float db) {
 	if(!skipResampler) {
 		const int channelCount = floatFormat.mChannelsPerFrame;
 
-		_r8bstate = (void *)(new r8bstate(channelCount, 1024, floatFormat.mSampleRate, outputFormat.mSampleRate));
+		// Surround streams are worth spreading over a few cores
+		int threadCount = 1;
+		if(channelCount >= 6)
+			threadCount = min(channelCount / 2, (int)[[NSProcessInfo processInfo] activeProcessorCount] / 2);
+
+		resampler = (void *)(new Resampler(channelCount, floatFormat.mSampleRate, outputFormat.mSampleRate, threadCount));
 
 		PRIME_LEN_ = max(floatFormat.mSampleRate / 20, 1024u);
 		PRIME_LEN_ = min(PRIME_LEN_, 16384u);
@@ -1035,16 +666,12 @@ static float db_to_scale(float db) {
 		free(hdcd_decoder);
 		hdcd_decoder = NULL;
 	}
-	if(_r8bstate) {
-		delete(r8bstate *)_r8bstate;
-		_r8bstate = NULL;
+	if(resampler) {
+		delete(Resampler *)resampler;
+		resampler = NULL;
 	}
-	if(dsd2pcm && dsd2pcmCount) {
-		for(size_t i = 0; i < dsd2pcmCount; ++i) {
-			dsd2pcm_free(dsd2pcm[i]);
-			dsd2pcm[i] = NULL;
-		}
-		free(dsd2pcm);
+	if(dsd2pcm) {
+		delete(DSDDecimator *)dsd2pcm;
 		dsd2pcm = NULL;
 	}
 	if(extrapolateBuffer) {
@@ -1062,6 +689,11 @@ static float db_to_scale(float db) {
 		inputBuffer = NULL;
 		inputBufferSize = 0;
 	}
+	if(rawBuffer) {
+		free(rawBuffer);
+		rawBuffer = NULL;
+		rawBufferSize = 0;
+	}
 	floatOffset = 0;
 	floatSize = 0;
 }
@@ -19,6 +19,8 @@
 
 	uint32_t inConfig;
 	uint32_t outConfig;
+
+	void *mixer;
 }
 
 - (id)initWithInputFormat:(AudioStreamBasicDescription)inf inputConfig:(uint32_t)iConfig andOutputFormat:(AudioStreamBasicDescription)outf outputConfig:(uint32_t)oConfig;
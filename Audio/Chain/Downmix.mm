@@ -0,0 +1,337 @@
+//
+//  Downmix.mm
+//  Cog
+//
+//  Created by Christopher Snowhill on 2/05/22.
+//  Copyright 2022 __LoSnoCo__. All rights reserved.
+//
+
+#import "Downmix.h"
+
+#import "Logging.h"
+
+#import "AudioChunk.h"
+
+#import "ChannelMixer.h"
+
+#include <vector>
+
+// Matrices hold a row of input channel coefficients per output channel
+
+static void downmix_to_stereo(int channels, uint32_t config, float *matrix) {
+	float FrontRatios[2] = { 0.0F, 0.0F };
+	float FrontCenterRatio = 0.0F;
+	float LFERatio = 0.0F;
+	float BackRatios[2] = { 0.0F, 0.0F };
+	float BackCenterRatio = 0.0F;
+	float SideRatios[2] = { 0.0F, 0.0F };
+	if(config & (AudioChannelFrontLeft | AudioChannelFrontRight)) {
+		FrontRatios[0] = 1.0F;
+	}
+	if(config & AudioChannelFrontCenter) {
+		FrontRatios[0] = 0.5858F;
+		FrontCenterRatio = 0.4142F;
+	}
+	if(config & (AudioChannelBackLeft | AudioChannelBackRight)) {
+		if(config & AudioChannelFrontCenter) {
+			FrontRatios[0] = 0.651F;
+			FrontCenterRatio = 0.46F;
+			BackRatios[0] = 0.5636F;
+			BackRatios[1] = 0.3254F;
+		} else {
+			FrontRatios[0] = 0.4226F;
+			BackRatios[0] = 0.366F;
+			BackRatios[1] = 0.2114F;
+		}
+	}
+	if(config & AudioChannelLFE) {
+		FrontRatios[0] *= 0.8F;
+		FrontCenterRatio *= 0.8F;
+		LFERatio = FrontCenterRatio;
+		BackRatios[0] *= 0.8F;
+		BackRatios[1] *= 0.8F;
+	}
+	if(config & AudioChannelBackCenter) {
+		FrontRatios[0] *= 0.86F;
+		FrontCenterRatio *= 0.86F;
+		LFERatio *= 0.86F;
+		BackRatios[0] *= 0.86F;
+		BackRatios[1] *= 0.86F;
+		BackCenterRatio = FrontCenterRatio * 0.86F;
+	}
+	if(config & (AudioChannelSideLeft | AudioChannelSideRight)) {
+		float ratio = 0.73F;
+		if(config & AudioChannelBackCenter) ratio = 0.85F;
+		FrontRatios[0] *= ratio;
+		FrontCenterRatio *= ratio;
+		LFERatio *= ratio;
+		BackRatios[0] *= ratio;
+		BackRatios[1] *= ratio;
+		BackCenterRatio *= ratio;
+		SideRatios[0] = 0.463882352941176 * ratio;
+		SideRatios[1] = 0.267882352941176 * ratio;
+	}
+
+	for(int j = 0; j < channels; ++j) {
+		float left = 0.0F, right = 0.0F;
+		switch([AudioChunk findChannelIndex:[AudioChunk extractChannelFlag:j fromConfig:config]]) {
+			case 0:
+				left = FrontRatios[0];
+				right = FrontRatios[1];
+				break;
+
+			case 1:
+				left = FrontRatios[1];
+				right = FrontRatios[0];
+				break;
+
+			case 2:
+				left = FrontCenterRatio;
+				right = FrontCenterRatio;
+				break;
+
+			case 3:
+				left = LFERatio;
+				right = LFERatio;
+				break;
+
+			case 4:
+				left = BackRatios[0];
+				right = BackRatios[1];
+				break;
+
+			case 5:
+				left = BackRatios[1];
+				right = BackRatios[0];
+				break;
+
+			case 6:
+			case 7:
+				break;
+
+			case 8:
+				left = BackCenterRatio;
+				right = BackCenterRatio;
+				break;
+
+			case 9:
+				left = SideRatios[0];
+				right = SideRatios[1];
+				break;
+
+			case 10:
+				left = SideRatios[1];
+				right = SideRatios[0];
+				break;
+
+			case 11:
+			case 12:
+			case 13:
+			case 14:
+			case 15:
+			case 16:
+			case 17:
+			default:
+				break;
+		}
+		matrix[j] = left;
+		matrix[channels + j] = right;
+	}
+}
+
+static void downmix_to_mono(int channels, uint32_t config, float *matrix) {
+	std::vector<float> stereoMatrix(channels * 2);
+	downmix_to_stereo(channels, config, &stereoMatrix[0]);
+	for(int j = 0; j < channels; ++j) {
+		matrix[j] = stereoMatrix[j] + stereoMatrix[channels + j];
+	}
+}
+
+static void route(float *matrix, int inchannels, int inIndex, uint32_t outIndex) {
+	if(outIndex != ~0)
+		matrix[outIndex * inchannels + inIndex] = 1.0F;
+}
+
+// Every input channel goes to the output channel of the same speaker, if any
+static void route_by_config(int inchannels, uint32_t inconfig, uint32_t outconfig, float *matrix) {
+	for(int i = 0; i < inchannels; ++i) {
+		uint32_t channelFlag = [AudioChunk extractChannelFlag:i fromConfig:inconfig];
+		route(matrix, inchannels, i, [AudioChunk channelIndexFromConfig:outconfig forFlag:channelFlag]);
+	}
+}
+
+static void upmix(int inchannels, uint32_t inconfig, int outchannels, uint32_t outconfig, float *matrix) {
+	if(inconfig == AudioConfigMono && outconfig == AudioConfigStereo) {
+		route(matrix, inchannels, 0, 0);
+		route(matrix, inchannels, 0, 1);
+	} else if(inconfig == AudioConfigMono && outconfig == AudioConfig4Point0) {
+		route(matrix, inchannels, 0, 0);
+		route(matrix, inchannels, 0, 1);
+	} else if(inconfig == AudioConfigMono && (outconfig & AudioChannelFrontCenter)) {
+		route(matrix, inchannels, 0, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelFrontCenter]);
+	} else if(inconfig == AudioConfig4Point0 && outchannels >= 5) {
+		route(matrix, inchannels, 0, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelFrontLeft]);
+		route(matrix, inchannels, 1, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelFrontRight]);
+		route(matrix, inchannels, 2, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelBackLeft]);
+		route(matrix, inchannels, 3, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelBackRight]);
+	} else if(inconfig == AudioConfig5Point0 && outchannels >= 6) {
+		route(matrix, inchannels, 0, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelFrontLeft]);
+		route(matrix, inchannels, 1, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelFrontRight]);
+		route(matrix, inchannels, 2, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelFrontCenter]);
+		route(matrix, inchannels, 3, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelBackLeft]);
+		route(matrix, inchannels, 4, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelBackRight]);
+	} else if(inconfig == AudioConfig6Point1 && outchannels >= 8) {
+		route(matrix, inchannels, 0, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelFrontLeft]);
+		route(matrix, inchannels, 1, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelFrontRight]);
+		route(matrix, inchannels, 2, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelFrontCenter]);
+		route(matrix, inchannels, 3, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelLFE]);
+		route(matrix, inchannels, 4, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelSideLeft]);
+		route(matrix, inchannels, 5, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelSideRight]);
+		uint32_t bcIndex = [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelBackCenter];
+		if(bcIndex != ~0)
+			route(matrix, inchannels, 6, bcIndex);
+		else {
+			route(matrix, inchannels, 6, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelBackLeft]);
+			route(matrix, inchannels, 6, [AudioChunk channelIndexFromConfig:outconfig forFlag:AudioChannelBackRight]);
+		}
+	} else {
+		route_by_config(inchannels, inconfig, outconfig, matrix);
+	}
+}
+
+@implementation DownmixProcessor
+
+- (id)initWithInputFormat:(AudioStreamBasicDescription)inf inputConfig:(uint32_t)iConfig andOutputFormat:(AudioStreamBasicDescription)outf outputConfig:(uint32_t)oConfig {
+	self = [super init];
+
+	if(self) {
+		if(inf.mFormatID != kAudioFormatLinearPCM ||
+		   (inf.mFormatFlags & kAudioFormatFlagsNativeFloatPacked) != kAudioFormatFlagsNativeFloatPacked ||
+		   inf.mBitsPerChannel != 32 ||
+		   inf.mBytesPerFrame != (4 * inf.mChannelsPerFrame) ||
+		   inf.mBytesPerPacket != inf.mFramesPerPacket * inf.mBytesPerFrame)
+			return nil;
+
+		if(outf.mFormatID != kAudioFormatLinearPCM ||
+		   (outf.mFormatFlags & kAudioFormatFlagsNativeFloatPacked) != kAudioFormatFlagsNativeFloatPacked ||
+		   outf.mBitsPerChannel != 32 ||
+		   outf.mBytesPerFrame != (4 * outf.mChannelsPerFrame) ||
+		   outf.mBytesPerPacket != outf.mFramesPerPacket * outf.mBytesPerFrame)
+			return nil;
+
+		inputFormat = inf;
+		outputFormat = outf;
+
+		inConfig = iConfig;
+		outConfig = oConfig;
+
+		// Whatever the layouts, mixing is one matrix, worked out once
+		const int inChannels = inputFormat.mChannelsPerFrame;
+		const int outChannels = outputFormat.mChannelsPerFrame;
+		std::vector<float> matrix(inChannels * outChannels, 0.0F);
+		if(inChannels > 2 && outConfig == AudioConfigStereo) {
+			downmix_to_stereo(inChannels, inConfig, &matrix[0]);
+		} else if(inChannels > 1 && outConfig == AudioConfigMono) {
+			downmix_to_mono(inChannels, inConfig, &matrix[0]);
+		} else if(inChannels < outChannels) {
+			upmix(inChannels, inConfig, outChannels, outConfig, &matrix[0]);
+		} else if(inConfig == outConfig && inChannels == outChannels) {
+			// Pass through, even when the config names fewer speakers than there are channels
+			for(int i = 0; i < inChannels; ++i) {
+				route(&matrix[0], inChannels, i, i);
+			}
+		} else {
+			route_by_config(inChannels, inConfig, outConfig, &matrix[0]);
+		}
+		mixer = (void *)(new ChannelMixer(inChannels, outChannels, &matrix[0]));
+
+		[self setupVirt];
+
+		[[NSUserDefaultsController sharedUserDefaultsController] addObserver:self forKeyPath:@"values.headphoneVirtualization" options:0 context:nil];
+		[[NSUserDefaultsController sharedUserDefaultsController] addObserver:self forKeyPath:@"values.hrirPath" options:0 context:nil];
+	}
+
+	return self;
+}
+
+- (void)dealloc {
+	[[NSUserDefaultsController sharedUserDefaultsController] removeObserver:self forKeyPath:@"values.headphoneVirtualization"];
+	[[NSUserDefaultsController sharedUserDefaultsController] removeObserver:self forKeyPath:@"values.hrirPath"];
+
+	if(mixer) {
+		delete(ChannelMixer *)mixer;
+		mixer = NULL;
+	}
+}
+
+- (void)setupVirt {
+	@synchronized(hFilter) {
+		hFilter = nil;
+	}
+
+	BOOL hVirt = [[[NSUserDefaultsController sharedUserDefaultsController] defaults] boolForKey:@"headphoneVirtualization"];
+
+	if(hVirt &&
+	   outputFormat.mChannelsPerFrame >= 2 &&
+	   (outConfig & AudioConfigStereo) == AudioConfigStereo &&
+	   inputFormat.mChannelsPerFrame >= 1 &&
+	   (inConfig & (AudioConfig7Point1 | AudioChannelBackCenter)) != 0) {
+		NSString *userPreset = [[[NSUserDefaultsController sharedUserDefaultsController] defaults] stringForKey:@"hrirPath"];
+
+		NSURL *presetUrl = nil;
+
+		if(userPreset && ![userPreset isEqualToString:@""]) {
+			presetUrl = [NSURL fileURLWithPath:userPreset];
+			if(![HeadphoneFilter validateImpulseFile:presetUrl])
+				presetUrl = nil;
+		}
+
+		if(!presetUrl) {
+			presetUrl = [[NSBundle mainBundle] URLForResource:@"gsx" withExtension:@"wv"];
+			if(![HeadphoneFilter validateImpulseFile:presetUrl])
+				presetUrl = nil;
+		}
+
+		if(presetUrl) {
+			@synchronized(hFilter) {
+				hFilter = [[HeadphoneFilter alloc] initWithImpulseFile:presetUrl forSampleRate:outputFormat.mSampleRate withInputChannels:inputFormat.mChannelsPerFrame withConfig:inConfig];
+			}
+		}
+	}
+}
+
+- (void)observeValueForKeyPath:(NSString *)keyPath
+                      ofObject:(id)object
+                        change:(NSDictionary *)change
+                       context:(void *)context {
+	DLog(@"SOMETHING CHANGED!");
+	if([keyPath isEqualToString:@"values.headphoneVirtualization"] ||
+	   [keyPath isEqualToString:@"values.hrirPath"]) {
+		// Reset the converter, without rebuffering
+		[self setupVirt];
+	}
+}
+
+- (void)process:(const void *)inBuffer frameCount:(size_t)frames output:(void *)outBuffer {
+	@synchronized(hFilter) {
+		if(hFilter) {
+			uint32_t outChannels = outputFormat.mChannelsPerFrame;
+			if(outChannels > 2) {
+				float tempBuffer[frames * 2];
+				[hFilter process:(const float *)inBuffer sampleCount:frames toBuffer:&tempBuffer[0]];
+				cblas_scopy((int)frames, tempBuffer, 2, (float *)outBuffer, outChannels);
+				cblas_scopy((int)frames, tempBuffer + 1, 2, ((float *)outBuffer) + 1, outChannels);
+				for(size_t i = 2; i < outChannels; ++i) {
+					vDSP_vclr(((float *)outBuffer) + i, outChannels, (int)frames);
+				}
+			} else {
+				[hFilter process:(const float *)inBuffer sampleCount:frames toBuffer:(float *)outBuffer];
+			}
+			return;
+		}
+	}
+
+	((ChannelMixer *)mixer)->process((const float *)inBuffer, frames, (float *)outBuffer);
+}
+
+@end
@@ -12,32 +12,8 @@
 #import <Cocoa/Cocoa.h>
 
 @interface HeadphoneFilter : NSObject {
-	FFTSetup fftSetup;
-
-	size_t fftSize;
-	size_t fftSizeOver2;
-	size_t log2n;
-	size_t log2nhalf;
-	size_t bufferSize;
-	size_t paddedBufferSize;
+	void *convolver;
 	size_t channelCount;
-
-	COMPLEX_SPLIT signal_fft;
-	COMPLEX_SPLIT input_filtered_signal_per_channel[2];
-	COMPLEX_SPLIT *impulse_responses;
-
-	float *left_result;
-	float *right_result;
-
-	float *left_mix_result;
-	float *right_mix_result;
-
-	float *paddedSignal;
-
-	float *prevOverlapLeft;
-	float *prevOverlapRight;
-
-	int prevOverlapLength;
 }
 
 + (BOOL)validateImpulseFile:(NSURL *)url;
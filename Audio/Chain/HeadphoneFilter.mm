@@ -12,20 +12,14 @@
 
 #import <stdlib.h>
 
-#import "r8bstate.h"
+#import <vector>
+
+#import "PartitionedConvolver.h"
+#import "Resampler.h"
 
 #import "lpc.h"
 #import "util.h"
 
-// Apparently _mm_malloc is Intel-only on newer macOS targets, so use supported posix_memalign
-static void *_memalign_malloc(size_t size, size_t align) {
-	void *ret = NULL;
-	if(posix_memalign(&ret, align, size) != 0) {
-		return NULL;
-	}
-	return ret;
-}
-
 @implementation HeadphoneFilter
 
 enum {
@@ -198,7 +192,7 @@ static const int8_t speakers_to_hesuvi_14[11][2] = {
 			double sampleRatio = sampleRate / sampleRateOfSource;
 			int resampledCount = (int)ceil((double)sampleCount * sampleRatio);
 
-			r8bstate *_r8bstate = new r8bstate(impulseChannels, 1024, sampleRateOfSource, sampleRate);
+			Resampler *resampler = new Resampler(impulseChannels, sampleRateOfSource, sampleRate);
 			
 			unsigned long PRIME_LEN_ = MAX(sampleRateOfSource / 20, 1024u);
 			PRIME_LEN_ = MIN(PRIME_LEN_, 16384u);
@@ -241,13 +235,13 @@ static const int8_t speakers_to_hesuvi_14[11][2] = {
 			size_t inputDone = 0;
 			size_t outputDone = 0;
 
-			outputDone = _r8bstate->resample(impulseBuffer, sampleCount + N_samples_to_add_ * 2, &inputDone, resampledImpulse, resampledCount);
+			outputDone = resampler->resample(impulseBuffer, sampleCount + N_samples_to_add_ * 2, &inputDone, resampledImpulse, resampledCount);
 			
 			if (outputDone < resampledCount) {
-				outputDone += _r8bstate->flush(resampledImpulse + outputDone * impulseChannels, resampledCount - outputDone);
+				outputDone += resampler->flush(resampledImpulse + outputDone * impulseChannels, resampledCount - outputDone);
 			}
 			
-			delete _r8bstate;
+			delete resampler;
 
 			outputDone -= N_samples_to_drop_ * 2;
 
@@ -260,90 +254,11 @@ static const int8_t speakers_to_hesuvi_14[11][2] = {
 
 		channelCount = channels;
 
-		bufferSize = 512;
-		fftSize = sampleCount + bufferSize;
-
-		int pow = 1;
-		while(fftSize > 2) {
-			pow++;
-			fftSize /= 2;
-		}
-		fftSize = 2 << pow;
-
-		float *deinterleavedImpulseBuffer = (float *)_memalign_malloc(fftSize * sizeof(float) * (impulseChannels + 1), 16);
-		if(!deinterleavedImpulseBuffer) {
-			free(impulseBuffer);
-			return nil;
-		}
-
-		for(size_t i = 0; i < impulseChannels; ++i) {
-			cblas_scopy(sampleCount, impulseBuffer + i, impulseChannels, deinterleavedImpulseBuffer + i * fftSize, 1);
-			vDSP_vclr(deinterleavedImpulseBuffer + i * fftSize + sampleCount, 1, fftSize - sampleCount);
-		}
-
-		free(impulseBuffer);
+		PartitionedConvolver *_convolver = new PartitionedConvolver(channels, 2, sampleCount);
 
-		// Null impulse
-		vDSP_vclr(deinterleavedImpulseBuffer + impulseChannels * fftSize, 1, fftSize);
-
-		paddedBufferSize = fftSize;
-		fftSizeOver2 = (fftSize + 1) / 2;
-		log2n = log2f(fftSize);
-		log2nhalf = log2n / 2;
-
-		fftSetup = vDSP_create_fftsetup(log2n, FFT_RADIX2);
-		if(!fftSetup) {
-			free(deinterleavedImpulseBuffer);
-			return nil;
-		}
-
-		paddedSignal = (float *)_memalign_malloc(sizeof(float) * paddedBufferSize, 16);
-		if(!paddedSignal) {
-			free(deinterleavedImpulseBuffer);
-			return nil;
-		}
-
-		signal_fft.realp = (float *)_memalign_malloc(sizeof(float) * fftSizeOver2, 16);
-		signal_fft.imagp = (float *)_memalign_malloc(sizeof(float) * fftSizeOver2, 16);
-		if(!signal_fft.realp || !signal_fft.imagp) {
-			free(deinterleavedImpulseBuffer);
-			return nil;
-		}
-
-		input_filtered_signal_per_channel[0].realp = (float *)_memalign_malloc(sizeof(float) * fftSizeOver2, 16);
-		input_filtered_signal_per_channel[0].imagp = (float *)_memalign_malloc(sizeof(float) * fftSizeOver2, 16);
-		if(!input_filtered_signal_per_channel[0].realp ||
-		   !input_filtered_signal_per_channel[0].imagp) {
-			free(deinterleavedImpulseBuffer);
-			return nil;
-		}
-
-		input_filtered_signal_per_channel[1].realp = (float *)_memalign_malloc(sizeof(float) * fftSizeOver2, 16);
-		input_filtered_signal_per_channel[1].imagp = (float *)_memalign_malloc(sizeof(float) * fftSizeOver2, 16);
-		if(!input_filtered_signal_per_channel[1].realp ||
-		   !input_filtered_signal_per_channel[1].imagp) {
-			free(deinterleavedImpulseBuffer);
-			return nil;
-		}
-
-		impulse_responses = (COMPLEX_SPLIT *)calloc(sizeof(COMPLEX_SPLIT), channels * 2);
-		if(!impulse_responses) {
-			free(deinterleavedImpulseBuffer);
-			return nil;
-		}
+		std::vector<float> backCenter;
 
 		for(size_t i = 0; i < channels; ++i) {
-			impulse_responses[i * 2 + 0].realp = (float *)_memalign_malloc(sizeof(float) * fftSizeOver2, 16);
-			impulse_responses[i * 2 + 0].imagp = (float *)_memalign_malloc(sizeof(float) * fftSizeOver2, 16);
-			impulse_responses[i * 2 + 1].realp = (float *)_memalign_malloc(sizeof(float) * fftSizeOver2, 16);
-			impulse_responses[i * 2 + 1].imagp = (float *)_memalign_malloc(sizeof(float) * fftSizeOver2, 16);
-
-			if(!impulse_responses[i * 2 + 0].realp || !impulse_responses[i * 2 + 0].imagp ||
-			   !impulse_responses[i * 2 + 1].realp || !impulse_responses[i * 2 + 1].imagp) {
-				free(deinterleavedImpulseBuffer);
-				return nil;
-			}
-
 			uint32_t channelFlag = [AudioChunk extractChannelFlag:(uint32_t)i fromConfig:config];
 			uint32_t channelIndex = [AudioChunk findChannelIndex:channelFlag];
 
@@ -363,177 +278,44 @@ static const int8_t speakers_to_hesuvi_14[11][2] = {
 			}
 
 			if(leftInChannel == speaker_is_back_center || rightInChannel == speaker_is_back_center) {
-				float *temp;
+				const float *impulse = impulseBuffer;
+				backCenter.resize(sampleCount * 2);
 				if(impulseChannels == 7) {
-					temp = (float *)malloc(sizeof(float) * fftSize);
-					if(!temp) {
-						free(deinterleavedImpulseBuffer);
-						return nil;
-					}
-
-					cblas_scopy((int)fftSize, deinterleavedImpulseBuffer + 4 * fftSize, 1, temp, 1);
-					vDSP_vadd(temp, 1, deinterleavedImpulseBuffer + 5 * fftSize, 1, temp, 1, fftSize);
-
-					vDSP_ctoz((DSPComplex *)temp, 2, &impulse_responses[i * 2 + 0], 1, fftSizeOver2);
-					vDSP_ctoz((DSPComplex *)temp, 2, &impulse_responses[i * 2 + 1], 1, fftSizeOver2);
+					vDSP_vadd(impulse + 4, impulseChannels, impulse + 5, impulseChannels, &backCenter[0], 1, sampleCount);
+					_convolver->setImpulse(i, 0, &backCenter[0], sampleCount);
+					_convolver->setImpulse(i, 1, &backCenter[0], sampleCount);
 				} else {
-					temp = (float *)malloc(sizeof(float) * fftSize * 2);
-					if(!temp) {
-						free(deinterleavedImpulseBuffer);
-						return nil;
-					}
-
-					cblas_scopy((int)fftSize, deinterleavedImpulseBuffer + 4 * fftSize, 1, temp, 1);
-					vDSP_vadd(temp, 1, deinterleavedImpulseBuffer + 12 * fftSize, 1, temp, 1, fftSize);
-
-					cblas_scopy((int)fftSize, deinterleavedImpulseBuffer + 5 * fftSize, 1, temp + fftSize, 1);
-					vDSP_vadd(temp + fftSize, 1, deinterleavedImpulseBuffer + 11 * fftSize, 1, temp + fftSize, 1, fftSize);
-
-					vDSP_ctoz((DSPComplex *)temp, 2, &impulse_responses[i * 2 + 0], 1, fftSizeOver2);
-					vDSP_ctoz((DSPComplex *)(temp + fftSize), 2, &impulse_responses[i * 2 + 1], 1, fftSizeOver2);
+					vDSP_vadd(impulse + 4, impulseChannels, impulse + 12, impulseChannels, &backCenter[0], 1, sampleCount);
+					vDSP_vadd(impulse + 5, impulseChannels, impulse + 11, impulseChannels, &backCenter[sampleCount], 1, sampleCount);
+					_convolver->setImpulse(i, 0, &backCenter[0], sampleCount);
+					_convolver->setImpulse(i, 1, &backCenter[sampleCount], sampleCount);
 				}
-
-				free(temp);
-			} else if(leftInChannel == speaker_not_present || rightInChannel == speaker_not_present) {
-				vDSP_ctoz((DSPComplex *)(deinterleavedImpulseBuffer + impulseChannels * fftSize), 2, &impulse_responses[i * 2 + 0], 1, fftSizeOver2);
-				vDSP_ctoz((DSPComplex *)(deinterleavedImpulseBuffer + impulseChannels * fftSize), 2, &impulse_responses[i * 2 + 1], 1, fftSizeOver2);
-			} else {
-				vDSP_ctoz((DSPComplex *)(deinterleavedImpulseBuffer + leftInChannel * fftSize), 2, &impulse_responses[i * 2 + 0], 1, fftSizeOver2);
-				vDSP_ctoz((DSPComplex *)(deinterleavedImpulseBuffer + rightInChannel * fftSize), 2, &impulse_responses[i * 2 + 1], 1, fftSizeOver2);
+			} else if(leftInChannel != speaker_not_present && rightInChannel != speaker_not_present) {
+				_convolver->setImpulse(i, 0, impulseBuffer + leftInChannel, sampleCount, impulseChannels);
+				_convolver->setImpulse(i, 1, impulseBuffer + rightInChannel, sampleCount, impulseChannels);
 			}
-
-			vDSP_fft_zrip(fftSetup, &impulse_responses[i * 2 + 0], 1, log2n, FFT_FORWARD);
-			vDSP_fft_zrip(fftSetup, &impulse_responses[i * 2 + 1], 1, log2n, FFT_FORWARD);
 		}
 
-		free(deinterleavedImpulseBuffer);
-
-		left_result = (float *)_memalign_malloc(sizeof(float) * fftSize, 16);
-		right_result = (float *)_memalign_malloc(sizeof(float) * fftSize, 16);
-		if(!left_result || !right_result)
-			return nil;
-
-		prevOverlapLeft = (float *)_memalign_malloc(sizeof(float) * fftSize, 16);
-		prevOverlapRight = (float *)_memalign_malloc(sizeof(float) * fftSize, 16);
-		if(!prevOverlapLeft || !prevOverlapRight)
-			return nil;
+		// Speakers which are not present keep null impulses
 
-		left_mix_result = (float *)_memalign_malloc(sizeof(float) * fftSize, 16);
-		right_mix_result = (float *)_memalign_malloc(sizeof(float) * fftSize, 16);
-		if(!left_mix_result || !right_mix_result)
-			return nil;
+		free(impulseBuffer);
 
-		prevOverlapLength = 0;
+		convolver = _convolver;
 	}
 
 	return self;
 }
 
 - (void)dealloc {
-	if(fftSetup) vDSP_destroy_fftsetup(fftSetup);
-
-	free(paddedSignal);
-
-	free(signal_fft.realp);
-	free(signal_fft.imagp);
-
-	free(input_filtered_signal_per_channel[0].realp);
-	free(input_filtered_signal_per_channel[0].imagp);
-	free(input_filtered_signal_per_channel[1].realp);
-	free(input_filtered_signal_per_channel[1].imagp);
-
-	if(impulse_responses) {
-		for(size_t i = 0; i < channelCount * 2; ++i) {
-			free(impulse_responses[i].realp);
-			free(impulse_responses[i].imagp);
-		}
-		free(impulse_responses);
-	}
-
-	free(left_result);
-	free(right_result);
-
-	free(prevOverlapLeft);
-	free(prevOverlapRight);
-
-	free(left_mix_result);
-	free(right_mix_result);
+	delete(PartitionedConvolver *)convolver;
 }
 
 - (void)process:(const float *)inBuffer sampleCount:(size_t)count toBuffer:(float *)outBuffer {
-	const float scale = 1.0 / (4.0 * (float)fftSize);
-
-	while(count > 0) {
-		size_t countToDo = (count > bufferSize) ? bufferSize : count;
-
-		vDSP_vclr(left_mix_result, 1, fftSize);
-		vDSP_vclr(right_mix_result, 1, fftSize);
-
-		for(size_t i = 0; i < channelCount; ++i) {
-			cblas_scopy((int)countToDo, inBuffer + i, (int)channelCount, paddedSignal, 1);
-
-			vDSP_vclr(paddedSignal + countToDo, 1, paddedBufferSize - countToDo);
-
-			vDSP_ctoz((DSPComplex *)paddedSignal, 2, &signal_fft, 1, fftSizeOver2);
-
-			vDSP_fft_zrip(fftSetup, &signal_fft, 1, log2n, FFT_FORWARD);
-
-			// One channel forward, then multiply and back twice
-
-			float preserveIRNyq = impulse_responses[i * 2 + 0].imagp[0];
-			float preserveSigNyq = signal_fft.imagp[0];
-			impulse_responses[i * 2 + 0].imagp[0] = 0;
-			signal_fft.imagp[0] = 0;
-
-			vDSP_zvmul(&signal_fft, 1, &impulse_responses[i * 2 + 0], 1, &input_filtered_signal_per_channel[0], 1, fftSizeOver2, 1);
-
-			input_filtered_signal_per_channel[0].imagp[0] = preserveIRNyq * preserveSigNyq;
-			impulse_responses[i * 2 + 0].imagp[0] = preserveIRNyq;
-
-			preserveIRNyq = impulse_responses[i * 2 + 1].imagp[0];
-			impulse_responses[i * 2 + 1].imagp[0] = 0;
-
-			vDSP_zvmul(&signal_fft, 1, &impulse_responses[i * 2 + 1], 1, &input_filtered_signal_per_channel[1], 1, fftSizeOver2, 1);
-
-			input_filtered_signal_per_channel[1].imagp[0] = preserveIRNyq * preserveSigNyq;
-			impulse_responses[i * 2 + 1].imagp[0] = preserveIRNyq;
-
-			vDSP_fft_zrip(fftSetup, &input_filtered_signal_per_channel[0], 1, log2n, FFT_INVERSE);
-			vDSP_fft_zrip(fftSetup, &input_filtered_signal_per_channel[1], 1, log2n, FFT_INVERSE);
-
-			vDSP_ztoc(&input_filtered_signal_per_channel[0], 1, (DSPComplex *)left_result, 2, fftSizeOver2);
-			vDSP_ztoc(&input_filtered_signal_per_channel[1], 1, (DSPComplex *)right_result, 2, fftSizeOver2);
-
-			vDSP_vadd(left_mix_result, 1, left_result, 1, left_mix_result, 1, fftSize);
-			vDSP_vadd(right_mix_result, 1, right_result, 1, right_mix_result, 1, fftSize);
-		}
-
-		// Integrate previous overlap
-		if(prevOverlapLength) {
-			vDSP_vadd(prevOverlapLeft, 1, left_mix_result, 1, left_mix_result, 1, prevOverlapLength);
-			vDSP_vadd(prevOverlapRight, 1, right_mix_result, 1, right_mix_result, 1, prevOverlapLength);
-		}
-
-		prevOverlapLength = (int)(fftSize - countToDo);
-
-		cblas_scopy(prevOverlapLength, left_mix_result + countToDo, 1, prevOverlapLeft, 1);
-		cblas_scopy(prevOverlapLength, right_mix_result + countToDo, 1, prevOverlapRight, 1);
-
-		vDSP_vsmul(left_mix_result, 1, &scale, left_mix_result, 1, countToDo);
-		vDSP_vsmul(right_mix_result, 1, &scale, right_mix_result, 1, countToDo);
-
-		cblas_scopy((int)countToDo, left_mix_result, 1, outBuffer + 0, 2);
-		cblas_scopy((int)countToDo, right_mix_result, 1, outBuffer + 1, 2);
-
-		inBuffer += countToDo * channelCount;
-		outBuffer += countToDo * 2;
-
-		count -= countToDo;
-	}
+	((PartitionedConvolver *)convolver)->process(inBuffer, count, outBuffer);
 }
 
 - (void)reset {
-	prevOverlapLength = 0;
+	((PartitionedConvolver *)convolver)->reset();
 }
 
 @end
@@ -51,18 +51,19 @@
 - (void)writeData:(const void *)ptr amount:(size_t)amount {
 	[accessLock lock];
 
-	AudioChunk *chunk = [[AudioChunk alloc] init];
-	[chunk setFormat:nodeFormat];
-	if(nodeChannelConfig) {
-		[chunk setChannelConfig:nodeChannelConfig];
-	}
-	[chunk setLossless:nodeLossless];
-	[chunk assignSamples:ptr frameCount:amount / nodeFormat.mBytesPerPacket];
-
-	const double chunkDuration = [chunk duration];
+	const size_t frameCount = amount / nodeFormat.mBytesPerPacket;
+	const double chunkDuration = (double)frameCount / nodeFormat.mSampleRate;
 	double durationLeft = [buffer maxDuration] - [buffer listDuration];
+	void *dest = NULL;
+
+	// Waits for both the duration and the buffer space, which stays taken
+	// after a reset until the reader skips what was dropped
+	while(shouldContinue == YES) {
+		if(chunkDuration <= durationLeft) {
+			dest = [buffer reserveFrames:frameCount format:nodeFormat channelConfig:nodeChannelConfig lossless:nodeLossless];
+			if(dest) break;
+		}
 
-	while(shouldContinue == YES && chunkDuration > durationLeft) {
 		if(durationLeft < chunkDuration) {
 			if(initialBufferFilled == NO) {
 				initialBufferFilled = YES;
@@ -71,16 +72,21 @@
 			}
 		}
 
-		if(durationLeft < chunkDuration || shouldReset) {
-			[accessLock unlock];
-			[semaphore wait];
-			[accessLock lock];
-		}
+		[accessLock unlock];
+		[semaphore wait];
+		[accessLock lock];
 
 		durationLeft = [buffer maxDuration] - [buffer listDuration];
 	}
 
-	[buffer addChunk:chunk];
+	if(!dest) {
+		dest = [buffer reserveFrames:frameCount format:nodeFormat channelConfig:nodeChannelConfig lossless:nodeLossless];
+	}
+
+	if(dest) {
+		memcpy(dest, ptr, frameCount * nodeFormat.mBytesPerPacket);
+		[buffer commitFrames:frameCount];
+	}
 
 	[accessLock unlock];
 }
@@ -98,10 +104,18 @@
 - (BOOL)peekFormat:(nonnull AudioStreamBasicDescription *)format channelConfig:(nonnull uint32_t *)config {
 	[accessLock lock];
 
+	const uint64_t readPosition = [[previousNode buffer] readPosition];
+
 	BOOL ret = [[previousNode buffer] peekFormat:format channelConfig:config];
 
+	const BOOL freed = [[previousNode buffer] readPosition] != readPosition;
+
 	[accessLock unlock];
 
+	if(freed) {
+		[[previousNode semaphore] signal];
+	}
+
 	return ret;
 }
 
@@ -125,15 +139,20 @@
 		[[previousNode semaphore] signal];
 	}
 
+	const uint64_t readPosition = [[previousNode buffer] readPosition];
+
 	AudioChunk *ret;
 
 	@autoreleasepool {
 		ret = [[previousNode buffer] removeSamples:maxFrames];
 	}
 
+	// Catching up on a reset frees room without reading any frames
+	const BOOL freed = [[previousNode buffer] readPosition] != readPosition;
+
 	[accessLock unlock];
 
-	if([ret frameCount]) {
+	if([ret frameCount] || freed) {
 		[[previousNode semaphore] signal];
 	}
 
@@ -0,0 +1,62 @@
+//
+//  AudioRingBufferBench.cpp
+//  CogAudio Framework
+//
+//  Measures AudioRingBuffer throughput between two threads, writing and
+//  reading 512 frame blocks of stereo float.
+//
+
+#include "AudioRingBuffer.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static const uint64_t totalFrames = 400000000;
+static const size_t blockFrames = 512;
+static const size_t frameSize = 2 * sizeof(float);
+
+static void produce(AudioRingBuffer &ring) {
+	std::vector<float> block(blockFrames * 2, 0.5f);
+	for(uint64_t frame = 0; frame < totalFrames;) {
+		void *out = ring.reserve(blockFrames);
+		if(!out) {
+			std::this_thread::yield();
+			continue;
+		}
+		memcpy(out, &block[0], blockFrames * frameSize);
+		ring.commit(blockFrames);
+		frame += blockFrames;
+	}
+}
+
+int main() {
+	AudioRingBuffer ring(1 << 20);
+	const uint32_t channels = 2;
+	ring.writeFormat(&channels, sizeof(channels), frameSize, 48000);
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::thread producer(produce, std::ref(ring));
+	std::vector<float> block(blockFrames * 2);
+	for(uint64_t frame = 0; frame < totalFrames;) {
+		size_t count;
+		const void *format;
+		const void *in = ring.read(blockFrames, &count, &format);
+		if(!in) {
+			std::this_thread::yield();
+			continue;
+		}
+		memcpy(&block[0], in, count * frameSize);
+		ring.consume(count);
+		frame += count;
+	}
+	producer.join();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	printf("%.1f Mframes/s of stereo float, %.0fx real time at 48 kHz\n",
+	       totalFrames / seconds / 1e6, totalFrames / seconds / 48000);
+	return 0;
+}
@@ -0,0 +1,128 @@
+//
+//  AudioRingBufferTest.cpp
+//  CogAudio Framework
+//
+//  Runs a producer and a consumer thread against one AudioRingBuffer, with
+//  random record sizes, channel count changes, discards and resizes. Every
+//  sample carries its frame number, channel and discard generation, so the
+//  consumer can tell a corrupt, reordered or lost frame from a discarded one.
+//  Most useful built with -fsanitize=thread.
+//
+
+#include "AudioRingBuffer.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+#include <thread>
+
+struct Format {
+	uint32_t channels;
+	uint32_t generation;
+};
+
+static const uint64_t totalFrames = 5000000;
+
+static uint32_t sampleValue(uint64_t frame, uint32_t channel, uint32_t generation) {
+	return (uint32_t)(frame * 16 + channel) ^ (generation << 28);
+}
+
+static void produce(AudioRingBuffer &ring, std::atomic<bool> &done) {
+	uint64_t frame = 0;
+	uint32_t channels = 2, generation = 0;
+	uint32_t r = 1;
+	bool formatPending = true;
+	while(frame < totalFrames) {
+		r = r * 1103515245 + 12345;
+		if((r >> 16) % 997 == 0) {
+			channels = 1 + (r >> 8) % 8;
+			formatPending = true;
+		}
+		if((r >> 16) % 4999 == 0) {
+			ring.discard();
+			++generation;
+			formatPending = true;
+		}
+		if(((r >> 12) & 255) == 0) {
+			ring.resize(32 * 1024 + ((r >> 20) & 0xffff));
+		}
+		if(formatPending) {
+			Format format = { channels, generation };
+			if(!ring.writeFormat(&format, sizeof(format), channels * 4, 48000)) {
+				std::this_thread::yield();
+				continue;
+			}
+			formatPending = false;
+		}
+
+		size_t count = 1 + (r >> 4) % 700;
+		uint32_t *out = (uint32_t *)ring.reserve(count);
+		if(!out) {
+			std::this_thread::yield();
+			continue;
+		}
+		for(size_t i = 0; i < count; ++i) {
+			for(uint32_t c = 0; c < channels; ++c) {
+				out[i * channels + c] = sampleValue(frame + i, c, generation);
+			}
+		}
+		ring.commit(count);
+		frame += count;
+	}
+	done = true;
+}
+
+int main() {
+	AudioRingBuffer ring(64 * 1024 + 48);
+	std::atomic<bool> done(false);
+	std::thread producer(produce, std::ref(ring), std::ref(done));
+
+	uint64_t received = 0, errors = 0, jumps = 0, lastFrame = 0;
+	uint32_t lastGeneration = 0;
+	bool started = false;
+	uint32_t r = 7;
+	for(;;) {
+		r = r * 1103515245 + 12345;
+		size_t count;
+		const void *formatData;
+		const uint32_t *in = (const uint32_t *)ring.read(1 + (r >> 16) % 900, &count, &formatData);
+		if(!in) {
+			if(done && ring.empty() && !ring.read(1, &count, &formatData))
+				break;
+			std::this_thread::yield();
+			continue;
+		}
+
+		Format format;
+		memcpy(&format, formatData, sizeof(format));
+		for(size_t i = 0; i < count; ++i) {
+			uint64_t frame = (in[i * format.channels] ^ (format.generation << 28)) / 16;
+			for(uint32_t c = 0; c < format.channels; ++c) {
+				if(in[i * format.channels + c] != sampleValue(frame, c, format.generation))
+					++errors;
+			}
+			// Frames may only go missing across a discard
+			if(started && frame != lastFrame + 1) {
+				if(format.generation == lastGeneration)
+					++errors;
+				else
+					++jumps;
+			}
+			started = true;
+			lastFrame = frame;
+			lastGeneration = format.generation;
+		}
+		ring.consume(count);
+		received += count;
+	}
+	producer.join();
+
+	printf("received %llu frames, %llu errors, %llu discards skipped over\n",
+	       (unsigned long long)received, (unsigned long long)errors, (unsigned long long)jumps);
+	if(ring.duration() != 0.0) {
+		printf("FAIL: duration %g left after draining\n", ring.duration());
+		++errors;
+	}
+	return errors ? 1 : 0;
+}
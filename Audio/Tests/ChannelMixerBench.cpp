@@ -0,0 +1,163 @@
+//
+//  ChannelMixerBench.cpp
+//  CogAudio Framework
+//
+//  Measures ChannelMixer against the loops Downmix used before it: the per
+//  sample switch on the speaker of each channel for 5.1 and 7.1 to stereo,
+//  and strided copies for stereo to 5.1. In Mframes/s, 4096 frame blocks.
+//
+
+#include "ChannelMixer.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+static const size_t blockFrames = 4096;
+static const int runs = 2000;
+
+// Speakers in the order of their config flags
+enum {
+	frontLeft,
+	frontRight,
+	frontCenter,
+	lowFrequency,
+	backLeft,
+	backRight,
+	sideLeft = 9,
+	sideRight = 10
+};
+
+struct StereoGains {
+	float front[2], center, lfe, back[2], side[2];
+};
+
+static void oldDownmixToStereo(const float *input, int channels, const int *speakers, const StereoGains &g, float *output, size_t count) {
+	for(size_t i = 0; i < count; ++i) {
+		float left = 0.0F, right = 0.0F;
+		for(int j = 0; j < channels; ++j) {
+			float s = input[i * channels + j];
+			switch(speakers[j]) {
+				case frontLeft:
+					left += s * g.front[0];
+					right += s * g.front[1];
+					break;
+				case frontRight:
+					left += s * g.front[1];
+					right += s * g.front[0];
+					break;
+				case frontCenter:
+					left += s * g.center;
+					right += s * g.center;
+					break;
+				case lowFrequency:
+					left += s * g.lfe;
+					right += s * g.lfe;
+					break;
+				case backLeft:
+					left += s * g.back[0];
+					right += s * g.back[1];
+					break;
+				case backRight:
+					left += s * g.back[1];
+					right += s * g.back[0];
+					break;
+				case sideLeft:
+					left += s * g.side[0];
+					right += s * g.side[1];
+					break;
+				case sideRight:
+					left += s * g.side[1];
+					right += s * g.side[0];
+					break;
+				default:
+					break;
+			}
+		}
+		output[i * 2] = left;
+		output[i * 2 + 1] = right;
+	}
+}
+
+static void oldStereoTo51(const float *input, float *output, size_t count) {
+	for(size_t i = 0; i < count * 6; ++i)
+		output[i] = 0.0f;
+	for(size_t i = 0; i < count; ++i) {
+		output[i * 6] = input[i * 2];
+		output[i * 6 + 1] = input[i * 2 + 1];
+	}
+}
+
+static double elapsed(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void fillRandom(std::vector<float> &v) {
+	for(size_t i = 0; i < v.size(); ++i)
+		v[i] = (float)(rand() % 2000 - 1000) / 1000.0f;
+}
+
+int main() {
+	static const int speakers51[] = { frontLeft, frontRight, frontCenter, lowFrequency, backLeft, backRight };
+	static const int speakers71[] = { frontLeft, frontRight, frontCenter, lowFrequency, backLeft, backRight, sideLeft, sideRight };
+	const StereoGains gains = { { 0.651f * 0.8f, 0.0f }, 0.46f * 0.8f, 0.46f * 0.8f, { 0.5636f * 0.8f, 0.3254f * 0.8f }, { 0.4638f, 0.2678f } };
+
+	printf("%-10s %10s %10s %12s\n", "layout", "old", "new", "max diff");
+	for(int channels = 6; channels <= 8; channels += 2) {
+		const int *speakers = channels == 6 ? speakers51 : speakers71;
+		std::vector<float> input(channels * blockFrames), oldOutput(2 * blockFrames), newOutput(2 * blockFrames);
+		fillRandom(input);
+
+		// The same gains, as a matrix
+		std::vector<float> matrix(2 * channels, 0.0f);
+		for(int j = 0; j < channels; ++j) {
+			float unit[8] = { 0 }, out[2];
+			unit[j] = 1.0f;
+			oldDownmixToStereo(unit, channels, speakers, gains, out, 1);
+			matrix[j] = out[0];
+			matrix[channels + j] = out[1];
+		}
+		ChannelMixer mixer(channels, 2, &matrix[0]);
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for(int r = 0; r < runs; ++r)
+			oldDownmixToStereo(&input[0], channels, speakers, gains, &oldOutput[0], blockFrames);
+		double oldTime = elapsed(start);
+		start = std::chrono::steady_clock::now();
+		for(int r = 0; r < runs; ++r)
+			mixer.process(&input[0], blockFrames, &newOutput[0]);
+		double newTime = elapsed(start);
+
+		double maxDiff = 0.0;
+		for(size_t i = 0; i < oldOutput.size(); ++i)
+			maxDiff = std::max(maxDiff, (double)fabs(oldOutput[i] - newOutput[i]));
+		printf("%-10s %10.0f %10.0f %12g\n", channels == 6 ? "5.1 -> 2" : "7.1 -> 2",
+		       blockFrames * runs / oldTime / 1e6, blockFrames * runs / newTime / 1e6, maxDiff);
+	}
+
+	{
+		std::vector<float> input(2 * blockFrames), oldOutput(6 * blockFrames), newOutput(6 * blockFrames);
+		fillRandom(input);
+		std::vector<float> matrix(12, 0.0f);
+		matrix[0 * 2 + 0] = 1.0f;
+		matrix[1 * 2 + 1] = 1.0f;
+		ChannelMixer mixer(2, 6, &matrix[0]);
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for(int r = 0; r < runs; ++r)
+			oldStereoTo51(&input[0], &oldOutput[0], blockFrames);
+		double oldTime = elapsed(start);
+		start = std::chrono::steady_clock::now();
+		for(int r = 0; r < runs; ++r)
+			mixer.process(&input[0], blockFrames, &newOutput[0]);
+		double newTime = elapsed(start);
+
+		printf("%-10s %10.0f %10.0f %12s\n", "2 -> 5.1", blockFrames * runs / oldTime / 1e6,
+		       blockFrames * runs / newTime / 1e6, oldOutput == newOutput ? "0" : "differs");
+	}
+	return 0;
+}
@@ -0,0 +1,79 @@
+//
+//  ChannelMixerTest.cpp
+//  CogAudio Framework
+//
+//  Checks ChannelMixer against a double precision matrix product, for random
+//  and identity matrices between 1 and 32 channels on either side, which
+//  covers every fixed count kernel and the generic one. Also checks that
+//  nothing is written past the output, that identity matrices copy exactly,
+//  and that outputs wider than any channel config come out silent.
+//
+
+#include "ChannelMixer.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <vector>
+
+static float randomSample() {
+	return (float)(rand() % 2000 - 1000) / 1000.0f;
+}
+
+int main() {
+	static const size_t channelCounts[] = { 1, 2, 3, 4, 5, 6, 7, 8, 10, 12, 16, 18, 32, 40 };
+	static const size_t frameCounts[] = { 0, 1, 2, 3, 17, 1000 };
+	const size_t countCount = sizeof(channelCounts) / sizeof(channelCounts[0]);
+	const size_t maxOutputCount = 32;
+	const float guard = 12345.0f;
+	int failures = 0;
+
+	srand(3);
+	for(size_t i = 0; i < countCount; ++i) {
+		for(size_t o = 0; o < countCount; ++o) {
+			size_t inputCount = channelCounts[i], outputCount = channelCounts[o];
+			for(int identity = 0; identity < 2; ++identity) {
+				std::vector<float> matrix(inputCount * outputCount);
+				for(size_t k = 0; k < outputCount; ++k) {
+					for(size_t j = 0; j < inputCount; ++j)
+						matrix[k * inputCount + j] = identity ? (j == k ? 1.0f : 0.0f) : randomSample();
+				}
+				ChannelMixer mixer(inputCount, outputCount, &matrix[0]);
+				const bool silent = outputCount > maxOutputCount && !(identity && inputCount == outputCount);
+
+				for(size_t f = 0; f < sizeof(frameCounts) / sizeof(frameCounts[0]); ++f) {
+					size_t frames = frameCounts[f];
+					std::vector<float> input(inputCount * frames + 1), output(outputCount * frames + 1, guard);
+					for(size_t n = 0; n < input.size(); ++n)
+						input[n] = randomSample();
+					mixer.process(&input[0], frames, &output[0]);
+
+					double maxError = 0.0;
+					bool exact = true;
+					for(size_t n = 0; n < frames; ++n) {
+						for(size_t k = 0; k < outputCount; ++k) {
+							double sum = 0.0;
+							for(size_t j = 0; j < inputCount && !silent; ++j)
+								sum += (double)matrix[k * inputCount + j] * input[n * inputCount + j];
+							float value = output[n * outputCount + k];
+							maxError = std::max(maxError, fabs(sum - value));
+							exact = exact && (float)sum == value;
+						}
+					}
+					if(maxError > 1e-4 || ((identity || silent) && !exact) || output[outputCount * frames] != guard) {
+						printf("FAIL: %zu to %zu channels, %s matrix, %zu frames, max error %g%s\n",
+						       inputCount, outputCount, identity ? "identity" : "random", frames, maxError,
+						       output[outputCount * frames] != guard ? ", wrote past the end" : "");
+						++failures;
+					}
+				}
+			}
+		}
+	}
+
+	if(failures)
+		printf("%d failures\n", failures);
+	return failures ? 1 : 0;
+}
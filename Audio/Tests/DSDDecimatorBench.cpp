@@ -0,0 +1,86 @@
+//
+//  DSDDecimatorBench.cpp
+//  CogAudio Framework
+//
+//  Measures DSDDecimator to 44.1 kHz against the path it replaced, dsd2pcm
+//  followed by Resampler from DSD rate / 8, and the first stages of both on
+//  their own, as multiples of real time.
+//
+
+#include "DSDDecimator.h"
+#include "DSD2PCMReference.h"
+#include "Resampler.h"
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+static const double seconds = 2.0;
+static const size_t blockFrames = 4096;
+
+static double elapsed(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static double runOld(const std::vector<uint8_t> &input, size_t channelCount, double dsdRate, bool resample) {
+	size_t frames = input.size() / channelCount;
+	std::vector<float> pcm(blockFrames * channelCount), output(65536 * channelCount);
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::vector<void *> states(channelCount);
+	for(size_t c = 0; c < channelCount; ++c)
+		states[c] = dsd2pcm_alloc();
+	Resampler resampler((int)channelCount, dsdRate / 8, 44100);
+	for(size_t done = 0; done < frames; done += blockFrames) {
+		size_t count = std::min(blockFrames, frames - done);
+		for(size_t c = 0; c < channelCount; ++c)
+			dsd2pcm_process(states[c], &input[done * channelCount], c, channelCount, &pcm[0], c, channelCount, count);
+		for(size_t used = 0; resample && used < count;) {
+			size_t inDone;
+			resampler.resample(&pcm[used * channelCount], count - used, &inDone, &output[0], 65536);
+			used += inDone;
+		}
+	}
+	for(size_t c = 0; c < channelCount; ++c)
+		dsd2pcm_free(states[c]);
+	return elapsed(start);
+}
+
+static double runNew(const std::vector<uint8_t> &input, size_t channelCount, double dsdRate, double targetRate) {
+	size_t frames = input.size() / channelCount;
+	std::vector<float> output(blockFrames * channelCount);
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	DSDDecimator decimator(channelCount, dsdRate, targetRate);
+	for(size_t done = 0; done < frames; done += blockFrames)
+		decimator.process(&input[done * channelCount], std::min(blockFrames, frames - done), &output[0]);
+	return elapsed(start);
+}
+
+int main() {
+	static const double dsdRates[] = { 2822400, 5644800, 11289600 };
+	static const size_t channelCounts[] = { 2, 6 };
+
+	printf("%-8s %8s %10s %10s %12s %12s\n", "rate", "channels", "old", "new", "stage 1 old", "stage 1 new");
+	for(size_t r = 0; r < sizeof(dsdRates) / sizeof(dsdRates[0]); ++r) {
+		for(size_t n = 0; n < sizeof(channelCounts) / sizeof(channelCounts[0]); ++n) {
+			double dsdRate = dsdRates[r];
+			size_t channelCount = channelCounts[n];
+			std::vector<uint8_t> input((size_t)(dsdRate / 8 * seconds) * channelCount);
+			srand(2);
+			for(size_t i = 0; i < input.size(); ++i)
+				input[i] = (uint8_t)rand();
+
+			double oldTime = runOld(input, channelCount, dsdRate, true);
+			double newTime = runNew(input, channelCount, dsdRate, 44100);
+			double oldFirst = runOld(input, channelCount, dsdRate, false);
+			double newFirst = runNew(input, channelCount, dsdRate, dsdRate / 8);
+
+			char name[16];
+			snprintf(name, sizeof(name), "DSD%.0f", dsdRate / 44100);
+			printf("%-8s %8zu %9.0fx %9.0fx %11.0fx %11.0fx\n", name, channelCount,
+			       seconds / oldTime, seconds / newTime, seconds / oldFirst, seconds / newFirst);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,163 @@
+//
+//  DSDDecimatorTest.cpp
+//  CogAudio Framework
+//
+//  Checks DSDDecimator against the dsd2pcm code it replaced, where its first
+//  stage alone is used, and that its output does not depend on how the input
+//  is split up. Runs sines from a sigma delta modulator through the whole
+//  chain to check the passband for flatness and the stopband for aliases.
+//
+
+#include "DSDDecimator.h"
+#include "DSD2PCMReference.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <vector>
+
+static int failures = 0;
+
+// Second order sigma delta modulator, oldest sample in the most significant bit
+static std::vector<uint8_t> modulate(size_t frames, size_t channelCount, double rate, double frequency, double amplitude) {
+	std::vector<uint8_t> output(frames * channelCount);
+	for(size_t c = 0; c < channelCount; ++c) {
+		double i1 = 0.0, i2 = 0.0;
+		for(size_t f = 0; f < frames; ++f) {
+			uint8_t byte = 0;
+			for(int bit = 0; bit < 8; ++bit) {
+				double x = amplitude * sin(2.0 * M_PI * frequency * (double)(f * 8 + bit) / rate + (double)c);
+				double y = i2 >= 0.0 ? 1.0 : -1.0;
+				i1 += x - y;
+				i2 += i1 - y;
+				if(y > 0.0)
+					byte |= 0x80 >> bit;
+			}
+			output[f * channelCount + c] = byte;
+		}
+	}
+	return output;
+}
+
+static size_t runChunked(DSDDecimator &decimator, const std::vector<uint8_t> &input, size_t channelCount, const size_t *chunks, size_t chunkCount, std::vector<float> &output) {
+	size_t frames = input.size() / channelCount;
+	output.resize(frames * channelCount);
+	size_t done = 0, outDone = 0;
+	for(size_t k = 0; done < frames; ++k) {
+		size_t count = std::min(chunks[k % chunkCount], frames - done);
+		outDone += decimator.process(&input[done * channelCount], count, &output[outDone * channelCount]);
+		done += count;
+	}
+	return outDone;
+}
+
+// At a ratio of 1, only the first stage runs, which has to match dsd2pcm
+static void testFirstStage() {
+	static const size_t chunks[] = { 1, 7, 1023, 1024, 1025, 3000, 13 };
+	static const size_t channelCounts[] = { 1, 2, 6 };
+	for(size_t n = 0; n < sizeof(channelCounts) / sizeof(channelCounts[0]); ++n) {
+		size_t channelCount = channelCounts[n];
+		const size_t frames = 100000;
+		std::vector<uint8_t> input(frames * channelCount);
+		srand(1);
+		for(size_t i = 0; i < input.size(); ++i)
+			input[i] = (uint8_t)rand();
+
+		std::vector<float> expected(frames * channelCount), output;
+		for(size_t c = 0; c < channelCount; ++c) {
+			void *state = dsd2pcm_alloc();
+			dsd2pcm_process(state, &input[0], c, channelCount, &expected[0], c, channelCount, frames);
+			dsd2pcm_free(state);
+		}
+
+		DSDDecimator decimator(channelCount, 2822400, 352800);
+		if(decimator.ratio() != 1 || decimator.outputRate() != 352800) {
+			printf("FAIL: DSD64 to 352.8 kHz has ratio %zu, rate %g\n", decimator.ratio(), decimator.outputRate());
+			++failures;
+		}
+		size_t outDone = runChunked(decimator, input, channelCount, chunks, sizeof(chunks) / sizeof(chunks[0]), output);
+		double maxError = 0.0;
+		for(size_t i = 0; i < frames * channelCount; ++i)
+			maxError = std::max(maxError, (double)fabs(expected[i] - output[i]));
+		if(outDone != frames || maxError > 1e-5) {
+			printf("FAIL: first stage, %zu channels, %zu frames out, max error %g\n", channelCount, outDone, maxError);
+			++failures;
+		}
+	}
+}
+
+static void testChunking() {
+	static const double rates[][2] = {
+		{ 2822400, 44100 },
+		{ 2822400, 48000 },
+		{ 5644800, 88200 },
+		{ 11289600, 44100 }
+	};
+	static const size_t whole[] = { 1 << 20 };
+	static const size_t chunks[] = { 1, 2, 3, 1024, 1025, 4097, 13 };
+	for(size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); ++r) {
+		const size_t channelCount = 2, frames = 100000;
+		std::vector<uint8_t> input(frames * channelCount);
+		for(size_t i = 0; i < input.size(); ++i)
+			input[i] = (uint8_t)rand();
+
+		DSDDecimator a(channelCount, rates[r][0], rates[r][1]), b(channelCount, rates[r][0], rates[r][1]);
+		std::vector<float> outA, outB;
+		size_t countA = runChunked(a, input, channelCount, whole, 1, outA);
+		size_t countB = runChunked(b, input, channelCount, chunks, sizeof(chunks) / sizeof(chunks[0]), outB);
+		size_t expected = (frames + a.ratio() - 1) / a.ratio();
+		if(countA != expected || countB != expected || !std::equal(outA.begin(), outA.begin() + countA * channelCount, outB.begin())) {
+			printf("FAIL: %g to %g, %zu and %zu frames out of %zu, or the chunked output differs\n", rates[r][0], rates[r][1], countA, countB, expected);
+			++failures;
+		}
+	}
+}
+
+// Level at the frequency a tone ends up at after decimation, in dB relative to the tone
+static double toneLevel(double frequency) {
+	const double dsdRate = 2822400, outputRate = 44100;
+	const size_t frames = (size_t)(dsdRate / 8);
+	std::vector<uint8_t> input = modulate(frames, 1, dsdRate, frequency, 0.5);
+	DSDDecimator decimator(1, dsdRate, outputRate);
+	std::vector<float> output(frames);
+	size_t count = decimator.process(&input[0], frames, &output[0]);
+
+	double alias = frequency > outputRate / 2 ? outputRate - frequency : frequency;
+	double ys = 0.0, yc = 0.0;
+	size_t n = 0;
+	for(size_t i = (size_t)(outputRate / 10); i < count; ++i, ++n) {
+		double t = (double)i / outputRate;
+		ys += output[i] * sin(2.0 * M_PI * alias * t);
+		yc += output[i] * cos(2.0 * M_PI * alias * t);
+	}
+	return 20.0 * log10(2.0 * sqrt(ys * ys + yc * yc) / (double)n);
+}
+
+static void testResponse() {
+	static const double passband[] = { 1000, 10000, 19000, 20000 };
+	static const double stopband[] = { 25000, 30000, 60000 };
+	for(size_t i = 0; i < sizeof(passband) / sizeof(passband[0]); ++i) {
+		double level = toneLevel(passband[i]);
+		if(fabs(level) > 0.1) {
+			printf("FAIL: %g Hz comes out at %.2f dB\n", passband[i], level);
+			++failures;
+		}
+	}
+	for(size_t i = 0; i < sizeof(stopband) / sizeof(stopband[0]); ++i) {
+		double level = toneLevel(stopband[i]);
+		if(level > -100.0) {
+			printf("FAIL: %g Hz aliases at %.1f dB\n", stopband[i], level);
+			++failures;
+		}
+	}
+}
+
+int main() {
+	testFirstStage();
+	testChunking();
+	testResponse();
+	if(failures)
+		printf("%d failures\n", failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,143 @@
+//
+//  HDCDBench.cpp
+//  CogAudio Framework
+//
+//  Measures the HDCD path of ConverterNode on a minute of plain CD audio,
+//  where the idle scan lets it skip the decoder, against the decoder it had
+//  before, with the plain 16 bit conversion for scale. Also times both
+//  decoders on HDCD material, where every block is decoded. Best of five,
+//  4096 frame blocks.
+//
+
+#include "HDCDReference.h"
+#include "SampleConverter.h"
+#include "hdcd_decode2.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+static const size_t frames = 60 * 44100;
+static const size_t blockFrames = 4096;
+static const int runs = 5;
+
+static double elapsed(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// ConverterNode's HDCD path over the whole signal
+static double runPath(const std::vector<int16_t> &signal, bool scan) {
+	SampleConverterFunc convert16 = sampleConverterForFormat(16, false, false, false);
+	SampleConverterInt32Func convert16To32 = sampleConverterInt32ForFormat(16, false, false);
+	SampleConverterFunc convert32 = sampleConverterForFormat(32, false, false, false);
+	std::vector<int32_t> buffer(blockFrames * 2);
+	std::vector<float> output(blockFrames * 2);
+	hdcd_state_stereo_t state;
+	if(scan)
+		hdcd_reset_stereo(&state, 44100);
+	else
+		hdcd_reset_stereo_reference(&state, 44100);
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for(size_t done = 0; done < frames; done += blockFrames) {
+		size_t count = std::min(blockFrames, frames - done);
+		const int16_t *input = &signal[done * 2];
+		if(scan && hdcd_scan_idle_stereo(&state, input, (int)count)) {
+			convert16(&output[0], input, count * 2);
+		} else {
+			convert16To32(&buffer[0], input, count * 2);
+			if(scan)
+				hdcd_process_stereo(&state, &buffer[0], (int)count);
+			else
+				hdcd_process_stereo_reference(&state, &buffer[0], (int)count);
+			convert32(&output[0], &buffer[0], count * 2);
+			for(size_t i = 0; i < count * 2; ++i)
+				output[i] *= 2.0f;
+		}
+	}
+	return elapsed(start);
+}
+
+static double runConversion(const std::vector<int16_t> &signal) {
+	SampleConverterFunc convert16 = sampleConverterForFormat(16, false, false, false);
+	std::vector<float> output(blockFrames * 2);
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for(size_t done = 0; done < frames; done += blockFrames)
+		convert16(&output[0], &signal[done * 2], std::min(blockFrames, frames - done) * 2);
+	return elapsed(start);
+}
+
+// The decoder alone, on samples that already carry HDCD packets
+static double runDecoder(const std::vector<int32_t> &input, bool current) {
+	std::vector<int32_t> buffer = input;
+	hdcd_state_stereo_t state;
+	if(current)
+		hdcd_reset_stereo(&state, 44100);
+	else
+		hdcd_reset_stereo_reference(&state, 44100);
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for(size_t done = 0; done < frames; done += blockFrames) {
+		int count = (int)std::min(blockFrames, frames - done);
+		if(current)
+			hdcd_process_stereo(&state, &buffer[done * 2], count);
+		else
+			hdcd_process_stereo_reference(&state, &buffer[done * 2], count);
+	}
+	return elapsed(start);
+}
+
+// Sixteen bit samples whose scrambled LSBs carry an A packet every 1500 frames
+static std::vector<int32_t> makeHDCD() {
+	std::vector<uint8_t> bits(frames * 2), lsbs(frames * 2);
+	uint32_t x = 7;
+	for(size_t i = 0; i < bits.size(); ++i) {
+		x = x * 1664525 + 1013904223;
+		bits[i] = (x >> 16) & 1;
+	}
+	for(size_t at = 0; at + 64 < frames; at += 1500) {
+		uint64_t packet = ((uint64_t)0x7e0fa005 << 8) | (uint8_t)(0x10 | (at / 1500 % 8));
+		for(int c = 0; c < 2; ++c) {
+			for(int i = 0; i < 40; ++i)
+				bits[(at + i) * 2 + c] = (packet >> (39 - i)) & 1;
+		}
+	}
+	std::vector<int32_t> output(frames * 2);
+	for(size_t n = 0; n < frames; ++n) {
+		for(int c = 0; c < 2; ++c) {
+			uint8_t bit = bits[n * 2 + c];
+			if(n >= 5)
+				bit ^= lsbs[(n - 5) * 2 + c];
+			if(n >= 23)
+				bit ^= lsbs[(n - 23) * 2 + c];
+			lsbs[n * 2 + c] = bit;
+			x = x * 1664525 + 1013904223;
+			output[n * 2 + c] = ((int32_t)(int16_t)(x >> 16) / 3 & ~1) | bit;
+		}
+	}
+	return output;
+}
+
+int main() {
+	std::vector<int16_t> plain(frames * 2);
+	uint32_t x = 1;
+	for(size_t i = 0; i < plain.size(); ++i) {
+		x = x * 1664525 + 1013904223;
+		plain[i] = (int16_t)(x >> 16) / 3;
+	}
+	std::vector<int32_t> hdcd = makeHDCD();
+
+	double best[5] = { 1e9, 1e9, 1e9, 1e9, 1e9 };
+	for(int r = 0; r < runs; ++r) {
+		best[0] = std::min(best[0], runPath(plain, false));
+		best[1] = std::min(best[1], runPath(plain, true));
+		best[2] = std::min(best[2], runConversion(plain));
+		best[3] = std::min(best[3], runDecoder(hdcd, false));
+		best[4] = std::min(best[4], runDecoder(hdcd, true));
+	}
+	printf("60 s plain CD, HDCD path:  old %.1f ms, new %.1f ms (16 bit conversion alone %.1f ms)\n", best[0] * 1e3, best[1] * 1e3, best[2] * 1e3);
+	printf("60 s HDCD, decoder alone:  old %.1f ms, new %.1f ms\n", best[3] * 1e3, best[4] * 1e3);
+	return 0;
+}
@@ -0,0 +1,27 @@
+//
+//  HDCDReference.h
+//  CogAudio Framework
+//
+//  The HDCD decoder from before the idle scan.
+//
+
+#ifndef HDCDReference_h
+#define HDCDReference_h
+
+#include "hdcd_decode2.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void hdcd_reset_reference(hdcd_state_t *state, unsigned rate);
+void hdcd_process_reference(hdcd_state_t *state, int32_t *samples, int count, int stride);
+
+void hdcd_reset_stereo_reference(hdcd_state_stereo_t *state, unsigned rate);
+void hdcd_process_stereo_reference(hdcd_state_stereo_t *state, int32_t *samples, int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,208 @@
+//
+//  HDCDTest.cpp
+//  CogAudio Framework
+//
+//  Runs the HDCD path of ConverterNode, with the idle scan deciding which
+//  blocks skip the decoder, against the decoder it had before on every
+//  block. Covers plain noise, packet runs with A and B codes and peak
+//  extend that cross the sustain expiry, and lone prefixes with no code,
+//  in blocks of many sizes. Output and decoder counters must be identical.
+//
+
+#include "HDCDReference.h"
+#include "SampleConverter.h"
+#include "hdcd_decode2.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+static uint64_t randomState = 88172645463325252ULL;
+
+static uint32_t randomBits() {
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 7;
+	randomState ^= randomState << 17;
+	return (uint32_t)randomState;
+}
+
+// Stereo 16 bit signal whose LSBs descramble to the given bit streams
+static std::vector<int16_t> makeSignal(size_t frames, const std::vector<uint8_t> bits[2]) {
+	std::vector<int16_t> output(frames * 2);
+	std::vector<uint8_t> lsbs[2] = { std::vector<uint8_t>(frames), std::vector<uint8_t>(frames) };
+	for(size_t n = 0; n < frames; ++n) {
+		for(int c = 0; c < 2; ++c) {
+			uint8_t bit = bits[c][n];
+			if(n >= 5)
+				bit ^= lsbs[c][n - 5];
+			if(n >= 23)
+				bit ^= lsbs[c][n - 23];
+			lsbs[c][n] = bit;
+			int value = (int)(12000 * sin(n * 0.01 * (c + 1))) + (int)(randomBits() % 2001) - 1000;
+			if(randomBits() % 50000 == 0)
+				value = (randomBits() & 1) ? 32767 : -32768;
+			output[n * 2 + c] = (int16_t)((value & ~1) | bit);
+		}
+	}
+	return output;
+}
+
+static void putBits(std::vector<uint8_t> &bits, size_t at, uint32_t value, int count) {
+	for(int i = 0; i < count; ++i) {
+		if(at + i < bits.size())
+			bits[at + i] = (value >> (count - 1 - i)) & 1;
+	}
+}
+
+// A or B packets every so many frames, with random gains and filter flags
+static void addPackets(std::vector<uint8_t> &bits, size_t start, size_t end, size_t every, bool peakExtend, int maxGain) {
+	for(size_t at = start; at + 64 < end; at += every) {
+		uint8_t gain = randomBits() % (maxGain + 1);
+		uint8_t code = (peakExtend ? 16 : 0) | (randomBits() % 2 ? 32 : 0);
+		if(randomBits() & 1) {
+			putBits(bits, at, 0x7e0fa005, 32);
+			putBits(bits, at + 32, code | (gain & 7), 8);
+		} else {
+			putBits(bits, at, 0x7e0fa006, 32);
+			uint8_t control = code | ((gain * 2) & 15);
+			putBits(bits, at + 32, ((uint32_t)control << 8) | (uint8_t)~control, 16);
+		}
+	}
+}
+
+struct Result {
+	std::vector<float> output;
+	size_t idleFrames;
+	hdcd_state_stereo_t state;
+};
+
+// Blocks of blockFrames, or of random sizes when it is 0
+static Result run(const std::vector<int16_t> &signal, bool scan, size_t blockFrames) {
+	Result result;
+	result.idleFrames = 0;
+	memset(&result.state, 0, sizeof(result.state));
+	if(scan)
+		hdcd_reset_stereo(&result.state, 44100);
+	else
+		hdcd_reset_stereo_reference(&result.state, 44100);
+
+	SampleConverterFunc convert16 = sampleConverterForFormat(16, false, false, false);
+	SampleConverterInt32Func convert16To32 = sampleConverterInt32ForFormat(16, false, false);
+	SampleConverterFunc convert32 = sampleConverterForFormat(32, false, false, false);
+
+	size_t frames = signal.size() / 2;
+	result.output.resize(signal.size());
+	std::vector<int32_t> buffer;
+	uint64_t savedState = randomState;
+	randomState = 12345;
+	for(size_t done = 0; done < frames;) {
+		size_t count = blockFrames ? blockFrames : 1 + randomBits() % 5000;
+		if(count > frames - done)
+			count = frames - done;
+		const int16_t *input = &signal[done * 2];
+		float *output = &result.output[done * 2];
+		if(scan && hdcd_scan_idle_stereo(&result.state, input, (int)count)) {
+			convert16(output, input, count * 2);
+			result.idleFrames += count;
+		} else {
+			buffer.resize(count * 2);
+			convert16To32(&buffer[0], input, count * 2);
+			if(scan)
+				hdcd_process_stereo(&result.state, &buffer[0], (int)count);
+			else
+				hdcd_process_stereo_reference(&result.state, &buffer[0], (int)count);
+			convert32(output, &buffer[0], count * 2);
+			for(size_t i = 0; i < count * 2; ++i)
+				output[i] *= 2.0f;
+		}
+		done += count;
+	}
+	randomState = savedState;
+	return result;
+}
+
+static bool sameCounters(const hdcd_state_t &a, const hdcd_state_t &b) {
+	return a.code_counterA == b.code_counterA && a.code_counterA_almost == b.code_counterA_almost &&
+	       a.code_counterB == b.code_counterB && a.code_counterB_checkfails == b.code_counterB_checkfails &&
+	       a.code_counterC == b.code_counterC && a.code_counterC_unmatched == b.code_counterC_unmatched &&
+	       a.count_peak_extend == b.count_peak_extend && a.count_transient_filter == b.count_transient_filter &&
+	       a.max_gain == b.max_gain && a.count_sustain_expired == b.count_sustain_expired &&
+	       a.control == b.control && a.running_gain == b.running_gain && a.window == b.window &&
+	       !memcmp(a.gain_counts, b.gain_counts, sizeof(a.gain_counts));
+}
+
+int main() {
+	const size_t rate = 44100;
+	static const struct {
+		const char *name;
+		size_t seconds;
+	} cases[] = {
+		{ "plain", 60 },
+		{ "packets from 5 to 25 s", 60 },
+		{ "packets from the start", 20 },
+		{ "peak extend at the end", 40 },
+		{ "lone prefixes", 30 }
+	};
+	static const size_t blockSizes[] = { 0, 4096, 1, 31, 33 };
+	int failures = 0;
+	bool sawIdle = false, sawPackets = false;
+
+	for(size_t k = 0; k < sizeof(cases) / sizeof(cases[0]); ++k) {
+		size_t frames = cases[k].seconds * rate;
+		std::vector<uint8_t> bits[2];
+		for(int c = 0; c < 2; ++c) {
+			bits[c].resize(frames);
+			for(size_t n = 0; n < frames; ++n)
+				bits[c][n] = randomBits() & 1;
+		}
+		for(int c = 0; c < 2; ++c) {
+			switch(k) {
+				case 1:
+					addPackets(bits[c], 5 * rate, 25 * rate, 2000, false, 7);
+					break;
+				case 2:
+					addPackets(bits[c], c * 3, 20 * rate, 1500, false, 6);
+					break;
+				case 3:
+					addPackets(bits[c], 30 * rate + 17, 40 * rate, 3000, true, 7);
+					break;
+				case 4:
+					for(size_t at = 1000 + c * 333; at + 64 < frames; at += rate) {
+						putBits(bits[c], at, 0x7e0fa005 + (at / rate % 2), 32);
+						putBits(bits[c], at + 32, 0xff, 8);
+					}
+					break;
+			}
+		}
+		std::vector<int16_t> signal = makeSignal(frames, bits);
+
+		for(size_t b = 0; b < sizeof(blockSizes) / sizeof(blockSizes[0]); ++b) {
+			// Single frames are slow, so only on the shorter cases
+			if(blockSizes[b] == 1 && frames > 20 * rate)
+				continue;
+			Result expected = run(signal, false, blockSizes[b]);
+			Result result = run(signal, true, blockSizes[b]);
+			sawIdle = sawIdle || result.idleFrames > 0;
+			sawPackets = sawPackets || result.state.channel[0].code_counterA + result.state.channel[0].code_counterB > 0;
+			if(expected.output != result.output ||
+			   !sameCounters(expected.state.channel[0], result.state.channel[0]) ||
+			   !sameCounters(expected.state.channel[1], result.state.channel[1])) {
+				size_t i = 0;
+				while(i < expected.output.size() && expected.output[i] == result.output[i])
+					++i;
+				printf("FAIL: %s, %zu frame blocks, first difference at sample %zu\n", cases[k].name, blockSizes[b], i);
+				++failures;
+			}
+		}
+	}
+	if(!sawIdle || !sawPackets) {
+		printf("FAIL: the cases did not exercise both the idle scan and the decoder\n");
+		++failures;
+	}
+
+	if(failures)
+		printf("%d failures\n", failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,54 @@
+//
+//  LPCBench.cpp
+//  CogAudio Framework
+//
+//  Measures lpc_extrapolate2 against the scalar version it replaced, priming
+//  with 2205 frames and extrapolating a second at 44.1 kHz, about what
+//  ConverterNode does at either end of a stream, in ms per call.
+//
+
+#include <stddef.h> // lpc.h expects size_t
+
+#include "lpc.h"
+#include "LPCReference.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <vector>
+
+typedef void (*ExtrapolateFunc)(float *const, const size_t, const int, const int, const size_t, const size_t, void **, size_t *);
+
+static const size_t prime = 2205, extra = 44100;
+static const int runs = 20;
+
+static double measure(ExtrapolateFunc extrapolate, const std::vector<float> &input, int nch, bool forward) {
+	std::vector<float> data = input;
+	void *buffer = NULL;
+	size_t size = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for(int r = 0; r < runs; ++r)
+		extrapolate(&data[extra * nch], prime, nch, LPC_ORDER, forward ? 0 : extra, forward ? extra : 0, &buffer, &size);
+	double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	free(buffer);
+	return time / runs * 1e3;
+}
+
+int main() {
+	static const int channelCounts[] = { 1, 2, 6, 8 };
+
+	printf("%-8s %-9s %10s %10s\n", "channels", "direction", "old", "new");
+	for(size_t n = 0; n < sizeof(channelCounts) / sizeof(channelCounts[0]); ++n) {
+		int nch = channelCounts[n];
+		std::vector<float> input((extra * 2 + prime) * nch, 0.0f);
+		for(size_t i = 0; i < prime * nch; ++i)
+			input[extra * nch + i] = 0.5f * sinf(i * 0.01f) + (float)(rand() % 2000 - 1000) / 20000.0f;
+		for(int forward = 0; forward < 2; ++forward) {
+			printf("%-8d %-9s %10.2f %10.2f\n", nch, forward ? "forward" : "backward",
+			       measure(lpc_extrapolate2_reference, input, nch, forward != 0), measure(lpc_extrapolate2, input, nch, forward != 0));
+		}
+	}
+	return 0;
+}
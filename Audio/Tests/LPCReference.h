@@ -0,0 +1,23 @@
+//
+//  LPCReference.h
+//  CogAudio Framework
+//
+//  The scalar lpc_extrapolate2 from before it was vectorized.
+//
+
+#ifndef LPCReference_h
+#define LPCReference_h
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void lpc_extrapolate2_reference(float *const data, const size_t data_len, const int nch, const int lpc_order, const size_t extra_bkwd, const size_t extra_fwd, void **extrapolate_buffer, size_t *extrapolate_buffer_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
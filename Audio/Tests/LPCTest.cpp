@@ -0,0 +1,100 @@
+//
+//  LPCTest.cpp
+//  CogAudio Framework
+//
+//  Checks the vectorized lpc_extrapolate2 against the scalar one it replaced,
+//  for every channel count the lane grouping treats differently and in both
+//  directions. Also checks that primes shorter than the order stay finite,
+//  that silence extrapolates to silence, and that a scratch buffer from a
+//  larger call is reused safely.
+//
+
+#include <stddef.h> // lpc.h expects size_t
+
+#include "lpc.h"
+#include "LPCReference.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <vector>
+
+static int failures = 0;
+
+static void testAgainstReference() {
+	static const int channelCounts[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	const size_t prime = 2205, extra = 44100;
+	srand(7);
+	for(size_t n = 0; n < sizeof(channelCounts) / sizeof(channelCounts[0]); ++n) {
+		int nch = channelCounts[n];
+		for(int forward = 0; forward < 2; ++forward) {
+			std::vector<float> expected((extra * 2 + prime) * nch, 0.0f);
+			for(size_t i = 0; i < prime; ++i) {
+				for(int c = 0; c < nch; ++c)
+					expected[(extra + i) * nch + c] = 0.4f * sinf(i * (0.03f + 0.011f * c)) + 0.2f * sinf(i * 0.2f + c) + 0.05f * ((rand() % 2001) / 1000.0f - 1.0f);
+			}
+			std::vector<float> output = expected;
+
+			void *bufferA = NULL, *bufferB = NULL;
+			size_t sizeA = 0, sizeB = 0;
+			lpc_extrapolate2_reference(&expected[extra * nch], prime, nch, LPC_ORDER, forward ? 0 : extra, forward ? extra : 0, &bufferA, &sizeA);
+			lpc_extrapolate2(&output[extra * nch], prime, nch, LPC_ORDER, forward ? 0 : extra, forward ? extra : 0, &bufferB, &sizeB);
+			free(bufferA);
+			free(bufferB);
+
+			// The predictor runs free for a second, so tiny differences in
+			// the coefficients grow; compare relative to the signal
+			double maxError = 0.0, peak = 0.0;
+			for(size_t i = 0; i < expected.size(); ++i) {
+				maxError = std::max(maxError, (double)fabs(expected[i] - output[i]));
+				peak = std::max(peak, (double)fabs(expected[i]));
+			}
+			if(!(maxError <= 1e-3 * peak)) {
+				printf("FAIL: %d channels, %s, max error %g against peak %g\n", nch, forward ? "forward" : "backward", maxError, peak);
+				++failures;
+			}
+		}
+	}
+}
+
+static void testEdgeCases() {
+	static const size_t primes[] = { 1, 5, 31, 32, 33, 64 };
+	void *buffer = NULL;
+	size_t size = 0;
+
+	// Largest first, so the later calls reuse the buffer
+	std::vector<float> large((1000 + 4410 + 1000) * 8, 0.1f);
+	lpc_extrapolate2(&large[1000 * 8], 4410, 8, LPC_ORDER, 1000, 0, &buffer, &size);
+
+	for(size_t p = 0; p < sizeof(primes) / sizeof(primes[0]); ++p) {
+		std::vector<float> data((100 + primes[p] + 100) * 3, 0.25f);
+		lpc_extrapolate2(&data[100 * 3], primes[p], 3, LPC_ORDER, 100, 0, &buffer, &size);
+		lpc_extrapolate2(&data[100 * 3], primes[p], 3, LPC_ORDER, 0, 100, &buffer, &size);
+		for(size_t i = 0; i < data.size(); ++i) {
+			if(!std::isfinite(data[i])) {
+				printf("FAIL: prime of %zu samples gave a non finite sample\n", primes[p]);
+				++failures;
+				break;
+			}
+		}
+	}
+
+	std::vector<float> silence((100 + 500 + 100) * 2, 0.0f);
+	lpc_extrapolate2(&silence[100 * 2], 500, 2, LPC_ORDER, 100, 0, &buffer, &size);
+	lpc_extrapolate2(&silence[100 * 2], 500, 2, LPC_ORDER, 0, 100, &buffer, &size);
+	if(std::count(silence.begin(), silence.end(), 0.0f) != (ptrdiff_t)silence.size()) {
+		printf("FAIL: silence extrapolated to something else\n");
+		++failures;
+	}
+	free(buffer);
+}
+
+int main() {
+	testAgainstReference();
+	testEdgeCases();
+	if(failures)
+		printf("%d failures\n", failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,116 @@
+//
+//  PartitionedConvolverTest.cpp
+//  CogAudio Framework
+//
+//  Checks PartitionedConvolver against direct convolution in the time
+//  domain, for stereo and 5.1 input, impulses shorter and longer than a
+//  block, several block sizes, and calls of random length, including ones
+//  that end partway into a block. Also checks that reset clears the state.
+//
+
+#include "PartitionedConvolver.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <vector>
+
+static int failures = 0;
+
+static float randomSample() {
+	return (float)rand() / (float)RAND_MAX - 0.5f;
+}
+
+// Signal to error ratio in dB of the output against direct convolution
+static double runCase(size_t inputCount, size_t outputCount, size_t impulseLength, size_t blockSize, size_t frames) {
+	PartitionedConvolver convolver(inputCount, outputCount, impulseLength, blockSize);
+	std::vector<float> impulses(inputCount * outputCount * impulseLength);
+	for(size_t i = 0; i < impulses.size(); ++i)
+		impulses[i] = randomSample() * 0.1f;
+	for(size_t i = 0; i < inputCount; ++i) {
+		for(size_t o = 0; o < outputCount; ++o)
+			convolver.setImpulse(i, o, &impulses[(i * outputCount + o) * impulseLength], impulseLength);
+	}
+
+	std::vector<float> input(frames * inputCount), output(frames * outputCount);
+	for(size_t i = 0; i < input.size(); ++i)
+		input[i] = randomSample();
+	for(size_t done = 0; done < frames;) {
+		size_t count = std::min(frames - done, (size_t)(1 + rand() % 300));
+		if(rand() % 4 == 0)
+			count = std::min(frames - done, blockSize);
+		convolver.process(&input[done * inputCount], count, &output[done * outputCount]);
+		done += count;
+	}
+
+	double error = 0.0, signal = 0.0;
+	for(size_t t = 0; t < frames; ++t) {
+		for(size_t o = 0; o < outputCount; ++o) {
+			double sum = 0.0;
+			for(size_t i = 0; i < inputCount; ++i) {
+				const float *impulse = &impulses[(i * outputCount + o) * impulseLength];
+				for(size_t k = 0; k < impulseLength && k <= t; ++k)
+					sum += impulse[k] * input[(t - k) * inputCount + i];
+			}
+			double difference = sum - output[t * outputCount + o];
+			error += difference * difference;
+			signal += sum * sum;
+		}
+	}
+	return error > 0.0 ? 10.0 * log10(signal / error) : 1000.0;
+}
+
+static void testAgainstDirect() {
+	static const struct {
+		size_t inputCount, outputCount, impulseLength, blockSize;
+	} cases[] = {
+		{ 2, 2, 1500, 128 },
+		{ 6, 2, 2200, 64 },
+		{ 6, 2, 1, 128 },
+		{ 8, 2, 512, 512 },
+		{ 2, 2, 2049, 512 },
+		{ 1, 3, 700, 256 }
+	};
+	for(size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c) {
+		double snr = runCase(cases[c].inputCount, cases[c].outputCount, cases[c].impulseLength, cases[c].blockSize, 5000);
+		if(snr < 120.0) {
+			printf("FAIL: %zu to %zu channels, %zu taps, %zu sample blocks, SNR %.1f dB\n",
+			       cases[c].inputCount, cases[c].outputCount, cases[c].impulseLength, cases[c].blockSize, snr);
+			++failures;
+		}
+	}
+}
+
+static void testReset() {
+	const size_t frames = 1000;
+	PartitionedConvolver convolver(2, 2, 1000, 128);
+	std::vector<float> impulse(1000);
+	for(size_t i = 0; i < impulse.size(); ++i)
+		impulse[i] = randomSample();
+	for(size_t i = 0; i < 2; ++i)
+		convolver.setImpulse(i, i, &impulse[0], impulse.size());
+
+	std::vector<float> input(frames * 2), first(frames * 2), second(frames * 2);
+	for(size_t i = 0; i < input.size(); ++i)
+		input[i] = randomSample();
+	convolver.process(&input[0], 300, &first[0]);
+	convolver.process(&input[300 * 2], frames - 300, &first[300 * 2]);
+	convolver.reset();
+	convolver.process(&input[0], 300, &second[0]);
+	convolver.process(&input[300 * 2], frames - 300, &second[300 * 2]);
+	if(first != second) {
+		printf("FAIL: output after reset differs\n");
+		++failures;
+	}
+}
+
+int main() {
+	srand(5);
+	testAgainstDirect();
+	testReset();
+	if(failures)
+		printf("%d failures\n", failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,116 @@
+//
+//  ResamplerBench.cpp
+//  CogAudio Framework
+//
+//  Measures Resampler for speed, as a multiple of real time, and for the
+//  quality of a resampled sine. Stereo runs on one thread, 7.1 on one and
+//  on four.
+//
+
+#include "Resampler.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+static const int seconds = 30;
+static const int blockFrames = 4096;
+static const int runs = 3;
+
+static const double rates[][2] = {
+	{ 44100, 48000 },
+	{ 48000, 44100 },
+	{ 44100, 96000 },
+	{ 96000, 44100 },
+	{ 22050, 48000 },
+	{ 44100, 47999 }
+};
+
+static void makeInput(std::vector<float> &input, int channelCount, double rate, double frequency) {
+	size_t frames = (size_t)(rate * seconds);
+	input.resize(frames * channelCount);
+	for(size_t i = 0; i < frames; ++i) {
+		float s = (float)(0.89 * sin(2.0 * M_PI * frequency * i / rate));
+		for(int c = 0; c < channelCount; ++c)
+			input[i * channelCount + c] = s;
+	}
+}
+
+// Signal to noise ratio of the first channel against the best fitting sine
+// of the given frequency, leaving out the first and last half second
+static double sineSNR(const std::vector<float> &output, int channelCount, size_t frames, double rate, double frequency) {
+	size_t start = (size_t)(rate / 2), end = frames - (size_t)(rate / 2);
+	double ss = 0, sc = 0, cc = 0, ys = 0, yc = 0;
+	for(size_t i = start; i < end; ++i) {
+		double w = 2.0 * M_PI * frequency * i / rate;
+		double s = sin(w), c = cos(w), y = output[i * channelCount];
+		ss += s * s;
+		sc += s * c;
+		cc += c * c;
+		ys += y * s;
+		yc += y * c;
+	}
+	double det = ss * cc - sc * sc;
+	double a = (ys * cc - yc * sc) / det;
+	double b = (yc * ss - ys * sc) / det;
+	double signal = 0, noise = 0;
+	for(size_t i = start; i < end; ++i) {
+		double w = 2.0 * M_PI * frequency * i / rate;
+		double fit = a * sin(w) + b * cos(w);
+		double e = output[i * channelCount] - fit;
+		signal += fit * fit;
+		noise += e * e;
+	}
+	return 10.0 * log10(signal / noise);
+}
+
+// Returns the wall clock time taken, as the work may be spread over threads
+static double runResampler(const std::vector<float> &input, int channelCount, int threadCount, double srcRate, double dstRate, std::vector<float> &output, size_t &frames) {
+	size_t inFrames = input.size() / channelCount;
+	output.resize((size_t)ceil(inFrames * dstRate / srcRate) * channelCount + blockFrames * channelCount);
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	Resampler resampler(channelCount, srcRate, dstRate, threadCount);
+	frames = 0;
+	for(size_t pos = 0; pos < inFrames;) {
+		size_t count = std::min((size_t)blockFrames, inFrames - pos), done;
+		frames += resampler.resample(&input[pos * channelCount], count, &done, &output[frames * channelCount], (output.size() / channelCount) - frames);
+		pos += done;
+	}
+	size_t flushed;
+	while((flushed = resampler.flush(&output[frames * channelCount], (output.size() / channelCount) - frames)) > 0)
+		frames += flushed;
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	static const int layouts[][2] = {
+		{ 2, 1 },
+		{ 8, 1 },
+		{ 8, 4 }
+	};
+
+	printf("%d s, best of %d, 1 kHz sine at -1 dBFS\n", seconds, runs);
+	printf("%-16s %8s %8s %12s %10s\n", "rates", "channels", "threads", "speed", "SNR");
+	for(size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); ++r) {
+		double srcRate = rates[r][0], dstRate = rates[r][1];
+		for(size_t l = 0; l < sizeof(layouts) / sizeof(layouts[0]); ++l) {
+			int channelCount = layouts[l][0], threadCount = layouts[l][1];
+			std::vector<float> input, output;
+			size_t frames = 0;
+			double best = 1e9;
+
+			makeInput(input, channelCount, srcRate, 1000.0);
+			for(int i = 0; i < runs; ++i)
+				best = std::min(best, runResampler(input, channelCount, threadCount, srcRate, dstRate, output, frames));
+
+			char name[32];
+			snprintf(name, sizeof(name), "%g>%g", srcRate, dstRate);
+			printf("%-16s %8d %8d %11.1fx %7.1f dB\n", name, channelCount, threadCount, seconds / best,
+			       sineSNR(output, channelCount, frames, dstRate, 1000.0));
+		}
+	}
+	return 0;
+}
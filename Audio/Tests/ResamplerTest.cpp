@@ -0,0 +1,98 @@
+//
+//  ResamplerTest.cpp
+//  CogAudio Framework
+//
+//  Checks that Resampler outputs the same stream however the input and the
+//  output are cut into blocks and however many threads it uses, and that it
+//  outputs exactly ceil(input frames * ratio) frames, up to ratios where one
+//  output frame steps over more input than the filter spans.
+//
+
+#include "Resampler.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+static std::mt19937 rng(42);
+static int failures = 0;
+
+#define CHECK(cond, ...)                \
+	do {                                \
+		if(!(cond)) {                   \
+			printf("FAIL: " __VA_ARGS__); \
+			printf("\n");               \
+			++failures;                 \
+		}                               \
+	} while(0)
+
+// Runs a whole stream through, with random block sizes on both sides if chunked
+static std::vector<float> run(int channelCount, double srcRate, double dstRate, const std::vector<float> &input, int threadCount, bool chunked) {
+	Resampler resampler(channelCount, srcRate, dstRate, threadCount);
+	size_t frames = input.size() / channelCount;
+	std::vector<float> output, block(70000 * channelCount);
+	for(size_t pos = 0; pos < frames;) {
+		size_t count = chunked ? std::min<size_t>(frames - pos, 1 + rng() % 5000) : frames - pos;
+		size_t outMax = chunked ? 1 + rng() % 3000 : block.size() / channelCount;
+		size_t done = 0;
+		size_t outDone = resampler.resample(&input[pos * channelCount], count, &done, &block[0], outMax);
+		output.insert(output.end(), block.begin(), block.begin() + outDone * channelCount);
+		pos += done;
+	}
+	for(;;) {
+		size_t outMax = chunked ? 1 + rng() % 3000 : block.size() / channelCount;
+		size_t outDone = resampler.flush(&block[0], outMax);
+		if(!outDone)
+			break;
+		output.insert(output.end(), block.begin(), block.begin() + outDone * channelCount);
+	}
+	CHECK(resampler.latency() == 0, "%g>%g latency left after flush", srcRate, dstRate);
+	return output;
+}
+
+int main() {
+	static const double rates[][2] = {
+		{ 44100, 48000 },
+		{ 48000, 44100 },
+		{ 44100, 96000 },
+		{ 192000, 44100 },
+		{ 352800, 44100 },
+		{ 44100, 47999 },
+		{ 44100.5, 48000 },
+		{ 22050, 192000 },
+		{ 8000, 44100 },
+		// The filter is cut short at the longest length allowed
+		{ 768000, 8000 },
+		{ 5644800, 11025 },
+		// Each output frame steps over more input than the filter spans
+		{ 22579200, 1000 },
+		{ 48000000, 2205 }
+	};
+
+	std::uniform_real_distribution<float> noise(-1.0f, 1.0f);
+	for(size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); ++r) {
+		double srcRate = rates[r][0], dstRate = rates[r][1];
+		const int channelCount = 3;
+		size_t frames = 30000 + rng() % 1000;
+		if(srcRate / dstRate > 50)
+			frames *= 20;
+		std::vector<float> input(frames * channelCount);
+		for(size_t i = 0; i < input.size(); ++i)
+			input[i] = noise(rng);
+
+		std::vector<float> whole = run(channelCount, srcRate, dstRate, input, 1, false);
+		std::vector<float> chunked = run(channelCount, srcRate, dstRate, input, 1, true);
+		std::vector<float> threaded = run(channelCount, srcRate, dstRate, input, 3, true);
+		size_t expected = (size_t)ceil(frames * dstRate / srcRate - 1e-9);
+		CHECK(whole.size() / channelCount == expected, "%g>%g output %zu frames, expected %zu", srcRate, dstRate, whole.size() / channelCount, expected);
+		CHECK(chunked == whole, "%g>%g differs when chunked", srcRate, dstRate);
+		CHECK(threaded == whole, "%g>%g differs when threaded", srcRate, dstRate);
+	}
+
+	if(failures)
+		printf("%d failures\n", failures);
+	return failures ? 1 : 0;
+}
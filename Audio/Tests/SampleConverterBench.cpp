@@ -0,0 +1,74 @@
+//
+//  SampleConverterBench.cpp
+//  CogAudio Framework
+//
+//  Measures SampleConverter against a model of the pass per step chain it
+//  replaced, which copied the input, swapped it, converted it and moved the
+//  result back, in Msamples/s.
+//
+
+#include "SampleConverter.h"
+#include "SampleConverterReference.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+
+static const size_t blockSamples = 32768;
+static const int runs = 2000;
+
+static double elapsed(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	static const struct {
+		const char *name;
+		uint32_t bitsPerSample;
+		bool isFloat;
+		bool isBigEndian;
+	} formats[] = {
+		{ "s8", 8, false, false },
+		{ "s16", 16, false, false },
+		{ "s16be", 16, false, true },
+		{ "s24", 24, false, false },
+		{ "s24be", 24, false, true },
+		{ "s32", 32, false, false },
+		{ "s32be", 32, false, true },
+		{ "f32be", 32, true, true },
+		{ "f64", 64, true, false }
+	};
+
+	std::vector<uint8_t> input(blockSamples * 8), scratch(blockSamples * 8);
+	std::vector<float> output(blockSamples);
+	for(size_t i = 0; i < input.size(); ++i)
+		input[i] = (uint8_t)rand();
+
+	printf("%-6s %12s %12s\n", "format", "new", "old");
+	for(size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f) {
+		uint32_t bitsPerSample = formats[f].bitsPerSample;
+		bool isFloat = formats[f].isFloat, isBigEndian = formats[f].isBigEndian;
+		size_t bytes = referenceSampleSize(bitsPerSample, isFloat);
+		SampleConverterFunc convert = sampleConverterForFormat(bitsPerSample, isFloat, false, isBigEndian);
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for(int r = 0; r < runs; ++r) {
+			convert(&output[0], &input[0], blockSamples);
+			__asm__ volatile("" : : "r"(&output[0]) : "memory");
+		}
+		double newTime = elapsed(start);
+
+		start = std::chrono::steady_clock::now();
+		for(int r = 0; r < runs; ++r) {
+			memcpy(&scratch[0], &input[0], blockSamples * bytes);
+			referenceConvert(&output[0], &scratch[0], blockSamples, bitsPerSample, isFloat, false, isBigEndian);
+			memmove(&scratch[0], &output[0], blockSamples * sizeof(float));
+			__asm__ volatile("" : : "r"(&scratch[0]) : "memory");
+		}
+		double oldTime = elapsed(start);
+
+		printf("%-6s %12.0f %12.0f\n", formats[f].name, blockSamples * runs / newTime / 1e6, blockSamples * runs / oldTime / 1e6);
+	}
+	return 0;
+}
@@ -0,0 +1,64 @@
+//
+//  SampleConverterReference.h
+//  CogAudio Framework
+//
+//  Scalar model of the conversion chain ConverterNode used before
+//  SampleConverter: byte swap, widen to a 16 or 32 bit container, convert
+//  to float and scale. Shared by the SampleConverter test and benchmark.
+//
+
+#ifndef SampleConverterReference_h
+#define SampleConverterReference_h
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+static inline size_t referenceSampleSize(uint32_t bitsPerSample, bool isFloat) {
+	return isFloat ? bitsPerSample / 8 : (bitsPerSample + 7) / 8;
+}
+
+static void referenceConvert(float *output, const uint8_t *input, size_t count, uint32_t bitsPerSample, bool isFloat, bool isUnsigned, bool isBigEndian) {
+	size_t bytes = referenceSampleSize(bitsPerSample, isFloat);
+	std::vector<uint8_t> data(input, input + count * bytes);
+	if(isBigEndian) {
+		for(size_t i = 0; i < count; ++i)
+			std::reverse(&data[i * bytes], &data[i * bytes] + bytes);
+	}
+	for(size_t i = 0; i < count; ++i) {
+		const uint8_t *p = &data[i * bytes];
+		if(isFloat) {
+			if(bytes == 4) {
+				float f;
+				memcpy(&f, p, 4);
+				output[i] = f;
+			} else {
+				double d;
+				memcpy(&d, p, 8);
+				output[i] = (float)d;
+			}
+		} else if(bytes == 1) {
+			uint16_t s = (uint16_t)((p[0] << 8) | p[0]);
+			if(isUnsigned) s ^= 0x8080;
+			output[i] = (float)(int16_t)s / 32768.0f;
+		} else if(bytes == 2) {
+			int16_t s;
+			memcpy(&s, p, 2);
+			if(isUnsigned) s ^= 0x8000;
+			output[i] = (float)s / 32768.0f;
+		} else if(bytes == 3) {
+			int32_t s = (int32_t)(((uint32_t)p[0] << 8) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 24));
+			if(isUnsigned) s ^= (int32_t)0x80000000;
+			output[i] = (float)s / 2147483648.0f;
+		} else {
+			int32_t s;
+			memcpy(&s, p, 4);
+			if(isUnsigned) s ^= (int32_t)0x80000000;
+			output[i] = (float)s / 2147483648.0f;
+		}
+	}
+}
+
+#endif /* SampleConverterReference_h */
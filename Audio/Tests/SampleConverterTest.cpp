@@ -0,0 +1,146 @@
+//
+//  SampleConverterTest.cpp
+//  CogAudio Framework
+//
+//  Checks every SampleConverter kernel for bit exact agreement with the
+//  conversion chain it replaced, on random data, with unaligned input and
+//  output and odd lengths, and in place for 32 and 64 bit input.
+//
+
+#include "SampleConverter.h"
+#include "SampleConverterReference.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static int failures = 0;
+
+static void fail(const char *what, uint32_t bitsPerSample, bool isFloat, bool isUnsigned, bool isBigEndian) {
+	printf("FAIL: %s, %u bit %s%s%s\n", what, bitsPerSample, isFloat ? "float" : "int",
+	       isUnsigned ? " unsigned" : "", isBigEndian ? " big endian" : "");
+	++failures;
+}
+
+// Random floats in -1.5 to 1.5, with integers the raw bytes are random
+static void fillInput(std::vector<uint8_t> &input, size_t offset, size_t count, uint32_t bitsPerSample, bool isFloat, bool isBigEndian) {
+	for(size_t i = 0; i < input.size(); ++i)
+		input[i] = (uint8_t)rand();
+	if(!isFloat)
+		return;
+	size_t bytes = bitsPerSample / 8;
+	for(size_t i = 0; i < count; ++i) {
+		uint8_t sample[8];
+		double value = (rand() / (double)RAND_MAX - 0.5) * 3.0;
+		if(bytes == 4) {
+			float f = (float)value;
+			memcpy(sample, &f, 4);
+		} else {
+			memcpy(sample, &value, 8);
+		}
+		if(isBigEndian)
+			std::reverse(sample, sample + bytes);
+		memcpy(&input[offset + i * bytes], sample, bytes);
+	}
+}
+
+static void testFloatConverters() {
+	static const struct {
+		uint32_t bitsPerSample;
+		bool isFloat;
+	} formats[] = {
+		{ 8, false }, { 12, false }, { 16, false }, { 20, false }, { 24, false }, { 32, false }, { 32, true }, { 64, true }
+	};
+
+	for(size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f) {
+		uint32_t bitsPerSample = formats[f].bitsPerSample;
+		bool isFloat = formats[f].isFloat;
+		for(int isUnsigned = 0; isUnsigned < 2; ++isUnsigned) {
+			if(isFloat && isUnsigned)
+				continue;
+			for(int isBigEndian = 0; isBigEndian < 2; ++isBigEndian) {
+				SampleConverterFunc convert = sampleConverterForFormat(bitsPerSample, isFloat, isUnsigned, isBigEndian);
+				if(!convert) {
+					fail("no converter", bitsPerSample, isFloat, isUnsigned, isBigEndian);
+					continue;
+				}
+				size_t bytes = referenceSampleSize(bitsPerSample, isFloat);
+				for(int trial = 0; trial < 200; ++trial) {
+					size_t count = rand() % 300, offset = rand() % 8, outOffset = trial & 1;
+					std::vector<uint8_t> input(count * bytes + 16);
+					fillInput(input, offset, count, bitsPerSample, isFloat, isBigEndian);
+					std::vector<float> expected(count + 1), output(count + 1);
+					referenceConvert(&expected[0], &input[offset], count, bitsPerSample, isFloat, isUnsigned, isBigEndian);
+					convert(&output[outOffset], &input[offset], count);
+					if(memcmp(&expected[0], &output[outOffset], count * sizeof(float))) {
+						fail("mismatch", bitsPerSample, isFloat, isUnsigned, isBigEndian);
+						break;
+					}
+				}
+			}
+		}
+	}
+}
+
+// The HDCD path takes 16 bit range integers
+static void testInt32Converters() {
+	static const uint32_t formats[] = { 8, 16 };
+	for(size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f) {
+		uint32_t bitsPerSample = formats[f];
+		for(int isUnsigned = 0; isUnsigned < 2; ++isUnsigned) {
+			for(int isBigEndian = 0; isBigEndian < 2; ++isBigEndian) {
+				SampleConverterInt32Func convert = sampleConverterInt32ForFormat(bitsPerSample, isUnsigned, isBigEndian);
+				if(!convert) {
+					fail("no int32 converter", bitsPerSample, false, isUnsigned, isBigEndian);
+					continue;
+				}
+				const size_t count = 1001;
+				std::vector<uint8_t> input(count * bitsPerSample / 8);
+				fillInput(input, 0, count, bitsPerSample, false, isBigEndian);
+				std::vector<int32_t> output(count);
+				std::vector<float> expected(count);
+				convert(&output[0], &input[0], count);
+				referenceConvert(&expected[0], &input[0], count, bitsPerSample, false, isUnsigned, isBigEndian);
+				for(size_t i = 0; i < count; ++i) {
+					if((float)output[i] / 32768.0f != expected[i]) {
+						fail("int32 mismatch", bitsPerSample, false, isUnsigned, isBigEndian);
+						break;
+					}
+				}
+			}
+		}
+	}
+}
+
+static void testInPlace() {
+	const size_t count = 1001;
+	{
+		std::vector<int32_t> samples(count);
+		for(size_t i = 0; i < count; ++i)
+			samples[i] = (int32_t)((uint32_t)rand() * 2654435761U);
+		std::vector<float> expected(count);
+		referenceConvert(&expected[0], (const uint8_t *)&samples[0], count, 32, false, false, false);
+		sampleConverterForFormat(32, false, false, false)((float *)&samples[0], &samples[0], count);
+		if(memcmp(&expected[0], &samples[0], count * sizeof(float)))
+			fail("in place mismatch", 32, false, false, false);
+	}
+	{
+		std::vector<double> samples(count);
+		for(size_t i = 0; i < count; ++i)
+			samples[i] = rand() / (double)RAND_MAX - 0.5;
+		std::vector<float> expected(count);
+		referenceConvert(&expected[0], (const uint8_t *)&samples[0], count, 64, true, false, false);
+		sampleConverterForFormat(64, true, false, false)((float *)&samples[0], &samples[0], count);
+		if(memcmp(&expected[0], &samples[0], count * sizeof(float)))
+			fail("in place mismatch", 64, true, false, false);
+	}
+}
+
+int main() {
+	srand(1);
+	testFloatConverters();
+	testInt32Converters();
+	testInPlace();
+	if(failures)
+		printf("%d failures\n", failures);
+	return failures ? 1 : 0;
+}
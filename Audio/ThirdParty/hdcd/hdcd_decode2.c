@@ -36,6 +36,14 @@
 #include <stdio.h>
 #include <string.h>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define HDCD_SSE2
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__)
+#include <arm_neon.h>
+#define HDCD_NEON
+#endif
+
 static const uint32_t peaktab[] = {
     0x2cc08300, 0x2cc10600, 0x2cc18900, 0x2cc20c00, 0x2cc28f00, 0x2cc31200, 0x2cc39500, 0x2cc41800, 0x2cc49b00, 0x2cc51e00, 0x2cc5a100, 0x2cc62400, 0x2cc6a700, 0x2cc72a00, 0x2cc7ad00, 0x2cc83000,
     0x2cc8b300, 0x2cc93600, 0x2cc9b900, 0x2cca3c00, 0x2ccabf00, 0x2ccb4200, 0x2ccbc500, 0x2ccc4800, 0x2ccccb00, 0x2ccd4e00, 0x2ccdd100, 0x2cce5400, 0x2cced700, 0x2ccf5a00, 0x2ccfdd00, 0x2cd06000,
@@ -1004,52 +1012,60 @@ static int hdcd_scan_stereo(hdcd_state_stereo_t *state, const int32_t *samples,
     return result;
 }
 
-static int hdcd_envelope(int32_t *samples, int count, int stride, int gain, int target_gain, int extend)
+static inline int32_t hdcd_peak_extend(int32_t sample)
 {
-    int i;
-
-    if (extend) {
-        for (i = 0; i < count; i++) {
-            int32_t sample = samples[i * stride];
-            int32_t asample = abs(sample) - 0x5981;
-            if (asample >= 0)
-                sample = sample >= 0 ? peaktab[asample] : -peaktab[asample];
-            else
-                sample <<= 15;
+    int32_t asample = abs(sample) - 0x5981;
+    if (asample >= 0)
+        return sample >= 0 ? peaktab[asample] : -peaktab[asample];
+    return (int32_t)((uint32_t)sample << 15);
+}
 
-            samples[i * stride] = sample;
-        }
-    } else {
-        for (i = 0; i < count; i++)
-            samples[i * stride] <<= 15;
-    }
+/* one pass over the run: each sample is shifted or peak extended, then
+ * takes the gain, which steps towards the target and then holds */
+static int hdcd_envelope(int32_t *samples, int count, int stride, int gain, int target_gain, int extend)
+{
+    int i = 0;
 
     if (gain > target_gain) {
-        for (i = 0; i < count && gain > target_gain; i++) {
+        for (; i < count && gain > target_gain; i++) {
+            int32_t sample = extend ? hdcd_peak_extend(samples[i * stride]) : (int32_t)((uint32_t)samples[i * stride] << 15);
             gain = (int32_t)((((int64_t)gain) * 8384836) >> 23);
             if (gain < target_gain) gain = target_gain;
-            APPLY_GAIN(*samples, gain);
-            samples += stride;
+            APPLY_GAIN(sample, gain);
+            samples[i * stride] = sample;
         }
-        count -= i;
     } else if (gain < target_gain) {
-        for (i = 0; i < count && gain < target_gain; i++) {
+        for (; i < count && gain < target_gain; i++) {
+            int32_t sample = extend ? hdcd_peak_extend(samples[i * stride]) : (int32_t)((uint32_t)samples[i * stride] << 15);
             gain = (int32_t)((((int64_t)gain) * 8418843) >> 23);
             if (gain > target_gain) gain = target_gain;
-            APPLY_GAIN(*samples, gain);
-            samples += stride;
+            APPLY_GAIN(sample, gain);
+            samples[i * stride] = sample;
         }
-        count -= i;
     }
 
     /* hold a steady level */
     if (gain == 0x800000) {
-        if (count > 0)
-            samples += count * stride;
+        if (extend) {
+            for (; i < count; i++)
+                samples[i * stride] = hdcd_peak_extend(samples[i * stride]);
+        } else {
+            for (; i < count; i++)
+                samples[i * stride] = (int32_t)((uint32_t)samples[i * stride] << 15);
+        }
     } else {
-        while (--count >= 0) {
-            APPLY_GAIN(*samples, gain);
-            samples += stride;
+        if (extend) {
+            for (; i < count; i++) {
+                int32_t sample = hdcd_peak_extend(samples[i * stride]);
+                APPLY_GAIN(sample, gain);
+                samples[i * stride] = sample;
+            }
+        } else {
+            for (; i < count; i++) {
+                int32_t sample = (int32_t)((uint32_t)samples[i * stride] << 15);
+                APPLY_GAIN(sample, gain);
+                samples[i * stride] = sample;
+            }
         }
     }
 
@@ -1144,6 +1160,124 @@ void hdcd_process_stereo(hdcd_state_stereo_t *state, int32_t *samples, int count
     state->channel[1].running_gain = gain[1];
 }
 
+/* no code in effect or pending, and the gain settled at unity, so the
+ * decoder would only shift the samples up */
+static int hdcd_idle(const hdcd_state_t *state)
+{
+    return !state->sustain && !state->arg && !state->control && state->running_gain == 0x800000;
+}
+
+static uint32_t hdcd_reverse_bits(uint32_t x)
+{
+    x = (x >> 1 & 0x55555555) | (x & 0x55555555) << 1;
+    x = (x >> 2 & 0x33333333) | (x & 0x33333333) << 2;
+    x = (x >> 4 & 0x0f0f0f0f) | (x & 0x0f0f0f0f) << 4;
+    x = (x >> 8 & 0x00ff00ff) | (x & 0x00ff00ff) << 8;
+    return x >> 16 | x << 16;
+}
+
+/* LSBs of count (up to 32) stereo frames, the first frame in the highest bit */
+static void hdcd_lsbs_stereo(const int16_t *samples, int count, uint32_t *bits0, uint32_t *bits1)
+{
+    uint32_t b0 = 0, b1 = 0;
+    int i = 0;
+
+#if defined(HDCD_SSE2)
+    if (count == 32) {
+        for (; i < 32; i += 8) {
+            /* a frame is one 32-bit lane, left LSB at bit 0 and right at 16;
+             * both are moved up to the sign bit and packed down to bytes */
+            const __m128i a = _mm_loadu_si128((const __m128i *)(samples + i * 2));
+            const __m128i b = _mm_loadu_si128((const __m128i *)(samples + i * 2 + 8));
+            const __m128i left = _mm_packs_epi32(_mm_slli_epi32(a, 31), _mm_slli_epi32(b, 31));
+            const __m128i right = _mm_packs_epi32(_mm_slli_epi32(a, 15), _mm_slli_epi32(b, 15));
+            const uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(left, right));
+            b0 |= (mask & 0xff) << i;
+            b1 |= (mask >> 8) << i;
+        }
+        *bits0 = hdcd_reverse_bits(b0);
+        *bits1 = hdcd_reverse_bits(b1);
+        return;
+    }
+#elif defined(HDCD_NEON)
+    static const int16_t shifts[8] = { 7, 6, 5, 4, 3, 2, 1, 0 };
+    const int16x8_t shift = vld1q_s16(shifts);
+    const uint16x8_t one = vdupq_n_u16(1);
+    for (; i + 8 <= count; i += 8) {
+        const int16x8x2_t frames = vld2q_s16(samples + i * 2);
+        b0 = b0 << 8 | vaddvq_u16(vshlq_u16(vandq_u16(vreinterpretq_u16_s16(frames.val[0]), one), shift));
+        b1 = b1 << 8 | vaddvq_u16(vshlq_u16(vandq_u16(vreinterpretq_u16_s16(frames.val[1]), one), shift));
+    }
+#endif
+    for (; i < count; i++) {
+        b0 = b0 << 1 | (samples[i * 2] & 1);
+        b1 = b1 << 1 | (samples[i * 2 + 1] & 1);
+    }
+    *bits0 = b0;
+    *bits1 = b1;
+}
+
+/* shift count new bits into the window, and report whether a packet prefix
+ * ends on any of them at or past the readahead, where hdcd_integrate could
+ * find it. its skips never pass over a possible prefix, so looking at every
+ * position finds the same ones. */
+static int hdcd_window_prefix(uint64_t *window, uint32_t bits, int count, int readahead)
+{
+    const uint64_t old = *window;
+    const uint64_t next = (old << count) | bits;
+    const uint64_t mask = ((uint64_t)1 << count) - 1;
+    /* descrambled stream, bit s is the word ending s positions back */
+    const uint64_t d = (uint64_t)(uint32_t)(old ^ old >> 5 ^ old >> 23) << count | ((next ^ next >> 5 ^ next >> 23) & mask);
+    const uint64_t z = ~d;
+    /* the prefix, 0x7e0fa00[56], has bits 25-30 set and 20-24 clear */
+    uint64_t candidates = (d >> 25 & d >> 26 & d >> 27 & d >> 28 & d >> 29 & d >> 30) & (z >> 20 & z >> 21 & z >> 22 & z >> 23 & z >> 24) & mask;
+    int s;
+
+    *window = next;
+
+    for (s = 0; candidates; s++, candidates >>= 1) {
+        if (candidates & 1) {
+            const uint32_t word = (uint32_t)(d >> s);
+            if ((word == 0x7e0fa005 || word == 0x7e0fa006) && count - s >= readahead)
+                return 1;
+        }
+    }
+    return 0;
+}
+
+int hdcd_scan_idle_stereo(hdcd_state_stereo_t *state, const int16_t *samples, int count)
+{
+    uint64_t window[2];
+    int readahead[2];
+    int i, c;
+
+    if (!hdcd_idle(&state->channel[0]) || !hdcd_idle(&state->channel[1]))
+        return 0;
+
+    for (c = 0; c < 2; c++) {
+        window[c] = state->channel[c].window;
+        readahead[c] = state->channel[c].readahead;
+    }
+
+    for (i = 0; i < count; i += 32) {
+        const int n = FFMIN(32, count - i);
+        uint32_t bits[2];
+        hdcd_lsbs_stereo(samples + i * 2, n, &bits[0], &bits[1]);
+        for (c = 0; c < 2; c++) {
+            if (hdcd_window_prefix(&window[c], bits[c], n, readahead[c]))
+                return 0;
+            readahead[c] = FFMAX(readahead[c] - n, 1);
+        }
+    }
+
+    /* checking again from the next sample is as good as the skip it was on */
+    for (c = 0; c < 2; c++) {
+        state->channel[c].window = window[c];
+        state->channel[c].readahead = readahead[c];
+    }
+    return 1;
+}
+
 void hdcd_detect_reset(hdcd_detection_data_t *detect) {
     detect->hdcd_detected = 0;
     detect->errors = 0;
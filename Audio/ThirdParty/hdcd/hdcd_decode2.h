@@ -113,6 +113,12 @@ void hdcd_process(hdcd_state_t *state, int *samples, int count, int stride);
 void hdcd_reset_stereo(hdcd_state_stereo_t *state, unsigned rate);
 void hdcd_process_stereo(hdcd_state_stereo_t *state, int *samples, int count);
 
+/* While no code is in effect, decoding only shifts samples up by 15 bits.
+ * Returns 1 if that holds for these native 16-bit frames, as no packet can
+ * start in them, and advances the state past them. Returns 0, leaving the
+ * state as it was, if they must go through hdcd_process_stereo. */
+int hdcd_scan_idle_stereo(hdcd_state_stereo_t *state, const int16_t *samples, int count);
+
 void hdcd_detect_reset(hdcd_detection_data_t *detect);
 void hdcd_detect_str(hdcd_detection_data_t *detect, char *str); /* char str[256] should be enough */
 /* there isn't a non-stereo version */
@@ -17,45 +17,66 @@
 #include <memory.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include "lpc.h"
 
-static void apply_window(float *const data, const size_t data_len) {
-#if 0
-	if (0) // subtract the mean
-	{
-		double mean = 0;
-		for(int i = 0; i < (int)data_len; i++)
-			mean += data[i];
-		mean /= data_len;
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define LPC_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define LPC_NEON
+#endif
+
+/* Channels are worked on four at a time, one per vector lane, so the
+   per sample recursion of the prediction runs for all of them at once.
+   Lane data is stored as [sample][LANES]. */
+#define LANES 4
+
+static size_t scratch_align(size_t size) {
+	return (size + 15) & ~(size_t)15;
+}
 
-		for(int i = 0; i < (int)data_len; i++)
-			data[i] -= (float)mean;
+static void make_window(float *const window, const size_t data_len) {
+	// Welch window
+	const float n2 = (data_len + 1) / 2.0f;
+	for(int i = 0; i < (int)data_len; i++) {
+		float k = (i + 1 - n2) / n2;
+		window[data_len - 1 - i] = 1.0f - k * k;
 	}
-#endif
+}
 
-	if(1) // Welch window
-	{
-		const float n2 = (data_len + 1) / 2.0f;
-		for(int i = 0; i < (int)data_len; i++) {
-			float k = (i + 1 - n2) / n2;
-			data[data_len - 1 - i] *= 1.0f - k * k;
+static void lanes_autocorrelation(const float *data, int n, int m, double *aut) {
+	/* autocorrelation, p+1 lag coefficients, stored as [lane][m+1] */
+	for(int j = 0; j <= m; j++) {
+#if defined(LPC_SSE2)
+		/* double needed for accumulator depth */
+		__m128d d01 = _mm_setzero_pd(), d23 = _mm_setzero_pd();
+		for(int i = j; i < n; i++) {
+			const __m128 a = _mm_loadu_ps(data + i * LANES);
+			const __m128 b = _mm_loadu_ps(data + (i - j) * LANES);
+			d01 = _mm_add_pd(d01, _mm_mul_pd(_mm_cvtps_pd(a), _mm_cvtps_pd(b)));
+			d23 = _mm_add_pd(d23, _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(a, a)), _mm_cvtps_pd(_mm_movehl_ps(b, b))));
 		}
+		double d[LANES];
+		_mm_storeu_pd(d, d01);
+		_mm_storeu_pd(d + 2, d23);
+#else
+		double d[LANES] = { 0 }; /* double needed for accumulator depth */
+		for(int i = j; i < n; i++)
+			for(int l = 0; l < LANES; l++)
+				d[l] += (double)data[i * LANES + l] * data[(i - j) * LANES + l];
+#endif
+		for(int l = 0; l < LANES; l++)
+			aut[l * (m + 1) + j] = d[l];
 	}
 }
 
-static float vorbis_lpc_from_data(float *data, float *lpci, int n, int m, double *aut, double *lpc) {
+static float vorbis_lpc_from_autocorrelation(const double *aut, float *lpci, int m, double *lpc) {
 	double error;
 	double epsilon;
 	int i, j;
 
-	/* autocorrelation, p+1 lag coefficients */
-	j = m + 1;
-	while(j--) {
-		double d = 0; /* double needed for accumulator depth */
-		for(i = j; i < n; i++) d += (double)data[i] * data[i - j];
-		aut[j] = d;
-	}
-
 	/* Generate lpc coefficients from autocorr values */
 
 	/* set our noise floor to about -100dB */
@@ -112,82 +133,152 @@ done:
 	return error;
 }
 
-static void vorbis_lpc_predict(float *coeff, float *prime, int m, float *data, long n, float *work) {
-	/* in: coeff[0...m-1] LPC coefficients
-	       prime[0...m-1] initial values (allocated size of n+m-1)
-	  out: data[0...n-1] data samples */
+static void lanes_predict(const float *coeff, int m, float *work, long n) {
+	/* in: coeff[0...m-1] LPC coefficients of each lane, oldest sample's first
+	       work[0...m-1] initial values (allocated size of n+m)
+	  out: work[m...m+n-1] data samples
 
-	long i, j, o, p;
-	float y;
+	  The newest sample's term is added last, so the sums over the older
+	  ones don't wait on the previous output. */
 
-	if(!prime)
-		for(i = 0; i < m; i++)
-			work[i] = 0.f;
-	else
-		for(i = 0; i < m; i++)
-			work[i] = prime[i];
+	long i;
+	int j;
 
 	for(i = 0; i < n; i++) {
-		y = 0;
-		o = i;
-		p = m;
+		const float *w = work + i * LANES;
+#if defined(LPC_SSE2)
+		__m128 a0 = _mm_setzero_ps(), a1 = _mm_setzero_ps(), a2 = _mm_setzero_ps(), a3 = _mm_setzero_ps();
+		for(j = 0; j + 4 < m; j += 4) {
+			a0 = _mm_add_ps(a0, _mm_mul_ps(_mm_loadu_ps(w + j * LANES), _mm_loadu_ps(coeff + j * LANES)));
+			a1 = _mm_add_ps(a1, _mm_mul_ps(_mm_loadu_ps(w + (j + 1) * LANES), _mm_loadu_ps(coeff + (j + 1) * LANES)));
+			a2 = _mm_add_ps(a2, _mm_mul_ps(_mm_loadu_ps(w + (j + 2) * LANES), _mm_loadu_ps(coeff + (j + 2) * LANES)));
+			a3 = _mm_add_ps(a3, _mm_mul_ps(_mm_loadu_ps(w + (j + 3) * LANES), _mm_loadu_ps(coeff + (j + 3) * LANES)));
+		}
+		for(; j < m - 1; j++)
+			a0 = _mm_add_ps(a0, _mm_mul_ps(_mm_loadu_ps(w + j * LANES), _mm_loadu_ps(coeff + j * LANES)));
+		__m128 y = _mm_add_ps(_mm_add_ps(a0, a1), _mm_add_ps(a2, a3));
+		y = _mm_add_ps(y, _mm_mul_ps(_mm_loadu_ps(w + j * LANES), _mm_loadu_ps(coeff + j * LANES)));
+		_mm_storeu_ps(work + (i + m) * LANES, _mm_sub_ps(_mm_setzero_ps(), y));
+#elif defined(LPC_NEON)
+		float32x4_t a0 = vdupq_n_f32(0), a1 = vdupq_n_f32(0), a2 = vdupq_n_f32(0), a3 = vdupq_n_f32(0);
+		for(j = 0; j + 4 < m; j += 4) {
+			a0 = vmlaq_f32(a0, vld1q_f32(w + j * LANES), vld1q_f32(coeff + j * LANES));
+			a1 = vmlaq_f32(a1, vld1q_f32(w + (j + 1) * LANES), vld1q_f32(coeff + (j + 1) * LANES));
+			a2 = vmlaq_f32(a2, vld1q_f32(w + (j + 2) * LANES), vld1q_f32(coeff + (j + 2) * LANES));
+			a3 = vmlaq_f32(a3, vld1q_f32(w + (j + 3) * LANES), vld1q_f32(coeff + (j + 3) * LANES));
+		}
+		for(; j < m - 1; j++)
+			a0 = vmlaq_f32(a0, vld1q_f32(w + j * LANES), vld1q_f32(coeff + j * LANES));
+		float32x4_t y = vaddq_f32(vaddq_f32(a0, a1), vaddq_f32(a2, a3));
+		y = vmlaq_f32(y, vld1q_f32(w + j * LANES), vld1q_f32(coeff + j * LANES));
+		vst1q_f32(work + (i + m) * LANES, vsubq_f32(vdupq_n_f32(0), y));
+#else
+		float y[LANES] = { 0 };
 		for(j = 0; j < m; j++)
-			y -= work[o++] * coeff[--p];
-
-		data[i] = work[o] = y;
+			for(int l = 0; l < LANES; l++)
+				y[l] -= w[j * LANES + l] * coeff[j * LANES + l];
+		for(int l = 0; l < LANES; l++)
+			work[(i + m) * LANES + l] = y[l];
+#endif
 	}
 }
 
 void lpc_extrapolate2(float *const data, const size_t data_len, const int nch, const int lpc_order, const size_t extra_bkwd, const size_t extra_fwd, void **extrapolate_buffer, size_t *extrapolate_buffer_size) {
-	const size_t tdata_size = sizeof(float) * (extra_bkwd + data_len + extra_fwd);
-	const size_t aut_size = sizeof(double) * (lpc_order + 1);
+	const size_t extra = extra_bkwd + extra_fwd;
+
+	const size_t window_size = scratch_align(sizeof(float) * data_len);
+	const size_t tdata_size = scratch_align(sizeof(float) * LANES * data_len);
+	const size_t work_size = scratch_align(sizeof(float) * LANES * (lpc_order + extra));
+	const size_t coeff_size = scratch_align(sizeof(float) * LANES * lpc_order);
+	const size_t aut_size = sizeof(double) * LANES * (lpc_order + 1);
 	const size_t lpc_size = sizeof(double) * lpc_order;
 	const size_t lpci_size = sizeof(float) * lpc_order;
-	const size_t work_size = sizeof(float) * (extra_bkwd + lpc_order + extra_fwd);
 
-	const size_t new_size = tdata_size + aut_size + lpc_size + lpci_size + work_size;
+	const size_t new_size = window_size + tdata_size + work_size + coeff_size + aut_size + lpc_size + lpci_size;
 
+	// Scratch only, so there is nothing to carry over when it grows
 	if(new_size > *extrapolate_buffer_size) {
-		*extrapolate_buffer = realloc(*extrapolate_buffer, new_size);
-		*extrapolate_buffer_size = new_size;
+		free(*extrapolate_buffer);
+		*extrapolate_buffer = malloc(new_size);
+		*extrapolate_buffer_size = *extrapolate_buffer ? new_size : 0;
 	}
 
-	float *tdata = (float *)(*extrapolate_buffer); // for 1 channel only
+	if(!*extrapolate_buffer) {
+		if(extra_bkwd)
+			memset(data - extra_bkwd * nch, 0, sizeof(float) * extra_bkwd * nch);
+		else
+			memset(data + data_len * nch, 0, sizeof(float) * extra_fwd * nch);
+		return;
+	}
 
-	double *aut = (double *)(*extrapolate_buffer + tdata_size);
-	double *lpc = (double *)(*extrapolate_buffer + tdata_size + aut_size);
-	float *lpci = (float *)(*extrapolate_buffer + tdata_size + aut_size + lpc_size);
-	float *work = (float *)(*extrapolate_buffer + tdata_size + aut_size + lpc_size + lpci_size);
+	uint8_t *scratch = (uint8_t *)(*extrapolate_buffer);
 
-	for(int c = 0; c < nch; c++) {
-		if(extra_bkwd) {
-			for(int i = 0; i < (int)data_len; i++)
-				tdata[data_len - 1 - i] = data[i * nch + c];
-		} else {
-			for(int i = 0; i < (int)data_len; i++)
-				tdata[i] = data[i * nch + c];
+	float *window = (float *)scratch;
+	float *tdata = (float *)(scratch + window_size);
+	float *work = (float *)(scratch + window_size + tdata_size);
+	float *coeff = (float *)(scratch + window_size + tdata_size + work_size);
+	double *aut = (double *)(scratch + window_size + tdata_size + work_size + coeff_size);
+	double *lpc = (double *)(scratch + window_size + tdata_size + work_size + coeff_size + aut_size);
+	float *lpci = (float *)(scratch + window_size + tdata_size + work_size + coeff_size + aut_size + lpc_size);
+
+	make_window(window, data_len);
+
+	const int len = (int)data_len;
+
+#if defined(LPC_SSE2)
+	// The damped prediction decays into denormals, which are slow here
+	const unsigned int csr = _mm_getcsr();
+	_mm_setcsr(csr | 0x8040);
+#endif
+
+	for(int c0 = 0; c0 < nch; c0 += LANES) {
+		const int lanes = (nch - c0 < LANES) ? nch - c0 : LANES;
+
+		// Gather, in the direction of extrapolation
+		for(int i = 0; i < len; i++) {
+			const float *in = data + (extra_bkwd ? (len - 1 - i) : i) * nch + c0;
+			int l;
+			for(l = 0; l < lanes; l++)
+				tdata[i * LANES + l] = in[l];
+			for(; l < LANES; l++)
+				tdata[i * LANES + l] = 0.0f;
 		}
 
-		apply_window(tdata, data_len);
-		vorbis_lpc_from_data(tdata, lpci, (int)data_len, lpc_order, aut, lpc);
+		// Prime with the last samples before windowing
+		for(int i = 0; i < lpc_order; i++) {
+			const int p = len - lpc_order + i;
+			for(int l = 0; l < LANES; l++)
+				work[i * LANES + l] = (p >= 0) ? tdata[p * LANES + l] : 0.0f;
+		}
 
-		// restore after apply_window
-		if(extra_bkwd) {
-			for(int i = 0; i < (int)data_len; i++)
-				tdata[data_len - 1 - i] = data[i * nch + c];
-		} else {
-			for(int i = 0; i < (int)data_len; i++)
-				tdata[i] = data[i * nch + c];
+		for(int i = 0; i < len; i++)
+			for(int l = 0; l < LANES; l++)
+				tdata[i * LANES + l] *= window[i];
+
+		lanes_autocorrelation(tdata, len, lpc_order, aut);
+
+		memset(coeff, 0, sizeof(float) * LANES * lpc_order);
+		for(int l = 0; l < lanes; l++) {
+			vorbis_lpc_from_autocorrelation(aut + l * (lpc_order + 1), lpci, lpc_order, lpc);
+			for(int j = 0; j < lpc_order; j++)
+				coeff[j * LANES + l] = lpci[lpc_order - 1 - j];
 		}
 
-		vorbis_lpc_predict(lpci, tdata + data_len - lpc_order, lpc_order, tdata + data_len, extra_fwd + extra_bkwd, work);
+		lanes_predict(coeff, lpc_order, work, (long)extra);
 
+		const float *out = work + lpc_order * LANES;
 		if(extra_bkwd) {
-			for(int i = 0; i < extra_bkwd; i++)
-				data[(-i - 1) * nch + c] = tdata[data_len + i];
+			for(int i = 0; i < (int)extra_bkwd; i++)
+				for(int l = 0; l < lanes; l++)
+					data[(-i - 1) * nch + c0 + l] = out[i * LANES + l];
 		} else {
-			for(int i = 0; i < extra_fwd; i++)
-				data[(i + data_len) * nch + c] = tdata[data_len + i];
+			for(int i = 0; i < (int)extra_fwd; i++)
+				for(int l = 0; l < lanes; l++)
+					data[(i + data_len) * nch + c0 + l] = out[i * LANES + l];
 		}
 	}
+
+#if defined(LPC_SSE2)
+	_mm_setcsr(csr);
+#endif
 }
@@ -0,0 +1,274 @@
+//
+//  AudioRingBuffer.cpp
+//  CogAudio Framework
+//
+
+#include "AudioRingBuffer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static uint8_t *allocateData(size_t size) {
+	void *ret = NULL;
+	if(posix_memalign(&ret, 16, size) != 0) {
+		return NULL;
+	}
+	return (uint8_t *)ret;
+}
+
+AudioRingBuffer::Storage *AudioRingBuffer::createStorage(size_t size, uint64_t base) {
+	Storage *storage = new Storage;
+	storage->size = align(size);
+	storage->data = allocateData(storage->size);
+	if(!storage->data)
+		storage->size = 0;
+	storage->base = base;
+	storage->next.store(NULL, std::memory_order_relaxed);
+	return storage;
+}
+
+void AudioRingBuffer::freeStorage(Storage *storage) {
+	free(storage->data);
+	delete storage;
+}
+
+AudioRingBuffer::AudioRingBuffer(size_t capacity)
+: writePos(0), readPos(0), writeTime(0.0), readTime(0.0), discardSequence(0), discardPos(0), discardTime(0.0), formatValid(false), writeFrameSize(0), writeSampleRate(0.0), reservedFrames(0), reservedPadding(0), readOffset(0), readFrameSize(0), readSampleRate(0.0) {
+	writeStorage = readStorage = createStorage(capacity, 0);
+}
+
+AudioRingBuffer::~AudioRingBuffer() {
+	while(readStorage) {
+		Storage *next = readStorage->next.load(std::memory_order_relaxed);
+		freeStorage(readStorage);
+		readStorage = next;
+	}
+}
+
+size_t AudioRingBuffer::capacity() const {
+	return writeStorage->size;
+}
+
+bool AudioRingBuffer::resize(size_t capacity) {
+	Storage *storage = createStorage(capacity, writePos.load(std::memory_order_relaxed));
+	if(!storage->data) {
+		freeStorage(storage);
+		return false;
+	}
+
+	// Published before any record written to it, which the consumer only
+	// looks for after seeing that record
+	writeStorage->next.store(storage, std::memory_order_release);
+	writeStorage = storage;
+	return true;
+}
+
+// Finds room for a record, wrapping to the start of the buffer if it would not fit before the end
+uint8_t *AudioRingBuffer::prepare(size_t size) {
+	const Storage *storage = writeStorage;
+	const size_t recordSize = sizeof(Header) + align(size);
+	if(!storage->data || recordSize > storage->size)
+		return NULL;
+
+	const uint64_t pos = writePos.load(std::memory_order_relaxed);
+	const size_t index = (pos - storage->base) % storage->size;
+	const size_t padding = (storage->size - index < recordSize) ? storage->size - index : 0;
+
+	// Records still unread in older storage take no room here
+	const uint64_t read = readPos.load(std::memory_order_acquire);
+	const uint64_t start = read > storage->base ? read : storage->base;
+	if(pos + padding + recordSize - start > storage->size)
+		return NULL;
+
+	reservedPadding = padding;
+	return storage->data + (pos + padding - storage->base) % storage->size + sizeof(Header);
+}
+
+void AudioRingBuffer::publish(uint32_t type, size_t size, double endTime) {
+	uint64_t pos = writePos.load(std::memory_order_relaxed);
+
+	if(reservedPadding) {
+		Header *h = header(writeStorage, pos);
+		h->type = recordPadding;
+		h->size = (uint32_t)(reservedPadding - sizeof(Header));
+		pos += reservedPadding;
+		reservedPadding = 0;
+	}
+
+	Header *h = header(writeStorage, pos);
+	h->type = type;
+	h->size = (uint32_t)size;
+	h->endTime = endTime;
+
+	writePos.store(pos + sizeof(Header) + align(size), std::memory_order_release);
+}
+
+bool AudioRingBuffer::writeFormat(const void *format, size_t size, size_t bytesPerFrame, double sampleRate) {
+	if(size > maxFormatSize || !bytesPerFrame || sampleRate <= 0.0)
+		return false;
+
+	uint8_t *p = prepare(sizeof(FormatHeader) + size);
+	if(!p)
+		return false;
+
+	FormatHeader *f = (FormatHeader *)p;
+	f->sampleRate = sampleRate;
+	f->bytesPerFrame = bytesPerFrame;
+	memcpy(f + 1, format, size);
+
+	publish(recordFormat, sizeof(FormatHeader) + size, writeTime.load(std::memory_order_relaxed));
+
+	formatValid = true;
+	writeFrameSize = bytesPerFrame;
+	writeSampleRate = sampleRate;
+	return true;
+}
+
+void *AudioRingBuffer::reserve(size_t frameCount) {
+	if(!formatValid)
+		return NULL;
+
+	uint8_t *p = prepare(frameCount * writeFrameSize);
+	if(p)
+		reservedFrames = frameCount;
+	return p;
+}
+
+void AudioRingBuffer::commit(size_t frameCount) {
+	if(frameCount > reservedFrames)
+		frameCount = reservedFrames;
+	reservedFrames = 0;
+
+	if(!frameCount) {
+		reservedPadding = 0;
+		return;
+	}
+
+	// The time goes first, so the consumer can never get ahead of it
+	const double endTime = writeTime.load(std::memory_order_relaxed) + (double)frameCount / writeSampleRate;
+	writeTime.store(endTime, std::memory_order_release);
+
+	publish(recordSamples, frameCount * writeFrameSize, endTime);
+}
+
+void AudioRingBuffer::discard() {
+	const uint32_t sequence = discardSequence.load(std::memory_order_relaxed);
+	discardSequence.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	discardPos.store(writePos.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	discardTime.store(writeTime.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	discardSequence.store(sequence + 2, std::memory_order_release);
+
+	formatValid = false;
+	reservedFrames = 0;
+	reservedPadding = 0;
+}
+
+// Skips whatever the producer discarded
+void AudioRingBuffer::catchUp() {
+	uint64_t pos;
+	double time;
+	for(;;) {
+		const uint32_t sequence = discardSequence.load(std::memory_order_acquire);
+		if(sequence & 1)
+			continue;
+		pos = discardPos.load(std::memory_order_relaxed);
+		time = discardTime.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if(discardSequence.load(std::memory_order_relaxed) == sequence)
+			break;
+	}
+
+	if(pos > readPos.load(std::memory_order_relaxed)) {
+		readOffset = 0;
+		readTime.store(time, std::memory_order_release);
+		readPos.store(pos, std::memory_order_release);
+	}
+}
+
+// Moves on to the storage holding pos, freeing any storage left behind
+void AudioRingBuffer::followStorage(uint64_t pos) {
+	Storage *next;
+	while((next = readStorage->next.load(std::memory_order_acquire)) && next->base <= pos) {
+		freeStorage(readStorage);
+		readStorage = next;
+	}
+}
+
+// Moves to the next record holding frames, taking in any format change on the way
+bool AudioRingBuffer::nextSamples() {
+	catchUp();
+
+	uint64_t pos = readPos.load(std::memory_order_relaxed);
+	while(pos < writePos.load(std::memory_order_acquire)) {
+		followStorage(pos);
+
+		const Header *h = header(readStorage, pos);
+		if(h->type == recordSamples)
+			return true;
+
+		if(h->type == recordFormat) {
+			const FormatHeader *f = (const FormatHeader *)(h + 1);
+			readFrameSize = (size_t)f->bytesPerFrame;
+			readSampleRate = f->sampleRate;
+			memcpy(readFormat, f + 1, h->size - sizeof(FormatHeader));
+		}
+
+		pos += sizeof(Header) + align(h->size);
+		readPos.store(pos, std::memory_order_release);
+	}
+
+	return false;
+}
+
+const void *AudioRingBuffer::peekFormat() {
+	return nextSamples() ? readFormat : NULL;
+}
+
+const void *AudioRingBuffer::read(size_t maxFrames, size_t *frameCount, const void **format) {
+	*frameCount = 0;
+	if(!nextSamples())
+		return NULL;
+
+	const Header *h = header(readStorage, readPos.load(std::memory_order_relaxed));
+	const size_t framesLeft = (h->size - readOffset) / readFrameSize;
+
+	*frameCount = framesLeft < maxFrames ? framesLeft : maxFrames;
+	if(format)
+		*format = readFormat;
+	return (const uint8_t *)(h + 1) + readOffset;
+}
+
+void AudioRingBuffer::consume(size_t frameCount) {
+	if(!frameCount)
+		return;
+
+	const uint64_t pos = readPos.load(std::memory_order_relaxed);
+	const Header *h = header(readStorage, pos);
+
+	readOffset += frameCount * readFrameSize;
+	if(readOffset >= h->size) {
+		readOffset = 0;
+		readTime.store(h->endTime, std::memory_order_release);
+		readPos.store(pos + sizeof(Header) + align(h->size), std::memory_order_release);
+	} else {
+		const size_t framesLeft = (h->size - readOffset) / readFrameSize;
+		readTime.store(h->endTime - (double)framesLeft / readSampleRate, std::memory_order_release);
+	}
+}
+
+uint64_t AudioRingBuffer::readPosition() const {
+	return readPos.load(std::memory_order_acquire);
+}
+
+double AudioRingBuffer::duration() const {
+	const double written = writeTime.load(std::memory_order_acquire);
+	const double read = readTime.load(std::memory_order_acquire);
+	const double discarded = discardTime.load(std::memory_order_acquire);
+	const double done = read > discarded ? read : discarded;
+	return written > done ? written - done : 0.0;
+}
+
+bool AudioRingBuffer::empty() const {
+	return duration() <= 0.0;
+}
@@ -0,0 +1,149 @@
+//
+//  AudioRingBuffer.h
+//  CogAudio Framework
+//
+
+#ifndef AudioRingBuffer_h
+#define AudioRingBuffer_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+// Lock free ring buffer of audio frames, for exactly one producer thread and
+// one consumer thread.
+//
+// Frames are written in records, each preceded by a small header, and a
+// format record precedes the first frames written after every change of
+// format, so the consumer always knows what it is reading. The format itself
+// is an opaque blob of up to maxFormatSize bytes, of which the buffer only
+// needs the frame size and sample rate.
+//
+// The producer writes straight into the buffer with reserve() and commit(),
+// and the consumer reads straight from it with read() and consume(). Records
+// never wrap, so both get contiguous memory.
+//
+// discard() lets the producer drop everything buffered so far. The consumer
+// skips the dropped records on its next read, and the space only becomes
+// free again after that, but duration() and empty() see it at once.
+//
+// resize() never waits for the consumer. Records already written stay in the
+// old storage, and the consumer moves on to the new one, freeing the old,
+// once it has read up to where the switch happened.
+class AudioRingBuffer {
+	public:
+	enum {
+		maxFormatSize = 128
+	};
+
+	explicit AudioRingBuffer(size_t capacity);
+	~AudioRingBuffer();
+
+	// Producer side
+
+	size_t capacity() const;
+
+	// Writes everything from here on to new storage. Not to be called between
+	// reserve() and commit()
+	bool resize(size_t capacity);
+
+	bool writeFormat(const void *format, size_t size, size_t bytesPerFrame, double sampleRate);
+
+	// Returns NULL if there is no room, or no format was written since the last discard()
+	void *reserve(size_t frameCount);
+	void commit(size_t frameCount);
+
+	void discard();
+
+	// Consumer side
+
+	// Format of the next frames, or NULL if there are none
+	const void *peekFormat();
+
+	// Returns up to maxFrames contiguous frames of one format, or NULL if there are none
+	const void *read(size_t maxFrames, size_t *frameCount, const void **format);
+	void consume(size_t frameCount);
+
+	// Either side
+
+	// Counts up as the consumer moves on, whether by reading or by skipping
+	// discarded records, so the producer knows when room may have been freed
+	uint64_t readPosition() const;
+
+	double duration() const;
+	bool empty() const;
+
+	private:
+	enum {
+		recordPadding,
+		recordFormat,
+		recordSamples
+	};
+
+	struct Header {
+		uint32_t type;
+		uint32_t size;
+		double endTime;
+	};
+
+	struct FormatHeader {
+		double sampleRate;
+		uint64_t bytesPerFrame;
+	};
+
+	// One block of storage, holding the records from base on until the next
+	// block takes over
+	struct Storage {
+		uint8_t *data;
+		size_t size;
+		uint64_t base;
+		std::atomic<Storage *> next;
+	};
+
+	static size_t align(size_t size) {
+		return (size + 15) & ~(size_t)15;
+	}
+
+	static Storage *createStorage(size_t size, uint64_t base);
+	static void freeStorage(Storage *storage);
+
+	Storage *writeStorage;
+	Storage *readStorage;
+
+	std::atomic<uint64_t> writePos;
+	std::atomic<uint64_t> readPos;
+
+	std::atomic<double> writeTime;
+	std::atomic<double> readTime;
+
+	// Written as a pair by discard(), guarded by an even sequence number
+	std::atomic<uint32_t> discardSequence;
+	std::atomic<uint64_t> discardPos;
+	std::atomic<double> discardTime;
+
+	// Producer state
+	bool formatValid;
+	size_t writeFrameSize;
+	double writeSampleRate;
+	size_t reservedFrames;
+	size_t reservedPadding;
+
+	// Consumer state
+	size_t readOffset;
+	size_t readFrameSize;
+	double readSampleRate;
+	uint8_t readFormat[maxFormatSize];
+
+	static Header *header(const Storage *storage, uint64_t pos) {
+		return (Header *)(storage->data + (pos - storage->base) % storage->size);
+	}
+
+	uint8_t *prepare(size_t size);
+	void publish(uint32_t type, size_t size, double endTime);
+	void catchUp();
+	void followStorage(uint64_t pos);
+	bool nextSamples();
+};
+
+#endif /* AudioRingBuffer_h */
@@ -0,0 +1,221 @@
+//
+//  ChannelMixer.cpp
+//  CogAudio Framework
+//
+
+#include "ChannelMixer.h"
+
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MIXER_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MIXER_NEON
+#endif
+
+static const size_t maxVectors = 8; // as many channels as a config can hold
+
+static void copyFrames(const float *, size_t, size_t inputCount, size_t, const float *input, size_t frames, float *output) {
+	memcpy(output, input, frames * inputCount * sizeof(float));
+}
+
+static void clearFrames(const float *, size_t, size_t, size_t outputCount, const float *, size_t frames, float *output) {
+	memset(output, 0, frames * outputCount * sizeof(float));
+}
+
+#if defined(MIXER_SSE2)
+static inline void storePartial(float *output, __m128 v, size_t count) {
+	switch(count) {
+		case 1:
+			_mm_store_ss(output, v);
+			break;
+		case 2:
+			_mm_storel_pi((__m64 *)output, v);
+			break;
+		case 3:
+			_mm_storel_pi((__m64 *)output, v);
+			_mm_store_ss(output + 2, _mm_movehl_ps(v, v));
+			break;
+		default:
+			_mm_storeu_ps(output, v);
+			break;
+	}
+}
+#elif defined(MIXER_NEON)
+static inline void storePartial(float *output, float32x4_t v, size_t count) {
+	switch(count) {
+		case 1:
+			vst1q_lane_f32(output, v, 0);
+			break;
+		case 2:
+			vst1_f32(output, vget_low_f32(v));
+			break;
+		case 3:
+			vst1_f32(output, vget_low_f32(v));
+			vst1q_lane_f32(output + 2, v, 2);
+			break;
+		default:
+			vst1q_f32(output, v);
+			break;
+	}
+}
+#endif
+
+// One frame at a time, every input sample scaled by its column and summed
+// into the output vectors. In and Out are 0 where only known at run time.
+template <size_t In, size_t Out>
+static void mixFrames(const float *columns, size_t stride, size_t inputCount, size_t outputCount, const float *input, size_t frames, float *output) {
+	const size_t inputs = In ? In : inputCount;
+	const size_t outputs = Out ? Out : outputCount;
+#if defined(MIXER_SSE2) || defined(MIXER_NEON)
+	const size_t vectors = (outputs + 3) / 4;
+	for(size_t i = 0; i < frames; ++i) {
+#if defined(MIXER_SSE2)
+		__m128 acc[maxVectors];
+		for(size_t v = 0; v < vectors; ++v)
+			acc[v] = _mm_setzero_ps();
+		for(size_t j = 0; j < inputs; ++j) {
+			const __m128 x = _mm_set1_ps(input[j]);
+			const float *column = columns + j * stride;
+			for(size_t v = 0; v < vectors; ++v)
+				acc[v] = _mm_add_ps(acc[v], _mm_mul_ps(x, _mm_loadu_ps(column + v * 4)));
+		}
+#else
+		float32x4_t acc[maxVectors];
+		for(size_t v = 0; v < vectors; ++v)
+			acc[v] = vdupq_n_f32(0.0f);
+		for(size_t j = 0; j < inputs; ++j) {
+			const float x = input[j];
+			const float *column = columns + j * stride;
+			for(size_t v = 0; v < vectors; ++v)
+				acc[v] = vmlaq_n_f32(acc[v], vld1q_f32(column + v * 4), x);
+		}
+#endif
+		for(size_t v = 0; v < vectors; ++v)
+			storePartial(output + v * 4, acc[v], outputs - v * 4);
+		input += inputs;
+		output += outputs;
+	}
+#else
+	for(size_t i = 0; i < frames; ++i) {
+		for(size_t k = 0; k < outputs; ++k) {
+			float sum = 0.0f;
+			for(size_t j = 0; j < inputs; ++j)
+				sum += columns[j * stride + k] * input[j];
+			output[k] = sum;
+		}
+		input += inputs;
+		output += outputs;
+	}
+#endif
+}
+
+#if defined(MIXER_SSE2)
+// Stereo output, two frames at a time: each column holds its two coefficients
+// twice, and is multiplied by the input channel of both frames, giving both
+// output frames in one vector.
+template <size_t In>
+static void mixPairs(const float *columns, size_t stride, size_t inputCount, size_t, const float *input, size_t frames, float *output) {
+	const size_t inputs = In ? In : inputCount;
+	size_t i = 0;
+	for(; i + 1 < frames; i += 2) {
+		const float *first = input;
+		const float *second = input + inputs;
+		__m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+		size_t j = 0;
+		for(; j + 4 <= inputs; j += 4) {
+			const __m128 a = _mm_loadu_ps(first + j);
+			const __m128 b = _mm_loadu_ps(second + j);
+			const float *column = columns + j * 4;
+			acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 0, 0)), _mm_loadu_ps(column)));
+			acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 1, 1)), _mm_loadu_ps(column + 4)));
+			acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 2, 2, 2)), _mm_loadu_ps(column + 8)));
+			acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 3, 3, 3)), _mm_loadu_ps(column + 12)));
+		}
+		for(; j < inputs; ++j) {
+			const __m128 x = _mm_shuffle_ps(_mm_load_ss(first + j), _mm_load_ss(second + j), _MM_SHUFFLE(0, 0, 0, 0));
+			acc0 = _mm_add_ps(acc0, _mm_mul_ps(x, _mm_loadu_ps(columns + j * 4)));
+		}
+		_mm_storeu_ps(output, _mm_add_ps(acc0, acc1));
+		input += inputs * 2;
+		output += 4;
+	}
+	if(i < frames)
+		mixFrames<In, 2>(columns, stride, inputCount, 2, input, 1, output);
+}
+#endif
+
+struct FixedKernel {
+	size_t inputCount;
+	size_t outputCount;
+	void (*kernel)(const float *columns, size_t stride, size_t inputCount, size_t outputCount, const float *input, size_t frames, float *output);
+};
+
+// 5.1, 6.1 and 7.1 to stereo, and back
+
+static const FixedKernel fixedKernels[] = {
+#if defined(MIXER_SSE2)
+	{ 6, 2, mixPairs<6> },
+	{ 7, 2, mixPairs<7> },
+	{ 8, 2, mixPairs<8> },
+#else
+	{ 6, 2, mixFrames<6, 2> },
+	{ 7, 2, mixFrames<7, 2> },
+	{ 8, 2, mixFrames<8, 2> },
+#endif
+	{ 1, 2, mixFrames<1, 2> },
+	{ 2, 1, mixFrames<2, 1> },
+	{ 2, 6, mixFrames<2, 6> },
+	{ 2, 8, mixFrames<2, 8> },
+	{ 6, 8, mixFrames<6, 8> }
+};
+
+ChannelMixer::ChannelMixer(size_t _inputCount, size_t _outputCount, const float *matrix)
+: inputCount(_inputCount), outputCount(_outputCount) {
+	// Stereo columns are doubled for the two frame kernel
+	stride = (outputCount == 2) ? 4 : (outputCount + 3) & ~(size_t)3;
+	columns.resize(inputCount * stride);
+	bool identity = inputCount == outputCount;
+	for(size_t j = 0; j < inputCount; ++j) {
+		for(size_t k = 0; k < outputCount; ++k) {
+			const float coeff = matrix[k * inputCount + j];
+			columns[j * stride + k] = coeff;
+			if(coeff != ((j == k) ? 1.0f : 0.0f))
+				identity = false;
+		}
+		if(outputCount == 2) {
+			columns[j * stride + 2] = columns[j * stride + 0];
+			columns[j * stride + 3] = columns[j * stride + 1];
+		}
+	}
+
+	if(identity) {
+		kernel = copyFrames;
+		return;
+	}
+
+	// Wider than any channel config, so never asked for, but gives silence
+	// rather than leaving the output as it was
+	if(outputCount > maxVectors * 4) {
+		kernel = clearFrames;
+		return;
+	}
+
+#if defined(MIXER_SSE2)
+	kernel = (outputCount == 2) ? mixPairs<0> : mixFrames<0, 0>;
+#else
+	kernel = mixFrames<0, 0>;
+#endif
+	for(size_t i = 0; i < sizeof(fixedKernels) / sizeof(fixedKernels[0]); ++i) {
+		if(fixedKernels[i].inputCount == inputCount && fixedKernels[i].outputCount == outputCount) {
+			kernel = fixedKernels[i].kernel;
+			break;
+		}
+	}
+}
+
+void ChannelMixer::process(const float *input, size_t frames, float *output) const {
+	kernel(&columns[0], stride, inputCount, outputCount, input, frames, output);
+}
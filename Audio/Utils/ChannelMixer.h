@@ -0,0 +1,39 @@
+//
+//  ChannelMixer.h
+//  CogAudio Framework
+//
+
+#ifndef ChannelMixer_h
+#define ChannelMixer_h
+
+#include <stddef.h>
+
+#include <vector>
+
+// Mixes interleaved float frames through a dense matrix of one coefficient
+// per output and input channel.
+//
+// The matrix is repacked once, as one column of output coefficients per
+// input channel, so each input sample is multiplied into all of its
+// outputs with SIMD. Downmixes to stereo work on two frames at a time,
+// their columns holding the pair of coefficients twice. The common layout
+// pairs get kernels with their channel counts fixed at compile time, and
+// an identity matrix is a plain copy.
+class ChannelMixer {
+	public:
+	// Takes outputCount rows of inputCount coefficients
+	ChannelMixer(size_t inputCount, size_t outputCount, const float *matrix);
+
+	void process(const float *input, size_t frames, float *output) const;
+
+	private:
+	typedef void (*Kernel)(const float *columns, size_t stride, size_t inputCount, size_t outputCount, const float *input, size_t frames, float *output);
+
+	size_t inputCount;
+	size_t outputCount;
+	size_t stride; // floats per column
+	std::vector<float> columns; // [input][stride]
+	Kernel kernel;
+};
+
+#endif /* ChannelMixer_h */
@@ -0,0 +1,358 @@
+//
+//  DSDDecimator.cpp
+//  CogAudio Framework
+//
+
+#include "DSDDecimator.h"
+
+#include <math.h>
+#include <string.h>
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define DSD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DSD_NEON
+#endif
+
+/*
+ * The first stage filter comes from dsd2pcm by Sebastian Gesemann.
+ *
+ * This is the 2nd half of an even order symmetric FIR
+ * lowpass filter (to be used on a signal sampled at 44100*64 Hz)
+ * Passband is 0-24 kHz (ripples +/- 0.025 dB)
+ * Stopband starts at 176.4 kHz (rejection: 170 dB)
+ * The overall gain is 2.0
+ */
+#define FILTER_COEFFS_COUNT 64
+static const float filterCoeffs[FILTER_COEFFS_COUNT] = {
+	0.09712411121659f, 0.09613438994044f, 0.09417884216316f, 0.09130441727307f,
+	0.08757947648990f, 0.08309142055179f, 0.07794369263673f, 0.07225228745463f,
+	0.06614191680338f, 0.05974199351302f, 0.05318259916599f, 0.04659059631228f,
+	0.04008603356890f, 0.03377897290478f, 0.02776684382775f, 0.02213240062966f,
+	0.01694232798846f, 0.01224650881275f, 0.00807793792573f, 0.00445323755944f,
+	0.00137370697215f, -0.00117318019994f, -0.00321193033831f, -0.00477694265140f,
+	-0.00591028841335f, -0.00665946056286f, -0.00707518873201f, -0.00720940203988f,
+	-0.00711340642819f, -0.00683632603227f, -0.00642384017266f, -0.00591723006715f,
+	-0.00535273320457f, -0.00476118922548f, -0.00416794965654f, -0.00359301524813f,
+	-0.00305135909510f, -0.00255339111833f, -0.00210551956895f, -0.00171076760278f,
+	-0.00136940723130f, -0.00107957856005f, -0.00083786862365f, -0.00063983084245f,
+	-0.00048043272086f, -0.00035442550015f, -0.00025663481039f, -0.00018217573430f,
+	-0.00012659899635f, -0.00008597726991f, -0.00005694188820f, -0.00003668060332f,
+	-0.00002290670286f, -0.00001380895679f, -0.00000799057558f, -0.00000440385083f,
+	-0.00000228567089f, -0.00000109760778f, -0.00000047286430f, -0.00000017129652f,
+	-0.00000004282776f, 0.00000000119422f, 0.00000000949179f, 0.00000000747450f
+};
+
+static const int filterParts = FILTER_COEFFS_COUNT / 8;
+
+static const double stopbandAttenuation = 140.0; // dB
+
+static double besselI0(double x) {
+	double sum = 1.0, term = 1.0;
+	for(int k = 1; k < 64; ++k) {
+		double t = x / (2.0 * k);
+		term *= t * t;
+		sum += term;
+		if(term < sum * 1e-17)
+			break;
+	}
+	return sum;
+}
+
+// Takes a multiple of 8 taps
+static inline float dot(const float *x, const float *h, size_t n) {
+#if defined(DSD_SSE2)
+	__m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+	for(size_t i = 0; i < n; i += 8) {
+		acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(x + i), _mm_loadu_ps(h + i)));
+		acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(x + i + 4), _mm_loadu_ps(h + i + 4)));
+	}
+	acc0 = _mm_add_ps(acc0, acc1);
+	acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+	acc0 = _mm_add_ss(acc0, _mm_shuffle_ps(acc0, acc0, 1));
+	return _mm_cvtss_f32(acc0);
+#elif defined(DSD_NEON)
+	float32x4_t acc0 = vdupq_n_f32(0.0f), acc1 = vdupq_n_f32(0.0f);
+	for(size_t i = 0; i < n; i += 8) {
+		acc0 = vmlaq_f32(acc0, vld1q_f32(x + i), vld1q_f32(h + i));
+		acc1 = vmlaq_f32(acc1, vld1q_f32(x + i + 4), vld1q_f32(h + i + 4));
+	}
+	acc0 = vaddq_f32(acc0, acc1);
+	float32x2_t half = vadd_f32(vget_low_f32(acc0), vget_high_f32(acc0));
+	return vget_lane_f32(vpadd_f32(half, half), 0);
+#else
+	float acc[8] = { 0 };
+	for(size_t i = 0; i < n; i += 8) {
+		for(size_t j = 0; j < 8; ++j)
+			acc[j] += x[i + j] * h[i + j];
+	}
+	return ((acc[0] + acc[4]) + (acc[1] + acc[5])) + ((acc[2] + acc[6]) + (acc[3] + acc[7]));
+#endif
+}
+
+// Only the even taps and the center of a halfband filter are nonzero, so the
+// even input samples go through the former and the odd ones are only delayed.
+struct DSDDecimator::Halfband {
+	size_t length; // even taps, a multiple of 8
+	size_t oddDelay;
+	std::vector<float> taps;
+	float center;
+
+	size_t channelCount;
+	std::vector<float> even; // [channel][2 * length], mirrored
+	std::vector<float> odd; // [channel][oddDelay]
+	std::vector<size_t> evenPos;
+	std::vector<size_t> oddPos;
+	std::vector<uint8_t> phase;
+
+	// Transition band as a fraction of the input rate
+	Halfband(size_t _channelCount, double transition)
+	: channelCount(_channelCount) {
+		double beta = 0.1102 * (stopbandAttenuation - 8.7);
+		size_t order = (size_t)ceil((stopbandAttenuation - 7.95) / (14.36 * transition)) + 1;
+		oddDelay = ((order + 1) / 4 + 3) & ~(size_t)3;
+		length = oddDelay * 2;
+
+		// 4 * oddDelay - 1 taps, centered on an odd one
+		const double middle = (double)(length - 1);
+		const double windowNorm = 1.0 / besselI0(beta);
+		taps.resize(length);
+		double sum = 0.0;
+		for(size_t i = 0; i < length; ++i) {
+			double t = (double)(i * 2) - middle;
+			double r = t / middle;
+			double window = besselI0(beta * sqrt(std::max(0.0, 1.0 - r * r))) * windowNorm;
+			double tap = sin(M_PI * t * 0.5) / (M_PI * t) * window;
+			taps[i] = (float)tap;
+			sum += tap;
+		}
+		for(size_t i = 0; i < length; ++i)
+			taps[i] = (float)(taps[i] * 0.5 / sum);
+		center = 0.5f;
+
+		even.resize(channelCount * length * 2);
+		odd.resize(channelCount * oddDelay);
+		evenPos.resize(channelCount);
+		oddPos.resize(channelCount);
+		phase.resize(channelCount);
+		reset();
+	}
+
+	void reset() {
+		std::fill(even.begin(), even.end(), 0.0f);
+		std::fill(odd.begin(), odd.end(), 0.0f);
+		std::fill(evenPos.begin(), evenPos.end(), 0);
+		std::fill(oddPos.begin(), oddPos.end(), 0);
+		std::fill(phase.begin(), phase.end(), 0);
+	}
+
+	// In place, returns the number of samples output
+	size_t process(size_t channel, float *samples, size_t count) {
+		float *e = &even[channel * length * 2];
+		float *o = &odd[channel * oddDelay];
+		size_t ep = evenPos[channel];
+		size_t op = oddPos[channel];
+		size_t i = 0, done = 0;
+
+		if(phase[channel] && count) {
+			o[op] = samples[i++];
+			if(++op == oddDelay) op = 0;
+			phase[channel] = 0;
+		}
+		for(; i + 1 < count; i += 2) {
+			e[ep] = e[ep + length] = samples[i];
+			if(++ep == length) ep = 0;
+			samples[done++] = dot(e + ep, &taps[0], length) + center * o[op];
+			o[op] = samples[i + 1];
+			if(++op == oddDelay) op = 0;
+		}
+		if(i < count) {
+			e[ep] = e[ep + length] = samples[i];
+			if(++ep == length) ep = 0;
+			samples[done++] = dot(e + ep, &taps[0], length) + center * o[op];
+			phase[channel] = 1;
+		}
+
+		evenPos[channel] = ep;
+		oddPos[channel] = op;
+		return done;
+	}
+};
+
+DSDDecimator::DSDDecimator(size_t _channelCount, double dsdRate, double targetRate)
+: channelCount(_channelCount) {
+	// Per part, the sum of the coefficients for every bit pattern
+	std::vector<float> table(filterParts * 0x100);
+	for(int part = 0; part < filterParts; ++part) {
+		for(int byte = 0; byte < 0x100; ++byte) {
+			double sum = 0.0;
+			for(int bit = 0; bit < 8; ++bit) {
+				double coeff = filterCoeffs[part * 8 + bit];
+				sum += (byte & (0x80 >> bit)) ? coeff : -coeff;
+			}
+			table[part * 0x100 + byte] = (float)sum;
+		}
+	}
+
+	// A byte is at the far end of the first half of the filter for the output
+	// it arrives with, and at the far end of the second half, bit reversed,
+	// for the output fifteen bytes later.
+	rows.resize(0x100 * rowSize);
+	for(int byte = 0; byte < 0x100; ++byte) {
+		int reversed = 0;
+		for(int bit = 0; bit < 8; ++bit) {
+			if(byte & (1 << bit))
+				reversed |= 0x80 >> bit;
+		}
+		for(int i = 0; i < filterParts; ++i) {
+			rows[byte * rowSize + i] = table[(filterParts - 1 - i) * 0x100 + byte];
+			rows[byte * rowSize + filterParts + i] = table[i * 0x100 + reversed];
+		}
+	}
+
+	rate = dsdRate / 8.0;
+	unsigned stages = 0;
+	while(stages < maxStages && targetRate > 0.0 && rate * 0.5 >= targetRate) {
+		rate *= 0.5;
+		++stages;
+	}
+
+	// The first stage output is centered halfway between the eighth and ninth last bytes
+	double totalDelay = 7.5;
+	const double passband = std::min(rate * 0.4535, 24000.0);
+	double stageRate = dsdRate / 8.0;
+	for(unsigned i = 0; i < stages; ++i) {
+		Halfband *h = new Halfband(channelCount, 0.5 - 2.0 * passband / stageRate);
+		totalDelay = (totalDelay + (double)(h->length - 1)) * 0.5;
+		halfbands.push_back(h);
+		stageRate *= 0.5;
+	}
+	delay = (size_t)(totalDelay + 0.5);
+
+	accum.resize(channelCount * rowSize);
+	scratch.resize(channelCount * blockSize);
+
+	reset();
+}
+
+DSDDecimator::~DSDDecimator() {
+	for(size_t i = 0; i < halfbands.size(); ++i)
+		delete halfbands[i];
+}
+
+double DSDDecimator::outputRate() const {
+	return rate;
+}
+
+size_t DSDDecimator::ratio() const {
+	return (size_t)1 << halfbands.size();
+}
+
+size_t DSDDecimator::latency() const {
+	return delay;
+}
+
+void DSDDecimator::reset() {
+	// The filter starts out full of digital silence
+	std::fill(accum.begin(), accum.end(), 0.0f);
+	std::vector<uint8_t> silence((rowSize - 1) * channelCount, 0xAA);
+	float discard[rowSize];
+	for(size_t i = 0; i < channelCount; ++i)
+		firstStage(&silence[0], rowSize - 1, i, discard);
+
+	for(size_t i = 0; i < halfbands.size(); ++i)
+		halfbands[i]->reset();
+}
+
+void DSDDecimator::firstStage(const uint8_t *input, size_t count, size_t channel, float *output) {
+	float *a = &accum[channel * rowSize];
+	const float *rowTable = &rows[0];
+	const size_t stride = channelCount;
+#if defined(DSD_SSE2)
+	__m128 a0 = _mm_loadu_ps(a), a1 = _mm_loadu_ps(a + 4);
+	__m128 a2 = _mm_loadu_ps(a + 8), a3 = _mm_loadu_ps(a + 12);
+	const __m128 zero = _mm_setzero_ps();
+	for(size_t i = 0; i < count; ++i) {
+		const float *row = rowTable + input[i * stride + channel] * rowSize;
+		a0 = _mm_add_ps(a0, _mm_loadu_ps(row));
+		a1 = _mm_add_ps(a1, _mm_loadu_ps(row + 4));
+		a2 = _mm_add_ps(a2, _mm_loadu_ps(row + 8));
+		a3 = _mm_add_ps(a3, _mm_loadu_ps(row + 12));
+		_mm_store_ss(output + i, a0);
+		// Shift everything down one output
+		a0 = _mm_move_ss(a0, a1);
+		a1 = _mm_move_ss(a1, a2);
+		a2 = _mm_move_ss(a2, a3);
+		a3 = _mm_move_ss(a3, zero);
+		a0 = _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(0, 3, 2, 1));
+		a1 = _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(0, 3, 2, 1));
+		a2 = _mm_shuffle_ps(a2, a2, _MM_SHUFFLE(0, 3, 2, 1));
+		a3 = _mm_shuffle_ps(a3, a3, _MM_SHUFFLE(0, 3, 2, 1));
+	}
+	_mm_storeu_ps(a, a0);
+	_mm_storeu_ps(a + 4, a1);
+	_mm_storeu_ps(a + 8, a2);
+	_mm_storeu_ps(a + 12, a3);
+#elif defined(DSD_NEON)
+	float32x4_t a0 = vld1q_f32(a), a1 = vld1q_f32(a + 4);
+	float32x4_t a2 = vld1q_f32(a + 8), a3 = vld1q_f32(a + 12);
+	const float32x4_t zero = vdupq_n_f32(0.0f);
+	for(size_t i = 0; i < count; ++i) {
+		const float *row = rowTable + input[i * stride + channel] * rowSize;
+		a0 = vaddq_f32(a0, vld1q_f32(row));
+		a1 = vaddq_f32(a1, vld1q_f32(row + 4));
+		a2 = vaddq_f32(a2, vld1q_f32(row + 8));
+		a3 = vaddq_f32(a3, vld1q_f32(row + 12));
+		output[i] = vgetq_lane_f32(a0, 0);
+		// Shift everything down one output
+		a0 = vextq_f32(a0, a1, 1);
+		a1 = vextq_f32(a1, a2, 1);
+		a2 = vextq_f32(a2, a3, 1);
+		a3 = vextq_f32(a3, zero, 1);
+	}
+	vst1q_f32(a, a0);
+	vst1q_f32(a + 4, a1);
+	vst1q_f32(a + 8, a2);
+	vst1q_f32(a + 12, a3);
+#else
+	for(size_t i = 0; i < count; ++i) {
+		const float *row = rowTable + input[i * stride + channel] * rowSize;
+		for(size_t j = 0; j < rowSize; ++j)
+			a[j] += row[j];
+		output[i] = a[0];
+		memmove(a, a + 1, (rowSize - 1) * sizeof(float));
+		a[rowSize - 1] = 0.0f;
+	}
+#endif
+}
+
+size_t DSDDecimator::process(const uint8_t *input, size_t count, float *output) {
+	size_t outCount = 0;
+	while(count) {
+		const size_t blockCount = std::min(count, (size_t)blockSize);
+		size_t produced = blockCount;
+		for(size_t i = 0; i < channelCount; ++i) {
+			float *block = &scratch[i * blockSize];
+			firstStage(input, blockCount, i, block);
+			produced = blockCount;
+			for(size_t j = 0; j < halfbands.size(); ++j)
+				produced = halfbands[j]->process(i, block, produced);
+		}
+
+		float *out = output + outCount * channelCount;
+		for(size_t i = 0; i < channelCount; ++i) {
+			const float *block = &scratch[i * blockSize];
+			for(size_t j = 0; j < produced; ++j)
+				out[j * channelCount + i] = block[j];
+		}
+
+		outCount += produced;
+		input += blockCount * channelCount;
+		count -= blockCount;
+	}
+	return outCount;
+}
@@ -0,0 +1,65 @@
+//
+//  DSDDecimator.h
+//  CogAudio Framework
+//
+
+#ifndef DSDDecimator_h
+#define DSDDecimator_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+// DSD to float PCM decimator for interleaved streams, one byte per channel
+// and frame, holding eight samples with the oldest in the most significant
+// bit.
+//
+// The first stage is the 128 tap symmetric FIR of dsd2pcm, which decimates
+// by 8. Every input byte adds one row of a per byte table to the sixteen
+// outputs it contributes to, rather than each output summing sixteen
+// lookups. It is followed by as many halfband stages as it takes to get
+// down to the target rate, or the lowest rate still above it, so common
+// rates need no further resampling. These keep everything up to 20 kHz,
+// or 24 kHz for higher rates, flat and free of aliasing. The overall gain
+// is 2, as with dsd2pcm.
+class DSDDecimator {
+	public:
+	DSDDecimator(size_t channelCount, double dsdRate, double targetRate);
+	~DSDDecimator();
+
+	double outputRate() const;
+
+	// Input frames per output frame
+	size_t ratio() const;
+
+	// Output frames of filter delay
+	size_t latency() const;
+
+	void reset();
+
+	// Consumes count input frames, returns the number of frames output, which
+	// is at most (count + ratio() - 1) / ratio()
+	size_t process(const uint8_t *input, size_t count, float *output);
+
+	private:
+	enum {
+		blockSize = 1024,
+		maxStages = 8,
+		rowSize = 16
+	};
+
+	struct Halfband;
+
+	size_t channelCount;
+	double rate;
+	size_t delay;
+	std::vector<float> rows; // [byte][rowSize], what a byte adds to the next outputs
+	std::vector<float> accum; // [channel][rowSize], pending first stage outputs
+	std::vector<Halfband *> halfbands;
+	std::vector<float> scratch; // [channel][blockSize]
+
+	void firstStage(const uint8_t *input, size_t count, size_t channel, float *output);
+};
+
+#endif /* DSDDecimator_h */
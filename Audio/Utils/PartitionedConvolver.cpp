@@ -0,0 +1,297 @@
+//
+//  PartitionedConvolver.cpp
+//  CogAudio Framework
+//
+
+#include "PartitionedConvolver.h"
+
+#include <math.h>
+#include <string.h>
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define CONVOLVER_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CONVOLVER_NEON
+#endif
+
+// Real FFT of a power of two size, computed as a complex FFT of half the size.
+// Spectra hold bins 0 through size / 2, and the inverse is scaled so that
+// it undoes the forward transform.
+class PartitionedConvolver::RealFFT {
+	public:
+	explicit RealFFT(size_t _size)
+	: size(_size), half(_size / 2), bitReverse(_size / 2), twiddles(_size / 2), realTwiddles(_size / 2 + 1), work(_size) {
+		size_t bits = 0;
+		while(((size_t)1 << bits) < half)
+			++bits;
+		for(size_t i = 0; i < half; ++i) {
+			size_t r = 0;
+			for(size_t j = 0; j < bits; ++j) {
+				if(i & ((size_t)1 << j))
+					r |= (size_t)1 << (bits - 1 - j);
+			}
+			bitReverse[i] = r;
+		}
+		for(size_t i = 0; i < half / 2; ++i) {
+			twiddles[i].re = (float)cos(2.0 * M_PI * i / half);
+			twiddles[i].im = (float)-sin(2.0 * M_PI * i / half);
+		}
+		for(size_t i = 0; i <= half; ++i) {
+			realTwiddles[i].re = (float)cos(2.0 * M_PI * i / size);
+			realTwiddles[i].im = (float)-sin(2.0 * M_PI * i / size);
+		}
+	}
+
+	void forward(const float *in, float *re, float *im) {
+		float *zr = &work[0], *zi = &work[half];
+		for(size_t i = 0; i < half; ++i) {
+			zr[bitReverse[i]] = in[i * 2];
+			zi[bitReverse[i]] = in[i * 2 + 1];
+		}
+		transform(zr, zi, false);
+		re[0] = zr[0] + zi[0];
+		im[0] = 0.0f;
+		re[half] = zr[0] - zi[0];
+		im[half] = 0.0f;
+		for(size_t k = 1; k < half; ++k) {
+			float ar = zr[k], ai = zi[k];
+			float br = zr[half - k], bi = -zi[half - k];
+			float er = (ar + br) * 0.5f, ei = (ai + bi) * 0.5f;
+			// (a - b) / 2i
+			float orr = (ai - bi) * 0.5f, oi = (br - ar) * 0.5f;
+			float wr = realTwiddles[k].re, wi = realTwiddles[k].im;
+			re[k] = er + orr * wr - oi * wi;
+			im[k] = ei + orr * wi + oi * wr;
+		}
+	}
+
+	void inverse(const float *re, const float *im, float *out) {
+		float *zr = &work[0], *zi = &work[half];
+		for(size_t k = 0; k < half; ++k) {
+			float ar = re[k], ai = im[k];
+			float br = re[half - k], bi = -im[half - k];
+			float er = (ar + br) * 0.5f, ei = (ai + bi) * 0.5f;
+			// (a - b) * conj(w) / 2
+			float dr = (ar - br) * 0.5f, di = (ai - bi) * 0.5f;
+			float wr = realTwiddles[k].re, wi = -realTwiddles[k].im;
+			float orr = dr * wr - di * wi, oi = dr * wi + di * wr;
+			// e + i * o
+			size_t j = bitReverse[k];
+			zr[j] = er - oi;
+			zi[j] = ei + orr;
+		}
+		transform(zr, zi, true);
+		const float scale = 1.0f / half;
+		for(size_t i = 0; i < half; ++i) {
+			out[i * 2] = zr[i] * scale;
+			out[i * 2 + 1] = zi[i] * scale;
+		}
+	}
+
+	private:
+	struct Complex {
+		float re, im;
+	};
+
+	size_t size, half;
+	std::vector<size_t> bitReverse;
+	std::vector<Complex> twiddles;
+	std::vector<Complex> realTwiddles;
+	std::vector<float> work;
+
+	// In place radix 2 decimation in time, on bit reversed input
+	void transform(float *zr, float *zi, bool inverse) const {
+		for(size_t len = 2; len <= half; len <<= 1) {
+			size_t span = len / 2, step = half / len;
+			for(size_t j = 0; j < span; ++j) {
+				float wr = twiddles[j * step].re;
+				float wi = inverse ? -twiddles[j * step].im : twiddles[j * step].im;
+				for(size_t i = j; i < half; i += len) {
+					size_t k = i + span;
+					float tr = zr[k] * wr - zi[k] * wi;
+					float ti = zr[k] * wi + zi[k] * wr;
+					zr[k] = zr[i] - tr;
+					zi[k] = zi[i] - ti;
+					zr[i] += tr;
+					zi[i] += ti;
+				}
+			}
+		}
+	}
+};
+
+// acc += x * h, over spectra of n bins, n being a multiple of 4
+static void complexMultiplyAccumulate(float *acc, const float *x, const float *h, size_t n) {
+	float *ar = acc, *ai = acc + n;
+	const float *xr = x, *xi = x + n;
+	const float *hr = h, *hi = h + n;
+#if defined(CONVOLVER_SSE2)
+	for(size_t i = 0; i < n; i += 4) {
+		__m128 vxr = _mm_loadu_ps(xr + i), vxi = _mm_loadu_ps(xi + i);
+		__m128 vhr = _mm_loadu_ps(hr + i), vhi = _mm_loadu_ps(hi + i);
+		__m128 vr = _mm_sub_ps(_mm_mul_ps(vxr, vhr), _mm_mul_ps(vxi, vhi));
+		__m128 vi = _mm_add_ps(_mm_mul_ps(vxr, vhi), _mm_mul_ps(vxi, vhr));
+		_mm_storeu_ps(ar + i, _mm_add_ps(_mm_loadu_ps(ar + i), vr));
+		_mm_storeu_ps(ai + i, _mm_add_ps(_mm_loadu_ps(ai + i), vi));
+	}
+#elif defined(CONVOLVER_NEON)
+	for(size_t i = 0; i < n; i += 4) {
+		float32x4_t vxr = vld1q_f32(xr + i), vxi = vld1q_f32(xi + i);
+		float32x4_t vhr = vld1q_f32(hr + i), vhi = vld1q_f32(hi + i);
+		float32x4_t vr = vmlsq_f32(vmlaq_f32(vld1q_f32(ar + i), vxr, vhr), vxi, vhi);
+		float32x4_t vi = vmlaq_f32(vmlaq_f32(vld1q_f32(ai + i), vxr, vhi), vxi, vhr);
+		vst1q_f32(ar + i, vr);
+		vst1q_f32(ai + i, vi);
+	}
+#else
+	for(size_t i = 0; i < n; ++i) {
+		ar[i] += xr[i] * hr[i] - xi[i] * hi[i];
+		ai[i] += xr[i] * hi[i] + xi[i] * hr[i];
+	}
+#endif
+}
+
+PartitionedConvolver::PartitionedConvolver(size_t _inputCount, size_t _outputCount, size_t impulseLength, size_t _blockSize)
+: inputCount(_inputCount), outputCount(_outputCount), blockSize(_blockSize), historyPos(0), fill(0), tailValid(false) {
+	binCount = (blockSize + 1 + 3) & ~(size_t)3;
+	partitionCount = std::max((impulseLength + blockSize - 1) / blockSize, (size_t)1);
+
+	fft = new RealFFT(blockSize * 2);
+
+	impulses.resize(inputCount * outputCount * partitionCount * binCount * 2);
+	history.resize(inputCount * (partitionCount - 1) * binCount * 2);
+	window.resize(inputCount * blockSize * 2);
+	current.resize(inputCount * binCount * 2);
+	accum.resize(outputCount * binCount * 2);
+	tail.resize(outputCount * blockSize);
+	result.resize(blockSize * 2);
+}
+
+PartitionedConvolver::~PartitionedConvolver() {
+	delete fft;
+}
+
+void PartitionedConvolver::setImpulse(size_t input, size_t output, const float *impulse, size_t length, size_t stride) {
+	length = std::min(length, partitionCount * blockSize);
+	for(size_t i = 0; i < partitionCount; ++i) {
+		size_t count = i * blockSize < length ? std::min(length - i * blockSize, blockSize) : 0;
+		for(size_t j = 0; j < count; ++j) {
+			result[j] = impulse[(i * blockSize + j) * stride];
+		}
+		std::fill(result.begin() + count, result.end(), 0.0f);
+		float *h = spectrum(impulses, (input * outputCount + output) * partitionCount + i);
+		memset(h, 0, binCount * 2 * sizeof(float));
+		fft->forward(&result[0], h, h + binCount);
+	}
+}
+
+// Contribution of the earlier blocks to the current one
+void PartitionedConvolver::accumulateHistory() {
+	std::fill(accum.begin(), accum.end(), 0.0f);
+	size_t slots = partitionCount - 1;
+	for(size_t i = 0; i < inputCount; ++i) {
+		for(size_t j = 1; j < partitionCount; ++j) {
+			const float *x = spectrum(history, i * slots + (historyPos + slots - (j - 1)) % slots);
+			for(size_t k = 0; k < outputCount; ++k) {
+				complexMultiplyAccumulate(spectrum(accum, k), x, spectrum(impulses, (i * outputCount + k) * partitionCount + j), binCount);
+			}
+		}
+	}
+}
+
+void PartitionedConvolver::accumulateCurrent() {
+	for(size_t i = 0; i < inputCount; ++i) {
+		const float *x = spectrum(current, i);
+		for(size_t k = 0; k < outputCount; ++k) {
+			complexMultiplyAccumulate(spectrum(accum, k), x, spectrum(impulses, (i * outputCount + k) * partitionCount), binCount);
+		}
+	}
+}
+
+void PartitionedConvolver::process(const float *input, size_t count, float *output) {
+	while(count > 0) {
+		size_t countToDo = std::min(count, blockSize - fill);
+
+		for(size_t i = 0; i < inputCount; ++i) {
+			float *w = &window[i * blockSize * 2];
+			const float *in = input + i;
+			for(size_t j = 0; j < countToDo; ++j, in += inputCount) {
+				w[blockSize + fill + j] = *in;
+			}
+			float *x = spectrum(current, i);
+			fft->forward(w, x, x + binCount);
+		}
+
+		// A whole block is done in one pass, otherwise the part coming
+		// from the earlier blocks is kept for the following calls
+		bool combined = false;
+		if(!tailValid) {
+			accumulateHistory();
+			if(!fill && countToDo == blockSize) {
+				combined = true;
+			} else {
+				for(size_t k = 0; k < outputCount; ++k) {
+					float *y = spectrum(accum, k);
+					fft->inverse(y, y + binCount, &result[0]);
+					memcpy(&tail[k * blockSize], &result[blockSize], blockSize * sizeof(float));
+				}
+				tailValid = true;
+			}
+		}
+		if(!combined)
+			std::fill(accum.begin(), accum.end(), 0.0f);
+
+		accumulateCurrent();
+
+		for(size_t k = 0; k < outputCount; ++k) {
+			float *y = spectrum(accum, k);
+			fft->inverse(y, y + binCount, &result[0]);
+			const float *r = &result[blockSize + fill];
+			float *out = output + k;
+			if(tailValid) {
+				const float *t = &tail[k * blockSize + fill];
+				for(size_t j = 0; j < countToDo; ++j, out += outputCount) {
+					*out = r[j] + t[j];
+				}
+			} else {
+				for(size_t j = 0; j < countToDo; ++j, out += outputCount) {
+					*out = r[j];
+				}
+			}
+		}
+
+		fill += countToDo;
+		input += countToDo * inputCount;
+		output += countToDo * outputCount;
+		count -= countToDo;
+
+		if(fill == blockSize) {
+			if(partitionCount > 1) {
+				size_t slots = partitionCount - 1;
+				historyPos = (historyPos + 1) % slots;
+				for(size_t i = 0; i < inputCount; ++i) {
+					memcpy(spectrum(history, i * slots + historyPos), spectrum(current, i), binCount * 2 * sizeof(float));
+				}
+			}
+			for(size_t i = 0; i < inputCount; ++i) {
+				float *w = &window[i * blockSize * 2];
+				memcpy(w, w + blockSize, blockSize * sizeof(float));
+				memset(w + blockSize, 0, blockSize * sizeof(float));
+			}
+			fill = 0;
+			tailValid = false;
+		}
+	}
+}
+
+void PartitionedConvolver::reset() {
+	std::fill(history.begin(), history.end(), 0.0f);
+	std::fill(window.begin(), window.end(), 0.0f);
+	historyPos = 0;
+	fill = 0;
+	tailValid = false;
+}
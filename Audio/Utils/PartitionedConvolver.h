@@ -0,0 +1,67 @@
+//
+//  PartitionedConvolver.h
+//  CogAudio Framework
+//
+
+#ifndef PartitionedConvolver_h
+#define PartitionedConvolver_h
+
+#include <stddef.h>
+
+#include <vector>
+
+// Uniformly partitioned overlap-save convolution of interleaved input
+// channels into interleaved output channels, every input having its own
+// impulse per output.
+//
+// Each input channel block is transformed once, and its spectrum kept in a
+// frequency domain delay line shared by all outputs. Per block, the outputs
+// then take one complex multiply-accumulate per input and partition, and a
+// single inverse transform. There is no latency: a block which is only
+// partly filled gets its first partition redone on every call, while the
+// contribution of the earlier blocks is only computed once.
+class PartitionedConvolver {
+	public:
+	PartitionedConvolver(size_t inputCount, size_t outputCount, size_t impulseLength, size_t blockSize = 512);
+	~PartitionedConvolver();
+
+	// Impulse of up to impulseLength samples, taken every stride floats
+	void setImpulse(size_t input, size_t output, const float *impulse, size_t length, size_t stride = 1);
+
+	void process(const float *input, size_t count, float *output);
+
+	void reset();
+
+	private:
+	class RealFFT;
+
+	size_t inputCount;
+	size_t outputCount;
+	size_t blockSize;
+	size_t binCount; // padded for SIMD
+	size_t partitionCount;
+
+	RealFFT *fft;
+
+	// Spectra are stored as binCount real parts followed by binCount imaginary parts
+	std::vector<float> impulses; // [input][output][partition]
+	std::vector<float> history; // [input][partition - 1], ring buffer
+	size_t historyPos;
+
+	std::vector<float> window; // [input][2 * blockSize], previous and current block
+	std::vector<float> current; // [input]
+	std::vector<float> accum; // [output]
+	std::vector<float> tail; // [output][blockSize]
+	std::vector<float> result;
+	size_t fill;
+	bool tailValid;
+
+	float *spectrum(std::vector<float> &v, size_t index) {
+		return &v[index * binCount * 2];
+	}
+
+	void accumulateHistory();
+	void accumulateCurrent();
+};
+
+#endif /* PartitionedConvolver_h */
@@ -0,0 +1,368 @@
+//
+//  Resampler.cpp
+//  CogAudio Framework
+//
+
+#include "Resampler.h"
+
+#include <math.h>
+#include <string.h>
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define RESAMPLER_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define RESAMPLER_NEON
+#endif
+
+static const double stopbandAttenuation = 140.0; // dB
+static const double transitionBand = 0.05; // of the lower rate
+static const size_t maxTaps = 16384;
+
+static double besselI0(double x) {
+	double sum = 1.0, term = 1.0;
+	for(int k = 1; k < 64; ++k) {
+		double t = x / (2.0 * k);
+		term *= t * t;
+		sum += term;
+		if(term < sum * 1e-17)
+			break;
+	}
+	return sum;
+}
+
+static uint64_t gcd(uint64_t a, uint64_t b) {
+	while(b) {
+		uint64_t t = a % b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
+
+// Both take a multiple of 8 taps
+static inline float dot(const float *x, const float *h, size_t n) {
+#if defined(RESAMPLER_SSE2)
+	__m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+	for(size_t i = 0; i < n; i += 8) {
+		acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(x + i), _mm_loadu_ps(h + i)));
+		acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(x + i + 4), _mm_loadu_ps(h + i + 4)));
+	}
+	acc0 = _mm_add_ps(acc0, acc1);
+	acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+	acc0 = _mm_add_ss(acc0, _mm_shuffle_ps(acc0, acc0, 1));
+	return _mm_cvtss_f32(acc0);
+#elif defined(RESAMPLER_NEON)
+	float32x4_t acc0 = vdupq_n_f32(0.0f), acc1 = vdupq_n_f32(0.0f);
+	for(size_t i = 0; i < n; i += 8) {
+		acc0 = vmlaq_f32(acc0, vld1q_f32(x + i), vld1q_f32(h + i));
+		acc1 = vmlaq_f32(acc1, vld1q_f32(x + i + 4), vld1q_f32(h + i + 4));
+	}
+	acc0 = vaddq_f32(acc0, acc1);
+	float32x2_t half = vadd_f32(vget_low_f32(acc0), vget_high_f32(acc0));
+	return vget_lane_f32(vpadd_f32(half, half), 0);
+#else
+	float acc[8] = { 0 };
+	for(size_t i = 0; i < n; i += 8) {
+		for(size_t j = 0; j < 8; ++j)
+			acc[j] += x[i + j] * h[i + j];
+	}
+	return ((acc[0] + acc[4]) + (acc[1] + acc[5])) + ((acc[2] + acc[6]) + (acc[3] + acc[7]));
+#endif
+}
+
+static inline float dotInterpolated(const float *x, const float *h0, const float *h1, float frac, size_t n) {
+#if defined(RESAMPLER_SSE2)
+	__m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+	__m128 f = _mm_set1_ps(frac);
+	for(size_t i = 0; i < n; i += 8) {
+		__m128 a0 = _mm_loadu_ps(h0 + i), a1 = _mm_loadu_ps(h0 + i + 4);
+		__m128 c0 = _mm_add_ps(a0, _mm_mul_ps(f, _mm_sub_ps(_mm_loadu_ps(h1 + i), a0)));
+		__m128 c1 = _mm_add_ps(a1, _mm_mul_ps(f, _mm_sub_ps(_mm_loadu_ps(h1 + i + 4), a1)));
+		acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(x + i), c0));
+		acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(x + i + 4), c1));
+	}
+	acc0 = _mm_add_ps(acc0, acc1);
+	acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+	acc0 = _mm_add_ss(acc0, _mm_shuffle_ps(acc0, acc0, 1));
+	return _mm_cvtss_f32(acc0);
+#elif defined(RESAMPLER_NEON)
+	float32x4_t acc0 = vdupq_n_f32(0.0f), acc1 = vdupq_n_f32(0.0f);
+	for(size_t i = 0; i < n; i += 8) {
+		float32x4_t a0 = vld1q_f32(h0 + i), a1 = vld1q_f32(h0 + i + 4);
+		float32x4_t c0 = vmlaq_n_f32(a0, vsubq_f32(vld1q_f32(h1 + i), a0), frac);
+		float32x4_t c1 = vmlaq_n_f32(a1, vsubq_f32(vld1q_f32(h1 + i + 4), a1), frac);
+		acc0 = vmlaq_f32(acc0, vld1q_f32(x + i), c0);
+		acc1 = vmlaq_f32(acc1, vld1q_f32(x + i + 4), c1);
+	}
+	acc0 = vaddq_f32(acc0, acc1);
+	float32x2_t half = vadd_f32(vget_low_f32(acc0), vget_high_f32(acc0));
+	return vget_lane_f32(vpadd_f32(half, half), 0);
+#else
+	float acc[8] = { 0 };
+	for(size_t i = 0; i < n; i += 8) {
+		for(size_t j = 0; j < 8; ++j)
+			acc[j] += x[i + j] * (h0[i + j] + frac * (h1[i + j] - h0[i + j]));
+	}
+	return ((acc[0] + acc[4]) + (acc[1] + acc[5])) + ((acc[2] + acc[6]) + (acc[3] + acc[7]));
+#endif
+}
+
+Resampler::Resampler(int _channelCount, double srcRate, double dstRate, int threadCount)
+: channelCount(_channelCount), historyPos(0), phase(0), inProcessed(0), outProcessed(0), flushing(false), outWanted(0), jobGeneration(0), pendingGroups(0), quit(false), jobCount(0) {
+	// Output positions step by downFactor / upFactor input frames
+	if(srcRate == floor(srcRate) && dstRate == floor(dstRate) && srcRate < 4294967296.0 && dstRate < 4294967296.0) {
+		uint64_t divisor = gcd((uint64_t)srcRate, (uint64_t)dstRate);
+		upFactor = (uint64_t)dstRate / divisor;
+		downFactor = (uint64_t)srcRate / divisor;
+	} else {
+		upFactor = 1 << 20;
+		downFactor = (uint64_t)llround(srcRate / dstRate * upFactor);
+	}
+	interpolate = upFactor > maxPhases;
+
+	buildKernels();
+
+	// Starts with the zeros preceding the first input frame
+	historyCapacity = taps + inputBlock;
+	historyCount = taps / 2 - 1;
+	history.resize(historyCapacity * channelCount);
+
+	schedule.resize(scheduleSize);
+
+	threadCount = std::max(1, std::min(threadCount, channelCount));
+	if(threadCount > 1)
+		planar.resize(scheduleSize * channelCount);
+	for(int i = 1; i < threadCount; ++i) {
+		workers.push_back(std::thread(&Resampler::workerLoop, this, i));
+	}
+}
+
+Resampler::~Resampler() {
+	{
+		std::lock_guard<std::mutex> lock(jobMutex);
+		quit = true;
+	}
+	jobStarted.notify_all();
+	for(auto &worker : workers) {
+		worker.join();
+	}
+}
+
+void Resampler::buildKernels() {
+	// Filter length is set by the transition band, in frames of the lower rate
+	double scale = downFactor > upFactor ? (double)downFactor / (double)upFactor : 1.0;
+	size_t lowTaps = (size_t)ceil((stopbandAttenuation - 7.95) / (2.285 * 2.0 * M_PI * transitionBand));
+	taps = (size_t)ceil(lowTaps * scale);
+	taps = std::min((taps + 7) & ~(size_t)7, maxTaps);
+
+	double cutoff = (0.5 - transitionBand / 2.0) / scale;
+	double beta = 0.1102 * (stopbandAttenuation - 8.7);
+	double windowScale = 1.0 / besselI0(beta);
+	double halfTaps = (double)(taps / 2);
+
+	size_t rows = interpolate ? interpolatedPhases + 1 : (size_t)upFactor;
+	kernels.resize(rows * taps);
+	std::vector<double> kernel(taps);
+	for(size_t row = 0; row < rows; ++row) {
+		double frac = interpolate ? (double)row / interpolatedPhases : (double)row / (double)upFactor;
+		double sum = 0.0;
+		for(size_t i = 0; i < taps; ++i) {
+			double t = halfTaps - 1.0 - (double)i + frac;
+			double x = t / halfTaps;
+			double window = x > -1.0 && x < 1.0 ? besselI0(beta * sqrt(1.0 - x * x)) * windowScale : 0.0;
+			double s = 2.0 * cutoff * t;
+			double sinc = s != 0.0 ? sin(M_PI * s) / (M_PI * s) : 1.0;
+			sum += kernel[i] = 2.0 * cutoff * sinc * window;
+		}
+		// Unity gain at every phase
+		for(size_t i = 0; i < taps; ++i) {
+			kernels[row * taps + i] = (float)(kernel[i] / sum);
+		}
+	}
+}
+
+size_t Resampler::latency() const {
+	uint64_t total = flushing ? outWanted : (inProcessed * upFactor + downFactor - 1) / downFactor;
+	return (size_t)(total - outProcessed);
+}
+
+void Resampler::compact() {
+	if(!historyPos)
+		return;
+	if(historyPos > historyCount) {
+		// At ratios the longest filter can't span, a step can reach past the
+		// frames held so far, and the rest of it skips input still to come
+		historyPos -= historyCount;
+		historyCount = 0;
+		return;
+	}
+	historyCount -= historyPos;
+	for(int i = 0; i < channelCount; ++i) {
+		float *channel = &history[i * historyCapacity];
+		memmove(channel, channel + historyPos, historyCount * sizeof(float));
+	}
+	historyPos = 0;
+}
+
+// Groups write to the output with the given strides, between frames and
+// between channels. Threads are given planar buffers, as interleaved output
+// would have them writing to the same cache lines all along.
+void Resampler::renderGroup(int group, size_t count, float *output, size_t frameStride, size_t channelStride) const {
+	int groupCount = (int)workers.size() + 1;
+	int first = group * channelCount / groupCount;
+	int last = (group + 1) * channelCount / groupCount;
+	for(size_t i = 0; i < count; ++i) {
+		const Step &step = schedule[i];
+		float *out = output + i * frameStride + first * channelStride;
+		const float *in = &history[first * historyCapacity + step.pos];
+		if(interpolate) {
+			for(int j = first; j < last; ++j, in += historyCapacity, out += channelStride) {
+				*out = dotInterpolated(in, step.kernel, step.kernel + taps, step.frac, taps);
+			}
+		} else {
+			for(int j = first; j < last; ++j, in += historyCapacity, out += channelStride) {
+				*out = dot(in, step.kernel, taps);
+			}
+		}
+	}
+}
+
+void Resampler::workerLoop(int group) {
+	uint32_t generation = 0;
+	for(;;) {
+		size_t count;
+		{
+			std::unique_lock<std::mutex> lock(jobMutex);
+			jobStarted.wait(lock, [&] { return quit || jobGeneration != generation; });
+			if(quit)
+				return;
+			generation = jobGeneration;
+			count = jobCount;
+		}
+		renderGroup(group, count, &planar[0], 1, scheduleSize);
+		{
+			std::lock_guard<std::mutex> lock(jobMutex);
+			if(!--pendingGroups)
+				jobFinished.notify_one();
+		}
+	}
+}
+
+// Renders as many frames as the history allows, up to outMax
+size_t Resampler::produce(float *output, size_t outMax) {
+	size_t ret = 0;
+	while(outMax) {
+		size_t limit = std::min(outMax, (size_t)scheduleSize);
+		if(flushing)
+			limit = (size_t)std::min((uint64_t)limit, outWanted - outProcessed);
+
+		size_t count = 0;
+		while(count < limit && historyPos + taps <= historyCount) {
+			Step &step = schedule[count++];
+			step.pos = historyPos;
+			if(interpolate) {
+				uint64_t position = phase * interpolatedPhases;
+				step.kernel = &kernels[(size_t)(position / upFactor) * taps];
+				step.frac = (float)(position % upFactor) / (float)upFactor;
+			} else {
+				step.kernel = &kernels[(size_t)phase * taps];
+				step.frac = 0.0f;
+			}
+			phase += downFactor;
+			historyPos += (size_t)(phase / upFactor);
+			phase %= upFactor;
+		}
+		if(!count)
+			break;
+
+		if(!workers.empty() && count >= 64) {
+			{
+				std::lock_guard<std::mutex> lock(jobMutex);
+				jobCount = count;
+				pendingGroups = (unsigned)workers.size();
+				++jobGeneration;
+			}
+			jobStarted.notify_all();
+			renderGroup(0, count, &planar[0], 1, scheduleSize);
+			{
+				std::unique_lock<std::mutex> lock(jobMutex);
+				jobFinished.wait(lock, [&] { return !pendingGroups; });
+			}
+			for(int i = 0; i < channelCount; ++i) {
+				const float *in = &planar[i * scheduleSize];
+				float *out = output + i;
+				for(size_t j = 0; j < count; ++j, out += channelCount) {
+					*out = in[j];
+				}
+			}
+		} else {
+			for(int i = 0; i <= (int)workers.size(); ++i) {
+				renderGroup(i, count, output, channelCount, 1);
+			}
+		}
+
+		output += count * channelCount;
+		outMax -= count;
+		outProcessed += count;
+		ret += count;
+	}
+	return ret;
+}
+
+size_t Resampler::resample(const float *input, size_t inCount, size_t *inDone, float *output, size_t outMax) {
+	size_t ret = 0;
+	if(inDone) *inDone = 0;
+	for(;;) {
+		size_t outputDone = produce(output, outMax);
+		output += outputDone * channelCount;
+		outMax -= outputDone;
+		ret += outputDone;
+		if(!outMax || !inCount)
+			break;
+
+		compact();
+		size_t blockCount = std::min(inCount, historyCapacity - historyCount);
+		for(int i = 0; i < channelCount; ++i) {
+			float *channel = &history[i * historyCapacity + historyCount];
+			const float *in = input + i;
+			for(size_t j = 0; j < blockCount; ++j, in += channelCount) {
+				channel[j] = *in;
+			}
+		}
+		historyCount += blockCount;
+		input += blockCount * channelCount;
+		inCount -= blockCount;
+		inProcessed += blockCount;
+		if(inDone) *inDone += blockCount;
+	}
+	return ret;
+}
+
+size_t Resampler::flush(float *output, size_t outMax) {
+	if(!flushing) {
+		flushing = true;
+		outWanted = (inProcessed * upFactor + downFactor - 1) / downFactor;
+	}
+	size_t ret = 0;
+	for(;;) {
+		size_t outputDone = produce(output, outMax);
+		output += outputDone * channelCount;
+		outMax -= outputDone;
+		ret += outputDone;
+		if(!outMax || outProcessed >= outWanted)
+			break;
+
+		// Pads the end of the stream with silence
+		compact();
+		size_t blockCount = historyCapacity - historyCount;
+		for(int i = 0; i < channelCount; ++i) {
+			memset(&history[i * historyCapacity + historyCount], 0, blockCount * sizeof(float));
+		}
+		historyCount += blockCount;
+	}
+	return ret;
+}
@@ -0,0 +1,93 @@
+//
+//  Resampler.h
+//  CogAudio Framework
+//
+
+#ifndef Resampler_h
+#define Resampler_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Polyphase windowed sinc resampler for interleaved float streams.
+//
+// The ratio is kept as an exact fraction of the two rates whenever they are
+// integral. Up to maxPhases, every output position gets its own kernel,
+// beyond that the kernels of the two nearest of interpolatedPhases positions
+// are interpolated. The filter is flat to 0.45 times the lower of the two
+// rates and attenuates by 140 dB from its Nyquist frequency on.
+//
+// Output is aligned with the input, the filter delay being compensated by
+// starting the history with zeros, and flush() then produces exactly
+// ceil(input frames * ratio) frames in total. Channels may be spread over
+// threadCount threads, which only pays off with many of them.
+class Resampler {
+	public:
+	Resampler(int channelCount, double srcRate, double dstRate, int threadCount = 1);
+	~Resampler();
+
+	// Output frames still owed for the input consumed so far
+	size_t latency() const;
+
+	// Consumes up to inCount frames, stopping early if outMax frames were output
+	size_t resample(const float *input, size_t inCount, size_t *inDone, float *output, size_t outMax);
+
+	// Outputs the rest of the stream, may be called repeatedly until it returns 0
+	size_t flush(float *output, size_t outMax);
+
+	private:
+	enum {
+		maxPhases = 1024,
+		interpolatedPhases = 1024,
+		inputBlock = 4096,
+		scheduleSize = 1024
+	};
+
+	struct Step {
+		size_t pos;
+		const float *kernel;
+		float frac;
+	};
+
+	int channelCount;
+	uint64_t upFactor, downFactor;
+	size_t taps;
+	bool interpolate;
+	std::vector<float> kernels;
+
+	size_t historyCapacity;
+	size_t historyCount;
+	size_t historyPos;
+	uint64_t phase;
+	std::vector<float> history;
+
+	uint64_t inProcessed;
+	uint64_t outProcessed;
+	bool flushing;
+	uint64_t outWanted;
+
+	std::vector<Step> schedule;
+
+	std::vector<std::thread> workers;
+	std::mutex jobMutex;
+	std::condition_variable jobStarted;
+	std::condition_variable jobFinished;
+	uint32_t jobGeneration;
+	unsigned pendingGroups;
+	bool quit;
+	size_t jobCount;
+	std::vector<float> planar;
+
+	void buildKernels();
+	void compact();
+	size_t produce(float *output, size_t outMax);
+	void renderGroup(int group, size_t count, float *output, size_t frameStride, size_t channelStride) const;
+	void workerLoop(int group);
+};
+
+#endif /* Resampler_h */
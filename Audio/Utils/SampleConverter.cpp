@@ -0,0 +1,330 @@
+//
+//  SampleConverter.cpp
+//  CogAudio Framework
+//
+
+#include "SampleConverter.h"
+
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define CONVERTER_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CONVERTER_NEON
+#endif
+
+static const float scale16 = 1.0f / 32768.0f;
+static const float scale32 = 1.0f / 2147483648.0f;
+
+// Scalar versions, also used for the tails of the vector loops
+
+template <bool isUnsigned>
+static inline int16_t read8(const uint8_t *in) {
+	uint16_t sample = (in[0] << 8) | in[0];
+	if(isUnsigned)
+		sample ^= 0x8080;
+	return (int16_t)sample;
+}
+
+template <bool isUnsigned, bool isBigEndian>
+static inline int16_t read16(const uint8_t *in) {
+	uint16_t sample = isBigEndian ? (in[0] << 8) | in[1] : in[0] | (in[1] << 8);
+	if(isUnsigned)
+		sample ^= 0x8000;
+	return (int16_t)sample;
+}
+
+template <bool isUnsigned, bool isBigEndian>
+static inline int32_t read24(const uint8_t *in) {
+	uint32_t sample = isBigEndian ? ((uint32_t)in[2] << 8) | ((uint32_t)in[1] << 16) | ((uint32_t)in[0] << 24) : ((uint32_t)in[0] << 8) | ((uint32_t)in[1] << 16) | ((uint32_t)in[2] << 24);
+	if(isUnsigned)
+		sample ^= 0x80000000;
+	return (int32_t)sample;
+}
+
+template <bool isUnsigned, bool isBigEndian>
+static inline int32_t read32(const uint8_t *in) {
+	uint32_t sample;
+	memcpy(&sample, in, 4);
+	if(isBigEndian)
+		sample = __builtin_bswap32(sample);
+	if(isUnsigned)
+		sample ^= 0x80000000;
+	return (int32_t)sample;
+}
+
+template <bool isBigEndian>
+static inline float readFloat(const uint8_t *in) {
+	uint32_t sample;
+	memcpy(&sample, in, 4);
+	if(isBigEndian)
+		sample = __builtin_bswap32(sample);
+	float ret;
+	memcpy(&ret, &sample, 4);
+	return ret;
+}
+
+template <bool isBigEndian>
+static inline float readDouble(const uint8_t *in) {
+	uint64_t sample;
+	memcpy(&sample, in, 8);
+	if(isBigEndian)
+		sample = __builtin_bswap64(sample);
+	double ret;
+	memcpy(&ret, &sample, 8);
+	return (float)ret;
+}
+
+#if defined(CONVERTER_SSE2)
+static inline void store16(float *out, __m128i samples) {
+	const __m128 scale = _mm_set1_ps(scale16);
+	__m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+	__m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+	_mm_storeu_ps(out, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+	_mm_storeu_ps(out + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+}
+
+static inline __m128i swap32(__m128i x) {
+	x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+	return _mm_or_si128(_mm_slli_epi32(x, 16), _mm_srli_epi32(x, 16));
+}
+#elif defined(CONVERTER_NEON)
+static inline void store16(float *out, int16x8_t samples) {
+	vst1q_f32(out, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(samples))), scale16));
+	vst1q_f32(out + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(samples))), scale16));
+}
+#endif
+
+template <bool isUnsigned>
+static void convert_8_to_f32(float *output, const void *input, size_t count) {
+	const uint8_t *in = (const uint8_t *)input;
+	size_t i = 0;
+#if defined(CONVERTER_SSE2)
+	const __m128i flip = _mm_set1_epi8(isUnsigned ? (char)0x80 : 0);
+	for(; i + 16 <= count; i += 16) {
+		__m128i samples = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(in + i)), flip);
+		store16(output + i, _mm_unpacklo_epi8(samples, samples));
+		store16(output + i + 8, _mm_unpackhi_epi8(samples, samples));
+	}
+#elif defined(CONVERTER_NEON)
+	const uint8x8_t flip = vdup_n_u8(isUnsigned ? 0x80 : 0);
+	for(; i + 8 <= count; i += 8) {
+		uint8x8_t samples = veor_u8(vld1_u8(in + i), flip);
+		uint8x8x2_t doubled = vzip_u8(samples, samples);
+		store16(output + i, vreinterpretq_s16_u8(vcombine_u8(doubled.val[0], doubled.val[1])));
+	}
+#endif
+	for(; i < count; ++i) {
+		output[i] = (float)read8<isUnsigned>(in + i) * scale16;
+	}
+}
+
+template <bool isUnsigned, bool isBigEndian>
+static void convert_16_to_f32(float *output, const void *input, size_t count) {
+	const uint8_t *in = (const uint8_t *)input;
+	size_t i = 0;
+#if defined(CONVERTER_SSE2)
+	const __m128i flip = _mm_set1_epi16(isUnsigned ? (short)0x8000 : 0);
+	for(; i + 8 <= count; i += 8) {
+		__m128i samples = _mm_loadu_si128((const __m128i *)(in + i * 2));
+		if(isBigEndian)
+			samples = _mm_or_si128(_mm_slli_epi16(samples, 8), _mm_srli_epi16(samples, 8));
+		store16(output + i, _mm_xor_si128(samples, flip));
+	}
+#elif defined(CONVERTER_NEON)
+	const int16x8_t flip = vdupq_n_s16(isUnsigned ? (int16_t)0x8000 : 0);
+	for(; i + 8 <= count; i += 8) {
+		uint8x16_t bytes = vld1q_u8(in + i * 2);
+		if(isBigEndian)
+			bytes = vrev16q_u8(bytes);
+		store16(output + i, veorq_s16(vreinterpretq_s16_u8(bytes), flip));
+	}
+#endif
+	for(; i < count; ++i) {
+		output[i] = (float)read16<isUnsigned, isBigEndian>(in + i * 2) * scale16;
+	}
+}
+
+// Whole words are loaded from every third byte, which needs one byte past
+// the sample, and the compiler vectorizes the rest
+template <bool isUnsigned, bool isBigEndian>
+static void convert_24_to_f32(float *output, const void *input, size_t count) {
+	const uint8_t *in = (const uint8_t *)input;
+	size_t i = 0;
+	for(; i + 1 < count; ++i) {
+		uint32_t sample;
+		memcpy(&sample, in + i * 3, 4);
+		sample = isBigEndian ? __builtin_bswap32(sample) & 0xFFFFFF00 : sample << 8;
+		if(isUnsigned)
+			sample ^= 0x80000000;
+		output[i] = (float)(int32_t)sample * scale32;
+	}
+	for(; i < count; ++i) {
+		output[i] = (float)read24<isUnsigned, isBigEndian>(in + i * 3) * scale32;
+	}
+}
+
+template <bool isUnsigned, bool isBigEndian>
+static void convert_32_to_f32(float *output, const void *input, size_t count) {
+	const uint8_t *in = (const uint8_t *)input;
+	size_t i = 0;
+#if defined(CONVERTER_SSE2)
+	const __m128i flip = _mm_set1_epi32(isUnsigned ? (int)0x80000000 : 0);
+	const __m128 scale = _mm_set1_ps(scale32);
+	for(; i + 4 <= count; i += 4) {
+		__m128i samples = _mm_loadu_si128((const __m128i *)(in + i * 4));
+		if(isBigEndian)
+			samples = swap32(samples);
+		samples = _mm_xor_si128(samples, flip);
+		_mm_storeu_ps(output + i, _mm_mul_ps(_mm_cvtepi32_ps(samples), scale));
+	}
+#elif defined(CONVERTER_NEON)
+	const int32x4_t flip = vdupq_n_s32(isUnsigned ? (int32_t)0x80000000 : 0);
+	for(; i + 4 <= count; i += 4) {
+		uint8x16_t bytes = vld1q_u8(in + i * 4);
+		if(isBigEndian)
+			bytes = vrev32q_u8(bytes);
+		int32x4_t samples = veorq_s32(vreinterpretq_s32_u8(bytes), flip);
+		vst1q_f32(output + i, vmulq_n_f32(vcvtq_f32_s32(samples), scale32));
+	}
+#endif
+	for(; i < count; ++i) {
+		output[i] = (float)read32<isUnsigned, isBigEndian>(in + i * 4) * scale32;
+	}
+}
+
+static void convert_f32_to_f32(float *output, const void *input, size_t count) {
+	if(output != input)
+		memmove(output, input, count * sizeof(float));
+}
+
+static void convert_f32be_to_f32(float *output, const void *input, size_t count) {
+	const uint8_t *in = (const uint8_t *)input;
+	size_t i = 0;
+#if defined(CONVERTER_SSE2)
+	for(; i + 4 <= count; i += 4) {
+		__m128i samples = swap32(_mm_loadu_si128((const __m128i *)(in + i * 4)));
+		_mm_storeu_ps(output + i, _mm_castsi128_ps(samples));
+	}
+#elif defined(CONVERTER_NEON)
+	for(; i + 4 <= count; i += 4) {
+		vst1q_f32(output + i, vreinterpretq_f32_u8(vrev32q_u8(vld1q_u8(in + i * 4))));
+	}
+#endif
+	for(; i < count; ++i) {
+		output[i] = readFloat<true>(in + i * 4);
+	}
+}
+
+template <bool isBigEndian>
+static void convert_f64_to_f32(float *output, const void *input, size_t count) {
+	const uint8_t *in = (const uint8_t *)input;
+	size_t i = 0;
+#if defined(CONVERTER_SSE2)
+	for(; i + 4 <= count; i += 4) {
+		__m128i lo = _mm_loadu_si128((const __m128i *)(in + i * 8));
+		__m128i hi = _mm_loadu_si128((const __m128i *)(in + i * 8 + 16));
+		if(isBigEndian) {
+			lo = _mm_shuffle_epi32(swap32(lo), _MM_SHUFFLE(2, 3, 0, 1));
+			hi = _mm_shuffle_epi32(swap32(hi), _MM_SHUFFLE(2, 3, 0, 1));
+		}
+		__m128 samples = _mm_movelh_ps(_mm_cvtpd_ps(_mm_castsi128_pd(lo)), _mm_cvtpd_ps(_mm_castsi128_pd(hi)));
+		_mm_storeu_ps(output + i, samples);
+	}
+#elif defined(CONVERTER_NEON) && defined(__aarch64__)
+	for(; i + 4 <= count; i += 4) {
+		uint8x16_t lo = vld1q_u8(in + i * 8);
+		uint8x16_t hi = vld1q_u8(in + i * 8 + 16);
+		if(isBigEndian) {
+			lo = vrev64q_u8(lo);
+			hi = vrev64q_u8(hi);
+		}
+		float32x2_t low = vcvt_f32_f64(vreinterpretq_f64_u8(lo));
+		vst1q_f32(output + i, vcvt_high_f32_f64(low, vreinterpretq_f64_u8(hi)));
+	}
+#endif
+	for(; i < count; ++i) {
+		output[i] = readDouble<isBigEndian>(in + i * 8);
+	}
+}
+
+template <bool isUnsigned>
+static void convert_8_to_s32(int32_t *output, const void *input, size_t count) {
+	const uint8_t *in = (const uint8_t *)input;
+	for(size_t i = 0; i < count; ++i) {
+		output[i] = read8<isUnsigned>(in + i);
+	}
+}
+
+template <bool isUnsigned, bool isBigEndian>
+static void convert_16_to_s32(int32_t *output, const void *input, size_t count) {
+	const uint8_t *in = (const uint8_t *)input;
+	for(size_t i = 0; i < count; ++i) {
+		output[i] = read16<isUnsigned, isBigEndian>(in + i * 2);
+	}
+}
+
+// Indexed by [isUnsigned][isBigEndian]
+static const SampleConverterFunc converters8[2][2] = {
+	{ convert_8_to_f32<false>, convert_8_to_f32<false> },
+	{ convert_8_to_f32<true>, convert_8_to_f32<true> }
+};
+
+static const SampleConverterFunc converters16[2][2] = {
+	{ convert_16_to_f32<false, false>, convert_16_to_f32<false, true> },
+	{ convert_16_to_f32<true, false>, convert_16_to_f32<true, true> }
+};
+
+static const SampleConverterFunc converters24[2][2] = {
+	{ convert_24_to_f32<false, false>, convert_24_to_f32<false, true> },
+	{ convert_24_to_f32<true, false>, convert_24_to_f32<true, true> }
+};
+
+static const SampleConverterFunc converters32[2][2] = {
+	{ convert_32_to_f32<false, false>, convert_32_to_f32<false, true> },
+	{ convert_32_to_f32<true, false>, convert_32_to_f32<true, true> }
+};
+
+static const SampleConverterInt32Func converters8ToInt32[2][2] = {
+	{ convert_8_to_s32<false>, convert_8_to_s32<false> },
+	{ convert_8_to_s32<true>, convert_8_to_s32<true> }
+};
+
+static const SampleConverterInt32Func converters16ToInt32[2][2] = {
+	{ convert_16_to_s32<false, false>, convert_16_to_s32<false, true> },
+	{ convert_16_to_s32<true, false>, convert_16_to_s32<true, true> }
+};
+
+SampleConverterFunc sampleConverterForFormat(uint32_t bitsPerSample, bool isFloat, bool isUnsigned, bool isBigEndian) {
+	if(isFloat) {
+		if(bitsPerSample == 32)
+			return isBigEndian ? convert_f32be_to_f32 : convert_f32_to_f32;
+		else if(bitsPerSample == 64)
+			return isBigEndian ? convert_f64_to_f32<true> : convert_f64_to_f32<false>;
+		return NULL;
+	}
+
+	if(bitsPerSample < 2)
+		return NULL;
+	else if(bitsPerSample <= 8)
+		return converters8[isUnsigned][isBigEndian];
+	else if(bitsPerSample <= 16)
+		return converters16[isUnsigned][isBigEndian];
+	else if(bitsPerSample <= 24)
+		return converters24[isUnsigned][isBigEndian];
+	else if(bitsPerSample <= 32)
+		return converters32[isUnsigned][isBigEndian];
+	return NULL;
+}
+
+SampleConverterInt32Func sampleConverterInt32ForFormat(uint32_t bitsPerSample, bool isUnsigned, bool isBigEndian) {
+	if(bitsPerSample < 2)
+		return NULL;
+	else if(bitsPerSample <= 8)
+		return converters8ToInt32[isUnsigned][isBigEndian];
+	else if(bitsPerSample <= 16)
+		return converters16ToInt32[isUnsigned][isBigEndian];
+	return NULL;
+}
@@ -0,0 +1,35 @@
+//
+//  SampleConverter.h
+//  CogAudio Framework
+//
+
+#ifndef SampleConverter_h
+#define SampleConverter_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Converts count interleaved samples to float in a single pass. Integers are
+// scaled from their container size, so 8 bit samples become 16 bit ones with
+// the byte repeated, and 20 bit samples are read like 24 bit ones. Only 32
+// and 64 bit input may be converted in place.
+typedef void (*SampleConverterFunc)(float *output, const void *input, size_t count);
+
+// Converts count 8 or 16 bit samples to 16 bit range integers, as the HDCD decoder takes them
+typedef void (*SampleConverterInt32Func)(int32_t *output, const void *input, size_t count);
+
+// Returns NULL for formats which are not handled, which includes DSD
+SampleConverterFunc sampleConverterForFormat(uint32_t bitsPerSample, bool isFloat, bool isUnsigned, bool isBigEndian);
+
+SampleConverterInt32Func sampleConverterInt32ForFormat(uint32_t bitsPerSample, bool isUnsigned, bool isBigEndian);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SampleConverter_h */
@@ -528,6 +528,8 @@ static void EMU_CALL dma_transfer(struct IOP_STATE *state, uint32 core, uint32 c
     break;
   }
 
+  if(!is_writing) { r3000_memory_written(R3000STATE); }
+
   /*
   ** Behavior here depends on compat level
   */
@@ -784,6 +786,10 @@ static void EMU_CALL iop_emucall_sw(void *state, uint32 a, uint32 d, uint32 mask
     break;
   }
   *((sint32*)((PSXRAM_BYTE_NATIVE)+((d+(4*( 0 )))&0x1FFFFC))) = r;
+  //
+  // The call may have loaded anything into RAM, code included
+  //
+  r3000_memory_written(R3000STATE);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1138,6 +1144,7 @@ uint32 EMU_CALL iop_getword(void *state, uint32 a) { a &= 0x1FFFFFFC;
 void EMU_CALL iop_setword(void *state, uint32 a, uint32 d) { a &= 0x1FFFFFFC;
   if(a < 0x00800000) {
     (*((uint32*)(PSXRAM_BYTE_NATIVE+(a&0x1FFFFC)))) = d;
+    r3000_memory_written(R3000STATE);
   }
 }
 
@@ -1199,7 +1206,7 @@ void EMU_CALL iop_upload_to_ram(void *state, uint32 address, const void *src, ui
     len -= advance;
     address += advance;
   }
-
+  r3000_memory_written(R3000STATE);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
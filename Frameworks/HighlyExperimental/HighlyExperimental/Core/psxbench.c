@@ -0,0 +1,270 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// psxbench - Times the whole PS1 core with the R3000 block cache on and off
+//
+// Not part of any target.  Build it on its own, from this directory, with
+// emuconfig.h where the <HighlyExperimental/...> includes can find it:
+//
+//   mkdir -p /tmp/he/HighlyExperimental && cp emuconfig.h /tmp/he/HighlyExperimental/
+//   cc -O2 -I/tmp/he -DEMU_COMPILE -DEMU_LITTLE_ENDIAN -DHAVE_STDINT_H psxbench.c psx.c iop.c ioptimer.c r3000.c spu.c spucore.c bios.c vfs.c mkhebios.c r3000asm.c r3000dis.c -lz -o psxbench
+//
+// Run it with the BIOS image, and optionally a self-contained .psf:
+//
+//   ./psxbench ../../../../Plugins/HighlyComplete/HighlyComplete/hebios.bin [file.psf]
+//
+// Without a .psf it runs a built-in program shaped like a sound driver: the
+// main loop idles, and a vblank event handler installed through the BIOS
+// does sequencer work and writes the SPU voice registers on every tick.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#include "psx.h"
+#include "iop.h"
+#include "r3000.h"
+#include "r3000asm.h"
+#include "bios.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <zlib.h>
+
+#define BENCH_SECONDS (60)
+#define BENCH_RUNS    (5)
+
+#define DRIVER_BASE (0x80010000)
+
+//
+// "@label" is replaced by the address of label, "@label_lo" by its low half
+//
+static const char *driver_source[] = {
+  "start:",
+  "lui $s7,0x1F80",
+  "ori $t0,$0,0xC000", "sh $t0,0x1DAA($s7)",
+  "ori $t0,$0,0x3FFF", "sh $t0,0x1D80($s7)", "sh $t0,0x1D82($s7)",
+  // pitch table
+  "lui $s0,0x8008",
+  "ori $t0,$0,0x1000", "sh $t0,0($s0)",  "ori $t0,$0,0x10F3", "sh $t0,2($s0)",
+  "ori $t0,$0,0x11F5", "sh $t0,4($s0)",  "ori $t0,$0,0x1306", "sh $t0,6($s0)",
+  "ori $t0,$0,0x1428", "sh $t0,8($s0)",  "ori $t0,$0,0x155B", "sh $t0,10($s0)",
+  "ori $t0,$0,0x16A0", "sh $t0,12($s0)", "ori $t0,$0,0x17F9", "sh $t0,14($s0)",
+  "ori $t0,$0,0x1965", "sh $t0,16($s0)", "ori $t0,$0,0x1AE8", "sh $t0,18($s0)",
+  "ori $t0,$0,0x1C82", "sh $t0,20($s0)", "ori $t0,$0,0x1E34", "sh $t0,22($s0)",
+  "ori $t0,$0,1", "sw $t0,0x80($s0)", "sw $0,0x84($s0)",
+  // voice start addresses and envelopes
+  "ori $s2,$0,0",
+  "vinit:",
+  "sll $t6,$s2,4", "addu $t6,$t6,$s7",
+  "ori $t0,$0,0x0200", "sh $t0,0x1C06($t6)",
+  "ori $t0,$0,0x80FF", "sh $t0,0x1C08($t6)",
+  "ori $t0,$0,0x1FC0", "sh $t0,0x1C0A($t6)",
+  "addiu $s2,$s2,1", "sltiu $t0,$s2,24", "bne $t0,$0,@vinit", "nop",
+  // EnterCriticalSection, OpenEvent(RCnt3, EvSpINT, EvMdINTR, tick),
+  // EnableEvent, unmask vblank, ExitCriticalSection
+  "ori $a0,$0,1", "syscall",
+  "lui $a0,0xF200", "ori $a0,$a0,3", "ori $a1,$0,2", "ori $a2,$0,0x1000",
+  "lui $a3,0x8001", "ori $a3,$a3,@tick_lo",
+  "ori $t1,$0,0x08", "ori $t2,$0,0xB0", "jalr $ra,$t2", "nop",
+  "or $a0,$v0,$0",
+  "ori $t1,$0,0x0C", "ori $t2,$0,0xB0", "jalr $ra,$t2", "nop",
+  "lw $t0,0x1074($s7)", "ori $t0,$t0,1", "sw $t0,0x1074($s7)",
+  "ori $a0,$0,2", "syscall",
+  "idle:",
+  "j @idle", "nop",
+  //
+  // Vblank handler
+  //
+  "tick:",
+  "addiu $sp,$sp,-32",
+  "sw $ra,0($sp)", "sw $s0,4($sp)", "sw $s1,8($sp)", "sw $s2,12($sp)",
+  "sw $s5,16($sp)", "sw $s6,20($sp)", "sw $s7,24($sp)",
+  "lui $s7,0x1F80", "lui $s0,0x8008",
+  "lui $s5,0x41C6", "ori $s5,$s5,0x4E6D",
+  "lw $s1,0x80($s0)", "lw $s6,0x84($s0)",
+  // BIOS memcpy of the sequence buffer
+  "lui $a0,0x8009", "lui $a1,0x8008", "ori $a2,$0,512",
+  "ori $t1,$0,0x2A", "ori $t2,$0,0xA0", "jalr $ra,$t2", "nop",
+  // 2000 channel updates
+  "ori $s2,$0,0",
+  "chan:",
+  "multu $s1,$s5", "mflo $s1", "addiu $s1,$s1,12345",
+  "srl $t0,$s1,16", "andi $t1,$t0,15", "sltiu $t2,$t1,12", "bne $t2,$0,@note", "nop",
+  "addiu $t1,$t1,-12",
+  "note:",
+  "sll $t1,$t1,1", "addu $t1,$t1,$s0", "lhu $t4,0($t1)",
+  "srl $t5,$t0,4", "andi $t5,$t5,3", "srlv $t4,$t4,$t5",
+  "andi $t6,$s2,15", "sll $t6,$t6,4", "addu $t6,$t6,$s7",
+  "sh $t4,0x1C04($t6)",
+  "mult $s6,$s2", "mflo $t7", "andi $t7,$t7,0x3FFF",
+  "sh $t7,0x1C00($t6)", "sh $t7,0x1C02($t6)",
+  "andi $t8,$s2,63", "sll $t8,$t8,5", "addu $t8,$t8,$s0",
+  "sw $s1,0x100($t8)", "sw $t4,0x104($t8)", "sh $t7,0x108($t8)",
+  "lw $t9,0x10C($t8)", "addiu $t9,$t9,1", "sw $t9,0x10C($t8)",
+  "addiu $s2,$s2,1", "sltiu $t0,$s2,2000", "bne $t0,$0,@chan", "nop",
+  // key on every 8th tick
+  "andi $t0,$s6,7", "bne $t0,$0,@nokey", "nop",
+  "srl $t0,$s1,8", "sh $t0,0x1D88($s7)", "srl $t0,$s1,24", "sh $t0,0x1D8A($s7)",
+  "nokey:",
+  "addiu $s6,$s6,1",
+  "sw $s1,0x80($s0)", "sw $s6,0x84($s0)",
+  "lw $ra,0($sp)", "lw $s0,4($sp)", "lw $s1,8($sp)", "lw $s2,12($sp)",
+  "lw $s5,16($sp)", "lw $s6,20($sp)", "lw $s7,24($sp)",
+  "jr $ra", "addiu $sp,$sp,32",
+  NULL
+};
+
+static uint8 bios[0x80000];
+
+static uint8 *exe;
+static uint32 exe_size;
+
+/////////////////////////////////////////////////////////////////////////////
+
+static uint32 get32lsb(const uint8 *p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24);
+}
+
+static void put32lsb(uint8 *p, uint32 n) {
+  p[0] = n; p[1] = n >> 8; p[2] = n >> 16; p[3] = n >> 24;
+}
+
+static uint32 driver_label(const char *name, size_t len) {
+  uint32 pc = DRIVER_BASE;
+  int i;
+  for(i = 0; driver_source[i]; i++) {
+    size_t l = strlen(driver_source[i]);
+    if(driver_source[i][l - 1] != ':') { pc += 4; continue; }
+    if(l - 1 == len && !strncmp(driver_source[i], name, len)) return pc;
+  }
+  fprintf(stderr, "undefined label %.*s\n", (int)len, name);
+  exit(1);
+}
+
+static int driver_build(void) {
+  uint32 pc = DRIVER_BASE;
+  uint32 n = 0;
+  int i;
+  exe_size = 0x800 + 0x1000;
+  exe = calloc(1, exe_size);
+  for(i = 0; driver_source[i]; i++) {
+    const char *s = driver_source[i];
+    char text[128], errorstring[256];
+    char *t = text;
+    if(s[strlen(s) - 1] == ':') continue;
+    while(*s) {
+      const char *name;
+      size_t len;
+      if(*s != '@') { *t++ = *s++; continue; }
+      name = ++s;
+      while(isalnum(*s) || *s == '_') s++;
+      len = s - name;
+      if(len > 3 && !strncmp(s - 3, "_lo", 3)) {
+        t += sprintf(t, "0x%X", driver_label(name, len - 3) & 0xFFFF);
+      } else {
+        t += sprintf(t, "0x%X", driver_label(name, len));
+      }
+    }
+    *t = 0;
+    if(r3000asm(pc, text, (uint32*)(exe + 0x800) + n, errorstring) < 0) {
+      fprintf(stderr, "%s: %s\n", text, errorstring);
+      return -1;
+    }
+    n++;
+    pc += 4;
+  }
+  memcpy(exe, "PS-X EXE", 8);
+  put32lsb(exe + 0x10, DRIVER_BASE);
+  put32lsb(exe + 0x18, DRIVER_BASE);
+  put32lsb(exe + 0x1C, n * 4);
+  put32lsb(exe + 0x30, 0x801FFF00);
+  strcpy((char*)exe + 0x4C, "Sony Computer Entertainment Inc. for North America area");
+  return 0;
+}
+
+//
+// Self-contained .psf only; a minipsf needs its _lib, which this doesn't load
+//
+static int psf_read(const char *path) {
+  FILE *f = fopen(path, "rb");
+  uint8 header[16];
+  uint8 *program;
+  uLongf size = 0x200000 + 0x800;
+  uint32 compressed;
+  if(!f) return -1;
+  if(fread(header, 1, 16, f) != 16 || memcmp(header, "PSF\x01", 4)) { fclose(f); return -1; }
+  compressed = get32lsb(header + 8);
+  fseek(f, 16 + get32lsb(header + 4), SEEK_SET);
+  program = malloc(compressed);
+  exe = malloc(size);
+  if(fread(program, 1, compressed, f) != compressed || uncompress(exe, &size, program, compressed) != Z_OK) {
+    fclose(f);
+    return -1;
+  }
+  fclose(f);
+  free(program);
+  exe_size = (uint32)size;
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+static double bench_run(uint32 block_cache, uint32 *hash) {
+  void *state = malloc(psx_get_state_size(1));
+  static sint16 buf[2 * 1024];
+  uint32 total = 0, h = 0;
+  clock_t t1, t2;
+  uint32 i;
+
+  psx_clear_state(state, 1);
+  if(psx_upload_psxexe(state, exe, exe_size) < 0) { fprintf(stderr, "not a PS-X EXE\n"); exit(1); }
+  r3000_set_block_cache(iop_get_r3000_state(psx_get_iop_state(state)), block_cache);
+
+  t1 = clock();
+  while(total < BENCH_SECONDS * 44100) {
+    uint32 samples = 1024;
+    if(psx_execute(state, 0x7FFFFFFF, buf, &samples, 0) < 0) { fprintf(stderr, "execute failed\n"); exit(1); }
+    for(i = 0; i < samples * 2; i++) { h = h * 31 + (uint16)buf[i]; }
+    total += samples;
+  }
+  t2 = clock();
+
+  //
+  // The driver counts its own ticks in RAM, so check those too
+  //
+  h = h * 31 + iop_getword(psx_get_iop_state(state), 0x8010C);
+  *hash = h;
+  free(state);
+  return ((double)(t2 - t1)) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char **argv) {
+  double best[2] = { 1e9, 1e9 };
+  uint32 hash[2];
+  FILE *f;
+  int i;
+
+  if(argc < 2) { fprintf(stderr, "usage: %s hebios.bin [file.psf]\n", argv[0]); return 1; }
+  f = fopen(argv[1], "rb");
+  if(!f || fread(bios, 1, sizeof(bios), f) != sizeof(bios)) { fprintf(stderr, "can't read %s\n", argv[1]); return 1; }
+  fclose(f);
+  if(argc > 2 ? psf_read(argv[2]) : driver_build()) { fprintf(stderr, "can't load %s\n", argc > 2 ? argv[2] : "driver"); return 1; }
+
+  bios_set_image(bios, sizeof(bios));
+  psx_init();
+
+  //
+  // Alternate the two so that drift in machine load hits both alike
+  //
+  for(i = 0; i < BENCH_RUNS * 2; i++) {
+    double t = bench_run(i & 1, hash + (i & 1));
+    if(t < best[i & 1]) best[i & 1] = t;
+  }
+
+  printf("%d s of audio, best of %d:\n", BENCH_SECONDS, BENCH_RUNS);
+  printf("  block cache off: %.3f s (%.1fx realtime)\n", best[0], BENCH_SECONDS / best[0]);
+  printf("  block cache on:  %.3f s (%.1fx realtime)\n", best[1], BENCH_SECONDS / best[1]);
+  printf("  output %s\n", (hash[0] == hash[1]) ? "identical" : "DIFFERS");
+  return hash[0] != hash[1];
+}
@@ -46,6 +46,42 @@ sint32 EMU_CALL r3000_init(void) {
 #define C0_epc    (14)
 #define C0_prid   (15)
 
+/*
+** Predecoded block cache
+**
+** Straight-line runs of instructions (up to and including a branch and its
+** delay slot) are decoded once into R3000_OP arrays. A block remembers the
+** instruction words it was built from and is compared against memory again
+** whenever code_gen has moved on since it was last checked. code_gen is
+** bumped when the hardware or host reports a write to memory
+** (r3000_memory_written), and on every store, from a block or from the
+** interpreter, to a page that holds cached code. Stores anywhere else leave
+** it alone, so blocks aren't compared again while only data is changing.
+*/
+#define BLOCK_CACHE_SIZE (256)
+#define BLOCK_MAX_OPS    (32)
+
+/*
+** Pages are tracked by physical address, RAM mirrors fold together and
+** everything outside RAM shares the upper half
+*/
+#define CODE_PAGES (1024)
+#define CODE_PAGE(a) ((((a) >> 12) & 511) | ((((a) & 0x1F800000) != 0) << 9))
+
+struct R3000_OP {
+  uint8 kind;
+  uint8 s, t, d;
+  uint32 imm;
+};
+
+struct R3000_BLOCK {
+  uint32 pc;
+  uint32 count;
+  uint32 gen;
+  uint32 words[BLOCK_MAX_OPS];
+  struct R3000_OP ops[BLOCK_MAX_OPS];
+};
+
 struct R3000_STATE {
   uint32 regs[32];
 
@@ -91,6 +127,13 @@ struct R3000_STATE {
   uint32 maxpc;
   void *fetchbase;
   uint32 fetchbox;
+  uint32 fetch_direct;
+  uint32 block_exit;
+
+  uint32 block_cache_enable;
+  uint32 code_gen;
+  uint8 code_pages[CODE_PAGES];
+  struct R3000_BLOCK blocks[BLOCK_CACHE_SIZE];
 };
 
 uint32 EMU_CALL r3000_get_state_size(void) {
@@ -103,6 +146,7 @@ void EMU_CALL r3000_clear_state(void *state) {
   STATE->pc = 0xBFC00000;
   /* update statistics every 20 million cycles (may overshoot a little) */
   STATE->usage_cycles_max = 20000000;
+  STATE->block_cache_enable = 1;
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -135,6 +179,23 @@ void EMU_CALL r3000_set_prid(void *state, uint32 prid) {
   STATE->c0_prid = prid;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+/*
+** Enable or disable the predecoded block cache
+** Both ways of execution are cycle-exact and produce identical results
+*/
+void EMU_CALL r3000_set_block_cache(void *state, uint32 enable) {
+  STATE->block_cache_enable = enable ? 1 : 0;
+}
+
+/*
+** Hardware or host wrote to memory behind the CPU's back (DMA, uploads,
+** emulator calls)
+*/
+void EMU_CALL r3000_memory_written(void *state) {
+  STATE->code_gen++;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 
 static EMU_INLINE uint32 EMU_CALL getc0(struct R3000_STATE *state, uint32 regnum) {
@@ -188,6 +249,7 @@ void EMU_CALL r3000_setreg(void *state, sint32 regnum, uint32 value) {
 /////////////////////////////////////////////////////////////////////////////
 
 void EMU_CALL r3000_break(void *state) {
+  STATE->block_exit = 1;
   if(STATE->cycles_remaining <= 0) return;
   STATE->cycles_deferred_from_break += STATE->cycles_remaining;
   STATE->cycles_remaining_last_checkpoint -= STATE->cycles_remaining;
@@ -312,10 +374,12 @@ static EMU_INLINE void EMU_CALL renew_fetch_region(struct R3000_STATE *state) {
     uint32 astart = (state->pc) & (~(t->mask));
     state->maxpc = astart + ((t->mask) + 1);
     state->fetchbase = ((uint8*)(t->p)) - astart;
+    state->fetch_direct = 1;
   } else {
     state->maxpc = state->pc + 4;
     state->fetchbase = ((uint8*)(&(state->fetchbox)))-(state->pc);
     state->fetchbox = ((r3000_load_callback_t)(t->p))(state->hwstate, state->pc, 0xFFFFFFFF);
+    state->fetch_direct = 0;
   }
 }
 
@@ -387,6 +451,7 @@ static EMU_INLINE uint32 EMU_CALL lw_noeffects(struct R3000_STATE *state, uint32
 
 static EMU_INLINE void EMU_CALL sb(struct R3000_STATE *state, uint32 a, uint32 d) {
   struct R3000_MEMORY_TYPE *t = mmwalk(state->map_store, a);
+  state->code_gen += state->code_pages[CODE_PAGE(a)];
   a &= t->mask;
   if(t->n == R3000_MAP_TYPE_POINTER) {
     a ^= EMU_ENDIAN_XOR(3);
@@ -401,6 +466,7 @@ static EMU_INLINE void EMU_CALL sb(struct R3000_STATE *state, uint32 a, uint32 d
 
 static EMU_INLINE void EMU_CALL sh(struct R3000_STATE *state, uint32 a, uint32 d) {
   struct R3000_MEMORY_TYPE *t = mmwalk(state->map_store, a);
+  state->code_gen += state->code_pages[CODE_PAGE(a)];
   a &= t->mask;
   if(t->n == R3000_MAP_TYPE_POINTER) {
     a ^= EMU_ENDIAN_XOR(2);
@@ -431,6 +497,7 @@ static EMU_INLINE void EMU_CALL sw(struct R3000_STATE *state, uint32 a, uint32 d
   if(state->cache_isolate) return;
 
   t = mmwalk(state->map_store, a);
+  state->code_gen += state->code_pages[CODE_PAGE(a)];
   a &= t->mask;
   a &= (~3);
   if(t->n == R3000_MAP_TYPE_POINTER) {
@@ -446,6 +513,364 @@ static EMU_INLINE uint32 EMU_CALL fetch(struct R3000_STATE *state) {
   return *((uint32*)(((uint8*)(state->fetchbase))+(state->pc)));
 }
 
+/////////////////////////////////////////////////////////////////////////////
+/*
+** Block building and execution
+*/
+
+/* Op kinds: minor opcodes as they are, major opcodes + 0x40, REGIMM + 0x80 */
+#define KIND_MAJOR(a)  (0x40+(a))
+#define KIND_REGIMM(a) (0x80+(a))
+
+//
+// Returns nonzero if the instruction can be part of a block
+// Sets *branch if it's a branch or jump, which ends the block after its
+// delay slot
+//
+static int EMU_CALL decode_op(uint32 pc, uint32 instruction, struct R3000_OP *op, int *branch) {
+  op->s = INS_S;
+  op->t = INS_T;
+  op->d = INS_D;
+  op->imm = SIGNED16(INS_I);
+  *branch = 0;
+  if(instruction < 0x04000000) {
+    op->kind = instruction & 0x3F;
+    switch(op->kind) {
+    case 0x00: case 0x02: case 0x03:
+      op->imm = INS_H; return 1;
+    case 0x08: case 0x09:
+      *branch = 1; return 1;
+    case 0x04: case 0x06: case 0x07:
+    case 0x10: case 0x11: case 0x12: case 0x13:
+    case 0x18: case 0x19: case 0x1A: case 0x1B:
+    case 0x20: case 0x21: case 0x22: case 0x23:
+    case 0x24: case 0x25: case 0x26: case 0x27:
+    case 0x2A: case 0x2B:
+      return 1;
+    }
+    /* syscall and invalid instructions are left to the interpreter */
+    return 0;
+  }
+  op->kind = KIND_MAJOR(instruction >> 26);
+  switch(instruction >> 26) {
+  case 0x01:
+    switch(INS_T) {
+    case 0x00: case 0x01: case 0x10: case 0x11:
+      op->kind = KIND_REGIMM(INS_T);
+      op->imm = pc+4+(((sint32)(SIGNED16(INS_I)))<<2);
+      *branch = 1;
+      return 1;
+    }
+    return 0;
+  case 0x02: case 0x03:
+    op->imm = (pc&0xF0000000)|((instruction<<2)&0x0FFFFFFC);
+    *branch = 1;
+    return 1;
+  case 0x04: case 0x05: case 0x06: case 0x07:
+    op->imm = pc+4+(((sint32)(SIGNED16(INS_I)))<<2);
+    *branch = 1;
+    return 1;
+  case 0x0C: case 0x0D: case 0x0E:
+    op->imm = UNSIGNED16(INS_I); return 1;
+  case 0x0F:
+    op->imm = INS_I << 16; return 1;
+  case 0x08: case 0x09: case 0x0A: case 0x0B:
+  case 0x20: case 0x21: case 0x22: case 0x23:
+  case 0x24: case 0x25: case 0x26:
+  case 0x28: case 0x29: case 0x2A: case 0x2B: case 0x2E:
+    return 1;
+  }
+  /* coprocessor 0 may change the interrupt state, leave it to the interpreter */
+  return 0;
+}
+
+static struct R3000_BLOCK* EMU_CALL build_block(struct R3000_STATE *state, struct R3000_BLOCK *block, const uint32 *code) {
+  uint32 pc = state->pc;
+  uint32 n, limit;
+  limit = (state->maxpc - pc) / 4;
+  if(limit > BLOCK_MAX_OPS) limit = BLOCK_MAX_OPS;
+  block->pc = pc;
+  block->count = 0;
+  for(n = 0; n < limit; n++) {
+    int branch;
+    if(!decode_op(pc + n * 4, code[n], block->ops + n, &branch)) break;
+    if(branch) {
+      int slot_branch;
+      /*
+      ** The delay slot has to be part of the same block. A branch in a
+      ** delay slot is a real branch if the first one isn't taken, and its
+      ** own delay slot wouldn't be, so leave that case to the interpreter.
+      */
+      if((n + 1) >= limit) break;
+      if(!decode_op(pc + n * 4 + 4, code[n + 1], block->ops + n + 1, &slot_branch)) break;
+      if(slot_branch) break;
+      n += 2;
+      break;
+    }
+  }
+  if(!n) return NULL;
+  memcpy(block->words, code, n * 4);
+  block->count = n;
+  block->gen = state->code_gen;
+  state->code_pages[CODE_PAGE(pc)] = 1;
+  state->code_pages[CODE_PAGE(pc + n * 4 - 4)] = 1;
+  return block;
+}
+
+//
+// Returns the valid block starting at the current PC, or NULL if the
+// interpreter has to handle the next instruction
+//
+static EMU_INLINE struct R3000_BLOCK* EMU_CALL get_block(struct R3000_STATE *state) {
+  struct R3000_BLOCK *block;
+  const uint32 *code;
+  if(state->pc >= state->maxpc) renew_fetch_region(state);
+  if(!state->fetch_direct) return NULL;
+  code = (const uint32*)(((uint8*)(state->fetchbase))+(state->pc));
+  block = state->blocks + ((state->pc >> 2) & (BLOCK_CACHE_SIZE - 1));
+  if(block->pc == state->pc && block->count) {
+    if(block->gen == state->code_gen) return block;
+    if(!memcmp(block->words, code, block->count * 4)) {
+      block->gen = state->code_gen;
+      return block;
+    }
+  }
+  return build_block(state, block, code);
+}
+
+//
+// Memory map entry for an access that hits the first entry of a map, if
+// that one is a pointer. Accesses like that can't have side effects, so
+// blocks do them directly; everything else goes through lb/lh/lw/sb/sh/sw.
+//
+static EMU_INLINE struct R3000_MEMORY_TYPE* EMU_CALL block_direct(struct R3000_MEMORY_MAP *map, uint32 a) {
+  a &= 0x1FFFFFFF;
+  if(a < map->x || a > map->y || map->type.n != R3000_MAP_TYPE_POINTER) return NULL;
+  return &(map->type);
+}
+
+#define DIRECT8(t,a)  (*((uint8 *)(((uint8*)((t)->p))+(((a)&((t)->mask))^EMU_ENDIAN_XOR(3)))))
+#define DIRECT16(t,a) (*((uint16*)(((uint8*)((t)->p))+((((a)&((t)->mask))^EMU_ENDIAN_XOR(2))&(~1)))))
+#define DIRECT32(t,a) (*((uint32*)(((uint8*)((t)->p))+(((a)&((t)->mask))&(~3)))))
+
+//
+// PC and the cycle count follow from the position in the block, so they
+// are only written back around anything that can look at them. A callback
+// may also take cycles away (r3000_break), which moves the base count and
+// ends the block.
+//
+#define BLOCK_INDEX ((uint32)(op - block->ops))
+#define BLOCK_PC    (block->pc + 4 * BLOCK_INDEX)
+#define BLOCK_SYNC_OUT { PC = BLOCK_PC; STATE->cycles_remaining = cycles - DIVIDER * ((sint32)(BLOCK_INDEX)); }
+#define BLOCK_SYNC_IN  { cycles = STATE->cycles_remaining + DIVIDER * ((sint32)(BLOCK_INDEX)); if(state->block_exit) { stop = op + 1; } }
+
+#define BLOCK_LOAD(direct,fast,slow) {                       \
+  t = (direct) ? block_direct(state->map_load, a) : NULL;    \
+  if(t) { d = (fast); }                                      \
+  else  { BLOCK_SYNC_OUT d = (slow); BLOCK_SYNC_IN }         \
+}
+
+//
+// A store that may have changed code ends the block if it changed the rest
+// of this very block, so the new code gets decoded
+//
+#define BLOCK_STORE_CHECK(a) {                                                 \
+  state->code_gen += state->code_pages[CODE_PAGE(a)];                          \
+  if(state->code_gen != gen) {                                                 \
+    gen = state->code_gen;                                                     \
+    if(memcmp(block->words + BLOCK_INDEX + 1, ((uint32*)(((uint8*)(state->fetchbase)) + block->pc)) + BLOCK_INDEX + 1, (block->count - BLOCK_INDEX - 1) * 4)) { \
+      stop = op + 1;                                                           \
+    }                                                                          \
+  }                                                                            \
+}
+
+#define BLOCK_STORE(direct,fast,slow) {                      \
+  t = (direct) ? block_direct(state->map_store, a) : NULL;   \
+  if(t) { fast; }                                            \
+  else  { BLOCK_SYNC_OUT slow; BLOCK_SYNC_IN }               \
+  BLOCK_STORE_CHECK(a)                                       \
+}
+
+#define OP_S (op->s)
+#define OP_T (op->t)
+#define OP_D (op->d)
+#define OP_I (op->imm)
+
+//
+// Runs the block at the current PC with the same per-instruction cycle
+// accounting as the interpreter, stopping early wherever the interpreter
+// loop would.
+// Returns 1 if the CPU went idle, 0 if a block was run, or -1 if the next
+// instruction has to be left to the interpreter
+//
+static sint32 EMU_CALL run_block(struct R3000_STATE *state) {
+  struct R3000_BLOCK *block = get_block(state);
+  const struct R3000_OP *op;
+  const struct R3000_OP *end;
+  const struct R3000_OP *stop;
+  struct R3000_MEMORY_TYPE *t;
+  sint32 cycles = STATE->cycles_remaining;
+  uint32 gen = STATE->code_gen;
+  uint32 a, d;
+  if(!block) return -1;
+  op = block->ops;
+  end = op + block->count;
+  stop = end;
+  //
+  // Stop where the interpreter would run out of cycles, except that a
+  // taken branch still gets its delay slot, which ends the block
+  //
+  { sint32 left = (cycles + (DIVIDER - 1)) / DIVIDER;
+    if(left < ((sint32)(block->count))) { stop = op + left; }
+  }
+  state->block_exit = 0;
+  for(;;) {
+    switch(op->kind) {
+    case 0x00: /* sll   */ if(OP_D) { REGS[OP_D] = ((uint32)(REGS[OP_T])) << OP_I;
+      } else if((STATE->slot) && (STATE->slot_target == (BLOCK_PC - 4))) {
+        /* idle detect, see the interpreter */
+        sint32 cycidle = cycles - DIVIDER * ((sint32)(BLOCK_INDEX));
+        if(cycidle < 0) { cycidle = 0; }
+        STATE->cycles_remaining = cycles - DIVIDER * ((sint32)(BLOCK_INDEX)) - cycidle;
+        STATE->usage_idle_cycles += cycidle;
+
+        STATE->slot = 0;
+        PC = BLOCK_PC - 4;
+        STATE->maxpc = 0;
+        return 1;
+      }
+      break;
+    case 0x02: /* srl   */ if(OP_D) { REGS[OP_D] = ((uint32)(REGS[OP_T])) >> OP_I; } break;
+    case 0x03: /* sra   */ if(OP_D) { REGS[OP_D] = ((sint32)(REGS[OP_T])) >> OP_I; } break;
+    case 0x04: /* sllv  */ if(OP_D) { uint32 sc=REGS[OP_S]; if(sc>=32){REGS[OP_D]=0;}else{REGS[OP_D]=REGS[OP_T]<<sc;} } break;
+    case 0x06: /* srlv  */ if(OP_D) { uint32 sc=REGS[OP_S]; if(sc>=32){REGS[OP_D]=0;}else{REGS[OP_D]=REGS[OP_T]>>sc;} } break;
+    case 0x07: /* srav  */ if(OP_D) { uint32 sc=REGS[OP_S]; if(sc>=32){sc=31;}            {REGS[OP_D]=(((sint32)(REGS[OP_T]))>>sc);} } break;
+    case 0x08: /* jr    */ if(!STATE->slot) {                      {STATE->slot=2;STATE->slot_target=REGS[OP_S];} } break;
+    case 0x09: /* jalr  */ if(!STATE->slot) { REGS[OP_D] = BLOCK_PC + 8;{STATE->slot=2;STATE->slot_target=REGS[OP_S];} } break;
+    case 0x10: /* mfhi  */ if(OP_D) { REGS[OP_D] = HI; } break;
+    case 0x11: /* mthi  */          { HI = REGS[OP_S]; } break;
+    case 0x12: /* mflo  */ if(OP_D) { REGS[OP_D] = LO; } break;
+    case 0x13: /* mtlo  */          { LO = REGS[OP_S]; } break;
+    case 0x18: /* mult  */ { sint64 t = ((sint64)(((sint32)(REGS[OP_S])))) * ((sint64)(((sint32)(REGS[OP_T])))); LO = (uint32)(t); HI = (uint32)(t >> 32); } break;
+    case 0x19: /* multu */ { uint64 t = ((uint64)(((uint32)(REGS[OP_S])))) * ((uint64)(((uint32)(REGS[OP_T])))); LO = (uint32)(t); HI = (uint32)(t >> 32); } break;
+    case 0x1A: /* div   */ if(REGS[OP_T]) { LO = ((sint32)(REGS[OP_S])) / ((sint32)(REGS[OP_T])); HI = ((sint32)(REGS[OP_S])) % ((sint32)(REGS[OP_T])); } break;
+    case 0x1B: /* divu  */ if(REGS[OP_T]) { LO = ((uint32)(REGS[OP_S])) / ((uint32)(REGS[OP_T])); HI = ((uint32)(REGS[OP_S])) % ((uint32)(REGS[OP_T])); } break;
+    case 0x20: /* add   */
+    case 0x21: /* addu  */ if(OP_D) { REGS[OP_D] =  (((uint32)(REGS[OP_S])) + ((uint32)(REGS[OP_T]))); } break;
+    case 0x22: /* sub   */
+    case 0x23: /* subu  */ if(OP_D) { REGS[OP_D] =  (((uint32)(REGS[OP_S])) - ((uint32)(REGS[OP_T]))); } break;
+    case 0x24: /* and   */ if(OP_D) { REGS[OP_D] =  (((uint32)(REGS[OP_S])) & ((uint32)(REGS[OP_T]))); } break;
+    case 0x25: /* or    */ if(OP_D) { REGS[OP_D] =  (((uint32)(REGS[OP_S])) | ((uint32)(REGS[OP_T]))); } break;
+    case 0x26: /* xor   */ if(OP_D) { REGS[OP_D] =  (((uint32)(REGS[OP_S])) ^ ((uint32)(REGS[OP_T]))); } break;
+    case 0x27: /* nor   */ if(OP_D) { REGS[OP_D] = ~(((uint32)(REGS[OP_S])) | ((uint32)(REGS[OP_T]))); } break;
+    case 0x2A: /* slt   */ if(OP_D) { REGS[OP_D] =  (((sint32)(REGS[OP_S])) < ((sint32)(REGS[OP_T]))); } break;
+    case 0x2B: /* sltu  */ if(OP_D) { REGS[OP_D] =  (((uint32)(REGS[OP_S])) < ((uint32)(REGS[OP_T]))); } break;
+
+    case KIND_REGIMM(0x00): /* bltz  */ if(!STATE->slot) { if( ((sint32)(REGS[OP_S])) <  0) {                STATE->slot=2;STATE->slot_target=OP_I; } } break;
+    case KIND_REGIMM(0x01): /* bgez  */ if(!STATE->slot) { if( ((sint32)(REGS[OP_S])) >= 0) {                STATE->slot=2;STATE->slot_target=OP_I; } } break;
+    case KIND_REGIMM(0x10): /* bltzal*/ if(!STATE->slot) { if( ((sint32)(REGS[OP_S])) <  0) { REGS[31]=BLOCK_PC+8; STATE->slot=2;STATE->slot_target=OP_I; } } break;
+    case KIND_REGIMM(0x11): /* bgezal*/ if(!STATE->slot) { if( ((sint32)(REGS[OP_S])) >= 0) { REGS[31]=BLOCK_PC+8; STATE->slot=2;STATE->slot_target=OP_I; } } break;
+
+    case KIND_MAJOR(0x02): /* j     */ if(!STATE->slot) {                STATE->slot=2;STATE->slot_target=OP_I; } break;
+    case KIND_MAJOR(0x03): /* jal   */ if(!STATE->slot) { REGS[31]=BLOCK_PC+8; STATE->slot=2;STATE->slot_target=OP_I; } break;
+    case KIND_MAJOR(0x04): /* beq   */ if(!STATE->slot) { if(REGS[OP_S] == REGS[OP_T]) { STATE->slot=2;STATE->slot_target=OP_I; } } break;
+    case KIND_MAJOR(0x05): /* bne   */ if(!STATE->slot) { if(REGS[OP_S] != REGS[OP_T]) { STATE->slot=2;STATE->slot_target=OP_I; } } break;
+    case KIND_MAJOR(0x06): /* blez  */ if(!STATE->slot) { if( ((sint32)(REGS[OP_S])) <= 0) { STATE->slot=2;STATE->slot_target=OP_I; } } break;
+    case KIND_MAJOR(0x07): /* bgtz  */ if(!STATE->slot) { if( ((sint32)(REGS[OP_S])) >  0) { STATE->slot=2;STATE->slot_target=OP_I; } } break;
+    case KIND_MAJOR(0x08): /* addi  */
+    case KIND_MAJOR(0x09): /* addiu */ if(OP_T) { REGS[OP_T] = REGS[OP_S] + OP_I; } break;
+    case KIND_MAJOR(0x0A): /* slti  */ if(OP_T) { REGS[OP_T] = ( ((sint32)(REGS[OP_S])) < ((sint32)(OP_I)) ); } break;
+    case KIND_MAJOR(0x0B): /* sltiu */ if(OP_T) { REGS[OP_T] = ( ((uint32)(REGS[OP_S])) < ((uint32)(OP_I)) ); } break;
+    case KIND_MAJOR(0x0C): /* andi  */ if(OP_T) { REGS[OP_T] = REGS[OP_S] & OP_I; } break;
+    case KIND_MAJOR(0x0D): /* ori   */ if(OP_T) { REGS[OP_T] = REGS[OP_S] | OP_I; } break;
+    case KIND_MAJOR(0x0E): /* xori  */ if(OP_T) { REGS[OP_T] = REGS[OP_S] ^ OP_I; } break;
+    case KIND_MAJOR(0x0F): /* lui   */ if(OP_T) { REGS[OP_T] = OP_I; } break;
+
+    case KIND_MAJOR(0x20): /* lb    */ a = REGS[OP_S] + OP_I; BLOCK_LOAD(1, DIRECT8(t,a), lb(state, a)) if(OP_T) { REGS[OP_T] = ((sint32)((sint8)(d)));  } break;
+    case KIND_MAJOR(0x21): /* lh    */ a = REGS[OP_S] + OP_I; BLOCK_LOAD(1, DIRECT16(t,a), lh(state, a)) if(OP_T) { REGS[OP_T] = ((sint32)((sint16)(d))); } break;
+    case KIND_MAJOR(0x23): /* lw    */ a = REGS[OP_S] + OP_I; BLOCK_LOAD(a != 0xFFFE0130, DIRECT32(t,a), lw(state, a)) if(OP_T) { REGS[OP_T] = d; } break;
+    case KIND_MAJOR(0x24): /* lbu   */ a = REGS[OP_S] + OP_I; BLOCK_LOAD(1, DIRECT8(t,a), lb(state, a)) if(OP_T) { REGS[OP_T] = d & 0x000000FF; } break;
+    case KIND_MAJOR(0x25): /* lhu   */ a = REGS[OP_S] + OP_I; BLOCK_LOAD(1, DIRECT16(t,a), lh(state, a)) if(OP_T) { REGS[OP_T] = d & 0x0000FFFF; } break;
+    case KIND_MAJOR(0x28): /* sb    */ a = REGS[OP_S] + OP_I; BLOCK_STORE(1, DIRECT8(t,a) = REGS[OP_T], sb(state, a, REGS[OP_T] & 0x000000FF)) break;
+    case KIND_MAJOR(0x29): /* sh    */ a = REGS[OP_S] + OP_I; BLOCK_STORE(1, DIRECT16(t,a) = REGS[OP_T], sh(state, a, REGS[OP_T] & 0x0000FFFF)) break;
+    case KIND_MAJOR(0x2B): /* sw    */ a = REGS[OP_S] + OP_I; BLOCK_STORE((a != 0xFFFE0130) && !(state->cache_isolate), DIRECT32(t,a) = REGS[OP_T], sw(state, a, REGS[OP_T])) break;
+
+    case KIND_MAJOR(0x22): /* lwl   */
+      BLOCK_SYNC_OUT
+      a = REGS[OP_S] + OP_I;
+      { int bitshift;
+        for(bitshift = 24;; bitshift -= 8) {
+          REGS[OP_T] &= ~(0xFF << bitshift);
+          REGS[OP_T] |= (((uint32)(lb(state, a))) & 0xFF) << bitshift;
+          if(!(a&3))break;
+          a--;
+        }
+      }
+      REGS[0] = 0;
+      BLOCK_SYNC_IN
+      break;
+    case KIND_MAJOR(0x26): /* lwr   */
+      BLOCK_SYNC_OUT
+      a = REGS[OP_S] + OP_I;
+      { int bitshift;
+        for(bitshift = 0;; bitshift += 8) {
+          REGS[OP_T] &= ~(0xFF << bitshift);
+          REGS[OP_T] |= (((uint32)(lb(state, a))) & 0xFF) << bitshift;
+          if((a&3) == 3)break;
+          a++;
+        }
+      }
+      REGS[0] = 0;
+      BLOCK_SYNC_IN
+      break;
+    case KIND_MAJOR(0x2A): /* swl   */
+      BLOCK_SYNC_OUT
+      a = REGS[OP_S] + OP_I;
+      { int bitshift;
+        for(bitshift = 24;; bitshift -= 8) {
+          sb(state, a, REGS[OP_T]>>bitshift);
+          if(!(a&3))break;
+          a--;
+        }
+      }
+      BLOCK_STORE_CHECK(a);
+      BLOCK_SYNC_IN
+      break;
+    case KIND_MAJOR(0x2E): /* swr   */
+      BLOCK_SYNC_OUT
+      a = REGS[OP_S] + OP_I;
+      { int bitshift;
+        for(bitshift = 0;; bitshift += 8) {
+          sb(state, a, REGS[OP_T]>>bitshift);
+          if((a&3) == 3)break;
+          a++;
+        }
+      }
+      BLOCK_STORE_CHECK(a);
+      BLOCK_SYNC_IN
+      break;
+    }
+
+    op++;
+    if(op >= stop) {
+      if(op >= end || !(STATE->slot)) break;
+      stop = end;
+    }
+  }
+
+  BLOCK_SYNC_OUT
+  //
+  // A branch is always followed by its delay slot within the block, so if
+  // one was taken, both have run by now
+  //
+  if(STATE->slot) {
+    STATE->slot = 0;
+    PC = STATE->slot_target & (~3);
+    STATE->maxpc = 0;
+  }
+  return 0;
+}
+
 #define caseMINOR(a) case(a):
 #define caseMAJOR(a) case(a):
 
@@ -474,6 +899,13 @@ sint32 EMU_CALL r3000_execute(void *state, sint32 cycles) {
   STATE->maxpc = 0;
 
   while(STATE->slot || STATE->cycles_remaining > 0) {
+    if(STATE->block_cache_enable) {
+      if(!(STATE->slot)) {
+        sint32 r = run_block(STATE);
+        if(r > 0) goto finishing_sync;
+        if(!r) continue;
+      }
+    }
     instruction = fetch(state);
     if(instruction < 0x04000000) {
       switch(instruction & 0x3F) {
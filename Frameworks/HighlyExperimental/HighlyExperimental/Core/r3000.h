@@ -39,6 +39,18 @@ void EMU_CALL r3000_set_advance_callback(
 
 void EMU_CALL r3000_set_prid(void *state, uint32 prid);
 
+//
+// Enables or disables the predecoded block cache (enabled by default).
+// Execution is cycle-identical either way.
+//
+void EMU_CALL r3000_set_block_cache(void *state, uint32 enable);
+
+//
+// Must be called when hardware writes memory the CPU may run code from
+// (DMA into RAM), so cached code gets checked again
+//
+void EMU_CALL r3000_memory_written(void *state);
+
 #define R3000_REG_GEN (0)
 #define R3000_REG_C0  (32)
 #define R3000_REG_PC  (64)
@@ -10,6 +10,14 @@
 
 #include "spucore.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SPUCORE_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define SPUCORE_NEON
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 /*
 ** Key-on defer
@@ -551,6 +559,12 @@ static spucore_predict_callback_t spucore_predict[8] = {
   spucore_predict_4, spucore_predict_1, spucore_predict_2, spucore_predict_3
 };
 
+//
+// Blocks are decoded one at a time, as the resampler gets to them. Decoding
+// them ahead into a ring per voice doesn't save any work: every sample
+// depends on the two before it, so a block takes as long either way, and
+// the ring would go stale whenever SPU RAM is written to.
+//
 static void EMU_CALL decode_sample_block(
   uint16 *ram,
   uint32 memmax,
@@ -606,6 +620,65 @@ static void EMU_CALL decode_sample_block(
   }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//
+// Gaussian interpolation of n samples from one decoded block, at a constant
+// phase increment. The caller makes sure the phase stays inside the block.
+//
+static void EMU_CALL gauss_interpolate(
+  const sint32 *array,
+  uint32 ph,
+  uint32 phase_inc,
+  sint32 *dest,
+  uint32 n
+) {
+  uint32 i = 0;
+#if defined(SPUCORE_SSE2)
+  //
+  // Two samples at a time with pmaddwd. Decoded samples can exceed 16 bits,
+  // since the predictor doesn't clamp every output, but stay under 2^20, so
+  // each one is split into its low 15 bits and the rest. The two halves
+  // multiply exactly in 16 bits and give the same sums as the scalar code.
+  //
+  {
+    const __m128i lomask = _mm_set1_epi32(0x7FFF);
+    for(; (i + 2) <= n; i += 2) {
+      uint32 ph1 = ph + phase_inc;
+      __m128i s0 = _mm_loadu_si128((const __m128i*)(array + (ph >> 12)));
+      __m128i s1 = _mm_loadu_si128((const __m128i*)(array + (ph1 >> 12)));
+      __m128i g = _mm_unpacklo_epi64(
+        _mm_loadl_epi64((const __m128i*)(((const uint8*)gauss_shuffled_reverse_table) + ((ph & 0xFF0) >> 1))),
+        _mm_loadl_epi64((const __m128i*)(((const uint8*)gauss_shuffled_reverse_table) + ((ph1 & 0xFF0) >> 1)))
+      );
+      __m128i lo = _mm_packs_epi32(_mm_and_si128(s0, lomask), _mm_and_si128(s1, lomask));
+      __m128i hi = _mm_packs_epi32(_mm_srai_epi32(s0, 15), _mm_srai_epi32(s1, 15));
+      __m128i p = _mm_add_epi32(_mm_madd_epi16(lo, g), _mm_slli_epi32(_mm_madd_epi16(hi, g), 15));
+      p = _mm_add_epi32(p, _mm_shuffle_epi32(p, _MM_SHUFFLE(2,3,0,1)));
+      p = _mm_srai_epi32(_mm_shuffle_epi32(p, _MM_SHUFFLE(2,0,2,0)), 15);
+      _mm_storel_epi64((__m128i*)(dest + i), p);
+      ph = ph1 + phase_inc;
+    }
+  }
+#endif
+  for(; i < n; i++) {
+    const sint32 *source_signal = array + (ph >> 12);
+    const sint16 *mygauss = (const sint16*) (((const uint8*)gauss_shuffled_reverse_table) + ((ph & 0xFF0) >> 1));
+#if defined(SPUCORE_NEON)
+    int32x4_t p = vmulq_s32(vld1q_s32(source_signal), vmovl_s16(vld1_s16(mygauss)));
+    int32x2_t q = vadd_s32(vget_low_s32(p), vget_high_s32(p));
+    sint32 sum = vget_lane_s32(vpadd_s32(q, q), 0);
+#else
+    sint32 sum =
+      (source_signal[0] * mygauss[0]) +
+      (source_signal[1] * mygauss[1]) +
+      (source_signal[2] * mygauss[2]) +
+      (source_signal[3] * mygauss[3]);
+#endif
+    dest[i] = sum >> 15;
+    ph += phase_inc;
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 // Returns the number of samples actually generated
@@ -643,10 +716,9 @@ static uint32 EMU_CALL resampler(
     s = n;
   } else {
     uint32 t = 0;
-    for(s = 0; s < n; s++) {
-      sint32 *source_signal;
-      sint16 *mygauss;
-      sint32 sum;
+    s = 0;
+    while(s < n) {
+      uint32 span;
       if(ph >= 0x1C000) {
         if(sample->state == SAMPLE_STATE_OFF) break;
         if(irq_state && irq_state->offset - sample->block_addr < 16 && irq_triggered_cycle == 0xFFFFFFFF) {
@@ -655,20 +727,22 @@ static uint32 EMU_CALL resampler(
         decode_sample_block(ram, memmax, sample, 0);
         ph -= 0x1C000;
       }
-      source_signal = sample->array + (ph >> 12);
-      mygauss = (sint16*) (((uint8*)gauss_shuffled_reverse_table) + ((ph & 0xFF0) >> 1));
-
-      { sum =
-          (source_signal[0] * mygauss[0]) +
-          (source_signal[1] * mygauss[1]) +
-          (source_signal[2] * mygauss[2]) +
-          (source_signal[3] * mygauss[3]);
+      /*
+      ** Interpolate everything up to the point where the next block is
+      ** needed in one pass
+      */
+      span = n - s;
+      if(ph >= 0x1C000) {
+        span = 1;
+      } else if(phase_inc) {
+        uint32 left = (0x1C000 - ph + phase_inc - 1) / phase_inc;
+        if(left < span) span = left;
       }
-      sum >>= 15;
-
-      *dest++ = sum;
-      ph += phase_inc;
-      t += phase_inc;
+      gauss_interpolate(sample->array, ph, phase_inc, dest, span);
+      dest += span;
+      s += span;
+      ph += phase_inc * span;
+      t += phase_inc * span;
     }
   }
 
@@ -1027,6 +1101,56 @@ static void EMU_CALL voices_off(struct SPUCORE_STATE *state, uint32 bits) {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
+#ifdef SPUCORE_SSE2
+static __m128i mullo_epi32_sse2(__m128i a, __m128i b) {
+  __m128i even = _mm_mul_epu32(a, b);
+  __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+  return _mm_unpacklo_epi32(
+    _mm_shuffle_epi32(even, _MM_SHUFFLE(0,0,2,0)),
+    _mm_shuffle_epi32(odd, _MM_SHUFFLE(0,0,2,0))
+  );
+}
+#endif
+
+/*
+** Applies a linear envelope segment to n samples, returns the final level
+*/
+static sint32 EMU_CALL envelope_apply(sint32 *buf, sint32 n, sint32 e, sint32 d) {
+  sint32 i = 0;
+#if defined(SPUCORE_SSE2)
+  if(n >= 4) {
+    __m128i ve = _mm_add_epi32(_mm_set1_epi32(e), mullo_epi32_sse2(_mm_set1_epi32(d), _mm_set_epi32(3, 2, 1, 0)));
+    __m128i vd = _mm_set1_epi32((sint32)((uint32)d * 4));
+    for(; i + 4 <= n; i += 4) {
+      __m128i b = mullo_epi32_sse2(_mm_loadu_si128((__m128i*)(buf + i)), _mm_srai_epi32(ve, 16));
+      _mm_storeu_si128((__m128i*)(buf + i), _mm_srai_epi32(b, 15));
+      ve = _mm_add_epi32(ve, vd);
+    }
+    e = _mm_cvtsi128_si32(ve);
+  }
+#elif defined(SPUCORE_NEON)
+  if(n >= 4) {
+    static const sint32 ramp[4] = { 0, 1, 2, 3 };
+    int32x4_t ve = vmlaq_n_s32(vdupq_n_s32(e), vld1q_s32(ramp), d);
+    int32x4_t vd = vdupq_n_s32((sint32)((uint32)d * 4));
+    for(; i + 4 <= n; i += 4) {
+      int32x4_t b = vmulq_s32(vld1q_s32(buf + i), vshrq_n_s32(ve, 16));
+      vst1q_s32(buf + i, vshrq_n_s32(b, 15));
+      ve = vaddq_s32(ve, vd);
+    }
+    e = vgetq_lane_s32(ve, 0);
+  }
+#endif
+  for(; i < n; i++) {
+    sint32 b = buf[i];
+    b *= (e >> 16);
+    b >>= 15;
+    buf[i] = b;
+    e += d;
+  }
+  return e;
+}
+
 /*
 ** - Scales samples in a buffer using an envelope
 ** - Returns the actual number of samples modified
@@ -1057,14 +1181,8 @@ static int EMU_CALL enveloper(
       i += max;
       e += max * d;
     } else {
-      while(max--) {
-        sint32 b = buf[i];
-        b *= (e >> 16);
-        b >>= 15;
-        buf[i] = b;
-        e += d;
-        i++;
-      }
+      e = envelope_apply(buf + i, max, e, d);
+      i += max;
     }
     env->level = e;
     env->delta = d;
@@ -1202,6 +1320,7 @@ static int EMU_CALL render_channel_mono(
     if(irq_state) {
       s = &spare_state;
       spare_state.offset = irq_state->offset;
+      spare_state.triggered_cycle = 0xFFFFFFFF;
     }
     r2 = render_channel_raw(ram, memmax, c, buf, fmbuf, nbuf, samples, s);
 	if(irq_state && irq_state->triggered_cycle == 0xFFFFFFFF && spare_state.triggered_cycle != 0xFFFFFFFF) irq_state->triggered_cycle = spare_state.triggered_cycle + r * 768;
@@ -1257,20 +1376,100 @@ static void EMU_CALL render_noise(
 //#define CLIP_PCMDBL_2(a,b) {CLIP_PCMDBL_1(a);CLIP_PCMDBL_1(b);}
 //#define CLIP_PCMDBL_4(a,b,c,d) {CLIP_PCMDBL_1(a);CLIP_PCMDBL_1(b);CLIP_PCMDBL_1(c);CLIP_PCMDBL_1(d);}
 
+////////////////////////////////////////////////////////////////////////////////
+/*
+** Reverb work area addresses used by one 22KHz step, already normalized
+*/
+struct SPUCORE_REVERB_ADDRESSES {
+  sint32 iir_src_a0;
+  sint32 iir_src_a1;
+  sint32 iir_src_b0;
+  sint32 iir_src_b1;
+  sint32 iir_dest_a0;
+  sint32 iir_dest_a1;
+  sint32 iir_dest_b0;
+  sint32 iir_dest_b1;
+  sint32 iir_dest_a0_plus;
+  sint32 iir_dest_a1_plus;
+  sint32 iir_dest_b0_plus;
+  sint32 iir_dest_b1_plus;
+  sint32 acc_src_a0;
+  sint32 acc_src_a1;
+  sint32 acc_src_b0;
+  sint32 acc_src_b1;
+  sint32 acc_src_c0;
+  sint32 acc_src_c1;
+  sint32 acc_src_d0;
+  sint32 acc_src_d1;
+  sint32 fb_src_a0;
+  sint32 fb_src_a1;
+  sint32 fb_src_b0;
+  sint32 fb_src_b1;
+  sint32 mix_dest_a0;
+  sint32 mix_dest_a1;
+  sint32 mix_dest_b0;
+  sint32 mix_dest_b1;
+};
+
+/*
+** Works out the addresses for a step at the current reverb address
+** Returns how many steps they stay good for: up to then, each of them and
+** the current address only move up by 2 per step, without wrapping around
+** the end of the work area
+*/
+static sint32 EMU_CALL reverb_addresses(struct SPUCORE_STATE *state, struct SPUCORE_REVERB_ADDRESSES *a) {
+  sint32 current  = state->reverb.current_address;
+  sint32 fb_src_a = MAKE_REVERB_OFFSET(FB_SRC_A);
+  sint32 fb_src_b = MAKE_REVERB_OFFSET(FB_SRC_B);
+  const sint32 *p = (const sint32*)a;
+  sint32 steps;
+  uint32 i;
+
+  a->mix_dest_a0 = MAKE_REVERB_OFFSET(MIX_DEST_A0) + current; NORMALIZE_REVERB_OFFSET(a->mix_dest_a0);
+  a->mix_dest_a1 = MAKE_REVERB_OFFSET(MIX_DEST_A1) + current; NORMALIZE_REVERB_OFFSET(a->mix_dest_a1);
+  a->mix_dest_b0 = MAKE_REVERB_OFFSET(MIX_DEST_B0) + current; NORMALIZE_REVERB_OFFSET(a->mix_dest_b0);
+  a->mix_dest_b1 = MAKE_REVERB_OFFSET(MIX_DEST_B1) + current; NORMALIZE_REVERB_OFFSET(a->mix_dest_b1);
+  a->fb_src_a0 = a->mix_dest_a0 - fb_src_a; NORMALIZE_REVERB_OFFSET(a->fb_src_a0);
+  a->fb_src_a1 = a->mix_dest_a1 - fb_src_a; NORMALIZE_REVERB_OFFSET(a->fb_src_a1);
+  a->fb_src_b0 = a->mix_dest_b0 - fb_src_b; NORMALIZE_REVERB_OFFSET(a->fb_src_b0);
+  a->fb_src_b1 = a->mix_dest_b1 - fb_src_b; NORMALIZE_REVERB_OFFSET(a->fb_src_b1);
+  a->acc_src_a0 = MAKE_REVERB_OFFSET(ACC_SRC_A0) + current; NORMALIZE_REVERB_OFFSET(a->acc_src_a0);
+  a->acc_src_a1 = MAKE_REVERB_OFFSET(ACC_SRC_A1) + current; NORMALIZE_REVERB_OFFSET(a->acc_src_a1);
+  a->acc_src_b0 = MAKE_REVERB_OFFSET(ACC_SRC_B0) + current; NORMALIZE_REVERB_OFFSET(a->acc_src_b0);
+  a->acc_src_b1 = MAKE_REVERB_OFFSET(ACC_SRC_B1) + current; NORMALIZE_REVERB_OFFSET(a->acc_src_b1);
+  a->acc_src_c0 = MAKE_REVERB_OFFSET(ACC_SRC_C0) + current; NORMALIZE_REVERB_OFFSET(a->acc_src_c0);
+  a->acc_src_c1 = MAKE_REVERB_OFFSET(ACC_SRC_C1) + current; NORMALIZE_REVERB_OFFSET(a->acc_src_c1);
+  a->acc_src_d0 = MAKE_REVERB_OFFSET(ACC_SRC_D0) + current; NORMALIZE_REVERB_OFFSET(a->acc_src_d0);
+  a->acc_src_d1 = MAKE_REVERB_OFFSET(ACC_SRC_D1) + current; NORMALIZE_REVERB_OFFSET(a->acc_src_d1);
+  a->iir_src_a0 = MAKE_REVERB_OFFSET(IIR_SRC_A0) + current; NORMALIZE_REVERB_OFFSET(a->iir_src_a0);
+  a->iir_src_a1 = MAKE_REVERB_OFFSET(IIR_SRC_A1) + current; NORMALIZE_REVERB_OFFSET(a->iir_src_a1);
+  a->iir_src_b0 = MAKE_REVERB_OFFSET(IIR_SRC_B0) + current; NORMALIZE_REVERB_OFFSET(a->iir_src_b0);
+  a->iir_src_b1 = MAKE_REVERB_OFFSET(IIR_SRC_B1) + current; NORMALIZE_REVERB_OFFSET(a->iir_src_b1);
+  a->iir_dest_a0 = MAKE_REVERB_OFFSET(IIR_DEST_A0) + current; NORMALIZE_REVERB_OFFSET(a->iir_dest_a0);
+  a->iir_dest_a1 = MAKE_REVERB_OFFSET(IIR_DEST_A1) + current; NORMALIZE_REVERB_OFFSET(a->iir_dest_a1);
+  a->iir_dest_b0 = MAKE_REVERB_OFFSET(IIR_DEST_B0) + current; NORMALIZE_REVERB_OFFSET(a->iir_dest_b0);
+  a->iir_dest_b1 = MAKE_REVERB_OFFSET(IIR_DEST_B1) + current; NORMALIZE_REVERB_OFFSET(a->iir_dest_b1);
+  a->iir_dest_a0_plus = a->iir_dest_a0 + 2; NORMALIZE_REVERB_OFFSET(a->iir_dest_a0_plus);
+  a->iir_dest_a1_plus = a->iir_dest_a1 + 2; NORMALIZE_REVERB_OFFSET(a->iir_dest_a1_plus);
+  a->iir_dest_b0_plus = a->iir_dest_b0 + 2; NORMALIZE_REVERB_OFFSET(a->iir_dest_b0_plus);
+  a->iir_dest_b1_plus = a->iir_dest_b1 + 2; NORMALIZE_REVERB_OFFSET(a->iir_dest_b1_plus);
+
+  steps = (state->reverb.safe_end_address - current + 1) >> 1;
+  for(i = 0; i < sizeof(*a) / sizeof(sint32); i++) {
+    sint32 left = (state->reverb.safe_end_address - p[i] + 1) >> 1;
+    if(left < steps) steps = left;
+  }
+  return steps;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /*
 ** 22KHz reverb steady state step
 */
-static void EMU_CALL reverb_steadystate22(struct SPUCORE_STATE *state, uint16 *ram, sint32 input_l, sint32 input_r) {
-  /*
-  ** Current reverb offset
-  */
-  sint32 current     = state->reverb.current_address;
+static void EMU_CALL reverb_steadystate22(struct SPUCORE_STATE *state, uint16 *ram, const struct SPUCORE_REVERB_ADDRESSES *a, sint32 input_l, sint32 input_r) {
   /*
   ** Reverb registers
   */
-  sint32 fb_src_a    = MAKE_REVERB_OFFSET(FB_SRC_A);
-  sint32 fb_src_b    = MAKE_REVERB_OFFSET(FB_SRC_B);
   sint32 iir_alpha   = MAKE_SINT32_COEF(IIR_ALPHA);
   sint32 acc_coef_a  = MAKE_SINT32_COEF(ACC_COEF_A);
   sint32 acc_coef_b  = MAKE_SINT32_COEF(ACC_COEF_B);
@@ -1279,40 +1478,9 @@ static void EMU_CALL reverb_steadystate22(struct SPUCORE_STATE *state, uint16 *r
   sint32 iir_coef    = MAKE_SINT32_COEF(IIR_COEF);
   sint32 fb_alpha    = MAKE_SINT32_COEF(FB_ALPHA);
   sint32 fb_x        = MAKE_SINT32_COEF(FB_X);
-  sint32 iir_dest_a0 = MAKE_REVERB_OFFSET(IIR_DEST_A0);
-  sint32 iir_dest_a1 = MAKE_REVERB_OFFSET(IIR_DEST_A1);
-  sint32 acc_src_a0  = MAKE_REVERB_OFFSET(ACC_SRC_A0);
-  sint32 acc_src_a1  = MAKE_REVERB_OFFSET(ACC_SRC_A1);
-  sint32 acc_src_b0  = MAKE_REVERB_OFFSET(ACC_SRC_B0);
-  sint32 acc_src_b1  = MAKE_REVERB_OFFSET(ACC_SRC_B1);
-  sint32 iir_src_a0  = MAKE_REVERB_OFFSET(IIR_SRC_A0);
-  sint32 iir_src_a1  = MAKE_REVERB_OFFSET(IIR_SRC_A1);
-  sint32 iir_dest_b0 = MAKE_REVERB_OFFSET(IIR_DEST_B0);
-  sint32 iir_dest_b1 = MAKE_REVERB_OFFSET(IIR_DEST_B1);
-  sint32 acc_src_c0  = MAKE_REVERB_OFFSET(ACC_SRC_C0);
-  sint32 acc_src_c1  = MAKE_REVERB_OFFSET(ACC_SRC_C1);
-  sint32 acc_src_d0  = MAKE_REVERB_OFFSET(ACC_SRC_D0);
-  sint32 acc_src_d1  = MAKE_REVERB_OFFSET(ACC_SRC_D1);
-  sint32 iir_src_b1  = MAKE_REVERB_OFFSET(IIR_SRC_B1);
-  sint32 iir_src_b0  = MAKE_REVERB_OFFSET(IIR_SRC_B0);
-  sint32 mix_dest_a0 = MAKE_REVERB_OFFSET(MIX_DEST_A0);
-  sint32 mix_dest_a1 = MAKE_REVERB_OFFSET(MIX_DEST_A1);
-  sint32 mix_dest_b0 = MAKE_REVERB_OFFSET(MIX_DEST_B0);
-  sint32 mix_dest_b1 = MAKE_REVERB_OFFSET(MIX_DEST_B1);
   sint32 in_coef_l   = MAKE_SINT32_COEF(IN_COEF_L);
   sint32 in_coef_r   = MAKE_SINT32_COEF(IN_COEF_R);
   /*
-  ** Alternate buffer positions
-  */
-  sint32 fb_src_a0;
-  sint32 fb_src_a1;
-  sint32 fb_src_b0;
-  sint32 fb_src_b1;
-  sint32 iir_dest_a0_plus;
-  sint32 iir_dest_a1_plus;
-  sint32 iir_dest_b0_plus;
-  sint32 iir_dest_b1_plus;
-  /*
   ** Intermediate results
   */
   sint32 acc0;
@@ -1334,38 +1502,6 @@ static void EMU_CALL reverb_steadystate22(struct SPUCORE_STATE *state, uint16 *r
   sint32 mix_b0;
   sint32 mix_b1;
 
-  /*
-  ** Offsets
-  */
-  mix_dest_a0 += current; NORMALIZE_REVERB_OFFSET(mix_dest_a0);
-  mix_dest_a1 += current; NORMALIZE_REVERB_OFFSET(mix_dest_a1);
-  mix_dest_b0 += current; NORMALIZE_REVERB_OFFSET(mix_dest_b0);
-  mix_dest_b1 += current; NORMALIZE_REVERB_OFFSET(mix_dest_b1);
-  fb_src_a0 = mix_dest_a0 - fb_src_a; NORMALIZE_REVERB_OFFSET(fb_src_a0);
-  fb_src_a1 = mix_dest_a1 - fb_src_a; NORMALIZE_REVERB_OFFSET(fb_src_a1);
-  fb_src_b0 = mix_dest_b0 - fb_src_b; NORMALIZE_REVERB_OFFSET(fb_src_b0);
-  fb_src_b1 = mix_dest_b1 - fb_src_b; NORMALIZE_REVERB_OFFSET(fb_src_b1);
-  acc_src_a0 += current; NORMALIZE_REVERB_OFFSET(acc_src_a0);
-  acc_src_a1 += current; NORMALIZE_REVERB_OFFSET(acc_src_a1);
-  acc_src_b0 += current; NORMALIZE_REVERB_OFFSET(acc_src_b0);
-  acc_src_b1 += current; NORMALIZE_REVERB_OFFSET(acc_src_b1);
-  acc_src_c0 += current; NORMALIZE_REVERB_OFFSET(acc_src_c0);
-  acc_src_c1 += current; NORMALIZE_REVERB_OFFSET(acc_src_c1);
-  acc_src_d0 += current; NORMALIZE_REVERB_OFFSET(acc_src_d0);
-  acc_src_d1 += current; NORMALIZE_REVERB_OFFSET(acc_src_d1);
-  iir_src_a0 += current; NORMALIZE_REVERB_OFFSET(iir_src_a0);
-  iir_src_a1 += current; NORMALIZE_REVERB_OFFSET(iir_src_a1);
-  iir_src_b0 += current; NORMALIZE_REVERB_OFFSET(iir_src_b0);
-  iir_src_b1 += current; NORMALIZE_REVERB_OFFSET(iir_src_b1);
-  iir_dest_a0 += current; NORMALIZE_REVERB_OFFSET(iir_dest_a0);
-  iir_dest_a1 += current; NORMALIZE_REVERB_OFFSET(iir_dest_a1);
-  iir_dest_b0 += current; NORMALIZE_REVERB_OFFSET(iir_dest_b0);
-  iir_dest_b1 += current; NORMALIZE_REVERB_OFFSET(iir_dest_b1);
-  iir_dest_a0_plus = iir_dest_a0 + 2; NORMALIZE_REVERB_OFFSET(iir_dest_a0_plus);
-  iir_dest_a1_plus = iir_dest_a1 + 2; NORMALIZE_REVERB_OFFSET(iir_dest_a1_plus);
-  iir_dest_b0_plus = iir_dest_b0 + 2; NORMALIZE_REVERB_OFFSET(iir_dest_b0_plus);
-  iir_dest_b1_plus = iir_dest_b1 + 2; NORMALIZE_REVERB_OFFSET(iir_dest_b1_plus);
-
   /*
   ** IIR
   */
@@ -1373,44 +1509,44 @@ static void EMU_CALL reverb_steadystate22(struct SPUCORE_STATE *state, uint16 *r
   input_l *= in_coef_l;
   input_r *= in_coef_r;
 #define OPPOSITE_IIR_ALPHA (32768-iir_alpha)
-  iir_input_a0 = ((RAM_SINT32_SAMPLE(iir_src_a0) * iir_coef) + input_l) >> 15;
-  iir_input_a1 = ((RAM_SINT32_SAMPLE(iir_src_a1) * iir_coef) + input_r) >> 15;
-  iir_input_b0 = ((RAM_SINT32_SAMPLE(iir_src_b0) * iir_coef) + input_l) >> 15;
-  iir_input_b1 = ((RAM_SINT32_SAMPLE(iir_src_b1) * iir_coef) + input_r) >> 15;
+  iir_input_a0 = ((RAM_SINT32_SAMPLE(a->iir_src_a0) * iir_coef) + input_l) >> 15;
+  iir_input_a1 = ((RAM_SINT32_SAMPLE(a->iir_src_a1) * iir_coef) + input_r) >> 15;
+  iir_input_b0 = ((RAM_SINT32_SAMPLE(a->iir_src_b0) * iir_coef) + input_l) >> 15;
+  iir_input_b1 = ((RAM_SINT32_SAMPLE(a->iir_src_b1) * iir_coef) + input_r) >> 15;
   CLIP_PCM_4(iir_input_a0,iir_input_a1,iir_input_b0,iir_input_b1);
-  iir_a0 = ((iir_input_a0 * iir_alpha) + (RAM_SINT32_SAMPLE(iir_dest_a0) * (OPPOSITE_IIR_ALPHA))) >> 15;
-  iir_a1 = ((iir_input_a1 * iir_alpha) + (RAM_SINT32_SAMPLE(iir_dest_a1) * (OPPOSITE_IIR_ALPHA))) >> 15;
-  iir_b0 = ((iir_input_b0 * iir_alpha) + (RAM_SINT32_SAMPLE(iir_dest_b0) * (OPPOSITE_IIR_ALPHA))) >> 15;
-  iir_b1 = ((iir_input_b1 * iir_alpha) + (RAM_SINT32_SAMPLE(iir_dest_b1) * (OPPOSITE_IIR_ALPHA))) >> 15;
+  iir_a0 = ((iir_input_a0 * iir_alpha) + (RAM_SINT32_SAMPLE(a->iir_dest_a0) * (OPPOSITE_IIR_ALPHA))) >> 15;
+  iir_a1 = ((iir_input_a1 * iir_alpha) + (RAM_SINT32_SAMPLE(a->iir_dest_a1) * (OPPOSITE_IIR_ALPHA))) >> 15;
+  iir_b0 = ((iir_input_b0 * iir_alpha) + (RAM_SINT32_SAMPLE(a->iir_dest_b0) * (OPPOSITE_IIR_ALPHA))) >> 15;
+  iir_b1 = ((iir_input_b1 * iir_alpha) + (RAM_SINT32_SAMPLE(a->iir_dest_b1) * (OPPOSITE_IIR_ALPHA))) >> 15;
   CLIP_PCM_4(iir_a0,iir_a1,iir_b0,iir_b1);
 
-  RAM_PCM_SAMPLE(iir_dest_a0_plus) = iir_a0;
-  RAM_PCM_SAMPLE(iir_dest_a1_plus) = iir_a1;
-  RAM_PCM_SAMPLE(iir_dest_b0_plus) = iir_b0;
-  RAM_PCM_SAMPLE(iir_dest_b1_plus) = iir_b1;
+  RAM_PCM_SAMPLE(a->iir_dest_a0_plus) = iir_a0;
+  RAM_PCM_SAMPLE(a->iir_dest_a1_plus) = iir_a1;
+  RAM_PCM_SAMPLE(a->iir_dest_b0_plus) = iir_b0;
+  RAM_PCM_SAMPLE(a->iir_dest_b1_plus) = iir_b1;
 
   /*
   ** Accumulators
   */
   acc0 =
-    ((RAM_SINT32_SAMPLE(acc_src_a0) * acc_coef_a) >> 15) +
-    ((RAM_SINT32_SAMPLE(acc_src_b0) * acc_coef_b) >> 15) +
-    ((RAM_SINT32_SAMPLE(acc_src_c0) * acc_coef_c) >> 15) +
-    ((RAM_SINT32_SAMPLE(acc_src_d0) * acc_coef_d) >> 15);
+    ((RAM_SINT32_SAMPLE(a->acc_src_a0) * acc_coef_a) >> 15) +
+    ((RAM_SINT32_SAMPLE(a->acc_src_b0) * acc_coef_b) >> 15) +
+    ((RAM_SINT32_SAMPLE(a->acc_src_c0) * acc_coef_c) >> 15) +
+    ((RAM_SINT32_SAMPLE(a->acc_src_d0) * acc_coef_d) >> 15);
   acc1 =
-    ((RAM_SINT32_SAMPLE(acc_src_a1) * acc_coef_a) >> 15) +
-    ((RAM_SINT32_SAMPLE(acc_src_b1) * acc_coef_b) >> 15) +
-    ((RAM_SINT32_SAMPLE(acc_src_c1) * acc_coef_c) >> 15) +
-    ((RAM_SINT32_SAMPLE(acc_src_d1) * acc_coef_d) >> 15);
+    ((RAM_SINT32_SAMPLE(a->acc_src_a1) * acc_coef_a) >> 15) +
+    ((RAM_SINT32_SAMPLE(a->acc_src_b1) * acc_coef_b) >> 15) +
+    ((RAM_SINT32_SAMPLE(a->acc_src_c1) * acc_coef_c) >> 15) +
+    ((RAM_SINT32_SAMPLE(a->acc_src_d1) * acc_coef_d) >> 15);
   CLIP_PCM_2(acc0,acc1);
 
   /*
   ** Feedback
   */
-  fb_a0 = RAM_SINT32_SAMPLE(fb_src_a0);
-  fb_a1 = RAM_SINT32_SAMPLE(fb_src_a1);
-  fb_b0 = RAM_SINT32_SAMPLE(fb_src_b0);
-  fb_b1 = RAM_SINT32_SAMPLE(fb_src_b1);
+  fb_a0 = RAM_SINT32_SAMPLE(a->fb_src_a0);
+  fb_a1 = RAM_SINT32_SAMPLE(a->fb_src_a1);
+  fb_b0 = RAM_SINT32_SAMPLE(a->fb_src_b0);
+  fb_b1 = RAM_SINT32_SAMPLE(a->fb_src_b1);
 
   mix_a0 = acc0 - ((fb_a0*fb_alpha)>>15);
   mix_a1 = acc1 - ((fb_a1*fb_alpha)>>15);
@@ -1425,30 +1561,22 @@ static void EMU_CALL reverb_steadystate22(struct SPUCORE_STATE *state, uint16 *r
   mix_b1>>=15;
 
   CLIP_PCM_4(mix_a0,mix_a1,mix_b0,mix_b1);
-  RAM_PCM_SAMPLE(mix_dest_a0) = mix_a0;
-  RAM_PCM_SAMPLE(mix_dest_a1) = mix_a1;
-  RAM_PCM_SAMPLE(mix_dest_b0) = mix_b0;
-  RAM_PCM_SAMPLE(mix_dest_b1) = mix_b1;
+  RAM_PCM_SAMPLE(a->mix_dest_a0) = mix_a0;
+  RAM_PCM_SAMPLE(a->mix_dest_a1) = mix_a1;
+  RAM_PCM_SAMPLE(a->mix_dest_b0) = mix_b0;
+  RAM_PCM_SAMPLE(a->mix_dest_b1) = mix_b1;
 
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /*
-** 22KHz reverb engine
+** 22KHz reverb engine, one step
 */
-static void EMU_CALL reverb_engine22(struct SPUCORE_STATE *state, uint16 *ram, sint32 *l, sint32 *r) {
+static void EMU_CALL reverb_engine22(struct SPUCORE_STATE *state, uint16 *ram, const struct SPUCORE_REVERB_ADDRESSES *a, sint32 *l, sint32 *r) {
   sint32 input_l = *l;
   sint32 input_r = *r;
   sint32 output_l;
   sint32 output_r;
-  sint32 mix_dest_a0 = state->reverb.current_address + MAKE_REVERB_OFFSET(MIX_DEST_A0);
-  sint32 mix_dest_a1 = state->reverb.current_address + MAKE_REVERB_OFFSET(MIX_DEST_A1);
-  sint32 mix_dest_b0 = state->reverb.current_address + MAKE_REVERB_OFFSET(MIX_DEST_B0);
-  sint32 mix_dest_b1 = state->reverb.current_address + MAKE_REVERB_OFFSET(MIX_DEST_B1);
-  NORMALIZE_REVERB_OFFSET(mix_dest_a0);
-  NORMALIZE_REVERB_OFFSET(mix_dest_a1);
-  NORMALIZE_REVERB_OFFSET(mix_dest_b0);
-  NORMALIZE_REVERB_OFFSET(mix_dest_b1);
 
   /*
   ** (Scale these down for now - avoids some clipping)
@@ -1462,7 +1590,7 @@ static void EMU_CALL reverb_engine22(struct SPUCORE_STATE *state, uint16 *ram, s
   ** Execute steady state step if necessary
   */
   if(state->flags & SPUREG_FLAG_REVERB_ENABLE) {
-    reverb_steadystate22(state, ram, input_l, input_r);
+    reverb_steadystate22(state, ram, a, input_l, input_r);
   }
 
   /*
@@ -1470,10 +1598,10 @@ static void EMU_CALL reverb_engine22(struct SPUCORE_STATE *state, uint16 *ram, s
   ** (pretty certain this is done AFTER the steady state step)
   */
   {
-    int al = RAM_SINT32_SAMPLE(mix_dest_a0);
-    int ar = RAM_SINT32_SAMPLE(mix_dest_a1);
-    int bl = RAM_SINT32_SAMPLE(mix_dest_b0);
-    int br = RAM_SINT32_SAMPLE(mix_dest_b1);
+    int al = RAM_SINT32_SAMPLE(a->mix_dest_a0);
+    int ar = RAM_SINT32_SAMPLE(a->mix_dest_a1);
+    int bl = RAM_SINT32_SAMPLE(a->mix_dest_b0);
+    int br = RAM_SINT32_SAMPLE(a->mix_dest_b1);
 
     output_l = al + bl;
     output_r = ar + br;
@@ -1481,143 +1609,107 @@ static void EMU_CALL reverb_engine22(struct SPUCORE_STATE *state, uint16 *ram, s
 
   *l = output_l;
   *r = output_r;
+}
 
-  /*
-  ** Advance reverb buffer position
-  */
-  state->reverb.current_address += 2;
-  if(state->reverb.current_address >= state->reverb.safe_end_address) {
-    state->reverb.current_address = state->reverb.safe_start_address;
+////////////////////////////////////////////////////////////////////////////////
+/*
+** 22KHz reverb engine, over a block of interleaved stereo samples
+** Each step is the same as before, but the work area addresses are only
+** worked out when one of them is about to wrap; in between, moving on to
+** the next step just moves the RAM pointer up by one sample.
+*/
+static void EMU_CALL reverb_engine22_block(struct SPUCORE_STATE *state, uint16 *ram, sint32 *buf, sint32 steps) {
+  struct SPUCORE_REVERB_ADDRESSES a;
+  while(steps > 0) {
+    sint32 run = reverb_addresses(state, &a);
+    sint32 i;
+    if(run > steps) run = steps;
+    for(i = 0; i < run; i++) {
+      reverb_engine22(state, ram + i, &a, buf + 0, buf + 1);
+      buf += 2;
+    }
+    steps -= run;
+    /*
+    ** Advance reverb buffer position
+    */
+    state->reverb.current_address += 2 * run;
+    if(state->reverb.current_address >= state->reverb.safe_end_address) {
+      state->reverb.current_address = state->reverb.safe_start_address;
+    }
   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
+/*
+** Lowpass/downsample, for an odd queue position
+** The filter is symmetrical, so each coefficient but the middle one is
+** applied to the sum of its two taps.
+*/
+static EMU_INLINE sint32 EMU_CALL reverb_downsample(const sint32 *queue, int q) {
+  sint32 s =
+    (queue[(q - 38) & 63] + queue[(q - 0) & 63]) * reverb_psx_lowpass_coefs[0] +
+    (queue[(q - 36) & 63] + queue[(q - 2) & 63]) * reverb_psx_lowpass_coefs[1] +
+    (queue[(q - 34) & 63] + queue[(q - 4) & 63]) * reverb_psx_lowpass_coefs[2] +
+    (queue[(q - 32) & 63] + queue[(q - 6) & 63]) * reverb_psx_lowpass_coefs[3] +
+    (queue[(q - 30) & 63] + queue[(q - 8) & 63]) * reverb_psx_lowpass_coefs[4] +
+    (queue[(q - 28) & 63] + queue[(q - 10) & 63]) * reverb_psx_lowpass_coefs[5] +
+    (queue[(q - 26) & 63] + queue[(q - 12) & 63]) * reverb_psx_lowpass_coefs[6] +
+    (queue[(q - 24) & 63] + queue[(q - 14) & 63]) * reverb_psx_lowpass_coefs[7] +
+    (queue[(q - 22) & 63] + queue[(q - 16) & 63]) * reverb_psx_lowpass_coefs[8] +
+    (queue[(q - 20) & 63] + queue[(q - 18) & 63]) * reverb_psx_lowpass_coefs[9] +
+    (queue[(q - 19) & 63]) * reverb_psx_lowpass_coefs[10];
+  return s >> 15;
+}
 
+////////////////////////////////////////////////////////////////////////////////
+/*
+** The input is downsampled for the whole buffer first, then the reverb
+** engine runs over that as one block, then its output is upsampled. None
+** of these steps feeds back into an earlier one, so the results are the
+** same as going through the three of them one sample at a time.
+*/
 static void EMU_CALL reverb_process(struct SPUCORE_STATE *state, uint16 *ram, sint32 *buf, int samples) {
+  sint32 wet[RENDERMAX + 2];
+  sint32 steps = 0;
   int q = state->reverb.resampler.queue_index;
+  int i;
   /*
-  ** Sample loop
+  ** Downsample
   */
-  while(samples--) {
+  for(i = 0; i < samples; i++, q++) {
     /*
-    ** Get an input sample
+    ** Put the input sample in the input queue
     */
-    sint32 l = buf[0];
-    sint32 r = buf[1];
+    state->reverb.resampler.in_queue_l[q & 63] = buf[2*i+0];
+    state->reverb.resampler.in_queue_r[q & 63] = buf[2*i+1];
     /*
-    ** Put it in the input queue
+    ** If we're ready to create another output sample...
     */
-    state->reverb.resampler.in_queue_l[q & 63] = l;
-    state->reverb.resampler.in_queue_r[q & 63] = r;
+    if(q & 1) {
+      wet[2*steps+0] = reverb_downsample(state->reverb.resampler.in_queue_l, q);
+      wet[2*steps+1] = reverb_downsample(state->reverb.resampler.in_queue_r, q);
+      steps++;
+    }
+  }
+  /*
+  ** Run the reverb engine
+  */
+  reverb_engine22_block(state, ram, wet, steps);
+  /*
+  ** Sample loop
+  */
+  q = state->reverb.resampler.queue_index;
+  steps = 0;
+  while(samples--) {
+    sint32 l;
+    sint32 r;
     /*
-    ** If we're ready to create another output sample...
+    ** Put the new stuff into the output queue
     */
     if(q & 1) {
-      /*
-      ** Lowpass/downsample
-      */
-#if 1
-      l =
-        (state->reverb.resampler.in_queue_l[(q - 38) & 63]) * reverb_psx_lowpass_coefs[0] +
-        (state->reverb.resampler.in_queue_l[(q - 36) & 63]) * reverb_psx_lowpass_coefs[1] +
-        (state->reverb.resampler.in_queue_l[(q - 34) & 63]) * reverb_psx_lowpass_coefs[2] +
-        (state->reverb.resampler.in_queue_l[(q - 32) & 63]) * reverb_psx_lowpass_coefs[3] +
-        (state->reverb.resampler.in_queue_l[(q - 30) & 63]) * reverb_psx_lowpass_coefs[4] +
-        (state->reverb.resampler.in_queue_l[(q - 28) & 63]) * reverb_psx_lowpass_coefs[5] +
-        (state->reverb.resampler.in_queue_l[(q - 26) & 63]) * reverb_psx_lowpass_coefs[6] +
-        (state->reverb.resampler.in_queue_l[(q - 24) & 63]) * reverb_psx_lowpass_coefs[7] +
-        (state->reverb.resampler.in_queue_l[(q - 22) & 63]) * reverb_psx_lowpass_coefs[8] +
-        (state->reverb.resampler.in_queue_l[(q - 20) & 63]) * reverb_psx_lowpass_coefs[9] +
-        (state->reverb.resampler.in_queue_l[(q - 19) & 63]) * reverb_psx_lowpass_coefs[10] +
-        (state->reverb.resampler.in_queue_l[(q - 18) & 63]) * reverb_psx_lowpass_coefs[9] +
-        (state->reverb.resampler.in_queue_l[(q - 16) & 63]) * reverb_psx_lowpass_coefs[8] +
-        (state->reverb.resampler.in_queue_l[(q - 14) & 63]) * reverb_psx_lowpass_coefs[7] +
-        (state->reverb.resampler.in_queue_l[(q - 12) & 63]) * reverb_psx_lowpass_coefs[6] +
-        (state->reverb.resampler.in_queue_l[(q - 10) & 63]) * reverb_psx_lowpass_coefs[5] +
-        (state->reverb.resampler.in_queue_l[(q - 8) & 63]) * reverb_psx_lowpass_coefs[4] +
-        (state->reverb.resampler.in_queue_l[(q - 6) & 63]) * reverb_psx_lowpass_coefs[3] +
-        (state->reverb.resampler.in_queue_l[(q - 4) & 63]) * reverb_psx_lowpass_coefs[2] +
-        (state->reverb.resampler.in_queue_l[(q - 2) & 63]) * reverb_psx_lowpass_coefs[1] +
-        (state->reverb.resampler.in_queue_l[(q - 0) & 63]) * reverb_psx_lowpass_coefs[0];
-      r =
-        (state->reverb.resampler.in_queue_r[(q - 38) & 63]) * reverb_psx_lowpass_coefs[0] +
-        (state->reverb.resampler.in_queue_r[(q - 36) & 63]) * reverb_psx_lowpass_coefs[1] +
-        (state->reverb.resampler.in_queue_r[(q - 34) & 63]) * reverb_psx_lowpass_coefs[2] +
-        (state->reverb.resampler.in_queue_r[(q - 32) & 63]) * reverb_psx_lowpass_coefs[3] +
-        (state->reverb.resampler.in_queue_r[(q - 30) & 63]) * reverb_psx_lowpass_coefs[4] +
-        (state->reverb.resampler.in_queue_r[(q - 28) & 63]) * reverb_psx_lowpass_coefs[5] +
-        (state->reverb.resampler.in_queue_r[(q - 26) & 63]) * reverb_psx_lowpass_coefs[6] +
-        (state->reverb.resampler.in_queue_r[(q - 24) & 63]) * reverb_psx_lowpass_coefs[7] +
-        (state->reverb.resampler.in_queue_r[(q - 22) & 63]) * reverb_psx_lowpass_coefs[8] +
-        (state->reverb.resampler.in_queue_r[(q - 20) & 63]) * reverb_psx_lowpass_coefs[9] +
-        (state->reverb.resampler.in_queue_r[(q - 19) & 63]) * reverb_psx_lowpass_coefs[10] +
-        (state->reverb.resampler.in_queue_r[(q - 18) & 63]) * reverb_psx_lowpass_coefs[9] +
-        (state->reverb.resampler.in_queue_r[(q - 16) & 63]) * reverb_psx_lowpass_coefs[8] +
-        (state->reverb.resampler.in_queue_r[(q - 14) & 63]) * reverb_psx_lowpass_coefs[7] +
-        (state->reverb.resampler.in_queue_r[(q - 12) & 63]) * reverb_psx_lowpass_coefs[6] +
-        (state->reverb.resampler.in_queue_r[(q - 10) & 63]) * reverb_psx_lowpass_coefs[5] +
-        (state->reverb.resampler.in_queue_r[(q - 8) & 63]) * reverb_psx_lowpass_coefs[4] +
-        (state->reverb.resampler.in_queue_r[(q - 6) & 63]) * reverb_psx_lowpass_coefs[3] +
-        (state->reverb.resampler.in_queue_r[(q - 4) & 63]) * reverb_psx_lowpass_coefs[2] +
-        (state->reverb.resampler.in_queue_r[(q - 2) & 63]) * reverb_psx_lowpass_coefs[1] +
-        (state->reverb.resampler.in_queue_r[(q - 0) & 63]) * reverb_psx_lowpass_coefs[0];
-#else
-      l = 0;
-      r = 0;
-
-      for (n = 47; n >= 0; n -= 8) {
-        l +=
-          (state->reverb.resampler.in_queue_l[(q - n + 0) & 63]) * reverb_psx_lowpass_coefs[n - 0] +
-          (state->reverb.resampler.in_queue_l[(q - n + 1) & 63]) * reverb_psx_lowpass_coefs[n - 1] +
-          (state->reverb.resampler.in_queue_l[(q - n + 2) & 63]) * reverb_psx_lowpass_coefs[n - 2] +
-          (state->reverb.resampler.in_queue_l[(q - n + 3) & 63]) * reverb_psx_lowpass_coefs[n - 3] +
-          (state->reverb.resampler.in_queue_l[(q - n + 4) & 63]) * reverb_psx_lowpass_coefs[n - 4] +
-          (state->reverb.resampler.in_queue_l[(q - n + 5) & 63]) * reverb_psx_lowpass_coefs[n - 5] +
-          (state->reverb.resampler.in_queue_l[(q - n + 6) & 63]) * reverb_psx_lowpass_coefs[n - 6] +
-          (state->reverb.resampler.in_queue_l[(q - n + 7) & 63]) * reverb_psx_lowpass_coefs[n - 7];
-        r +=
-          (state->reverb.resampler.in_queue_r[(q - n + 0) & 63]) * reverb_psx_lowpass_coefs[n - 0] +
-          (state->reverb.resampler.in_queue_r[(q - n + 1) & 63]) * reverb_psx_lowpass_coefs[n - 1] +
-          (state->reverb.resampler.in_queue_r[(q - n + 2) & 63]) * reverb_psx_lowpass_coefs[n - 2] +
-          (state->reverb.resampler.in_queue_r[(q - n + 3) & 63]) * reverb_psx_lowpass_coefs[n - 3] +
-          (state->reverb.resampler.in_queue_r[(q - n + 4) & 63]) * reverb_psx_lowpass_coefs[n - 4] +
-          (state->reverb.resampler.in_queue_r[(q - n + 5) & 63]) * reverb_psx_lowpass_coefs[n - 5] +
-          (state->reverb.resampler.in_queue_r[(q - n + 6) & 63]) * reverb_psx_lowpass_coefs[n - 6] +
-          (state->reverb.resampler.in_queue_r[(q - n + 7) & 63]) * reverb_psx_lowpass_coefs[n - 7];
-      }
-#endif
-
-      l >>= 15;
-      r >>= 15;
-
-/*
-      l =
-        (state->reverb.resampler.in_queue_l[(q - 6) & 7]) * reverb_new_lowpass_coefs[0] +
-        (state->reverb.resampler.in_queue_l[(q - 4) & 7]) * reverb_new_lowpass_coefs[1] +
-        (state->reverb.resampler.in_queue_l[(q - 3) & 7]) * reverb_new_lowpass_coefs[2] +
-        (state->reverb.resampler.in_queue_l[(q - 2) & 7]) * reverb_new_lowpass_coefs[1] +
-        (state->reverb.resampler.in_queue_l[(q - 0) & 7]) * reverb_new_lowpass_coefs[0];
-      l >>= 11;
-      r =
-        (state->reverb.resampler.in_queue_r[(q - 6) & 7]) * reverb_new_lowpass_coefs[0] +
-        (state->reverb.resampler.in_queue_r[(q - 4) & 7]) * reverb_new_lowpass_coefs[1] +
-        (state->reverb.resampler.in_queue_r[(q - 3) & 7]) * reverb_new_lowpass_coefs[2] +
-        (state->reverb.resampler.in_queue_r[(q - 2) & 7]) * reverb_new_lowpass_coefs[1] +
-        (state->reverb.resampler.in_queue_r[(q - 0) & 7]) * reverb_new_lowpass_coefs[0];
-      r >>= 11;
-*/
-//l = state->reverb.resampler.in_queue_l[q & 7];
-//r = state->reverb.resampler.in_queue_r[q & 7];
-
-      /*
-      ** Run the reverb engine
-      */
-      reverb_engine22(state, ram, &l, &r);
-      /*
-      ** Put the new stuff into the output queue
-      */
-      state->reverb.resampler.out_queue_l[q & 15] = l;
-      state->reverb.resampler.out_queue_r[q & 15] = r;
+      state->reverb.resampler.out_queue_l[q & 15] = wet[2*steps+0];
+      state->reverb.resampler.out_queue_r[q & 15] = wet[2*steps+1];
+      steps++;
     }
     /*
     ** Upsample
@@ -1672,6 +1764,44 @@ static void EMU_CALL reverb_process(struct SPUCORE_STATE *state, uint16 *ram, si
   state->reverb.resampler.queue_index = q;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/*
+** Adds a voice into an interleaved stereo buffer, on the enabled sides
+*/
+static void EMU_CALL mix_voice(sint32 *out, const sint32 *in, int n, sint32 v_l, sint32 v_r, int left, int right) {
+  int i = 0;
+#if defined(SPUCORE_SSE2)
+  __m128i vl = _mm_set1_epi32(v_l);
+  __m128i vr = _mm_set1_epi32(v_r);
+  __m128i mask = _mm_set_epi32(right ? -1 : 0, left ? -1 : 0, right ? -1 : 0, left ? -1 : 0);
+  for(; i + 4 <= n; i += 4) {
+    __m128i s = _mm_loadu_si128((const __m128i*)(in + i));
+    __m128i q_l = _mm_srai_epi32(mullo_epi32_sse2(s, vl), 16);
+    __m128i q_r = _mm_srai_epi32(mullo_epi32_sse2(s, vr), 16);
+    __m128i o0 = _mm_loadu_si128((__m128i*)(out + 2 * i));
+    __m128i o1 = _mm_loadu_si128((__m128i*)(out + 2 * i + 4));
+    o0 = _mm_add_epi32(o0, _mm_and_si128(_mm_unpacklo_epi32(q_l, q_r), mask));
+    o1 = _mm_add_epi32(o1, _mm_and_si128(_mm_unpackhi_epi32(q_l, q_r), mask));
+    _mm_storeu_si128((__m128i*)(out + 2 * i), o0);
+    _mm_storeu_si128((__m128i*)(out + 2 * i + 4), o1);
+  }
+#elif defined(SPUCORE_NEON)
+  int32x4_t ml = vdupq_n_s32(left ? -1 : 0);
+  int32x4_t mr = vdupq_n_s32(right ? -1 : 0);
+  for(; i + 4 <= n; i += 4) {
+    int32x4_t s = vld1q_s32(in + i);
+    int32x4x2_t o = vld2q_s32(out + 2 * i);
+    o.val[0] = vaddq_s32(o.val[0], vandq_s32(vshrq_n_s32(vmulq_n_s32(s, v_l), 16), ml));
+    o.val[1] = vaddq_s32(o.val[1], vandq_s32(vshrq_n_s32(vmulq_n_s32(s, v_r), 16), mr));
+    vst2q_s32(out + 2 * i, o);
+  }
+#endif
+  for(; i < n; i++) {
+    if(left ) out[2*i+0] += (v_l * in[i]) >> 16;
+    if(right) out[2*i+1] += (v_r * in[i]) >> 16;
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 //int spucore_frq[RENDERMAX];
@@ -1763,14 +1893,8 @@ static void EMU_CALL render(struct SPUCORE_STATE *state, uint16 *ram, sint16 *bu
     if(r < samples) memset(ibuffm + r, 0, 4 * (samples-r));
     v_l = volume_getlevel(state->chan[ch].vol+0);
     v_r = volume_getlevel(state->chan[ch].vol+1);
-    for(i = 0; i < r; i++) {
-      sint32 q_l = (v_l * ibuf[i]) >> 16;
-      sint32 q_r = (v_r * ibuf[i]) >> 16;
-      if(main_l) ibufmix[2*i+0] += q_l;
-      if(main_r) ibufmix[2*i+1] += q_r;
-      if(verb_l) ibufrvb[2*i+0] += q_l;
-      if(verb_r) ibufrvb[2*i+1] += q_r;
-    }
+    if(main_l | main_r) mix_voice(ibufmix, ibuf, r, v_l, v_r, main_l != 0, main_r != 0);
+    if(verb_l | verb_r) mix_voice(ibufrvb, ibuf, r, v_l, v_r, verb_l != 0, verb_r != 0);
   }
 
   state->irq_triggered_cycle = irq_state.triggered_cycle;
@@ -22,22 +22,37 @@
 #include <stdlib.h>
 #include <math.h>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define YAM_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define YAM_NEON
+#endif
+
 #ifndef _WIN32
 #define __cdecl
-#ifdef __aarch64__
+#if defined(__aarch64__) || defined(__amd64__)
 #define __fastcall
 #else
 #define __fastcall __attribute__((regparm(3)))
 #endif
 #endif
 
-/* No dynarec for x86_64 yet */
-#if defined(_WIN32) || defined(__i386__)
+/* x86_64 dynarec is System V ABI only, no Win64 yet */
+#if defined(_WIN64)
+#elif defined(__amd64__)
+#define ENABLE_DYNAREC
+#define DYNAREC_AMD64
+#elif defined(_WIN32) || defined(__i386__)
 #define ENABLE_DYNAREC
 #endif
-#if defined(_WIN64) || defined(__amd64__)
-#undef ENABLE_DYNAREC
-#endif
+
+/*
+** Define YAM_DYNAREC_CHECK to run every block of DSP samples through both
+** the dynarec and the interpreter, report any difference on stderr, and keep
+** the interpreter's results.  Slow; meant for testing the code generators.
+*/
 
 // no 'conversion from _blah_ possible loss of data' warnings
 #pragma warning (disable: 4244)
@@ -359,7 +374,11 @@ static uint64 mpro_aica_read(struct MPRO *mpro) {
   return value;
 }
 
+#ifdef DYNAREC_AMD64
+#define DYNACODE_MAX_SIZE (0x8000)
+#else
 #define DYNACODE_MAX_SIZE (0x6000)
+#endif
 #define DYNACODE_SLOP_SIZE (0x80)
 
 struct YAM_STATE {
@@ -377,6 +396,7 @@ struct YAM_STATE {
 #ifdef ENABLE_DYNAREC
   uint8 dsp_dyna_enabled;
   uint8 dsp_dyna_valid;
+  uint32 dsp_dyna_serial;
 #endif
   uint32 randseed;
   uint32 mem_word_address_xor;
@@ -447,10 +467,11 @@ struct YAM_STATE {
   //
   struct YAM_CHAN chan[64];
   //
-  // Buffer for dynarec code
+  // Buffer for dynarec code, mapped executable outside the state
+  // (see yam_prepare_dynacode)
   //
 #ifdef ENABLE_DYNAREC
-  uint8 dynacode[DYNACODE_MAX_SIZE];
+  uint8 *dynacode;
 #endif
 };
 
@@ -502,10 +523,7 @@ void EMU_CALL yam_clear_state(void *state, uint8 version) {
   // Enable DSP emulation by default
   YAMSTATE->dsp_emulation_enabled = 1;
 
-  // Enable DSP dynarec
-#ifdef ENABLE_DYNAREC
-  YAMSTATE->dsp_dyna_enabled = 1;
-#endif
+  // DSP dynarec stays off until yam_enable_dsp_dynarec maps its buffer
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -601,10 +619,19 @@ void EMU_CALL yam_enable_dsp(void *state, uint8 enable) {
 #endif
 }
 
+//
+// Enabling maps the dynacode buffer, disabling unmaps it, so a state with the
+// dynarec enabled must have it disabled again before it's freed
+//
 void EMU_CALL yam_enable_dsp_dynarec(void *state, uint8 enable) {
 #ifdef ENABLE_DYNAREC
-  YAMSTATE->dsp_dyna_enabled = (enable != 0);
-  if(enable == 0) { YAMSTATE->dsp_dyna_valid = 0; }
+  if(enable) {
+    yam_prepare_dynacode(state);
+  } else {
+    yam_unprepare_dynacode(state);
+  }
+  YAMSTATE->dsp_dyna_enabled = (YAMSTATE->dynacode != NULL);
+  YAMSTATE->dsp_dyna_valid = 0;
 #endif
 }
 
@@ -1972,6 +1999,16 @@ static int env_needstep(uint32 effrate, uint32 odometer) {
   // 11111111 0x04
 }
 
+//
+// Steps can only occur where (odometer & mask) == 0, so env_needstep
+// only has to be asked there
+//
+static uint32 env_stepmask(uint32 effrate) {
+  if(effrate <= 0x01) return 0xFFFFFFFF;
+  if(effrate >= 0x30) return 1;
+  return (1 << (12 - ((effrate - 1) >> 2))) - 1;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Read next sample
@@ -2105,6 +2142,21 @@ static uint32 generate_samples(
   uint32 base_phaseinc;
   uint32 lfophaseinc = lfophaseinctable[chan->lfof];
   uint32 bufptrsave = state->bufptr;
+  //
+  // Registers can't change during a block (every write flushes first), so
+  // envelope rates and filter coefficients only need recomputing when the
+  // envelope state or filter level moves
+  //
+  uint32 amp_envstate = 0xFF, amp_rate = 0, amp_mask = 0;
+  uint32 lpf_envstate = 0xFF, lpf_rate = 0, lpf_mask = 0;
+  uint32 lpf_level = 0xFFFFFFFF;
+  sint32 lpf_f = 0;
+  sint32 lpf_q = qtable[chan->q & 0x1F];
+  //
+  // Plain forward 8/16-bit playback away from the loop points is read
+  // inline; anything else goes through readnextsample
+  //
+  int fastread = (chan->pcms < 2) && (chan->ssctl == 0);
 
 //gfreq[samples]++;
 
@@ -2185,10 +2237,12 @@ static uint32 generate_samples(
       }
       // Apply filter, if we want it
       if(!(chan->lpoff)) {
-        uint32 fv = chan->lpflevel;
-        uint32 qv = chan->q & 0x1F;
-        sint32 f = (((fv & 0xFF) | 0x100) << 4) >> ((fv >> 8) ^ 0x1F);
-        sint32 q = qtable[qv];
+        sint32 f, q = lpf_q;
+        if(chan->lpflevel != lpf_level) {
+          uint32 fv = lpf_level = chan->lpflevel;
+          lpf_f = (((fv & 0xFF) | 0x100) << 4) >> ((fv >> 8) ^ 0x1F);
+        }
+        f = lpf_f;
         s = f * s + (0x2000 - f + q) * (chan->lpp1) - q * (chan->lpp2);
         s >>= 13;
         chan->lpp2 = chan->lpp1;
@@ -2210,7 +2264,13 @@ static uint32 generate_samples(
     //
     // Advance amplitude envelope
     //
-    { uint32 effectiverate = env_adjustrate(chan, chan->ar[chan->envstate]);
+    if(chan->envstate != amp_envstate) {
+      amp_envstate = chan->envstate;
+      amp_rate = env_adjustrate(chan, chan->ar[amp_envstate]);
+      amp_mask = env_stepmask(amp_rate);
+    }
+    if(!(odometer & amp_mask)) {
+      uint32 effectiverate = amp_rate;
       if(env_needstep(effectiverate, odometer)) {
         switch(chan->envstate) {
         case 0: // attack
@@ -2231,7 +2291,13 @@ static uint32 generate_samples(
     //
     // Advance filter envelope
     //
-    { uint32 effectiverate = env_adjustrate(chan, chan->fr[chan->lpfstate]);
+    if(chan->lpfstate != lpf_envstate) {
+      lpf_envstate = chan->lpfstate;
+      lpf_rate = env_adjustrate(chan, chan->fr[lpf_envstate]);
+      lpf_mask = env_stepmask(lpf_rate);
+    }
+    if(!(odometer & lpf_mask)) {
+      uint32 effectiverate = lpf_rate;
       if(env_needstep(effectiverate, odometer)) {
         uint32 d = envdecayvalue[effectiverate][odometer&3];
         uint32 target = chan->flv[chan->lpfstate+1];
@@ -2286,7 +2352,26 @@ static uint32 generate_samples(
       chan->frcphase += realphaseinc;
       while(chan->frcphase >= 0x40000) {
         chan->frcphase -= 0x40000;
-        readnextsample(state, chan, 0, 1);
+        if(
+          fastread && chan->sampler_dir == 1 &&
+          chan->playpos != (uint32)chan->loopstart &&
+          ((chan->playpos + 1) & 0xFFFF) != (uint32)chan->loopend
+        ) {
+          sint32 s;
+          if(chan->pcms == 0) {
+            s = *(sint16*)(((sint8*)(state->ram_ptr)) + (((chan->sampleaddr + 2 * chan->playpos) ^ (state->mem_word_address_xor)) & (state->ram_mask)));
+            s ^= chan->sampler_invert;
+          } else {
+            s = *(sint8*)(((sint8*)(state->ram_ptr)) + (((chan->sampleaddr + chan->playpos) ^ (state->mem_byte_address_xor)) & (state->ram_mask)));
+            s ^= chan->sampler_invert >> 8;
+            s <<= 8;
+          }
+          chan->playpos = (chan->playpos + 1) & 0xFFFF;
+          chan->samplebufcur = chan->samplebufnext;
+          chan->samplebufnext = s;
+        } else {
+          readnextsample(state, chan, 0, 1);
+        }
       }
     }
     // Advance our temporary odometer copy
@@ -2297,11 +2382,88 @@ static uint32 generate_samples(
   return g;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// Add (buf * lin) >> att into a mono or interleaved stereo bus
+//
+#ifdef YAM_SSE2
+static __m128i mullo_epi32_sse2(__m128i a, __m128i b) {
+  __m128i even = _mm_mul_epu32(a, b);
+  __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+  return _mm_unpacklo_epi32(
+    _mm_shuffle_epi32(even, _MM_SHUFFLE(0,0,2,0)),
+    _mm_shuffle_epi32(odd, _MM_SHUFFLE(0,0,2,0))
+  );
+}
+#endif
+
+static void mix_mono(
+  sint32 *out, const sint32 *buf, uint32 n,
+  sint32 lin, uint8 att
+) {
+  uint32 i = 0;
+#if defined(YAM_SSE2)
+  __m128i vlin = _mm_set1_epi32(lin);
+  __m128i vatt = _mm_cvtsi32_si128(att);
+  for(; i + 4 <= n; i += 4) {
+    __m128i s = mullo_epi32_sse2(_mm_loadu_si128((const __m128i*)(buf + i)), vlin);
+    __m128i o = _mm_loadu_si128((const __m128i*)(out + i));
+    _mm_storeu_si128((__m128i*)(out + i), _mm_add_epi32(o, _mm_sra_epi32(s, vatt)));
+  }
+#elif defined(YAM_NEON)
+  int32x4_t vatt = vdupq_n_s32(-(sint32)att);
+  for(; i + 4 <= n; i += 4) {
+    int32x4_t s = vmulq_n_s32(vld1q_s32(buf + i), lin);
+    vst1q_s32(out + i, vaddq_s32(vld1q_s32(out + i), vshlq_s32(s, vatt)));
+  }
+#endif
+  for(; i < n; i++) {
+    out[i] += (buf[i]*lin) >> att;
+  }
+}
+
+static void mix_stereo(
+  sint32 *out, const sint32 *buf, uint32 n,
+  sint32 lin_l, uint8 att_l, sint32 lin_r, uint8 att_r
+) {
+  uint32 i = 0;
+#if defined(YAM_SSE2)
+  __m128i vlin_l = _mm_set1_epi32(lin_l);
+  __m128i vlin_r = _mm_set1_epi32(lin_r);
+  __m128i vatt_l = _mm_cvtsi32_si128(att_l);
+  __m128i vatt_r = _mm_cvtsi32_si128(att_r);
+  for(; i + 4 <= n; i += 4) {
+    __m128i s = _mm_loadu_si128((const __m128i*)(buf + i));
+    __m128i l = _mm_sra_epi32(mullo_epi32_sse2(s, vlin_l), vatt_l);
+    __m128i r = _mm_sra_epi32(mullo_epi32_sse2(s, vlin_r), vatt_r);
+    __m128i o0 = _mm_loadu_si128((const __m128i*)(out + 2 * i));
+    __m128i o1 = _mm_loadu_si128((const __m128i*)(out + 2 * i + 4));
+    _mm_storeu_si128((__m128i*)(out + 2 * i), _mm_add_epi32(o0, _mm_unpacklo_epi32(l, r)));
+    _mm_storeu_si128((__m128i*)(out + 2 * i + 4), _mm_add_epi32(o1, _mm_unpackhi_epi32(l, r)));
+  }
+#elif defined(YAM_NEON)
+  int32x4_t vatt_l = vdupq_n_s32(-(sint32)att_l);
+  int32x4_t vatt_r = vdupq_n_s32(-(sint32)att_r);
+  for(; i + 4 <= n; i += 4) {
+    int32x4_t s = vld1q_s32(buf + i);
+    int32x4x2_t o = vld2q_s32(out + 2 * i);
+    o.val[0] = vaddq_s32(o.val[0], vshlq_s32(vmulq_n_s32(s, lin_l), vatt_l));
+    o.val[1] = vaddq_s32(o.val[1], vshlq_s32(vmulq_n_s32(s, lin_r), vatt_r));
+    vst2q_s32(out + 2 * i, o);
+  }
+#endif
+  for(; i < n; i++) {
+    out[2 * i + 0] += (buf[i]*lin_l) >> att_l;
+    out[2 * i + 1] += (buf[i]*lin_r) >> att_r;
+  }
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Render a single channel and add it to the given outputs
 //
 // directout or fxout may be NULL
+// fxout is one plane of the planar effect bus (RENDERMAX samples per send)
 //
 static void render_and_add_channel(
   struct YAM_STATE *state,
@@ -2311,7 +2473,6 @@ static void render_and_add_channel(
   uint32 odometer,
   uint32 samples
 ) {
-  uint32 i;
   sint32 localbuf[RENDERMAX];
   uint32 rendersamples;
 
@@ -2340,20 +2501,13 @@ static void render_and_add_channel(
       (state->mono) ? 0 : (chan->dipan),
       &att_l, &att_r, &lin_l, &lin_r
     );
-    for(i = 0; i < rendersamples; i++) {
-      directout[0] += (localbuf[i]*lin_l) >> att_l;
-      directout[1] += (localbuf[i]*lin_r) >> att_r;
-      directout += 2;
-    }
+    mix_stereo(directout, localbuf, rendersamples, lin_l, att_l, lin_r, att_r);
   }
   if(fxout) {
     uint32 att = (chan->dsplevel) ^ 0xF;
     sint32 lin = 4 - (att & 1);
     att >>= 1; att += 2;
-    for(i = 0; i < rendersamples; i++) {
-      fxout[0] += (localbuf[i]*lin) >> att;
-      fxout += 16;
-    }
+    mix_mono(fxout, localbuf, rendersamples, lin, att);
   }
 
 }
@@ -2532,8 +2686,9 @@ static void __fastcall dsp_sample_interpret(struct YAM_STATE *state) {
 #define C(N) { *outp++ = ((uint8)(N)); }
 #define C32(N) { *((uint32*)outp) = ((uint32)(N)); outp += 4; }
 #define C32CALL(N) { *((uint32*)outp) = ((uint32)(N)) - (((uint32)(outp))+4); outp += 4; }
+#define C32REL(P,T) { *((uint32*)(P)) = ((uint32)((T) - ((P)+4))); }
 
-#define STRUCTOFS(thetype,thefield) ((uint32)(&(((struct thetype*)0)->thefield)))
+#define STRUCTOFS(thetype,thefield) ((uint32)(size_t)(&(((struct thetype*)0)->thefield)))
 #define STATEOFS(thefield) STRUCTOFS(YAM_STATE,thefield)
 
 #ifdef ENABLE_DYNAREC
@@ -2561,7 +2716,7 @@ static int instruction_uses_shifted(struct MPRO *mpro) {
 // Also uses the current ringbuffer pointer and size, and ram pointer/mask/memwordxor
 // So if any of those change, the compiled dynacode must be invalidated
 //
-#ifdef ENABLE_DYNAREC
+#if defined(ENABLE_DYNAREC) && !defined(DYNAREC_AMD64)
 static void dynacompile(struct YAM_STATE *state) {
   // Pre-compute ringbuffer size mask
   uint32 rbmask = (1 << ((state->rbl)+13)) - 1;
@@ -2853,10 +3008,492 @@ static void dynacompile(struct YAM_STATE *state) {
 }
 #endif
 
+//
+// x86_64 version of the above, System V ABI: state arrives in RDI
+// Unlike the x86 version, this follows dsp_sample_interpret exactly,
+// since that's what x86_64 builds have always been running
+//
+#ifdef DYNAREC_AMD64
+static void dynacompile(struct YAM_STATE *state) {
+  // Pre-compute ringbuffer size mask
+  uint32 rbmask = (1 << ((state->rbl)+13)) - 1;
+
+  uint8 *outp = state->dynacode;
+  uint8 *f2i_calls[128];
+  uint8 *i2f_calls[128];
+  int f2i_count = 0;
+  int i2f_count = 0;
+  int i;
+  char ins_uses_acc[129];
+  char ins_uses_shifted[129];
+  //
+  // Put some slop here to avoid cache problems?
+  //
+  outp += DYNACODE_SLOP_SIZE;
+  //
+  // Figure out which instructions need what things
+  // (skipped instructions use neither, they just overwrite ACC)
+  //
+  memset(ins_uses_acc, 0, sizeof(ins_uses_acc));
+  memset(ins_uses_shifted, 0, sizeof(ins_uses_shifted));
+  ins_uses_acc[128] = 1;
+  ins_uses_shifted[128] = 1;
+  for(i = 0; i < 128; i++) {
+    struct MPRO *mpro = state->mpro + i;
+    ins_uses_shifted[i] = instruction_uses_shifted(mpro);
+    ins_uses_acc[i] =
+      (ins_uses_shifted[i]) ||
+      ((mpro->__kisxzbon & 0x0C) == 0x04);
+  }
+
+  //
+  // Prefix
+  //
+  C(0x53)                                                 // push rbx
+  C(0x55)                                                 // push rbp
+  C(0x8B) C(0xAF) C32(STATEOFS(mdec_ct))                  // mov ebp,[rdi+<OFS32:mdec_ct>]
+  C(0x8B) C(0xB7) C32(STATEOFS(xzbchoice[XZBCHOICE_ACC])) // mov esi,[rdi+<OFS32:acc>]
+  C(0x4C) C(0x8B) C(0x97) C32(STATEOFS(ram_ptr))          // mov r10,[rdi+<OFS32:ram_ptr>]
+  // 21 bytes
+  //
+  // Each instruction
+  //
+  for(i = 0; i < 128; i++) {
+    struct MPRO *mpro = state->mpro + i;
+    //
+    // Skipped instruction: ACC = TEMP[MDEC_CT] * FRC_REG + TEMP[MDEC_CT]
+    //
+    if(mpro->__kisxzbon & 0x80) {
+      C(0x89) C(0xE9)                                           // mov ecx,ebp
+      C(0x83) C(0xE1) C(0x7F)                                   // and ecx,7Fh
+      C(0x8B) C(0x87) C32(STATEOFS(yychoice[YYCHOICE_FRC_REG])) // mov eax,[rdi+yychoice0]
+      C(0xF7) C(0xAC) C(0x8F) C32(STATEOFS(temp))               // imul dword ptr [rdi+rcx*4+temp]
+      C(0x0F) C(0xAC) C(0xD0) C(0x0C)                           // shrd eax,edx,12
+      C(0x03) C(0x84) C(0x8F) C32(STATEOFS(temp))               // add eax,[rdi+rcx*4+<OFS32:temp>]
+      C(0x89) C(0xC6)                                           // mov esi,eax
+      // 31 bytes
+      continue;
+    }
+    //
+    // If we need to compute the new accumulator, do so (to EAX)
+    //
+    if(ins_uses_acc[i + 1]) {
+      int need_tra =
+        ((mpro->__kisxzbon & 0x10) == 0x00) ||
+        ((mpro->__kisxzbon & 0x0C) == 0x00);
+      //
+      // If we will need TRA in the future, compute it in ECX
+      //
+      if(need_tra) {
+        C(0x8D) C(0x4D) C(mpro->t_0rrrrrrr) // lea ecx,[rbp+<BYTE:TRA>]
+        C(0x83) C(0xE1) C(0x7F)             // and ecx,7Fh
+      }
+      // 6 bytes max
+      //
+      // Load EAX with the Y value
+      //
+      switch(mpro->m_wrAFyyYh & 0x0C) {
+      case 0x00: // FRC_REG
+        C(0x8B) C(0x87) C32(STATEOFS(yychoice[YYCHOICE_FRC_REG])) // mov eax,[rdi+yychoice0]
+        break;
+      case 0x04: // COEF
+        { sint32 coef = state->coef[mpro->c_0rrrrrrr];
+          C(0xB8) C32(coef)                                       // mov eax,<SINT32:COEF>
+        }
+        break;
+      case 0x08: // Y_REG_H
+        C(0x8B) C(0x87) C32(STATEOFS(yychoice[YYCHOICE_Y_REG_H])) // mov eax,[rdi+yychoice2]
+        break;
+      case 0x0C: // Y_REG_L
+        C(0x8B) C(0x87) C32(STATEOFS(yychoice[YYCHOICE_Y_REG_L])) // mov eax,[rdi+yychoice3]
+        break;
+      }
+      // 6 bytes max
+      //
+      // Multiply by the X value
+      //
+      if((mpro->__kisxzbon & 0x10) == 0) {
+        C(0xF7) C(0xAC) C(0x8F) C32(STATEOFS(temp))             // imul dword ptr [rdi+rcx*4+temp]
+      } else {
+        C(0xF7) C(0xAF) C32(STATEOFS(inputs[mpro->i_00rrrrrr])) // imul dword ptr [rdi+<OFS32:INPUTS+4*IRA>]
+      }
+      C(0x0F) C(0xAC) C(0xD0) C(0x0C) // shrd eax,edx,12
+      // 11 bytes max
+      //
+      // Add B if necessary
+      //
+      if((mpro->__kisxzbon & 0x08) == 0) {
+        if(mpro->negb == 0) {
+          if((mpro->__kisxzbon & 0x04) == 0) {
+            C(0x03) C(0x84) C(0x8F) C32(STATEOFS(temp)) // add eax,[rdi+rcx*4+<OFS32:temp>]
+          } else {
+            C(0x01) C(0xF0)                             // add eax,esi
+          }
+        } else {
+          if((mpro->__kisxzbon & 0x04) == 0) {
+            C(0x2B) C(0x84) C(0x8F) C32(STATEOFS(temp)) // sub eax,[rdi+rcx*4+<OFS32:temp>]
+          } else {
+            C(0x29) C(0xF0)                             // sub eax,esi
+          }
+        }
+      }
+      // 7 bytes max
+    }
+    // 30 bytes max
+    //
+    // If YRL is on, latch Y register
+    //
+    if(mpro->m_wrAFyyYh & 2) {
+      C(0x8B) C(0x97) C32(STATEOFS(inputs[mpro->i_00rrrrrr]))   // mov edx,[rdi+<OFS32:INPUTS+4*IRA>]
+      C(0xC1) C(0xFA) C(0x0B)                                   // sar edx,11
+      C(0x89) C(0x97) C32(STATEOFS(yychoice[YYCHOICE_Y_REG_H])) // mov [rdi+<OFS32:yychoice2>],edx
+      C(0x8B) C(0x97) C32(STATEOFS(inputs[mpro->i_00rrrrrr]))   // mov edx,[rdi+<OFS32:INPUTS+4*IRA>]
+      C(0xC1) C(0xFA) C(0x04)                                   // sar edx,4
+      C(0x81) C(0xE2) C32(0x00000FFF)                           // and edx,0FFFh
+      C(0x89) C(0x97) C32(STATEOFS(yychoice[YYCHOICE_Y_REG_L])) // mov [rdi+<OFS32:yychoice3>],edx
+    }
+    // 36 bytes max
+    //
+    // If we will be needing SHIFTED this instruction, edx will become SHIFTED:
+    //
+    if(ins_uses_shifted[i]) {
+      if((mpro->__kisxzbon & 0x20) == 0) { // no saturate
+        C(0x89) C(0xF2)                           // mov edx,esi
+        if(mpro->m_wrAFyyYh & 1) {
+          C(0x01) C(0xD2)                         // add edx,edx
+        }
+        // 4 bytes max
+      } else { // saturate
+        if((mpro->m_wrAFyyYh & 1) == 0) { // NOT shifting left
+          C(0x8D) C(0x96) C32(0x00800000)         // lea edx,[rsi+800000h]
+          C(0xF7) C(0xC2) C32(0xFF000000)         // test edx,0FF000000h
+          C(0x89) C(0xF2)                         // mov edx,esi
+          // 14 bytes max
+        } else { // shifting left
+          C(0x8D) C(0x94) C(0x36) C32(0x00800000) // lea edx,[rsi+rsi+800000h]
+          C(0xF7) C(0xC2) C32(0xFF000000)         // test edx,0FF000000h
+          C(0x8D) C(0x14) C(0x36)                 // lea edx,[rsi+rsi]
+          // 16 bytes max
+        }
+        C(0x74) C(0x09)                 // je +9bytes
+        C(0xC1) C(0xFA) C(0x1F)         // sar edx,1Fh
+        C(0x81) C(0xF2) C32(0x007FFFFF) // xor edx,7FFFFFh
+        // 27 bytes max
+      }
+    }
+    // 27 bytes max
+    //
+    // If we need the accumulator next instruction, save it
+    //
+    if(ins_uses_acc[i + 1]) {
+      C(0x89) C(0xC6) // mov esi,eax
+    }
+    // 2 bytes max
+    //
+    // If TWT is on, perform the temp write of SHIFTED
+    //
+    if((mpro->t_Twwwwwww & 0x80) == 0) {
+      C(0x8D) C(0x4D) C(mpro->t_Twwwwwww)         // lea ecx,[rbp+<BYTE:TWA>]
+      C(0x83) C(0xE1) C(0x7F)                     // and ecx,7Fh
+      C(0x89) C(0x94) C(0x8F) C32(STATEOFS(temp)) // mov [rdi+rcx*4+<OFS32:temp>],edx
+    }
+    // 13 bytes max
+    //
+    // If FRCL is set, latch it
+    //
+    if(mpro->m_wrAFyyYh & 0x10) {
+      C(0x89) C(0xD0) //mov eax,edx
+      if(mpro->__kisxzbon & 0x40) { // interpolate mode
+        C(0x25) C32(0x00000FFF) // and eax,0FFFh
+      } else { // non-interpolate mode
+        C(0xC1) C(0xF8) C(0x0B) // sar eax,11
+      }
+      C(0x89) C(0x87) C32(STATEOFS(yychoice[YYCHOICE_FRC_REG])) // mov [rdi+<OFS32:yychoice0>],eax
+    }
+    // 13 bytes max
+    //
+    // If we'll be needing an address, compute it in EBX (a byte offset into RAM)
+    //
+    if(mpro->m_wrAFyyYh & 0xC0) {
+      uint32 madrsnx = state->madrs[mpro->m_00aaaaaa];
+      if(mpro->__kisxzbon & 1) { madrsnx++; }
+      madrsnx &= 0xFFFF;
+      if(mpro->tablemask == 0) {
+        C(0x8D) C(0x9D) C32(madrsnx)                       // lea ebx,[rbp+<DWORD:MADRS+NXADR>]
+        if(mpro->adrmask != 0) {
+          C(0x03) C(0x9F) C32(STATEOFS(adrs_reg))          // add ebx,[rdi+<OFS32:adrs_reg>]
+        }
+        C(0x81) C(0xE3) C32(rbmask)                        // and ebx,<DWORD:rblmask>
+        // 18 bytes max
+      } else {
+        C(0xBB) C32(madrsnx)                               // mov ebx,<DWORD:MADRS+NXADR masked by 0xFFFF>
+        if(mpro->adrmask != 0) {
+          C(0x03) C(0x9F) C32(STATEOFS(adrs_reg))          // add ebx,[rdi+<OFS32:adrs_reg>]
+          C(0x81) C(0xE3) C32(0x0000FFFF)                  // and ebx,0FFFFh
+        }
+        // 17 bytes max
+      }
+      C(0x01) C(0xDB)                                      // add ebx,ebx
+      if(state->rbp != 0) {
+        C(0x81) C(0xC3) C32(state->rbp)                    // add ebx,<DWORD:rbp>
+      }
+      C(0x81) C(0xE3) C32(state->ram_mask)                 // and ebx,<DWORD:RAMMASK>
+      if(state->mem_word_address_xor != 0) {
+        C(0x81) C(0xF3) C32(state->mem_word_address_xor)   // xor ebx,<DWORD:memwxor>
+      }
+    }
+    // 38 bytes max
+    //
+    // If MRD is set, read from RAM+EBX:
+    //
+    if(mpro->m_wrAFyyYh & 0x40) {
+      C(0x41) C(0x0F) C(0xBF) C(0x04) C(0x1A)               // movsx eax,word ptr [r10+rbx]
+      if((mpro->__kisxzbon & 0x02) == 0) { // NOFL=0
+        C(0xE8) f2i_calls[f2i_count++] = outp; C32(0)       // call float16_to_int24
+      } else { // NOFL=1:
+        C(0xC1) C(0xE0) C(0x08)                             // shl eax,8
+      }
+      C(0x89) C(0x87) C32(STATEOFS(mem_in_data[(i+2)&3]))   // mov [rdi+<OFS32:meminptr>],eax
+    }
+    // 16 bytes max
+    //
+    // If MWT is set, write edx to RAM+EBX:
+    //
+    if(mpro->m_wrAFyyYh & 0x80) {
+      if((mpro->__kisxzbon & 0x02) == 0) { // NOFL=0
+        C(0xE8) i2f_calls[i2f_count++] = outp; C32(0)       // call int24_to_float16
+      } else { // NOFL=1:
+        C(0x89) C(0xD0)                                     // mov eax,edx
+        C(0xC1) C(0xF8) C(0x08)                             // sar eax,8
+      }
+      C(0x66) C(0x41) C(0x89) C(0x04) C(0x1A)               // mov [r10+rbx],ax
+    }
+    // 10 bytes max
+    //
+    // If ADRL is set, latch address reg
+    //
+    if(mpro->m_wrAFyyYh & 0x20) {
+      if(mpro->__kisxzbon & 0x40) { // interpolate mode
+        C(0x89) C(0xD0)                                         // mov eax,edx
+        C(0xC1) C(0xF8) C(0x0C)                                 // sar eax,12
+      } else {
+        C(0x8B) C(0x87) C32(STATEOFS(inputs[mpro->i_00rrrrrr])) // mov eax,[rdi+<OFS32:INPUTS+4*IRA>]
+        C(0xC1) C(0xF8) C(0x10)                                 // sar eax,16
+      }
+      C(0x25) C32(0x00000FFF)                 // and eax,0FFFh
+      C(0x89) C(0x87) C32(STATEOFS(adrs_reg)) // mov [rdi+<OFS32:adrs_reg>],eax
+    }
+    // 20 bytes max
+    //
+    // If EWT is on, perform write of EFREG
+    //
+    if((mpro->e_000Twwww & 0x10) == 0) {
+      C(0x89) C(0xD0)                                              // mov eax,edx
+      C(0xC1) C(0xF8) C(0x08)                                      // sar eax,8
+      C(0x66) C(0x89) C(0x87) C32(STATEOFS(efreg[mpro->e_000Twwww])) // mov [rdi+<OFS32:EFREG+2*EWA>],ax
+    }
+    // 12 bytes max
+    //
+    // If IWT is on, perform input write
+    // (the slot MRD just wrote is never the one read here)
+    //
+    if((mpro->i_0T0wwwww & 0x40) == 0) {
+      C(0x8B) C(0x87) C32(STATEOFS(mem_in_data[i&3]))         // mov eax,[rdi+<OFS32:memindata>]
+      C(0x89) C(0x87) C32(STATEOFS(inputs[mpro->i_0T0wwwww])) // mov [rdi+<OFS32:INPUTS+4*IWA>],eax
+    }
+    // 12 bytes max
+  }
+  // 229 bytes max per instruction
+  //
+  // Suffix
+  //
+  C(0x89) C(0xB7) C32(STATEOFS(xzbchoice[XZBCHOICE_ACC])) // mov [rdi+<OFS32:acc>],esi
+  C(0x5D)                                                 // pop rbp
+  C(0x5B)                                                 // pop rbx
+  C(0xC3)                                                 // retn
+  // 9 bytes
+  //
+  // Float conversion subroutines, only if used
+  // Both clobber ECX, R8D, R9D
+  //
+  if(f2i_count) {
+    uint8 *f2i = outp;
+    // EAX = float16_to_int24(EAX)
+    C(0x89) C(0xC1)                                   // mov ecx,eax
+    C(0xC1) C(0xE9) C(0x0B)                           // shr ecx,11
+    C(0x83) C(0xE1) C(0x0F)                           // and ecx,0Fh
+    C(0x41) C(0x89) C(0xC0)                           // mov r8d,eax
+    C(0x41) C(0x81) C(0xE0) C32(0x00008000)           // and r8d,8000h
+    C(0x41) C(0xC1) C(0xE0) C(0x10)                   // shl r8d,16
+    C(0x41) C(0xD1) C(0xF8)                           // sar r8d,1
+    C(0x45) C(0x89) C(0xC1)                           // mov r9d,r8d
+    C(0x41) C(0x81) C(0xF1) C32(0x40000000)           // xor r9d,40000000h
+    C(0x83) C(0xF9) C(0x0C)                           // cmp ecx,12
+    C(0x45) C(0x0F) C(0x42) C(0xC1)                   // cmovb r8d,r9d
+    C(0x41) C(0xB9) C32(11)                           // mov r9d,11
+    C(0x41) C(0x0F) C(0x43) C(0xC9)                   // cmovae ecx,r9d
+    C(0x25) C32(0x000007FF)                           // and eax,7FFh
+    C(0xC1) C(0xE0) C(0x13)                           // shl eax,19
+    C(0x44) C(0x09) C(0xC0)                           // or eax,r8d
+    C(0x83) C(0xC1) C(0x08)                           // add ecx,8
+    C(0xD3) C(0xF8)                                   // sar eax,cl
+    C(0xC3)                                           // retn
+    // 69 bytes
+    for(i = 0; i < f2i_count; i++) { C32REL(f2i_calls[i], f2i) }
+  }
+  if(i2f_count) {
+    uint8 *i2f = outp;
+    // EAX = int24_to_float16(EDX)
+    C(0x89) C(0xD0)                                   // mov eax,edx
+    C(0x41) C(0x89) C(0xC0)                           // mov r8d,eax
+    C(0x41) C(0xC1) C(0xE0) C(0x08)                   // shl r8d,8
+    C(0x41) C(0xC1) C(0xF8) C(0x1F)                   // sar r8d,31
+    C(0x44) C(0x31) C(0xC0)                           // xor eax,r8d
+    C(0x25) C32(0x007FFFFF)                           // and eax,7FFFFFh
+    C(0x89) C(0xC1)                                   // mov ecx,eax
+    C(0x81) C(0xC9) C32(0x00000800)                   // or ecx,800h
+    C(0x0F) C(0xBD) C(0xC9)                           // bsr ecx,ecx
+    C(0xF7) C(0xD9)                                   // neg ecx
+    C(0x83) C(0xC1) C(0x16)                           // add ecx,22
+    C(0x41) C(0x89) C(0xC9)                           // mov r9d,ecx
+    C(0x3D) C32(0x00000800)                           // cmp eax,800h
+    C(0x41) C(0x83) C(0xD1) C(0x00)                   // adc r9d,0
+    C(0x41) C(0xC1) C(0xE1) C(0x0B)                   // shl r9d,11
+    C(0xD3) C(0xE0)                                   // shl eax,cl
+    C(0xC1) C(0xE8) C(0x0B)                           // shr eax,11
+    C(0x25) C32(0x000007FF)                           // and eax,7FFh
+    C(0x44) C(0x09) C(0xC8)                           // or eax,r9d
+    C(0x41) C(0x81) C(0xE0) C32(0x000087FF)           // and r8d,87FFh
+    C(0x44) C(0x31) C(0xC0)                           // xor eax,r8d
+    C(0xC3)                                           // retn
+    // 81 bytes
+    for(i = 0; i < i2f_count; i++) { C32REL(i2f_calls[i], i2f) }
+  }
+  //
+  // Set valid flag
+  //
+  state->dsp_dyna_valid = 1;
+}
+#endif
+
 /////////////////////////////////////////////////////////////////////////////
 
 typedef void (__fastcall *dsp_sample_t)(struct YAM_STATE *state);
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// Run the DSP for a block of samples, collecting EFREG after each one
+//
+static void render_effects_dsp(
+  struct YAM_STATE *state,
+  dsp_sample_t samplefunc,
+  const sint32 *fxbus,
+  sint16 *efout,
+  uint32 samples
+) {
+  uint32 i, j;
+  for(i = 0; i < samples; i++, efout += 16) {
+    //
+    // Clip and copy fxbus inputs (20-bit, pre-promote to 24-bit)
+    //
+    for(j = 0; j < 16; j++) {
+      sint32 t = fxbus[RENDERMAX * j + i];
+      if(t < (-0x80000)) t = (-0x80000);
+      if(t > ( 0x7FFFF)) t = ( 0x7FFFF);
+      state->inputs[0x20 + j] = t << 4;
+    }
+    //
+    // Execute one DSP sample
+    //
+    samplefunc(state);
+    // Advance MDEC_CT
+    state->mdec_ct--;
+    for(j = 0; j < 16; j++) { efout[j] = state->efreg[j]; }
+  }
+}
+
+#if defined(YAM_DYNAREC_CHECK) && defined(ENABLE_DYNAREC)
+//
+// DSP addresses wrap around the whole of sound RAM from RBP, which on the
+// AICA reaches well past 64K words, so all of it is compared
+//
+static void dsp_check_ram(struct YAM_STATE *state, uint8 *buf, int restore) {
+  uint8 *ram = (uint8*)(state->ram_ptr);
+  if(restore) { memcpy(ram, buf, state->ram_mask + 1); } else { memcpy(buf, ram, state->ram_mask + 1); }
+}
+
+//
+// Run the block through the dynarec, then again through the interpreter
+// from the same starting point, and complain about any difference
+//
+static void render_effects_check(
+  struct YAM_STATE *state,
+  dsp_sample_t samplefunc,
+  const sint32 *fxbus,
+  sint16 *efout,
+  uint32 samples
+) {
+  const struct { const char *name; uint32 ofs; uint32 size; } fields[] = {
+    { "TEMP",    STATEOFS(temp),                        sizeof(state->temp) },
+    { "MEMS",    STATEOFS(inputs),                      4 * 0x20 },
+    { "EXTS",    STATEOFS(inputs[0x30]),                4 * 0x10 },
+    { "EFREG",   STATEOFS(efreg),                       2 * 0x10 },
+    { "ADRS",    STATEOFS(adrs_reg),                    sizeof(state->adrs_reg) },
+    { "ACC",     STATEOFS(xzbchoice[XZBCHOICE_ACC]),    sizeof(sint32) },
+    { "FRC_REG", STATEOFS(yychoice[YYCHOICE_FRC_REG]),  sizeof(sint32) },
+    { "Y_REG",   STATEOFS(yychoice[YYCHOICE_Y_REG_H]),  2 * sizeof(sint32) },
+    { "MEMDATA", STATEOFS(mem_in_data),                 sizeof(state->mem_in_data) }
+  };
+  uint32 regs_start = STATEOFS(temp);
+  uint32 regs_size = STATEOFS(mem_in_data[4]) - regs_start;
+  uint8 *regs_before = (uint8*)malloc(regs_size);
+  uint8 *regs_dyna = (uint8*)malloc(regs_size);
+  int check_ram = (state->ram_ptr != NULL);
+  uint32 ram_size = check_ram ? (state->ram_mask + 1) : 0;
+  uint8 *ram_before = (uint8*)malloc(ram_size);
+  uint8 *ram_dyna = (uint8*)malloc(ram_size);
+  sint16 efout_dyna[16*RENDERMAX];
+  uint32 i;
+
+  memcpy(regs_before, ((uint8*)state) + regs_start, regs_size);
+  if(check_ram) { dsp_check_ram(state, ram_before, 0); }
+
+  render_effects_dsp(state, samplefunc, fxbus, efout_dyna, samples);
+
+  memcpy(regs_dyna, ((uint8*)state) + regs_start, regs_size);
+  memcpy(((uint8*)state) + regs_start, regs_before, regs_size);
+  if(check_ram) {
+    dsp_check_ram(state, ram_dyna, 0);
+    dsp_check_ram(state, ram_before, 1);
+  }
+
+  render_effects_dsp(state, dsp_sample_interpret, fxbus, efout, samples);
+
+  for(i = 0; i < (sizeof(fields) / sizeof(fields[0])); i++) {
+    if(memcmp(((uint8*)state) + fields[i].ofs, regs_dyna + (fields[i].ofs - regs_start), fields[i].size)) {
+      fprintf(stderr, "yam: dynarec mismatch in %s, odometer %u\n", fields[i].name, state->odometer);
+    }
+  }
+  for(i = 0; i < samples; i++) {
+    if(memcmp(efout + 16 * i, efout_dyna + 16 * i, 16 * sizeof(sint16))) {
+      fprintf(stderr, "yam: dynarec mismatch in EFREG output, sample %u of %u\n", i, samples);
+      break;
+    }
+  }
+  if(check_ram) {
+    dsp_check_ram(state, ram_before, 0);
+    if(memcmp(ram_before, ram_dyna, ram_size)) {
+      fprintf(stderr, "yam: dynarec mismatch in ringbuffer RAM, odometer %u\n", state->odometer);
+    }
+  }
+
+  free(regs_before);
+  free(regs_dyna);
+  free(ram_before);
+  free(ram_dyna);
+}
+#endif
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Render effects by emulating the DSP
@@ -2873,11 +3510,18 @@ static void render_effects(
   uint8 efatt_r[16];
   sint32 eflin_l[16];
   sint32 eflin_r[16];
+  sint16 efout[16*RENDERMAX];
 
 #ifdef ENABLE_DYNAREC
-  if(state->dsp_dyna_enabled) {
-    if(!(state->dsp_dyna_valid)) {
+  if(state->dsp_dyna_enabled && state->dynacode) {
+    //
+    // Copies of the state share the buffer, so the code in it is only this
+    // state's if the serial it was compiled under still matches
+    //
+    if(!(state->dsp_dyna_valid) || *((uint32*)(state->dynacode)) != state->dsp_dyna_serial) {
       dynacompile(state);
+      state->dsp_dyna_serial++;
+      *((uint32*)(state->dynacode)) = state->dsp_dyna_serial;
     }
     samplefunc = (dsp_sample_t)(((uint8*)(state->dynacode)) + DYNACODE_SLOP_SIZE);
   } else {
@@ -2899,29 +3543,23 @@ static void render_effects(
     );
   }
   //
+  // Run the DSP over the whole block
+  //
+#if defined(YAM_DYNAREC_CHECK) && defined(ENABLE_DYNAREC)
+  if(samplefunc != dsp_sample_interpret) {
+    render_effects_check(state, samplefunc, fxbus, efout, samples);
+  } else
+#endif
+  render_effects_dsp(state, samplefunc, fxbus, efout, samples);
+  //
   // For every sample:
   //
-  for(i = 0; i < samples; i++, fxbus += 16, out += 2) {
-    //
-    // Clip and copy fxbus inputs (20-bit, pre-promote to 24-bit)
-    //
-    for(j = 0; j < 16; j++) {
-      sint32 t = fxbus[j];
-      if(t < (-0x80000)) t = (-0x80000);
-      if(t > ( 0x7FFFF)) t = ( 0x7FFFF);
-      state->inputs[0x20 + j] = t << 4;
-    }
-    //
-    // Execute one DSP sample
-    //
-    samplefunc(state);
-    // Advance MDEC_CT
-    state->mdec_ct--;
+  for(i = 0; i < samples; i++, out += 2) {
     //
     // Copy outputs out of EFREG, scale accordingly, and add to output
     //
     for(j = 0; j < 16; j++) if(state->efsdl[j]) {
-      sint32 ef = (sint32)((sint16)(state->efreg[j]));
+      sint32 ef = (sint32)((sint16)(efout[16 * i + j]));
       ef <<= 4;
       out[0] += (ef*eflin_l[j]) >> efatt_l[j];
       out[1] += (ef*eflin_r[j]) >> efatt_r[j];
@@ -2988,7 +3626,9 @@ fclose(f);
   }
   if(buf) {
     memset(outbuf, 0, 4*2*samples);
-    if(wantreverb) memset(fxbus, 0, 4*16*samples);
+    if(wantreverb) {
+      for(i = 0; i < 16; i++) { memset(fxbus + RENDERMAX * i, 0, 4*samples); }
+    }
   }
   //
   // Figure out if any channels need to be rendered before others
@@ -3017,7 +3657,7 @@ fclose(f);
     state->bufptr = bufptr_base + j;
 // is 11
     render_and_add_channel(state, chan, directout,
-      wantreverb ? (fxbus + chan->dspchan) : NULL,
+      wantreverb ? (fxbus + RENDERMAX * chan->dspchan) : NULL,
       odometer, samples
     );
   }
@@ -3068,35 +3708,45 @@ void EMU_CALL yam_flush(void *state) {
 
 /////////////////////////////////////////////////////////////////////////////
 //
-// Prepare or unprepare dynacode buffer for execution
+// Map or unmap the dynacode buffer
+//
+// It lives in its own mapping rather than in the state, since hardened
+// runtimes only allow executable pages that were mapped for JIT up front.
+// The state only holds a pointer to it, so any copy of the state shares it.
 //
 void EMU_CALL yam_prepare_dynacode(void *state) {
 #ifdef ENABLE_DYNAREC
+  void *p;
+  if(YAMSTATE->dynacode) return;
 #ifdef _WIN32
-  DWORD i;
-  VirtualProtect( &YAMSTATE->dynacode, sizeof(YAMSTATE->dynacode), PAGE_EXECUTE_READWRITE, &i );
+  p = VirtualAlloc(NULL, DYNACODE_MAX_SIZE, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
 #elif defined(HAVE_MPROTECT)
-  unsigned long startaddr = &YAMSTATE->dynacode;
-  unsigned long length    = sizeof(YAMSTATE->dynacode);
-  int           psize     = getpagesize();
-  unsigned long addr      = ( startaddr & ~(psize - 1) );
-  mprotect( (char *) addr, length + startaddr - addr + psize, PROT_READ | PROT_WRITE | PROT_EXEC );
+  {
+    int flags = MAP_PRIVATE | MAP_ANON;
+#ifdef MAP_JIT
+    flags |= MAP_JIT;
 #endif
+    p = mmap(NULL, DYNACODE_MAX_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC, flags, -1, 0);
+    if(p == MAP_FAILED) { p = NULL; }
+  }
+#else
+  p = NULL;
+#endif
+  YAMSTATE->dynacode = (uint8*)p;
+  YAMSTATE->dsp_dyna_valid = 0;
 #endif
 }
 
 void EMU_CALL yam_unprepare_dynacode(void *state) {
 #ifdef ENABLE_DYNAREC
+  if(!YAMSTATE->dynacode) return;
 #ifdef _WIN32
-  DWORD i;
-  VirtualProtect( &YAMSTATE->dynacode, sizeof(YAMSTATE->dynacode), PAGE_READWRITE, &i );
+  VirtualFree(YAMSTATE->dynacode, 0, MEM_RELEASE);
 #elif defined(HAVE_MPROTECT)
-  unsigned long startaddr = &YAMSTATE->dynacode;
-  unsigned long length    = sizeof(YAMSTATE->dynacode);
-  int           psize     = getpagesize();
-  unsigned long addr      = ( startaddr & ~(psize - 1) );
-  mprotect( (char *) addr, length + startaddr - addr + psize, PROT_READ | PROT_WRITE );
+  munmap(YAMSTATE->dynacode, DYNACODE_MAX_SIZE);
 #endif
+  YAMSTATE->dynacode = NULL;
+  YAMSTATE->dsp_dyna_valid = 0;
 #endif
 }
 
@@ -0,0 +1,92 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// yambench - Times the SCSP/AICA DSP, interpreter against dynarec
+//
+// Not part of any target.  Build it on its own, from this directory:
+//
+//   cc -O2 -DEMU_COMPILE -DEMU_LITTLE_ENDIAN -DHAVE_STDINT_H -DHAVE_MPROTECT yambench.c -lm -o yambench
+//
+// Add -DYAM_DYNAREC_CHECK to have every block cross-checked against the
+// interpreter instead, in which case the timings mean nothing.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#include "yam.c"
+
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_SECONDS (60)
+
+static uint64 bench_rand(uint64 *seed) {
+  *seed = (*seed) * 6364136223846793005ULL + 1442695040888963407ULL;
+  return *seed;
+}
+
+//
+// A reverb-style program: all 128 steps MAC, and the odd ones read or write
+// the ringbuffer, which is as heavy as DSP programs get
+//
+static void bench_program(struct YAM_STATE *state, uint8 version) {
+  uint64 seed = 12345;
+  int i;
+  for(i = 0; i < 128; i++) {
+    uint64 v = bench_rand(&seed);
+    v &= ~(((uint64)0xC0) << 23);
+    if(i & 1) { v |= ((uint64)(((v >> 40) & 1) ? 0x40 : 0x80)) << 23; }
+    if(version == 1) {
+      mpro_scsp_write(state->mpro + i, v | 1);
+    } else {
+      mpro_aica_write(state->mpro + i, v | 1);
+    }
+    state->coef[i] = ((sint16)(bench_rand(&seed) >> 20)) >> 3;
+  }
+  for(i = 0; i < 64; i++) { state->madrs[i] = i * 97; }
+  for(i = 0; i < 16; i++) { state->efsdl[i] = 15; }
+  state->rbl = 3;
+  state->dsp_dyna_valid = 0;
+}
+
+static double bench_run(uint8 version, uint8 dynarec) {
+  struct YAM_STATE *state = malloc(sizeof(struct YAM_STATE));
+  uint32 ramsize = (version == 1) ? 0x80000 : 0x800000;
+  uint8 *ram = calloc(1, ramsize);
+  static sint32 fxbus[16 * RENDERMAX];
+  static sint32 out[2 * RENDERMAX];
+  clock_t t1, t2;
+  uint32 n;
+  int i;
+
+  yam_clear_state(state, version);
+  yam_setram(state, (uint32*)ram, ramsize, (version == 1) ? 1 : 3, (version == 1) ? 0 : 2);
+  yam_enable_dsp_dynarec(state, dynarec);
+  if(dynarec && !state->dsp_dyna_enabled) {
+    fprintf(stderr, "no dynarec in this build\n");
+    exit(1);
+  }
+  bench_program(state, version);
+  for(i = 0; i < 16 * RENDERMAX; i++) { fxbus[i] = (i * 7919) % 0x40000 - 0x20000; }
+
+  t1 = clock();
+  for(n = 0; n < 44100 * BENCH_SECONDS; n += RENDERMAX) {
+    memset(out, 0, sizeof(out));
+    render_effects(state, fxbus, out, RENDERMAX);
+  }
+  t2 = clock();
+
+  yam_enable_dsp_dynarec(state, 0);
+  free(ram);
+  free(state);
+  return (double)(t2 - t1) / CLOCKS_PER_SEC;
+}
+
+int main(void) {
+  uint8 version;
+  for(version = 1; version <= 2; version++) {
+    double interp = bench_run(version, 0);
+    double dyna = bench_run(version, 1);
+    printf("%s, %d s of audio: interpreter %.3f s, dynarec %.3f s (%.2fx)\n",
+      (version == 1) ? "SCSP" : "AICA", BENCH_SECONDS, interp, dyna, interp / dyna);
+  }
+  return 0;
+}
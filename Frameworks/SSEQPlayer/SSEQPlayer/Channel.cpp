@@ -14,6 +14,13 @@
 #define _USE_MATH_DEFINES
 #include <cmath>
 #include <limits>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SINC_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define SINC_NEON
+#endif
 #include "Channel.h"
 #include "Player.h"
 #include "common.h"
@@ -88,7 +95,7 @@ static inline double sinc(double x)
 
 Channel::Channel() : chnId(-1), tempReg(), state(CS_NONE), trackId(-1), prio(0), manualSweep(false), flags(), pan(0), extAmpl(0), velocity(0), extPan(0),
 	key(0), ampl(0), extTune(0), orgKey(0), modType(0), modSpeed(0), modDepth(0), modRange(0), modDelay(0), modDelayCnt(0), modCounter(0),
-	sweepLen(0), sweepCnt(0), sweepPitch(0), attackLvl(0), sustainLvl(0x7F), decayRate(0), releaseRate(0xFFFF), noteLength(-1), vol(0), ply(nullptr), reg()
+	sweepLen(0), sweepCnt(0), sweepPitch(0), attackLvl(0), sustainLvl(0x7F), decayRate(0), releaseRate(0xFFFF), noteLength(-1), vol(0), ply(nullptr), reg(), sincKernels(nullptr)
 {
 	this->clearHistory();
 	if (!this->initializedLUTs)
@@ -581,6 +588,7 @@ void Channel::Update()
 			tmr = Timer_Adjust(tmr, totalAdj);
 		this->reg.timer = -tmr;
 		this->reg.sampleIncrease = (ARM7_CLOCK / static_cast<double>(this->ply->sampleRate * 2)) / (0x10000 - this->reg.timer);
+		this->sincKernels = nullptr;
 		this->flags.reset(CF_UPDTMR);
 	}
 
@@ -643,6 +651,58 @@ static const int16_t wavedutytbl[8][8] =
 	{ -0x7FFF, -0x7FFF, -0x7FFF, -0x7FFF, -0x7FFF, -0x7FFF, -0x7FFF, -0x7FFF }
 };
 
+// Dot product of 16 history samples with one of the precomputed kernels
+static inline float sincDot(const int16_t *data, const float *kernel)
+{
+#if defined(SINC_SSE2)
+	__m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+	__m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 8));
+	__m128 sum = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 16)), _mm_loadu_ps(kernel));
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 16)), _mm_loadu_ps(kernel + 4)));
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 16)), _mm_loadu_ps(kernel + 8)));
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 16)), _mm_loadu_ps(kernel + 12)));
+	sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+	sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+	return _mm_cvtss_f32(sum);
+#elif defined(SINC_NEON)
+	int16x8_t lo = vld1q_s16(data);
+	int16x8_t hi = vld1q_s16(data + 8);
+	float32x4_t sum = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(lo))), vld1q_f32(kernel));
+	sum = vmlaq_f32(sum, vcvtq_f32_s32(vmovl_s16(vget_high_s16(lo))), vld1q_f32(kernel + 4));
+	sum = vmlaq_f32(sum, vcvtq_f32_s32(vmovl_s16(vget_low_s16(hi))), vld1q_f32(kernel + 8));
+	sum = vmlaq_f32(sum, vcvtq_f32_s32(vmovl_s16(vget_high_s16(hi))), vld1q_f32(kernel + 12));
+	float32x2_t half = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+	return vget_lane_f32(vpadd_f32(half, half), 0);
+#else
+	float sum = 0.0f;
+	for (unsigned i = 0; i < Channel::SINC_WIDTH * 2; ++i)
+		sum += data[i] * kernel[i];
+	return sum;
+#endif
+}
+
+// Fills kernels with SINC_PHASES sets of SINC_WIDTH * 2 taps, built the same
+// way Interpolate() does for INTERPOLATION_SINC, for the middle of each phase
+void Channel::BuildSincKernels(float *kernels, double sampleIncrease)
+{
+	int step = sampleIncrease > 1.0 ? static_cast<int>(SINC_RESOLUTION / sampleIncrease) : SINC_RESOLUTION;
+	const int window_step = SINC_RESOLUTION;
+	for (unsigned phase = 0; phase < SINC_PHASES; ++phase, kernels += SINC_WIDTH * 2)
+	{
+		double kernel[SINC_WIDTH * 2], kernel_sum = 0.0;
+		int shift = (2 * phase + 1) * SINC_RESOLUTION / (2 * SINC_PHASES);
+		int shift_adj = shift * step / SINC_RESOLUTION;
+		for (int i = SINC_WIDTH; i >= -static_cast<int>(SINC_WIDTH - 1); --i)
+		{
+			int pos = i * step;
+			int window_pos = i * window_step;
+			kernel_sum += kernel[i + SINC_WIDTH - 1] = sinc_lut[::abs(shift_adj - pos)] * window_lut[::abs(shift - window_pos)];
+		}
+		for (unsigned i = 0; i < SINC_WIDTH * 2; ++i)
+			kernels[i] = static_cast<float>(kernel[i] / kernel_sum);
+	}
+}
+
 // Linear interpolation code originally from DeSmuME
 // Legrange comes from Olli Niemitalo:
 // http://www.student.oulu.fi/~oniemita/dsp/deip.pdf
@@ -653,7 +713,14 @@ int32_t Channel::Interpolate()
 
 	const auto &data = &this->sampleHistory[this->sampleHistoryPtr + 16];
 
-	if (this->ply->interpolation == INTERPOLATION_SINC)
+	if (this->ply->interpolation == INTERPOLATION_FASTSINC)
+	{
+		if (!this->sincKernels)
+			this->sincKernels = this->ply->GetSincKernels(this->reg.sampleIncrease);
+		const float *kernel = this->sincKernels + static_cast<int>(ratio * SINC_PHASES) * SINC_WIDTH * 2;
+		return static_cast<int32_t>(sincDot(&data[1 - static_cast<int>(SINC_WIDTH)], kernel));
+	}
+	else if (this->ply->interpolation == INTERPOLATION_SINC)
 	{
 		double kernel[SINC_WIDTH * 2], kernel_sum = 0.0;
 		int i = SINC_WIDTH, shift = static_cast<int>(std::floor(ratio * SINC_RESOLUTION));
@@ -784,6 +851,22 @@ void Channel::IncrementSample()
 	}
 }
 
+// Generates up to samples samples into out, stopping early if the channel
+// gets killed. As the registers are cleared by then, the sample during which
+// that happens is silent, and isn't counted in the returned length.
+unsigned Channel::GenerateBlock(int32_t *out, unsigned samples)
+{
+	for (unsigned i = 0; i < samples; ++i)
+	{
+		int32_t sample = this->GenerateSample();
+		this->IncrementSample();
+		if (this->state == CS_NONE)
+			return i;
+		out[i] = sample;
+	}
+	return samples;
+}
+
 void Channel::clearHistory()
 {
 	this->sampleHistoryPtr = 0;
@@ -147,6 +147,15 @@ struct Channel
 	static double sinc_lut[SINC_SAMPLES + 1];
 	static double window_lut[SINC_SAMPLES + 1];
 
+	/*
+	 * For INTERPOLATION_FASTSINC, the normalized kernels are computed
+	 * ahead of time for SINC_PHASES fractional positions, per resampling
+	 * ratio. The Player keeps them, this points to the set matching the
+	 * current timer, or is null if it has yet to be looked up.
+	 */
+	static const unsigned SINC_PHASES = 512;
+	const float *sincKernels;
+
 	Channel();
 
 	void UpdateVol(const Track &trk);
@@ -161,5 +170,8 @@ struct Channel
 	int32_t Interpolate();
 	int32_t GenerateSample();
 	void IncrementSample();
+	unsigned GenerateBlock(int32_t *out, unsigned samples);
 	void clearHistory();
+
+	static void BuildSincKernels(float *kernels, double sampleIncrease);
 };
@@ -8,6 +8,7 @@
  * https://github.com/fincs/FSS
  */
 
+#include <cmath>
 #include "Player.h"
 #include "common.h"
 
@@ -176,20 +177,49 @@ void Player::Timer()
 	this->Run();
 }
 
-static inline int32_t muldiv7(int32_t val, uint8_t mul)
+// Downsampling ratios are split into bands of 1/32 octave, the kernels of a
+// band being built for its middle. Upsampling needs no low-pass adjustment,
+// so those all share the first set.
+const float *Player::GetSincKernels(double sampleIncrease) const
 {
-	return mul == 127 ? val : ((val * mul) >> 7);
+	static const int BANDS_PER_OCTAVE = 32;
+	size_t band = 0;
+	if (sampleIncrease > 1.0)
+		band = static_cast<size_t>(std::log2(sampleIncrease) * BANDS_PER_OCTAVE) + 1;
+	if (band >= this->sincKernels.size())
+		this->sincKernels.resize(band + 1);
+	auto &kernels = this->sincKernels[band];
+	if (kernels.empty())
+	{
+		kernels.resize(Channel::SINC_PHASES * Channel::SINC_WIDTH * 2);
+		Channel::BuildSincKernels(&kernels[0], band ? std::exp2((band - 0.5) / BANDS_PER_OCTAVE) : 1.0);
+	}
+	return &kernels[0];
 }
 
-void Player::GenerateSamples(std::vector<uint8_t> &buf, unsigned offset, unsigned samples)
+// Output is rendered in blocks ending at the next clock cycle, as nothing
+// affecting the channel parameters happens between those. Each channel is
+// run over the whole block before mixing, keeping the mix loop simple enough
+// to be vectorized. The results are identical to the old per-sample loop.
+void Player::GenerateSamples(int16_t *buf, unsigned samples)
 {
+	static const unsigned BLOCK_SIZE = 1024;
+	int32_t chnBuf[BLOCK_SIZE], leftBuf[BLOCK_SIZE], rightBuf[BLOCK_SIZE];
 	unsigned long mute = this->mutes.to_ulong();
 
-	for (unsigned smpl = 0; smpl < samples; ++smpl)
+	while (samples)
 	{
-		this->secondsIntoPlayback += this->secondsPerSample;
+		unsigned count = 0;
+		bool clock = false;
+		do
+		{
+			++count;
+			this->secondsIntoPlayback += this->secondsPerSample;
+			clock = this->secondsIntoPlayback > this->secondsUntilNextClock;
+		} while (!clock && count < samples && count < BLOCK_SIZE);
 
-		int32_t leftChannel = 0, rightChannel = 0;
+		memset(leftBuf, 0, count * sizeof(int32_t));
+		memset(rightBuf, 0, count * sizeof(int32_t));
 
 		// I need to advance the sound channels here
 		for (int i = 0; i < 16; ++i)
@@ -198,35 +228,42 @@ void Player::GenerateSamples(std::vector<uint8_t> &buf, unsigned offset, unsigne
 
 			if (chn.state > CS_NONE)
 			{
-				int32_t sample = chn.GenerateSample();
-				chn.IncrementSample();
+				// The register is cleared if the channel is killed, so it is
+				// read first. A factor of 128 stands in for muldiv7's 127.
+				int32_t volumeMul = chn.reg.volumeMul == 127 ? 128 : chn.reg.volumeMul;
+				int datashift = chn.reg.volumeDiv == 3 ? 4 : chn.reg.volumeDiv;
+				int32_t leftMul = chn.reg.panning == 0 ? 128 : 127 - chn.reg.panning;
+				int32_t rightMul = chn.reg.panning == 127 ? 128 : chn.reg.panning;
+
+				unsigned length = chn.GenerateBlock(chnBuf, count);
 
 				if (mute & BIT(i))
 					continue;
 
-				uint8_t datashift = chn.reg.volumeDiv;
-				if (datashift == 3)
-					datashift = 4;
-				sample = muldiv7(sample, chn.reg.volumeMul) >> datashift;
-
-				leftChannel += muldiv7(sample, 127 - chn.reg.panning);
-				rightChannel += muldiv7(sample, chn.reg.panning);
+				for (unsigned j = 0; j < length; ++j)
+				{
+					int32_t sample = ((chnBuf[j] * volumeMul) >> 7) >> datashift;
+					leftBuf[j] += (sample * leftMul) >> 7;
+					rightBuf[j] += (sample * rightMul) >> 7;
+				}
 			}
 		}
 
-		clamp(leftChannel, -0x8000, 0x7FFF);
-		clamp(rightChannel, -0x8000, 0x7FFF);
+		for (unsigned j = 0; j < count; ++j)
+		{
+			int32_t leftChannel = leftBuf[j], rightChannel = rightBuf[j];
+			clamp(leftChannel, -0x8000, 0x7FFF);
+			clamp(rightChannel, -0x8000, 0x7FFF);
+			*buf++ = static_cast<int16_t>(leftChannel);
+			*buf++ = static_cast<int16_t>(rightChannel);
+		}
 
-		buf[offset++] = leftChannel & 0xFF;
-		buf[offset++] = (leftChannel >> 8) & 0xFF;
-		buf[offset++] = rightChannel & 0xFF;
-		buf[offset++] = (rightChannel >> 8) & 0xFF;
+		samples -= count;
 
-		if (this->secondsIntoPlayback > this->secondsUntilNextClock)
+		if (clock)
 		{
 			this->Timer();
 			this->secondsUntilNextClock += SecondsPerClockCycle;
 		}
 	}
 }
-
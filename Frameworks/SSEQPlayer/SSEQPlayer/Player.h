@@ -11,6 +11,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include <bitset>
 #include <SSEQPlayer/SSEQ.h>
 #include <SSEQPlayer/Track.h>
@@ -48,5 +49,9 @@ struct Player
 	/* Playback helper */
 	double secondsPerSample, secondsIntoPlayback, secondsUntilNextClock;
 	std::bitset<16> mutes;
-	void GenerateSamples(std::vector<uint8_t> &buf, unsigned offset, unsigned samples);
+	void GenerateSamples(int16_t *buf, unsigned samples);
+
+	/* Kernels for INTERPOLATION_FASTSINC, built on first use per ratio band */
+	mutable std::vector<std::vector<float>> sincKernels;
+	const float *GetSincKernels(double sampleIncrease) const;
 };
@@ -56,5 +56,6 @@ enum Interpolation
 	INTERPOLATION_LINEAR,
 	INTERPOLATION_4POINTLEGRANGE,
 	INTERPOLATION_6POINTLEGRANGE,
-	INTERPOLATION_SINC
+	INTERPOLATION_SINC,
+	INTERPOLATION_FASTSINC // Same kernel as above, precomputed at fixed phases
 };
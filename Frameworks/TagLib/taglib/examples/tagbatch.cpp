@@ -0,0 +1,142 @@
+/* Copyright (C) 2026 Cog contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include <batchreader.h>
+#include <tpropertymap.h>
+
+using namespace std;
+
+void usage()
+{
+  cout << endl;
+  cout << "Usage: tagbatch [options] [files]" << endl;
+  cout << endl;
+  cout << "Reads the tags and audio properties of every file named, or of every" << endl;
+  cout << "path read from standard input if there are none, and reports how many" << endl;
+  cout << "files were read per second." << endl;
+  cout << endl;
+  cout << "  -j <workers>     number of threads" << endl;
+  cout << "  -d <depth>       number of files read at once" << endl;
+  cout << "  -c <file>        cache results in <file>" << endl;
+  cout << "  -n               read the tags only" << endl;
+  cout << "  -q               print the summary only" << endl;
+  cout << endl;
+
+  exit(1);
+}
+
+double now()
+{
+  timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned int workers = 0;
+  unsigned int ioDepth = 0;
+  string cacheFile;
+  bool readAudioProperties = true;
+  bool quiet = false;
+
+  vector<string> paths;
+
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+      workers = atoi(argv[++i]);
+    else if(strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+      ioDepth = atoi(argv[++i]);
+    else if(strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+      cacheFile = argv[++i];
+    else if(strcmp(argv[i], "-n") == 0)
+      readAudioProperties = false;
+    else if(strcmp(argv[i], "-q") == 0)
+      quiet = true;
+    else if(argv[i][0] == '-')
+      usage();
+    else
+      paths.push_back(argv[i]);
+  }
+
+  if(paths.empty()) {
+    string line;
+    while(getline(cin, line)) {
+      if(!line.empty())
+        paths.push_back(line);
+    }
+  }
+
+  TagLib::BatchReader reader(workers, ioDepth);
+
+  if(!cacheFile.empty() && !reader.setCacheFile(cacheFile))
+    cerr << "Could not read the cache " << cacheFile << ", starting over" << endl;
+
+  const double start = now();
+  const vector<TagLib::BatchReader::Result> results = reader.read(paths, readAudioProperties);
+  const double elapsed = now() - start;
+
+  unsigned int valid = 0;
+  unsigned int cached = 0;
+
+  for(vector<TagLib::BatchReader::Result>::const_iterator it = results.begin(); it != results.end(); ++it) {
+    if(it->valid)
+      valid++;
+    if(it->cached)
+      cached++;
+
+    if(quiet)
+      continue;
+
+    cout << it->path;
+    if(!it->valid) {
+      cout << "\t(unreadable)" << endl;
+      continue;
+    }
+    if(readAudioProperties)
+      cout << "\t" << it->lengthInMilliseconds << " ms, " << it->sampleRate << " Hz, "
+           << it->channels << " ch, " << it->bitrate << " kb/s";
+    cout << endl;
+
+    for(TagLib::PropertyMap::ConstIterator p = it->properties.begin(); p != it->properties.end(); ++p) {
+      for(TagLib::StringList::ConstIterator v = p->second.begin(); v != p->second.end(); ++v)
+        cout << "  " << p->first << "=" << *v << endl;
+    }
+  }
+
+  if(!cacheFile.empty() && !reader.saveCache())
+    cerr << "Could not write the cache " << cacheFile << endl;
+
+  cerr << results.size() << " files (" << valid << " readable, " << cached << " cached) in "
+       << elapsed << " s, " << (elapsed > 0 ? results.size() / elapsed : 0.0) << " files/s" << endl;
+
+  return 0;
+}
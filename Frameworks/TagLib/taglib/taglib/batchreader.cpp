@@ -0,0 +1,567 @@
+/***************************************************************************
+    copyright            : (C) 2026 by Cog contributors
+ ***************************************************************************/
+
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU Lesser General Public License version   *
+ *   2.1 as published by the Free Software Foundation.                     *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful, but   *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA         *
+ *   02110-1301  USA                                                       *
+ *                                                                         *
+ *   Alternatively, this file is available under the Mozilla Public        *
+ *   License Version 1.1.  You may obtain a copy of the License at         *
+ *   http://www.mozilla.org/MPL/                                           *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+
+#ifndef _WIN32
+# include <pthread.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+#include <tboundedfilestream.h>
+#include <tbytevector.h>
+#include <tdebug.h>
+#include <tfilestream.h>
+#include <tstring.h>
+
+#include "batchreader.h"
+#include "fileref.h"
+
+using namespace TagLib;
+
+namespace
+{
+  // "TLBC", then a version, then one entry per file.  Everything is stored
+  // big endian, strings as a length and their UTF-8 bytes, and the path of
+  // each file as a length and its bytes as they are.
+
+  const char cacheMagic[] = "TLBC";
+  const unsigned int cacheVersion = 2;
+
+  enum CacheFlags {
+    ValidFlag           = 0x01,
+    AudioPropertiesFlag = 0x02
+  };
+
+  struct CacheKey
+  {
+    unsigned long long device;
+    unsigned long long inode;
+
+    bool operator<(const CacheKey &other) const
+    {
+      if(device != other.device)
+        return device < other.device;
+      return inode < other.inode;
+    }
+  };
+
+  struct CacheEntry
+  {
+    CacheEntry() :
+      size(0),
+      mtime(0),
+      mtimeNanoseconds(0),
+      flags(0) {}
+
+    unsigned long long size;
+    long long mtime;
+    unsigned int mtimeNanoseconds;
+    unsigned char flags;
+    BatchReader::Result result;
+  };
+
+  typedef std::map<CacheKey, CacheEntry> CacheMap;
+
+  void appendString(ByteVector &data, const String &s)
+  {
+    const ByteVector utf8 = s.data(String::UTF8);
+    data.append(ByteVector::fromUInt(utf8.size()));
+    data.append(utf8);
+  }
+
+  // Reads from data at offset, advancing it.  All of these return false
+  // instead if the data runs out.
+
+  bool readUInt(const ByteVector &data, unsigned int &offset, unsigned int &value)
+  {
+    if(data.size() - offset < 4)
+      return false;
+    value = data.toUInt(offset);
+    offset += 4;
+    return true;
+  }
+
+  bool readLongLong(const ByteVector &data, unsigned int &offset, unsigned long long &value)
+  {
+    if(data.size() - offset < 8)
+      return false;
+    value = static_cast<unsigned long long>(data.toLongLong(offset));
+    offset += 8;
+    return true;
+  }
+
+  bool readString(const ByteVector &data, unsigned int &offset, String &s)
+  {
+    unsigned int length;
+    if(!readUInt(data, offset, length) || data.size() - offset < length)
+      return false;
+    s = String(data.mid(offset, length), String::UTF8);
+    offset += length;
+    return true;
+  }
+
+  bool readPath(const ByteVector &data, unsigned int &offset, std::string &path)
+  {
+    unsigned int length;
+    if(!readUInt(data, offset, length) || data.size() - offset < length)
+      return false;
+    path.assign(data.data() + offset, length);
+    offset += length;
+    return true;
+  }
+
+  bool readEntry(const ByteVector &data, unsigned int &offset, CacheKey &key, CacheEntry &entry)
+  {
+    unsigned long long mtime;
+    if(!readPath(data, offset, entry.result.path) ||
+       !readLongLong(data, offset, key.device) ||
+       !readLongLong(data, offset, key.inode) ||
+       !readLongLong(data, offset, entry.size) ||
+       !readLongLong(data, offset, mtime) ||
+       !readUInt(data, offset, entry.mtimeNanoseconds) ||
+       data.size() - offset < 1)
+      return false;
+
+    entry.mtime = static_cast<long long>(mtime);
+    entry.flags = static_cast<unsigned char>(data[offset++]);
+    entry.result.valid = (entry.flags & ValidFlag) != 0;
+
+    unsigned int audio[4];
+    for(int i = 0; i < 4; ++i) {
+      if(!readUInt(data, offset, audio[i]))
+        return false;
+    }
+    entry.result.lengthInMilliseconds = static_cast<int>(audio[0]);
+    entry.result.bitrate              = static_cast<int>(audio[1]);
+    entry.result.sampleRate           = static_cast<int>(audio[2]);
+    entry.result.channels             = static_cast<int>(audio[3]);
+
+    unsigned int keyCount;
+    if(!readUInt(data, offset, keyCount))
+      return false;
+
+    for(unsigned int i = 0; i < keyCount; ++i) {
+      String name;
+      unsigned int valueCount;
+      if(!readString(data, offset, name) || !readUInt(data, offset, valueCount))
+        return false;
+
+      StringList values;
+      for(unsigned int j = 0; j < valueCount; ++j) {
+        String value;
+        if(!readString(data, offset, value))
+          return false;
+        values.append(value);
+      }
+      entry.result.properties.insert(name, values);
+    }
+
+    return true;
+  }
+
+  void appendEntry(ByteVector &data, const CacheKey &key, const CacheEntry &entry)
+  {
+    const std::string &path = entry.result.path;
+    data.append(ByteVector::fromUInt(static_cast<unsigned int>(path.size())));
+    data.append(ByteVector(path.data(), static_cast<unsigned int>(path.size())));
+    data.append(ByteVector::fromLongLong(static_cast<long long>(key.device)));
+    data.append(ByteVector::fromLongLong(static_cast<long long>(key.inode)));
+    data.append(ByteVector::fromLongLong(static_cast<long long>(entry.size)));
+    data.append(ByteVector::fromLongLong(entry.mtime));
+    data.append(ByteVector::fromUInt(entry.mtimeNanoseconds));
+    data.append(static_cast<char>(entry.flags));
+    data.append(ByteVector::fromUInt(entry.result.lengthInMilliseconds));
+    data.append(ByteVector::fromUInt(entry.result.bitrate));
+    data.append(ByteVector::fromUInt(entry.result.sampleRate));
+    data.append(ByteVector::fromUInt(entry.result.channels));
+
+    const PropertyMap &properties = entry.result.properties;
+    data.append(ByteVector::fromUInt(properties.size()));
+    for(PropertyMap::ConstIterator it = properties.begin(); it != properties.end(); ++it) {
+      appendString(data, it->first);
+      data.append(ByteVector::fromUInt(it->second.size()));
+      for(StringList::ConstIterator value = it->second.begin(); value != it->second.end(); ++value)
+        appendString(data, *value);
+    }
+  }
+
+  // Copies out everything read from one file.
+
+  void copyResult(BatchReader::Result &result, const FileRef &f)
+  {
+    if(f.isNull())
+      return;
+
+    result.valid = true;
+    result.properties = f.file()->properties();
+
+    const AudioProperties *audioProperties = f.audioProperties();
+    if(audioProperties) {
+      result.lengthInMilliseconds = audioProperties->lengthInMilliseconds();
+      result.bitrate              = audioProperties->bitrate();
+      result.sampleRate           = audioProperties->sampleRate();
+      result.channels             = audioProperties->channels();
+    }
+  }
+
+  // Opens one file.  Nothing is ever written, so the file is opened read
+  // only.  Without audio properties only the tags are needed, so the reads
+  // are kept to where they are stored.
+
+  void readFile(BatchReader::Result &result, bool readAudioProperties)
+  {
+    if(readAudioProperties) {
+      FileStream stream(result.path.c_str(), true);
+      copyResult(result, FileRef(&stream, true));
+    }
+    else {
+      BoundedFileStream stream(result.path.c_str());
+      copyResult(result, FileRef(&stream, false));
+    }
+  }
+
+#ifndef _WIN32
+
+  unsigned int processorCount()
+  {
+    const long count = ::sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? static_cast<unsigned int>(count) : 1;
+  }
+
+  // Identifies the file at path, or returns false if it can't be stat'ed.
+
+  bool statFile(const std::string &path, CacheKey &key, CacheEntry &entry)
+  {
+    struct stat st;
+    if(::stat(path.c_str(), &st) != 0)
+      return false;
+
+    key.device = static_cast<unsigned long long>(st.st_dev);
+    key.inode  = static_cast<unsigned long long>(st.st_ino);
+    entry.size  = static_cast<unsigned long long>(st.st_size);
+    entry.mtime = static_cast<long long>(st.st_mtime);
+# if defined(__APPLE__)
+    entry.mtimeNanoseconds = static_cast<unsigned int>(st.st_mtimespec.tv_nsec);
+# else
+    entry.mtimeNanoseconds = static_cast<unsigned int>(st.st_mtim.tv_nsec);
+# endif
+    return true;
+  }
+
+#endif
+}
+
+class BatchReader::BatchReaderPrivate
+{
+public:
+  BatchReaderPrivate(unsigned int workers, unsigned int ioDepth) :
+    workers(workers),
+    ioDepth(ioDepth),
+    paths(0),
+    results(0),
+    readAudioProperties(true),
+    next(0),
+    ioAvailable(0)
+  {
+#ifndef _WIN32
+    pthread_mutex_init(&cacheMutex, 0);
+    pthread_mutex_init(&queueMutex, 0);
+    pthread_mutex_init(&ioMutex, 0);
+    pthread_cond_init(&ioCondition, 0);
+#endif
+  }
+
+  ~BatchReaderPrivate()
+  {
+#ifndef _WIN32
+    pthread_cond_destroy(&ioCondition);
+    pthread_mutex_destroy(&ioMutex);
+    pthread_mutex_destroy(&queueMutex);
+    pthread_mutex_destroy(&cacheMutex);
+#endif
+  }
+
+  void run();
+#ifndef _WIN32
+  static void *runWorker(void *d);
+#endif
+
+  unsigned int workers;
+  unsigned int ioDepth;
+
+  std::string cacheFileName;
+  CacheMap cache;
+
+  // The batch being read
+
+  const std::vector<std::string> *paths;
+  std::vector<Result> *results;
+  bool readAudioProperties;
+  size_t next;
+  unsigned int ioAvailable;
+
+#ifndef _WIN32
+  pthread_mutex_t cacheMutex;
+  pthread_mutex_t queueMutex;
+  pthread_mutex_t ioMutex;
+  pthread_cond_t ioCondition;
+#endif
+};
+
+#ifndef _WIN32
+
+void *BatchReader::BatchReaderPrivate::runWorker(void *d)
+{
+  static_cast<BatchReaderPrivate *>(d)->run();
+  return 0;
+}
+
+void BatchReader::BatchReaderPrivate::run()
+{
+  for(;;) {
+    pthread_mutex_lock(&queueMutex);
+    const size_t index = next++;
+    pthread_mutex_unlock(&queueMutex);
+
+    if(index >= paths->size())
+      return;
+
+    Result &result = (*results)[index];
+    result.path = (*paths)[index];
+
+    CacheKey key;
+    CacheEntry entry;
+    const bool known = statFile(result.path, key, entry);
+
+    if(known && !cacheFileName.empty()) {
+      pthread_mutex_lock(&cacheMutex);
+      CacheMap::iterator it = cache.find(key);
+      const bool hit = it != cache.end() &&
+        it->second.size == entry.size &&
+        it->second.mtime == entry.mtime &&
+        it->second.mtimeNanoseconds == entry.mtimeNanoseconds &&
+        (!readAudioProperties || (it->second.flags & AudioPropertiesFlag));
+      if(hit) {
+        // A file that was moved is found under its new path from now on
+        if(it->second.result.path != result.path)
+          it->second.result.path = result.path;
+        result = it->second.result;
+        result.cached = true;
+      }
+      pthread_mutex_unlock(&cacheMutex);
+
+      if(hit)
+        continue;
+    }
+
+    pthread_mutex_lock(&ioMutex);
+    while(ioAvailable == 0)
+      pthread_cond_wait(&ioCondition, &ioMutex);
+    --ioAvailable;
+    pthread_mutex_unlock(&ioMutex);
+
+    readFile(result, readAudioProperties);
+
+    pthread_mutex_lock(&ioMutex);
+    ++ioAvailable;
+    pthread_cond_signal(&ioCondition);
+    pthread_mutex_unlock(&ioMutex);
+
+    if(known && !cacheFileName.empty()) {
+      entry.flags = (result.valid ? ValidFlag : 0) |
+                    (readAudioProperties ? AudioPropertiesFlag : 0);
+      entry.result = result;
+
+      pthread_mutex_lock(&cacheMutex);
+      cache[key] = entry;
+      pthread_mutex_unlock(&cacheMutex);
+    }
+  }
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// public members
+////////////////////////////////////////////////////////////////////////////////
+
+BatchReader::BatchReader(unsigned int workers, unsigned int ioDepth) :
+  d(0)
+{
+#ifndef _WIN32
+  if(workers == 0)
+    workers = std::max(processorCount() * 2, 4U);
+#endif
+  if(workers == 0)
+    workers = 1;
+  if(ioDepth == 0 || ioDepth > workers)
+    ioDepth = workers;
+
+  d = new BatchReaderPrivate(workers, ioDepth);
+}
+
+BatchReader::~BatchReader()
+{
+  delete d;
+}
+
+bool BatchReader::setCacheFile(const std::string &fileName)
+{
+#ifdef _WIN32
+  return false;
+#else
+  d->cacheFileName = fileName;
+  d->cache.clear();
+
+  FILE *file = ::fopen(fileName.c_str(), "rb");
+  if(!file)
+    return true;
+
+  ByteVector data;
+  ByteVector buffer(static_cast<unsigned int>(65536), 0);
+  size_t count;
+  while((count = ::fread(buffer.data(), 1, buffer.size(), file)) > 0)
+    data.append(buffer.mid(0, static_cast<unsigned int>(count)));
+  const bool error = ::ferror(file) != 0;
+  ::fclose(file);
+
+  unsigned int offset = 4;
+  unsigned int version;
+  if(error || !data.startsWith(cacheMagic) ||
+     !readUInt(data, offset, version) || version != cacheVersion) {
+    debug("BatchReader::setCacheFile() -- Not a cache file, or an unknown version.");
+    return false;
+  }
+
+  while(offset < data.size()) {
+    CacheKey key;
+    CacheEntry entry;
+    if(!readEntry(data, offset, key, entry)) {
+      debug("BatchReader::setCacheFile() -- The cache file is truncated.");
+      d->cache.clear();
+      return false;
+    }
+    d->cache[key] = entry;
+  }
+
+  // Drops the files that have since been deleted, moved away or replaced, so
+  // that the cache does not keep growing as the files it covers change.
+
+  for(CacheMap::iterator it = d->cache.begin(); it != d->cache.end();) {
+    CacheKey key;
+    CacheEntry entry;
+    if(!statFile(it->second.result.path, key, entry) ||
+       key.device != it->first.device || key.inode != it->first.inode)
+      d->cache.erase(it++);
+    else
+      ++it;
+  }
+
+  return true;
+#endif
+}
+
+bool BatchReader::saveCache()
+{
+  if(d->cacheFileName.empty())
+    return false;
+
+  ByteVector data(cacheMagic);
+  data.append(ByteVector::fromUInt(cacheVersion));
+  for(CacheMap::const_iterator it = d->cache.begin(); it != d->cache.end(); ++it)
+    appendEntry(data, it->first, it->second);
+
+  // Written beside the old one and renamed over it, so that an interrupted
+  // save leaves the old cache in place.
+
+  const std::string tempName = d->cacheFileName + ".tmp";
+  FILE *file = ::fopen(tempName.c_str(), "wb");
+  if(!file)
+    return false;
+
+  const bool written = ::fwrite(data.data(), 1, data.size(), file) == data.size();
+  if(::fclose(file) != 0 || !written ||
+     ::rename(tempName.c_str(), d->cacheFileName.c_str()) != 0) {
+    ::remove(tempName.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+unsigned int BatchReader::cacheSize() const
+{
+  return static_cast<unsigned int>(d->cache.size());
+}
+
+std::vector<BatchReader::Result> BatchReader::read(const std::vector<std::string> &paths,
+                                                   bool readAudioProperties)
+{
+  std::vector<Result> results(paths.size());
+
+#ifdef _WIN32
+
+  for(size_t i = 0; i < paths.size(); ++i) {
+    results[i].path = paths[i];
+    readFile(results[i], readAudioProperties);
+  }
+
+#else
+
+  d->paths = &paths;
+  d->results = &results;
+  d->readAudioProperties = readAudioProperties;
+  d->next = 0;
+  d->ioAvailable = d->ioDepth;
+
+  const unsigned int count =
+    static_cast<unsigned int>(std::min<size_t>(d->workers, paths.size()));
+
+  // Any worker that can't be started leaves its share to the others, and to
+  // this thread, which always works through the list as well.
+
+  std::vector<pthread_t> threads;
+  threads.reserve(count);
+  for(unsigned int i = 1; i < count; ++i) {
+    pthread_t thread;
+    if(pthread_create(&thread, 0, BatchReaderPrivate::runWorker, d) == 0)
+      threads.push_back(thread);
+  }
+
+  d->run();
+
+  for(size_t i = 0; i < threads.size(); ++i)
+    pthread_join(threads[i], 0);
+
+  d->paths = 0;
+  d->results = 0;
+
+#endif
+
+  return results;
+}
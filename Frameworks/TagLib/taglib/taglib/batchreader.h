@@ -0,0 +1,156 @@
+/***************************************************************************
+    copyright            : (C) 2026 by Cog contributors
+ ***************************************************************************/
+
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU Lesser General Public License version   *
+ *   2.1 as published by the Free Software Foundation.                     *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful, but   *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA         *
+ *   02110-1301  USA                                                       *
+ *                                                                         *
+ *   Alternatively, this file is available under the Mozilla Public        *
+ *   License Version 1.1.  You may obtain a copy of the License at         *
+ *   http://www.mozilla.org/MPL/                                           *
+ ***************************************************************************/
+
+#ifndef TAGLIB_BATCHREADER_H
+#define TAGLIB_BATCHREADER_H
+
+#include <string>
+#include <vector>
+
+#include "tpropertymap.h"
+#include "taglib_export.h"
+
+namespace TagLib {
+
+  //! Reads the tags and audio properties of many files at once
+
+  /*!
+   * BatchReader opens a list of files with FileRef on a pool of worker
+   * threads, and returns what was read from each one as a plain value, so
+   * that none of the files need to stay open.
+   *
+   * The number of files being read at any one time, the I/O depth, is limited
+   * separately from the number of workers.  A worker only holds one of these
+   * slots while it opens and parses a file, so checking the other files
+   * against the cache is not held up behind slow storage.
+   *
+   * Given a cache file, results are kept between runs, keyed by the device,
+   * inode, size and modification time of each file.  A file that has not
+   * changed since it was last read is not opened again.  Files that are no
+   * longer found at the path they were last read from are dropped from the
+   * cache when it is loaded.
+   *
+   * \note Files are read one at a time on the calling thread, and nothing is
+   * cached, on Windows.
+   */
+
+  class TAGLIB_EXPORT BatchReader
+  {
+  public:
+
+    /*!
+     * What was read from one file.
+     */
+    struct Result
+    {
+      Result() :
+        valid(false),
+        cached(false),
+        lengthInMilliseconds(0),
+        bitrate(0),
+        sampleRate(0),
+        channels(0) {}
+
+      /*!
+       * The path as it was passed to read().
+       */
+      std::string path;
+
+      /*!
+       * True if the file could be opened and is of a supported type.
+       */
+      bool valid;
+
+      /*!
+       * True if this result came from the cache instead of the file.
+       */
+      bool cached;
+
+      /*!
+       * The tags, as returned by File::properties().
+       */
+      PropertyMap properties;
+
+      /*!
+       * The audio properties, or 0 if they were not read.
+       */
+      int lengthInMilliseconds;
+      int bitrate;
+      int sampleRate;
+      int channels;
+    };
+
+    /*!
+     * Creates a reader with \a workers threads, of which at most \a ioDepth
+     * read from files at once.  Either one may be 0 to use a default: twice
+     * the number of processors for the workers, and all of them for the I/O
+     * depth.
+     */
+    explicit BatchReader(unsigned int workers = 0, unsigned int ioDepth = 0);
+
+    /*!
+     * Destroys this BatchReader.  The cache is not saved.
+     *
+     * \see saveCache()
+     */
+    ~BatchReader();
+
+    /*!
+     * Uses \a fileName to cache results in, and loads the results cached in it
+     * so far, except for files that have been deleted, moved or replaced since.
+     * Returns false if it exists and could not be read, in which case the cache
+     * starts out empty.
+     */
+    bool setCacheFile(const std::string &fileName);
+
+    /*!
+     * Writes every result cached so far to the cache file.  Returns false if
+     * there is no cache file, or it could not be written.
+     */
+    bool saveCache();
+
+    /*!
+     * Returns the number of results held in the cache.
+     */
+    unsigned int cacheSize() const;
+
+    /*!
+     * Reads each of \a paths, and returns the results in the same order.  If
+     * \a readAudioProperties is false, only the tags are read, through a
+     * BoundedFileStream.
+     */
+    std::vector<Result> read(const std::vector<std::string> &paths,
+                             bool readAudioProperties = true);
+
+  private:
+    BatchReader(const BatchReader &);
+    BatchReader &operator=(const BatchReader &);
+
+    class BatchReaderPrivate;
+    BatchReaderPrivate *d;
+  };
+
+}
+
+#endif
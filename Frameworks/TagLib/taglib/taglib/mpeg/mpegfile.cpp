@@ -408,7 +408,9 @@ void MPEG::File::setID3v2FrameFactory(const ID3v2::FrameFactory *factory)
 
 long MPEG::File::nextFrameOffset(long position)
 {
-  ByteVector frameSyncBytes(2, '\0');
+  // Whether the last buffer ended with the first byte of a sync word.
+
+  bool previousSync = false;
 
   while(true) {
     seek(position);
@@ -416,23 +418,36 @@ long MPEG::File::nextFrameOffset(long position)
     if(buffer.isEmpty())
       return -1;
 
-    for(unsigned int i = 0; i < buffer.size(); ++i) {
-      frameSyncBytes[0] = frameSyncBytes[1];
-      frameSyncBytes[1] = buffer[i];
-      if(isFrameSync(frameSyncBytes)) {
-        const Header header(this, position + i - 1, true);
+    if(previousSync) {
+      const char bytes[] = { '\xFF', buffer[0] };
+      if(isFrameSync(ByteVector(bytes, 2))) {
+        const Header header(this, position - 1, true);
+        if(header.isValid())
+          return position - 1;
+      }
+    }
+
+    // Only the 0xFF bytes can start a sync word, so skip straight to them.
+
+    const int lastByte = buffer.size() - 1;
+    for(int i = buffer.find('\xFF'); i >= 0 && i < lastByte; i = buffer.find('\xFF', i + 1)) {
+      if(isFrameSync(buffer, i)) {
+        const Header header(this, position + i, true);
         if(header.isValid())
-          return position + i - 1;
+          return position + i;
       }
     }
 
+    previousSync = (buffer[lastByte] == '\xFF');
     position += bufferSize();
   }
 }
 
 long MPEG::File::previousFrameOffset(long position)
 {
-  ByteVector frameSyncBytes(2, '\0');
+  // The byte following the current buffer.
+
+  char nextByte = '\0';
 
   while(position > 0) {
     const long bufferLength = std::min<long>(position, bufferSize());
@@ -440,16 +455,22 @@ long MPEG::File::previousFrameOffset(long position)
 
     seek(position);
     const ByteVector buffer = readBlock(bufferLength);
+    const char *data = buffer.data();
 
     for(int i = buffer.size() - 1; i >= 0; --i) {
-      frameSyncBytes[1] = frameSyncBytes[0];
-      frameSyncBytes[0] = buffer[i];
-      if(isFrameSync(frameSyncBytes)) {
+      if(data[i] != '\xFF')
+        continue;
+
+      const char bytes[] = { data[i], (i + 1 < static_cast<int>(buffer.size())) ? data[i + 1] : nextByte };
+      if(isFrameSync(ByteVector(bytes, 2))) {
         const Header header(this, position + i, true);
         if(header.isValid())
           return position + i + header.frameLength();
       }
     }
+
+    if(!buffer.isEmpty())
+      nextByte = data[0];
   }
 
   return -1;
@@ -552,10 +573,12 @@ long MPEG::File::findID3v2()
   if(firstHeader.isValid())
     return -1;
 
-  // Look for an ID3v2 tag until reaching the first valid MPEG frame.
+  // Look for an ID3v2 tag until reaching the first valid MPEG frame.  Only
+  // the 0xFF bytes can start a sync word, so the search skips straight to
+  // them and to the tag identifiers, taking each in the order a byte by byte
+  // scan would have completed it.
 
-  ByteVector frameSyncBytes(2, '\0');
-  ByteVector tagHeaderBytes(3, '\0');
+  ByteVector previous;
   long position = 0;
 
   while(true) {
@@ -564,22 +587,28 @@ long MPEG::File::findID3v2()
     if(buffer.isEmpty())
       return -1;
 
-    for(unsigned int i = 0; i < buffer.size(); ++i) {
-      frameSyncBytes[0] = frameSyncBytes[1];
-      frameSyncBytes[1] = buffer[i];
-      if(isFrameSync(frameSyncBytes)) {
-        const Header header(this, position + i - 1, true);
+    // The last two bytes of the previous buffer may start either.
+
+    ByteVector window = previous;
+    window.append(buffer);
+    const long windowOffset = position - previous.size();
+
+    int sync = window.find('\xFF');
+    const int tag = window.find(headerID);
+
+    while(sync >= 0 && (tag < 0 || sync <= tag + 1)) {
+      if(sync + 1 < static_cast<int>(window.size()) && isFrameSync(window, sync)) {
+        const Header header(this, windowOffset + sync, true);
         if(header.isValid())
           return -1;
       }
-
-      tagHeaderBytes[0] = tagHeaderBytes[1];
-      tagHeaderBytes[1] = tagHeaderBytes[2];
-      tagHeaderBytes[2] = buffer[i];
-      if(tagHeaderBytes == headerID)
-        return position + i - 2;
+      sync = window.find('\xFF', sync + 1);
     }
 
+    if(tag >= 0)
+      return windowOffset + tag;
+
+    previous = buffer.mid(buffer.size() - std::min<unsigned int>(2, buffer.size()));
     position += bufferSize();
   }
 }
@@ -0,0 +1,483 @@
+/***************************************************************************
+    copyright            : (C) 2026 by Cog contributors
+ ***************************************************************************/
+
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU Lesser General Public License version   *
+ *   2.1 as published by the Free Software Foundation.                     *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful, but   *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA         *
+ *   02110-1301  USA                                                       *
+ *                                                                         *
+ *   Alternatively, this file is available under the Mozilla Public        *
+ *   License Version 1.1.  You may obtain a copy of the License at         *
+ *   http://www.mozilla.org/MPL/                                           *
+ ***************************************************************************/
+
+#include "tboundedfilestream.h"
+#include "tstring.h"
+#include "tdebug.h"
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <errno.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/stat.h>
+#endif
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+using namespace TagLib;
+
+namespace
+{
+  // Tags larger than this are left to be read as they are parsed.
+
+  const long maxRegionSize = 16 * 1024 * 1024;
+
+#ifdef _WIN32
+
+  typedef FileName FileNameHandle;
+  typedef HANDLE FileHandle;
+
+  const FileHandle InvalidFileHandle = INVALID_HANDLE_VALUE;
+
+  FileHandle openFile(const FileName &path)
+  {
+#if defined (PLATFORM_WINRT)
+    return CreateFile2(path.wstr().c_str(), GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, NULL);
+#else
+    return CreateFileW(path.wstr().c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, 0, NULL);
+#endif
+  }
+
+  void closeFile(FileHandle file)
+  {
+    CloseHandle(file);
+  }
+
+  long fileLength(FileHandle file)
+  {
+    LARGE_INTEGER size;
+    if(!GetFileSizeEx(file, &size) || size.QuadPart > LONG_MAX)
+      return -1;
+    return static_cast<long>(size.QuadPart);
+  }
+
+  size_t readFileAt(FileHandle file, char *buffer, size_t length, long offset)
+  {
+    OVERLAPPED overlapped = {};
+    overlapped.Offset = static_cast<DWORD>(offset);
+
+    DWORD count;
+    if(ReadFile(file, buffer, static_cast<DWORD>(length), &count, &overlapped))
+      return static_cast<size_t>(count);
+    else
+      return 0;
+  }
+
+#else   // _WIN32
+
+  struct FileNameHandle : public std::string
+  {
+    FileNameHandle(FileName name) : std::string(name) {}
+    operator FileName () const { return c_str(); }
+  };
+
+  typedef int FileHandle;
+
+  const FileHandle InvalidFileHandle = -1;
+
+  FileHandle openFile(const FileName &path)
+  {
+    return ::open(path, O_RDONLY);
+  }
+
+  void closeFile(FileHandle file)
+  {
+    ::close(file);
+  }
+
+  long fileLength(FileHandle file)
+  {
+    struct stat st;
+    if(::fstat(file, &st) != 0 || st.st_size > LONG_MAX)
+      return -1;
+    return static_cast<long>(st.st_size);
+  }
+
+  size_t readFileAt(FileHandle file, char *buffer, size_t length, long offset)
+  {
+    size_t count = 0;
+    while(count < length) {
+      const ssize_t n = ::pread(file, buffer + count, length - count, offset + count);
+      if(n < 0 && errno == EINTR)
+        continue;
+      if(n <= 0)
+        break;
+      count += static_cast<size_t>(n);
+    }
+    return count;
+  }
+
+#endif  // _WIN32
+
+  struct Region
+  {
+    Region(long offset, const ByteVector &data) :
+      offset(offset),
+      data(data) {}
+
+    long end() const { return offset + static_cast<long>(data.size()); }
+
+    bool operator<(const Region &other) const { return offset < other.offset; }
+
+    long offset;
+    ByteVector data;
+  };
+}
+
+class BoundedFileStream::BoundedFileStreamPrivate
+{
+public:
+  BoundedFileStreamPrivate(FileName fileName) :
+    file(InvalidFileHandle),
+    name(fileName),
+    length(0),
+    position(0),
+    prefetchReads(0),
+    fallbackReads(0) {}
+
+  ByteVector readAt(long offset, unsigned long count);
+  const Region *regionAt(long offset) const;
+  void fetch(long start, long end);
+  ByteVector peek(long offset, unsigned int count);
+  void prefetch(long windowSize);
+
+  FileHandle file;
+  FileNameHandle name;
+  long length;
+  long position;
+  std::vector<Region> regions;
+  unsigned int prefetchReads;
+  unsigned int fallbackReads;
+};
+
+ByteVector BoundedFileStream::BoundedFileStreamPrivate::readAt(long offset, unsigned long count)
+{
+  if(offset < 0 || offset >= length)
+    return ByteVector();
+
+  count = std::min<unsigned long>(count, length - offset);
+
+  ByteVector data(static_cast<unsigned int>(count), 0);
+  data.resize(static_cast<unsigned int>(readFileAt(file, data.data(), data.size(), offset)));
+  return data;
+}
+
+const Region *BoundedFileStream::BoundedFileStreamPrivate::regionAt(long offset) const
+{
+  for(std::vector<Region>::const_iterator it = regions.begin(); it != regions.end(); ++it) {
+    if(offset >= it->offset && offset < it->end())
+      return &*it;
+  }
+  return 0;
+}
+
+void BoundedFileStream::BoundedFileStreamPrivate::fetch(long start, long end)
+{
+  start = std::max(start, 0L);
+  end = std::min(end, length);
+
+  // Only the part not held yet at either end is read.
+
+  const Region *first = regionAt(start);
+  if(first)
+    start = first->end();
+
+  const Region *last = regionAt(end - 1);
+  if(last && last->offset > start)
+    end = last->offset;
+
+  if(start >= end)
+    return;
+
+  const ByteVector data = readAt(start, end - start);
+  ++prefetchReads;
+  if(data.isEmpty())
+    return;
+
+  regions.push_back(Region(start, data));
+  std::sort(regions.begin(), regions.end());
+
+  // Merge the regions that now overlap or touch.
+
+  std::vector<Region> merged;
+  for(std::vector<Region>::const_iterator it = regions.begin(); it != regions.end(); ++it) {
+    if(!merged.empty() && it->offset <= merged.back().end()) {
+      if(it->end() > merged.back().end())
+        merged.back().data.append(it->data.mid(merged.back().end() - it->offset));
+    }
+    else {
+      merged.push_back(*it);
+    }
+  }
+  regions.swap(merged);
+}
+
+ByteVector BoundedFileStream::BoundedFileStreamPrivate::peek(long offset, unsigned int count)
+{
+  if(offset < 0)
+    return ByteVector();
+
+  fetch(offset, offset + count);
+
+  const Region *region = regionAt(offset);
+  if(!region)
+    return ByteVector();
+  return region->data.mid(offset - region->offset, count);
+}
+
+void BoundedFileStream::BoundedFileStreamPrivate::prefetch(long windowSize)
+{
+  fetch(0, windowSize);
+  fetch(length - windowSize, length);
+
+  // An ID3v2 tag, whose header gives its size, followed by a window for
+  // whatever comes after it.
+
+  long start = 0;
+
+  const ByteVector id3v2 = peek(0, 10);
+  if(id3v2.size() == 10 && id3v2.startsWith("ID3")) {
+    const long size = ((id3v2[6] & 0x7f) << 21) | ((id3v2[7] & 0x7f) << 14) |
+                      ((id3v2[8] & 0x7f) << 7)  |  (id3v2[9] & 0x7f);
+    start = 10 + size + ((id3v2[5] & 0x10) ? 10 : 0);
+    if(start <= maxRegionSize)
+      fetch(0, start + windowSize);
+  }
+
+  if(peek(start, 4) == "fLaC") {
+
+    // The FLAC metadata blocks, walked header by header.  A window is read
+    // past any header that isn't held yet, and the blocks skipped over on the
+    // way are filled in at the end.
+
+    long end = start + 4;
+    for(;;) {
+      if(!regionAt(end) || !regionAt(end + 3))
+        fetch(end, end + windowSize);
+
+      const ByteVector header = peek(end, 4);
+      if(header.size() < 4)
+        break;
+
+      end += 4 + header.toUInt(1U, 3U);
+      if(end >= length || (header[0] & 0x80))
+        break;
+    }
+
+    if(end - start <= maxRegionSize)
+      fetch(start, end);
+  }
+  else if(peek(start + 4, 4) == "ftyp") {
+
+    // The MP4 top level atoms, of which only the headers are read, and all of
+    // moov.
+
+    long long offset = start;
+    while(offset + 8 <= length) {
+      const ByteVector header = peek(static_cast<long>(offset), 16);
+      if(header.size() < 8)
+        break;
+
+      long long size = header.toUInt(0U);
+      if(size == 1 && header.size() == 16)
+        size = header.toLongLong(8U);
+      else if(size == 0)
+        size = length - offset;
+
+      if(size < 8 || offset + size > length)
+        break;
+
+      if(header.containsAt("moov", 4) && size <= maxRegionSize)
+        fetch(static_cast<long>(offset), static_cast<long>(offset + size));
+
+      offset += size;
+    }
+  }
+
+  // An APEv2 tag, before an ID3v1 tag if there is one.
+
+  long end = length;
+  if(length >= 128 && peek(length - 128, 3) == "TAG")
+    end = length - 128;
+
+  const ByteVector footer = peek(end - 32, 32);
+  if(footer.size() == 32 && footer.startsWith("APETAGEX")) {
+    const long size = static_cast<long>(footer.toUInt(12U, false));
+    const bool hasHeader = (footer.toUInt(20U, false) & 0x80000000U) != 0;
+    if(size <= maxRegionSize)
+      fetch(end - size - (hasHeader ? 32 : 0), end);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// public members
+////////////////////////////////////////////////////////////////////////////////
+
+BoundedFileStream::BoundedFileStream(FileName fileName, unsigned int windowSize) :
+  d(new BoundedFileStreamPrivate(fileName))
+{
+  d->file = openFile(fileName);
+
+  if(d->file == InvalidFileHandle) {
+# ifdef _WIN32
+    debug("Could not open file " + fileName.toString());
+# else
+    debug("Could not open file " + String(static_cast<const char *>(d->name)));
+# endif
+    return;
+  }
+
+  d->length = fileLength(d->file);
+  if(d->length < 0) {
+    closeFile(d->file);
+    d->file = InvalidFileHandle;
+    return;
+  }
+
+  d->prefetch(std::max(windowSize, 128U));
+}
+
+BoundedFileStream::~BoundedFileStream()
+{
+  if(isOpen())
+    closeFile(d->file);
+
+  delete d;
+}
+
+FileName BoundedFileStream::name() const
+{
+  return d->name;
+}
+
+ByteVector BoundedFileStream::readBlock(unsigned long length)
+{
+  if(!isOpen()) {
+    debug("BoundedFileStream::readBlock() -- invalid file.");
+    return ByteVector();
+  }
+
+  if(length == 0 || d->position >= d->length)
+    return ByteVector();
+
+  length = std::min<unsigned long>(length, d->length - d->position);
+
+  const Region *region = d->regionAt(d->position);
+  if(region && d->position + static_cast<long>(length) <= region->end()) {
+    const ByteVector data = region->data.mid(d->position - region->offset, length);
+    d->position += static_cast<long>(length);
+    return data;
+  }
+
+  ++d->fallbackReads;
+
+  const ByteVector data = d->readAt(d->position, length);
+  d->position += static_cast<long>(data.size());
+  return data;
+}
+
+void BoundedFileStream::writeBlock(const ByteVector &)
+{
+  debug("BoundedFileStream::writeBlock() -- tried to write to a read only stream.");
+}
+
+void BoundedFileStream::insert(const ByteVector &, unsigned long, unsigned long)
+{
+  debug("BoundedFileStream::insert() -- tried to write to a read only stream.");
+}
+
+void BoundedFileStream::removeBlock(unsigned long, unsigned long)
+{
+  debug("BoundedFileStream::removeBlock() -- tried to write to a read only stream.");
+}
+
+bool BoundedFileStream::readOnly() const
+{
+  return true;
+}
+
+bool BoundedFileStream::isOpen() const
+{
+  return (d->file != InvalidFileHandle);
+}
+
+void BoundedFileStream::seek(long offset, Position p)
+{
+  if(!isOpen()) {
+    debug("BoundedFileStream::seek() -- invalid file.");
+    return;
+  }
+
+  long position;
+  switch(p) {
+  case Beginning:
+    position = offset;
+    break;
+  case Current:
+    position = d->position + offset;
+    break;
+  case End:
+    position = d->length + offset;
+    break;
+  default:
+    debug("BoundedFileStream::seek() -- Invalid Position value.");
+    return;
+  }
+
+  if(position >= 0)
+    d->position = position;
+}
+
+void BoundedFileStream::clear()
+{
+}
+
+long BoundedFileStream::tell() const
+{
+  return d->position;
+}
+
+long BoundedFileStream::length()
+{
+  return d->length;
+}
+
+void BoundedFileStream::truncate(long)
+{
+  debug("BoundedFileStream::truncate() -- tried to write to a read only stream.");
+}
+
+unsigned int BoundedFileStream::prefetchReads() const
+{
+  return d->prefetchReads;
+}
+
+unsigned int BoundedFileStream::fallbackReads() const
+{
+  return d->fallbackReads;
+}
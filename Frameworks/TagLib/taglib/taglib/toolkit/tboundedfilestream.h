@@ -0,0 +1,161 @@
+/***************************************************************************
+    copyright            : (C) 2026 by Cog contributors
+ ***************************************************************************/
+
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU Lesser General Public License version   *
+ *   2.1 as published by the Free Software Foundation.                     *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful, but   *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA         *
+ *   02110-1301  USA                                                       *
+ *                                                                         *
+ *   Alternatively, this file is available under the Mozilla Public        *
+ *   License Version 1.1.  You may obtain a copy of the License at         *
+ *   http://www.mozilla.org/MPL/                                           *
+ ***************************************************************************/
+
+#ifndef TAGLIB_BOUNDEDFILESTREAM_H
+#define TAGLIB_BOUNDEDFILESTREAM_H
+
+#include "taglib_export.h"
+#include "taglib.h"
+#include "tbytevector.h"
+#include "tiostream.h"
+
+namespace TagLib {
+
+  //! A read only file stream that reads only where tags are kept
+
+  /*!
+   * BoundedFileStream reads the head and the tail of a file up front, each
+   * \a windowSize bytes long, in one positioned read apiece.  It then widens
+   * them to take in whatever tags it can see the extent of from their
+   * headers:
+   *
+   * - an ID3v2 tag at the start of the file, and a window past its end,
+   * - the FLAC metadata blocks that follow,
+   * - the \e moov atom of an MP4 file, and the headers of the top level atoms
+   *   around it,
+   * - an APEv2 tag at the end of the file, before any ID3v1 tag.
+   *
+   * Each of these takes a few more reads at most, and all reads made while
+   * the file is parsed are served from memory.  Opening a file with it and
+   * without audio properties bounds the I/O to these regions, which suits
+   * reading the tags of many files on slow or remote storage.
+   *
+   * Reads that fall outside the regions still go to the file, so every file
+   * type can be read through it.  They are counted by fallbackReads(), which
+   * tells whether the bounds held for a file.
+   *
+   * The stream can't be written to.
+   */
+
+  class TAGLIB_EXPORT BoundedFileStream : public IOStream
+  {
+  public:
+    /*!
+     * Opens \a fileName, and reads its head and tail, each \a windowSize
+     * bytes long, along with the tags found in them.
+     */
+    BoundedFileStream(FileName fileName, unsigned int windowSize = 65536);
+
+    /*!
+     * Destroys this BoundedFileStream instance.
+     */
+    virtual ~BoundedFileStream();
+
+    /*!
+     * Returns the file name in the local file system encoding.
+     */
+    FileName name() const;
+
+    /*!
+     * Reads a block of size \a length at the current get pointer.
+     */
+    ByteVector readBlock(unsigned long length);
+
+    /*!
+     * Does nothing, as the stream is read only.
+     */
+    void writeBlock(const ByteVector &data);
+
+    /*!
+     * Does nothing, as the stream is read only.
+     */
+    void insert(const ByteVector &data, unsigned long start = 0, unsigned long replace = 0);
+
+    /*!
+     * Does nothing, as the stream is read only.
+     */
+    void removeBlock(unsigned long start = 0, unsigned long length = 0);
+
+    /*!
+     * Returns true.
+     */
+    bool readOnly() const;
+
+    /*!
+     * Returns true if the file could be opened.
+     */
+    bool isOpen() const;
+
+    /*!
+     * Move the I/O pointer to \a offset in the file from position \a p.  This
+     * defaults to seeking from the beginning of the file.
+     *
+     * \see Position
+     */
+    void seek(long offset, Position p = Beginning);
+
+    /*!
+     * Does nothing, as there are no end-of-file or error flags to reset.
+     */
+    void clear();
+
+    /*!
+     * Returns the current offset within the file.
+     */
+    long tell() const;
+
+    /*!
+     * Returns the length of the file.
+     */
+    long length();
+
+    /*!
+     * Does nothing, as the stream is read only.
+     */
+    void truncate(long length);
+
+    /*!
+     * Returns the number of reads from the file made up front, to fill in the
+     * regions that are held in memory.
+     */
+    unsigned int prefetchReads() const;
+
+    /*!
+     * Returns the number of reads that fell outside the regions held in
+     * memory, and had to go to the file.  This is 0 as long as the file was
+     * only read within its head, tail and tags.
+     */
+    unsigned int fallbackReads() const;
+
+  private:
+    BoundedFileStream(const BoundedFileStream &);
+    BoundedFileStream &operator=(const BoundedFileStream &);
+
+    class BoundedFileStreamPrivate;
+    BoundedFileStreamPrivate *d;
+  };
+
+}
+
+#endif
@@ -37,6 +37,14 @@
 
 #include "tbytevector.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+# include <emmintrin.h>
+# define SEARCH_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+# include <arm_neon.h>
+# define SEARCH_NEON
+#endif
+
 // This is a bit ugly to keep writing over and over again.
 
 // A rather obscure feature of the C++ spec that I hadn't thought of that makes
@@ -46,69 +54,197 @@
 
 namespace TagLib {
 
-template <class TIterator>
-int findChar(
-  const TIterator dataBegin, const TIterator dataEnd,
-  char c, unsigned int offset, int byteAlign)
+// Pattern search over plain memory.  The candidate positions are offset,
+// offset + byteAlign, offset + 2 * byteAlign and so on.  With SIMD, sixteen
+// of them at a time are filtered on the first and last byte of the pattern,
+// and only those that pass are compared in full.
+
+namespace
 {
-  const size_t dataSize = dataEnd - dataBegin;
-  if(offset + 1 > dataSize)
-    return -1;
+#if defined(SEARCH_SSE2) || defined(SEARCH_NEON)
 
-  // n % 0 is invalid
+  // Bits of the match mask per candidate position.
 
-  if(byteAlign == 0)
-    return -1;
+# if defined(SEARCH_SSE2)
+  const unsigned int maskBits = 1;
+# else
+  const unsigned int maskBits = 4;
+# endif
+
+  const unsigned long long positionMask = (1ULL << maskBits) - 1;
+
+  // Candidates at p[i] whose pattern would end at q[i].
 
-  for(TIterator it = dataBegin + offset; it < dataEnd; it += byteAlign) {
-    if(*it == c)
-      return static_cast<int>(it - dataBegin);
+  inline unsigned long long matchMask(const char *p, const char *q, char first, char last)
+  {
+# if defined(SEARCH_SSE2)
+    const __m128i a = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), _mm_set1_epi8(first));
+    const __m128i b = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(q)), _mm_set1_epi8(last));
+    return static_cast<unsigned int>(_mm_movemask_epi8(_mm_and_si128(a, b)));
+# else
+    const uint8x16_t a = vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t *>(p)), vdupq_n_u8(static_cast<uint8_t>(first)));
+    const uint8x16_t b = vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t *>(q)), vdupq_n_u8(static_cast<uint8_t>(last)));
+    const uint8x8_t n = vshrn_n_u16(vreinterpretq_u16_u8(vandq_u8(a, b)), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(n), 0);
+# endif
   }
 
-  return -1;
-}
+  // The positions of a block that are a multiple of byteAlign away from
+  // position \a phase, or 0 if the block size is not such a multiple.
 
-template <class TIterator>
-int findVector(
-  const TIterator dataBegin, const TIterator dataEnd,
-  const TIterator patternBegin, const TIterator patternEnd,
-  unsigned int offset, int byteAlign)
-{
-  const size_t dataSize    = dataEnd    - dataBegin;
-  const size_t patternSize = patternEnd - patternBegin;
-  if(patternSize == 0 || offset + patternSize > dataSize)
-    return -1;
+  unsigned long long alignmentMask(size_t byteAlign, size_t phase)
+  {
+    if(16 % byteAlign != 0)
+      return 0;
 
-  // Special case that pattern contains just single char.
+    unsigned long long mask = 0;
+    for(size_t i = phase % byteAlign; i < 16; i += byteAlign)
+      mask |= positionMask << (i * maskBits);
 
-  if(patternSize == 1)
-    return findChar(dataBegin, dataEnd, *patternBegin, offset, byteAlign);
+    return mask;
+  }
 
-  // n % 0 is invalid
+  inline unsigned int lowestBit(unsigned long long x)
+  {
+# if defined(__GNUC__)
+    return __builtin_ctzll(x);
+# else
+    unsigned int n = 0;
+    while(!(x & 1)) {
+      x >>= 1;
+      ++n;
+    }
+    return n;
+# endif
+  }
 
-  if(byteAlign == 0)
-    return -1;
+  inline unsigned int highestBit(unsigned long long x)
+  {
+# if defined(__GNUC__)
+    return 63 - __builtin_clzll(x);
+# else
+    unsigned int n = 63;
+    while(!(x >> n))
+      --n;
+    return n;
+# endif
+  }
 
-  // We don't use sophisticated algorithms like Knuth-Morris-Pratt here.
+#endif
 
-  // In the current implementation of TagLib, data and patterns are too small
-  // for such algorithms to work effectively.
+  inline bool matchesAt(const char *data, const char *pattern, size_t patternSize)
+  {
+    return data[0] == pattern[0] &&
+           data[patternSize - 1] == pattern[patternSize - 1] &&
+           (patternSize <= 2 || ::memcmp(data + 1, pattern + 1, patternSize - 2) == 0);
+  }
 
-  for(TIterator it = dataBegin + offset; it < dataEnd - patternSize + 1; it += byteAlign) {
+  // Returns the first match at or after \a offset.
 
-    TIterator itData    = it;
-    TIterator itPattern = patternBegin;
+  int findForward(const char *data, size_t dataSize, const char *pattern, size_t patternSize,
+                  size_t offset, int byteAlign)
+  {
+    if(patternSize == 0 || offset + patternSize > dataSize)
+      return -1;
+
+    // n % 0 is invalid
+
+    if(byteAlign <= 0)
+      return -1;
+
+    const size_t align = static_cast<size_t>(byteAlign);
+    const size_t lastStart = dataSize - patternSize;
+    const char first = pattern[0];
+    const char last = pattern[patternSize - 1];
+
+    size_t pos = offset;
+
+#if defined(SEARCH_SSE2) || defined(SEARCH_NEON)
+
+    const unsigned long long alignMask = alignmentMask(align, 0);
+    if(alignMask) {
+      for(; pos + 15 <= lastStart; pos += 16) {
+        unsigned long long mask = matchMask(data + pos, data + pos + patternSize - 1, first, last) & alignMask;
+        while(mask) {
+          const unsigned int bit = lowestBit(mask);
+          const size_t candidate = pos + bit / maskBits;
+          if(patternSize <= 2 || ::memcmp(data + candidate + 1, pattern + 1, patternSize - 2) == 0)
+            return static_cast<int>(candidate);
+          mask &= ~(positionMask << bit);
+        }
+      }
+    }
 
-    while(*itData == *itPattern) {
-      ++itData;
-      ++itPattern;
+#endif
+
+    if(align == 1) {
+      while(pos <= lastStart) {
+        const void *p = ::memchr(data + pos, first, lastStart - pos + 1);
+        if(!p)
+          return -1;
+        pos = static_cast<const char *>(p) - data;
+        if(matchesAt(data + pos, pattern, patternSize))
+          return static_cast<int>(pos);
+        ++pos;
+      }
+      return -1;
+    }
 
-      if(itPattern == patternEnd)
-        return static_cast<int>(it - dataBegin);
+    for(; pos <= lastStart; pos += align) {
+      if(matchesAt(data + pos, pattern, patternSize))
+        return static_cast<int>(pos);
     }
+
+    return -1;
   }
 
-  return -1;
+  // Returns the last match that starts at least \a offset bytes before the
+  // last position a match could start at.
+
+  int findBackward(const char *data, size_t dataSize, const char *pattern, size_t patternSize,
+                   size_t offset, int byteAlign)
+  {
+    if(patternSize == 0 || offset + patternSize > dataSize)
+      return -1;
+
+    // n % 0 is invalid
+
+    if(byteAlign <= 0)
+      return -1;
+
+    const size_t align = static_cast<size_t>(byteAlign);
+    long pos = static_cast<long>(dataSize - patternSize - offset);
+
+#if defined(SEARCH_SSE2) || defined(SEARCH_NEON)
+
+    // Blocks end at the candidate, so its phase is the last position.
+
+    const unsigned long long alignMask = alignmentMask(align, 15);
+    if(alignMask) {
+      const char first = pattern[0];
+      const char last = pattern[patternSize - 1];
+      for(; pos >= 15; pos -= 16) {
+        const char *block = data + pos - 15;
+        unsigned long long mask = matchMask(block, block + patternSize - 1, first, last) & alignMask;
+        while(mask) {
+          const unsigned int bit = highestBit(mask) & ~(maskBits - 1);
+          const size_t candidate = (pos - 15) + bit / maskBits;
+          if(patternSize <= 2 || ::memcmp(data + candidate + 1, pattern + 1, patternSize - 2) == 0)
+            return static_cast<int>(candidate);
+          mask &= ~(positionMask << bit);
+        }
+      }
+    }
+
+#endif
+
+    for(; pos >= 0; pos -= static_cast<long>(align)) {
+      if(matchesAt(data + pos, pattern, patternSize))
+        return static_cast<int>(pos);
+    }
+
+    return -1;
+  }
 }
 
 template <class T>
@@ -421,13 +557,12 @@ char ByteVector::at(unsigned int index) const
 
 int ByteVector::find(const ByteVector &pattern, unsigned int offset, int byteAlign) const
 {
-  return findVector<ConstIterator>(
-    begin(), end(), pattern.begin(), pattern.end(), offset, byteAlign);
+  return findForward(data(), size(), pattern.data(), pattern.size(), offset, byteAlign);
 }
 
 int ByteVector::find(char c, unsigned int offset, int byteAlign) const
 {
-  return findChar<ConstIterator>(begin(), end(), c, offset, byteAlign);
+  return findForward(data(), size(), &c, 1, offset, byteAlign);
 }
 
 int ByteVector::rfind(const ByteVector &pattern, unsigned int offset, int byteAlign) const
@@ -438,13 +573,7 @@ int ByteVector::rfind(const ByteVector &pattern, unsigned int offset, int byteAl
       offset = 0;
   }
 
-  const int pos = findVector<ConstReverseIterator>(
-    rbegin(), rend(), pattern.rbegin(), pattern.rend(), offset, byteAlign);
-
-  if(pos == -1)
-    return -1;
-  else
-    return size() - pos - pattern.size();
+  return findBackward(data(), size(), pattern.data(), pattern.size(), offset, byteAlign);
 }
 
 bool ByteVector::containsAt(const ByteVector &pattern, unsigned int offset, unsigned int patternOffset, unsigned int patternLength) const
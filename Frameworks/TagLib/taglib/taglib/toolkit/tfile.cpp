@@ -29,6 +29,8 @@
 #include "tdebug.h"
 #include "tpropertymap.h"
 
+#include <algorithm>
+
 #ifdef _WIN32
 # include <windows.h>
 # include <io.h>
@@ -242,19 +244,19 @@ void File::writeBlock(const ByteVector &data)
 
 long File::find(const ByteVector &pattern, long fromOffset, const ByteVector &before)
 {
-  if(!d->stream || pattern.size() > bufferSize())
+  if(!d->stream || pattern.isEmpty() || pattern.size() > bufferSize())
       return -1;
 
-  // The position in the file that the current buffer starts at.
+  // A match may straddle two blocks.  The last few bytes of each block are
+  // kept, enough for either pattern less one, and searched together with the
+  // start of the next block before the block itself is.
 
-  long bufferOffset = fromOffset;
-  ByteVector buffer;
+  const unsigned int overlap = std::max(pattern.size(), before.size()) - 1;
 
-  // These variables are used to keep track of a partial match that happens at
-  // the end of a buffer.
+  // The position in the file that the current block starts at.
 
-  int previousPartialMatch = -1;
-  int beforePreviousPartialMatch = -1;
+  long bufferOffset = fromOffset;
+  ByteVector previous;
 
   // Save the location of the current read pointer.  We will restore the
   // position using seek() before all returns.
@@ -265,65 +267,36 @@ long File::find(const ByteVector &pattern, long fromOffset, const ByteVector &be
 
   seek(fromOffset);
 
-  // This loop is the crux of the find method.  There are three cases that we
-  // want to account for:
-  //
-  // (1) The previously searched buffer contained a partial match of the search
-  // pattern and we want to see if the next one starts with the remainder of
-  // that pattern.
-  //
-  // (2) The search pattern is wholly contained within the current buffer.
-  //
-  // (3) The current buffer ends with a partial match of the pattern.  We will
-  // note this for use in the next iteration, where we will check for the rest
-  // of the pattern.
-  //
-  // All three of these are done in two steps.  First we check for the pattern
-  // and do things appropriately if a match (or partial match) is found.  We
-  // then check for "before".  The order is important because it gives priority
-  // to "real" matches.
-
-  for(buffer = readBlock(bufferSize()); buffer.size() > 0; buffer = readBlock(bufferSize())) {
-
-    // (1) previous partial match
-
-    if(previousPartialMatch >= 0 && int(bufferSize()) > previousPartialMatch) {
-      const int patternOffset = (bufferSize() - previousPartialMatch);
-      if(buffer.containsAt(pattern, 0, patternOffset)) {
-        seek(originalPosition);
-        return bufferOffset - bufferSize() + previousPartialMatch;
-      }
-    }
+  // A match of the pattern takes priority over one of "before" in the same
+  // block, or across the same two blocks.
+
+  for(ByteVector buffer = readBlock(bufferSize()); !buffer.isEmpty(); buffer = readBlock(bufferSize())) {
+
+    ByteVector seam;
+    if(!previous.isEmpty()) {
+      seam = previous;
+      seam.append(buffer.mid(0, overlap));
 
-    if(!before.isEmpty() && beforePreviousPartialMatch >= 0 && int(bufferSize()) > beforePreviousPartialMatch) {
-      const int beforeOffset = (bufferSize() - beforePreviousPartialMatch);
-      if(buffer.containsAt(before, 0, beforeOffset)) {
+      const long location = seam.find(pattern);
+      if(location >= 0) {
         seek(originalPosition);
-        return -1;
+        return bufferOffset - previous.size() + location;
       }
     }
 
-    // (2) pattern contained in current buffer
-
-    long location = buffer.find(pattern);
+    const long location = buffer.find(pattern);
     if(location >= 0) {
       seek(originalPosition);
       return bufferOffset + location;
     }
 
-    if(!before.isEmpty() && buffer.find(before) >= 0) {
+    if(!before.isEmpty() && (seam.find(before) >= 0 || buffer.find(before) >= 0)) {
       seek(originalPosition);
       return -1;
     }
 
-    // (3) partial match
-
-    previousPartialMatch = buffer.endsWithPartialMatch(pattern);
-
-    if(!before.isEmpty())
-      beforePreviousPartialMatch = buffer.endsWithPartialMatch(before);
-
-    bufferOffset += bufferSize();
+    previous = buffer.mid(buffer.size() - std::min(overlap, buffer.size()));
+    bufferOffset += buffer.size();
   }
 
   // Since we hit the end of the file, reset the status before continuing.
@@ -338,20 +311,16 @@ long File::find(const ByteVector &pattern, long fromOffset, const ByteVector &be
 
 long File::rfind(const ByteVector &pattern, long fromOffset, const ByteVector &before)
 {
-  if(!d->stream || pattern.size() > bufferSize())
+  if(!d->stream || pattern.isEmpty() || pattern.size() > bufferSize())
       return -1;
 
-  // The position in the file that the current buffer starts at.
+  // See the notes in find() for an explanation of this algorithm.  Here the
+  // first few bytes of each block are kept, for the block read before it.
 
-  ByteVector buffer;
+  const unsigned int overlap = std::max(pattern.size(), before.size()) - 1;
 
-  // These variables are used to keep track of a partial match that happens at
-  // the end of a buffer.
-
-  /*
-  int previousPartialMatch = -1;
-  int beforePreviousPartialMatch = -1;
-  */
+  ByteVector buffer;
+  ByteVector previous;
 
   // Save the location of the current read pointer.  We will restore the
   // position using seek() before all returns.
@@ -366,8 +335,6 @@ long File::rfind(const ByteVector &pattern, long fromOffset, const ByteVector &b
   long bufferLength = bufferSize();
   long bufferOffset = fromOffset + pattern.size();
 
-  // See the notes in find() for an explanation of this algorithm.
-
   while(true) {
 
     if(bufferOffset > bufferLength) {
@@ -383,9 +350,20 @@ long File::rfind(const ByteVector &pattern, long fromOffset, const ByteVector &b
     if(buffer.isEmpty())
       break;
 
-    // TODO: (1) previous partial match
+    // A match straddling the two blocks is later than any within this one.
+
+    ByteVector seam;
+    if(!previous.isEmpty()) {
+      const unsigned int seamOffset = buffer.size() - std::min(overlap, buffer.size());
+      seam = buffer.mid(seamOffset);
+      seam.append(previous);
 
-    // (2) pattern contained in current buffer
+      const long location = seam.rfind(pattern);
+      if(location >= 0) {
+        seek(originalPosition);
+        return bufferOffset + seamOffset + location;
+      }
+    }
 
     const long location = buffer.rfind(pattern);
     if(location >= 0) {
@@ -393,12 +371,12 @@ long File::rfind(const ByteVector &pattern, long fromOffset, const ByteVector &b
       return bufferOffset + location;
     }
 
-    if(!before.isEmpty() && buffer.find(before) >= 0) {
+    if(!before.isEmpty() && (seam.find(before) >= 0 || buffer.find(before) >= 0)) {
       seek(originalPosition);
       return -1;
     }
 
-    // TODO: (3) partial match
+    previous = buffer.mid(0, overlap);
   }
 
   // Since we hit the end of the file, reset the status before continuing.
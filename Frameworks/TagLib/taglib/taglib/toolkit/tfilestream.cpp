@@ -32,8 +32,20 @@
 #else
 # include <stdio.h>
 # include <unistd.h>
+# include <climits>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# ifdef __APPLE__
+#  include <sys/param.h>
+#  include <sys/mount.h>
+# elif defined(__linux__)
+#  include <sys/vfs.h>
+#  include <linux/magic.h>
+# endif
 #endif
 
+#include <algorithm>
+
 using namespace TagLib;
 
 namespace
@@ -86,6 +98,17 @@ namespace
       return 0;
   }
 
+  // Reads are not memory mapped with the Win32 API.
+
+  const char *mapFile(FileHandle, long &)
+  {
+    return 0;
+  }
+
+  void unmapFile(const char *, long)
+  {
+  }
+
 #else   // _WIN32
 
   struct FileNameHandle : public std::string
@@ -123,6 +146,63 @@ namespace
     return fwrite(buffer.data(), sizeof(char), buffer.size(), file);
   }
 
+  // Returns true only if the file is known to be on a local volume.  Where
+  // that can't be told, the answer is false.
+
+  bool isLocalFile(int fd)
+  {
+#if defined(MNT_LOCAL)
+    struct statfs fs;
+    return fstatfs(fd, &fs) == 0 && (fs.f_flags & MNT_LOCAL);
+#elif defined(__linux__)
+    struct statfs fs;
+    if(fstatfs(fd, &fs) != 0)
+      return false;
+
+    switch(fs.f_type) {
+    case EXT4_SUPER_MAGIC:
+    case XFS_SUPER_MAGIC:
+    case BTRFS_SUPER_MAGIC:
+    case TMPFS_MAGIC:
+      return true;
+    default:
+      return false;
+    }
+#else
+    return false;
+#endif
+  }
+
+  // Maps a regular file on a local volume for reading.  Files on network
+  // volumes are left to stdio, since a mapping raises SIGBUS instead of
+  // returning an error when the server goes away.  So does a mapped file that
+  // is truncated underneath it, which is why FileStream drops the mapping
+  // before anything it writes can shrink the file.
+
+  const char *mapFile(FileHandle file, long &length)
+  {
+    const int fd = fileno(file);
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0 || st.st_size > LONG_MAX)
+      return 0;
+
+    if(!isLocalFile(fd))
+      return 0;
+
+    void *map = mmap(0, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    if(map == MAP_FAILED)
+      return 0;
+
+    length = static_cast<long>(st.st_size);
+    return static_cast<const char *>(map);
+  }
+
+  void unmapFile(const char *map, long length)
+  {
+    munmap(const_cast<char *>(map), static_cast<size_t>(length));
+  }
+
 #endif  // _WIN32
 }
 
@@ -133,12 +213,37 @@ public:
     : file(InvalidFileHandle)
     , name(fileName)
     , readOnly(true)
+    , map(0)
+    , mapLength(0)
+    , position(0)
+  {
+  }
+
+  // Hands reading back to the file handle, at the mapped read position,
+  // before anything is written through it.
+
+  void closeMapping()
   {
+    if(!map)
+      return;
+
+    unmapFile(map, mapLength);
+    map = 0;
+
+#ifndef _WIN32
+    fseek(file, position, SEEK_SET);
+#endif
   }
 
   FileHandle file;
   FileNameHandle name;
   bool readOnly;
+
+  // The whole file as it was opened, and the read position within it.
+
+  const char *map;
+  long mapLength;
+  long position;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -164,6 +269,14 @@ FileStream::FileStream(FileName fileName, bool openReadOnly)
 # else
     debug("Could not open file " + String(static_cast<const char *>(d->name)));
 # endif
+
+  // Reads go through a mapping of the file where possible, so that they need
+  // no system calls.  The first write drops it.
+
+  if(isOpen()) {
+    d->position = tell();
+    d->map = mapFile(d->file, d->mapLength);
+  }
 }
 
 FileStream::FileStream(int fileDescriptor, bool openReadOnly)
@@ -181,10 +294,18 @@ FileStream::FileStream(int fileDescriptor, bool openReadOnly)
 
   if(d->file == InvalidFileHandle)
     debug("Could not open file using file descriptor");
+
+  if(isOpen()) {
+    d->position = tell();
+    d->map = mapFile(d->file, d->mapLength);
+  }
 }
 
 FileStream::~FileStream()
 {
+  if(d->map)
+    unmapFile(d->map, d->mapLength);
+
   if(isOpen())
     closeFile(d->file);
 
@@ -206,6 +327,20 @@ ByteVector FileStream::readBlock(unsigned long length)
   if(length == 0)
     return ByteVector();
 
+  if(d->map) {
+
+    // Copied straight out of the mapping, with no system calls.
+
+    const unsigned long available = (d->position < d->mapLength)
+      ? static_cast<unsigned long>(d->mapLength - d->position) : 0;
+    const unsigned int count = static_cast<unsigned int>(std::min(length, available));
+
+    ByteVector buffer(d->map + d->position, count);
+    d->position += count;
+
+    return buffer;
+  }
+
   const unsigned long streamLength = static_cast<unsigned long>(FileStream::length());
   if(length > bufferSize() && length > streamLength)
     length = streamLength;
@@ -230,6 +365,8 @@ void FileStream::writeBlock(const ByteVector &data)
     return;
   }
 
+  d->closeMapping();
+
   writeFile(d->file, data);
 }
 
@@ -245,6 +382,8 @@ void FileStream::insert(const ByteVector &data, unsigned long start, unsigned lo
     return;
   }
 
+  d->closeMapping();
+
   if(data.size() == replace) {
     seek(start);
     writeBlock(data);
@@ -321,6 +460,8 @@ void FileStream::removeBlock(unsigned long start, unsigned long length)
     return;
   }
 
+  d->closeMapping();
+
   unsigned long bufferLength = bufferSize();
 
   long readPosition = start + length;
@@ -367,6 +508,31 @@ void FileStream::seek(long offset, Position p)
     return;
   }
 
+  if(d->map) {
+    long base;
+    switch(p) {
+    case Beginning:
+      base = 0;
+      break;
+    case Current:
+      base = d->position;
+      break;
+    case End:
+      base = d->mapLength;
+      break;
+    default:
+      debug("FileStream::seek() -- Invalid Position value.");
+      return;
+    }
+
+    // Like fseek(), seeking past the end is allowed, but not before the start.
+
+    if(base + offset >= 0)
+      d->position = base + offset;
+
+    return;
+  }
+
 #ifdef _WIN32
 
   if(p != Beginning && p != Current && p != End) {
@@ -419,6 +585,9 @@ void FileStream::clear()
 
 long FileStream::tell() const
 {
+  if(d->map)
+    return d->position;
+
 #ifdef _WIN32
 
   const LARGE_INTEGER zero = {};
@@ -447,6 +616,9 @@ long FileStream::length()
     return 0;
   }
 
+  if(d->map)
+    return d->mapLength;
+
 #ifdef _WIN32
 
   LARGE_INTEGER fileSize;
@@ -479,6 +651,8 @@ long FileStream::length()
 
 void FileStream::truncate(long length)
 {
+  d->closeMapping();
+
 #ifdef _WIN32
 
   const long currentPos = tell();
@@ -0,0 +1,214 @@
+/***************************************************************************
+    copyright           : (C) 2026 by Cog contributors
+ ***************************************************************************/
+
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU Lesser General Public License version   *
+ *   2.1 as published by the Free Software Foundation.                     *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful, but   *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA         *
+ *   02110-1301  USA                                                       *
+ *                                                                         *
+ *   Alternatively, this file is available under the Mozilla Public        *
+ *   License Version 1.1.  You may obtain a copy of the License at         *
+ *   http://www.mozilla.org/MPL/                                           *
+ ***************************************************************************/
+
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <batchreader.h>
+#include <fileref.h>
+#include <tag.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace std;
+using namespace TagLib;
+
+class TestBatchReader : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE(TestBatchReader);
+  CPPUNIT_TEST(testRead);
+  CPPUNIT_TEST(testReadTagsOnly);
+  CPPUNIT_TEST(testCache);
+  CPPUNIT_TEST(testCacheChangedFile);
+  CPPUNIT_TEST(testCacheMissingFile);
+  CPPUNIT_TEST(testBadCache);
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+
+  void testRead()
+  {
+    vector<string> paths;
+    paths.push_back(TEST_FILE_PATH_C("xing.mp3"));
+    paths.push_back(TEST_FILE_PATH_C("click.mpc"));
+    paths.push_back(TEST_FILE_PATH_C("nonexistent.mp3"));
+    paths.push_back(TEST_FILE_PATH_C("empty.ogg"));
+    paths.push_back(TEST_FILE_PATH_C("no-tags.flac"));
+
+    BatchReader reader(3, 2);
+    const vector<BatchReader::Result> results = reader.read(paths);
+    CPPUNIT_ASSERT_EQUAL(paths.size(), results.size());
+
+    for(size_t i = 0; i < paths.size(); ++i) {
+      CPPUNIT_ASSERT_EQUAL(paths[i], results[i].path);
+      CPPUNIT_ASSERT(!results[i].cached);
+
+      FileRef f(paths[i].c_str());
+      CPPUNIT_ASSERT_EQUAL(!f.isNull(), results[i].valid);
+      if(f.isNull())
+        continue;
+
+      CPPUNIT_ASSERT(f.file()->properties() == results[i].properties);
+      CPPUNIT_ASSERT_EQUAL(f.audioProperties()->lengthInMilliseconds(), results[i].lengthInMilliseconds);
+      CPPUNIT_ASSERT_EQUAL(f.audioProperties()->bitrate(), results[i].bitrate);
+      CPPUNIT_ASSERT_EQUAL(f.audioProperties()->sampleRate(), results[i].sampleRate);
+      CPPUNIT_ASSERT_EQUAL(f.audioProperties()->channels(), results[i].channels);
+    }
+  }
+
+  void testReadTagsOnly()
+  {
+    vector<string> paths;
+    paths.push_back(TEST_FILE_PATH_C("xing.mp3"));
+
+    BatchReader reader;
+    const vector<BatchReader::Result> results = reader.read(paths, false);
+    CPPUNIT_ASSERT(results[0].valid);
+    CPPUNIT_ASSERT_EQUAL(0, results[0].lengthInMilliseconds);
+    CPPUNIT_ASSERT_EQUAL(0, results[0].sampleRate);
+  }
+
+  void testCache()
+  {
+    ScopedFileCopy copy("xing", ".mp3");
+    const string cacheName = copy.fileName() + ".cache";
+
+    vector<string> paths;
+    paths.push_back(copy.fileName());
+    paths.push_back(TEST_FILE_PATH_C("nonexistent.mp3"));
+
+    BatchReader::Result first;
+    {
+      BatchReader reader;
+      CPPUNIT_ASSERT(reader.setCacheFile(cacheName));
+      CPPUNIT_ASSERT(reader.saveCache());
+
+      // Tags only, so the audio properties have to be read next time
+
+      CPPUNIT_ASSERT(!reader.read(paths, false)[0].cached);
+      CPPUNIT_ASSERT(reader.read(paths, false)[0].cached);
+      CPPUNIT_ASSERT(!reader.read(paths)[0].cached);
+      first = reader.read(paths)[0];
+      CPPUNIT_ASSERT(first.cached);
+      CPPUNIT_ASSERT_EQUAL(1U, reader.cacheSize());
+      CPPUNIT_ASSERT(reader.saveCache());
+    }
+    {
+      BatchReader reader;
+      CPPUNIT_ASSERT(reader.setCacheFile(cacheName));
+      CPPUNIT_ASSERT_EQUAL(1U, reader.cacheSize());
+
+      const vector<BatchReader::Result> results = reader.read(paths);
+      CPPUNIT_ASSERT(results[0].cached);
+      CPPUNIT_ASSERT(results[0].valid);
+      CPPUNIT_ASSERT_EQUAL(copy.fileName(), results[0].path);
+      CPPUNIT_ASSERT(first.properties == results[0].properties);
+      CPPUNIT_ASSERT_EQUAL(first.lengthInMilliseconds, results[0].lengthInMilliseconds);
+      CPPUNIT_ASSERT_EQUAL(first.bitrate, results[0].bitrate);
+      CPPUNIT_ASSERT_EQUAL(first.sampleRate, results[0].sampleRate);
+      CPPUNIT_ASSERT_EQUAL(first.channels, results[0].channels);
+      CPPUNIT_ASSERT(!results[1].cached);
+      CPPUNIT_ASSERT(!results[1].valid);
+    }
+
+    deleteFile(cacheName);
+  }
+
+  void testCacheChangedFile()
+  {
+    ScopedFileCopy copy("xing", ".mp3");
+    const string cacheName = copy.fileName() + ".cache";
+
+    vector<string> paths;
+    paths.push_back(copy.fileName());
+
+    BatchReader reader;
+    CPPUNIT_ASSERT(reader.setCacheFile(cacheName));
+    CPPUNIT_ASSERT(!reader.read(paths)[0].cached);
+
+    {
+      FileRef f(copy.fileName().c_str());
+      f.tag()->setTitle("A title long enough to change the size of the file");
+      f.save();
+    }
+
+    const BatchReader::Result result = reader.read(paths)[0];
+    CPPUNIT_ASSERT(!result.cached);
+    CPPUNIT_ASSERT_EQUAL(String("A title long enough to change the size of the file"),
+                         result.properties["TITLE"].front());
+
+    deleteFile(cacheName);
+  }
+
+  void testCacheMissingFile()
+  {
+    const string cacheName = TEST_FILE_PATH_C("missing.cache");
+    vector<string> paths(2);
+    {
+      ScopedFileCopy copy1("xing", ".mp3");
+      paths[0] = copy1.fileName();
+      {
+        ScopedFileCopy copy2("click", ".mpc");
+        paths[1] = copy2.fileName();
+
+        BatchReader reader;
+        CPPUNIT_ASSERT(reader.setCacheFile(cacheName));
+        reader.read(paths);
+        CPPUNIT_ASSERT_EQUAL(2U, reader.cacheSize());
+        CPPUNIT_ASSERT(reader.saveCache());
+      }
+
+      BatchReader reader;
+      CPPUNIT_ASSERT(reader.setCacheFile(cacheName));
+      CPPUNIT_ASSERT_EQUAL(1U, reader.cacheSize());
+      CPPUNIT_ASSERT(reader.read(paths)[0].cached);
+      CPPUNIT_ASSERT(reader.saveCache());
+    }
+
+    BatchReader reader;
+    CPPUNIT_ASSERT(reader.setCacheFile(cacheName));
+    CPPUNIT_ASSERT_EQUAL(0U, reader.cacheSize());
+
+    deleteFile(cacheName);
+  }
+
+  void testBadCache()
+  {
+    ScopedFileCopy cache("xing", ".mp3");
+
+    BatchReader reader;
+    CPPUNIT_ASSERT(!reader.setCacheFile(cache.fileName()));
+    CPPUNIT_ASSERT_EQUAL(0U, reader.cacheSize());
+
+    vector<string> paths;
+    paths.push_back(TEST_FILE_PATH_C("xing.mp3"));
+    CPPUNIT_ASSERT(reader.read(paths)[0].valid);
+    CPPUNIT_ASSERT(reader.saveCache());
+    CPPUNIT_ASSERT(reader.setCacheFile(cache.fileName()));
+    CPPUNIT_ASSERT_EQUAL(1U, reader.cacheSize());
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestBatchReader);
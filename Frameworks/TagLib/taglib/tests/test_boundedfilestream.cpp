@@ -0,0 +1,167 @@
+/***************************************************************************
+    copyright           : (C) 2026 by Cog contributors
+ ***************************************************************************/
+
+/***************************************************************************
+ *   This library is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU Lesser General Public License version   *
+ *   2.1 as published by the Free Software Foundation.                     *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful, but   *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU     *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with this library; if not, write to the Free Software   *
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA         *
+ *   02110-1301  USA                                                       *
+ *                                                                         *
+ *   Alternatively, this file is available under the Mozilla Public        *
+ *   License Version 1.1.  You may obtain a copy of the License at         *
+ *   http://www.mozilla.org/MPL/                                           *
+ ***************************************************************************/
+
+#include <string>
+#include <tboundedfilestream.h>
+#include <tfilestream.h>
+#include <tpropertymap.h>
+#include <fileref.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace std;
+using namespace TagLib;
+
+class TestBoundedFileStream : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE(TestBoundedFileStream);
+  CPPUNIT_TEST(testReadBlock);
+  CPPUNIT_TEST(testSeek);
+  CPPUNIT_TEST(testReadOnly);
+  CPPUNIT_TEST(testNonexistent);
+  CPPUNIT_TEST(testTagsWithinBounds);
+  CPPUNIT_TEST(testFallback);
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+
+  void testReadBlock()
+  {
+    FileStream file(TEST_FILE_PATH_C("xing.mp3"), true);
+    BoundedFileStream stream(TEST_FILE_PATH_C("xing.mp3"), 256);
+    CPPUNIT_ASSERT(stream.isOpen());
+    CPPUNIT_ASSERT_EQUAL(file.length(), stream.length());
+
+    const ByteVector data = file.readBlock(file.length());
+
+    // Reads within the head and tail, across their edges, and between them
+
+    ByteVector read;
+    unsigned long length = 1;
+    while(stream.tell() < stream.length()) {
+      read.append(stream.readBlock(length));
+      length = length * 2 + 1;
+    }
+    CPPUNIT_ASSERT(data == read);
+    CPPUNIT_ASSERT(stream.fallbackReads() > 0);
+
+    CPPUNIT_ASSERT(stream.readBlock(10).isEmpty());
+  }
+
+  void testSeek()
+  {
+    FileStream file(TEST_FILE_PATH_C("xing.mp3"), true);
+    BoundedFileStream stream(TEST_FILE_PATH_C("xing.mp3"), 256);
+
+    stream.seek(-128, IOStream::End);
+    file.seek(-128, IOStream::End);
+    CPPUNIT_ASSERT_EQUAL(file.tell(), stream.tell());
+    CPPUNIT_ASSERT_EQUAL(file.readBlock(128), stream.readBlock(200));
+
+    stream.seek(100);
+    stream.seek(-50, IOStream::Current);
+    file.seek(50);
+    CPPUNIT_ASSERT_EQUAL(50L, stream.tell());
+    CPPUNIT_ASSERT_EQUAL(file.readBlock(300), stream.readBlock(300));
+
+    stream.seek(-1);
+    CPPUNIT_ASSERT_EQUAL(350L, stream.tell());
+
+    stream.seek(100, IOStream::End);
+    CPPUNIT_ASSERT(stream.readBlock(1).isEmpty());
+  }
+
+  void testReadOnly()
+  {
+    ScopedFileCopy copy("xing", ".mp3");
+
+    {
+      BoundedFileStream stream(copy.fileName().c_str());
+      CPPUNIT_ASSERT(stream.readOnly());
+
+      stream.writeBlock("abcd");
+      stream.insert("abcd", 0, 0);
+      stream.removeBlock(0, 4);
+      stream.truncate(0);
+    }
+
+    FileStream file(copy.fileName().c_str(), true);
+    FileStream original(TEST_FILE_PATH_C("xing.mp3"), true);
+    CPPUNIT_ASSERT_EQUAL(original.length(), file.length());
+    CPPUNIT_ASSERT(original.readBlock(original.length()) == file.readBlock(file.length()));
+  }
+
+  void testNonexistent()
+  {
+    BoundedFileStream stream(TEST_FILE_PATH_C("nonexistent.mp3"));
+    CPPUNIT_ASSERT(!stream.isOpen());
+    CPPUNIT_ASSERT(stream.readBlock(4).isEmpty());
+
+    FileRef f(&stream, false);
+    CPPUNIT_ASSERT(f.isNull());
+  }
+
+  void testTagsWithinBounds()
+  {
+    // Tags at the start, at the end, and behind FLAC metadata blocks and MP4
+    // atoms, all read with no more than the head and tail up front
+
+    const char *files[] = {
+      "ape-id3v2.mp3",
+      "ape-id3v1.mp3",
+      "silence-44-s.flac",
+      "has-tags.m4a",
+      "ilst-is-last.m4a",
+      "mac-399-tagged.ape",
+      "tagged.wv"
+    };
+
+    for(size_t i = 0; i < sizeof(files) / sizeof(files[0]); ++i) {
+      BoundedFileStream stream(TEST_FILE_PATH_C(files[i]), 1024);
+      FileRef bounded(&stream, false);
+      FileRef f(TEST_FILE_PATH_C(files[i]), false);
+
+      CPPUNIT_ASSERT(!bounded.isNull());
+      CPPUNIT_ASSERT(f.file()->properties() == bounded.file()->properties());
+      CPPUNIT_ASSERT(stream.prefetchReads() <= 4);
+      CPPUNIT_ASSERT_EQUAL(0U, stream.fallbackReads());
+    }
+  }
+
+  void testFallback()
+  {
+    // Ogg comments are read page by page, past a window this small
+
+    BoundedFileStream stream(TEST_FILE_PATH_C("test.ogg"), 1024);
+    FileRef bounded(&stream, false);
+    FileRef f(TEST_FILE_PATH_C("test.ogg"), false);
+
+    CPPUNIT_ASSERT(!bounded.isNull());
+    CPPUNIT_ASSERT(f.file()->properties() == bounded.file()->properties());
+    CPPUNIT_ASSERT(stream.fallbackReads() > 0);
+  }
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestBoundedFileStream);
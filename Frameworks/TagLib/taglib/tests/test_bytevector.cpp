@@ -39,9 +39,11 @@ class TestByteVector : public CppUnit::TestFixture
   CPPUNIT_TEST(testFind1);
   CPPUNIT_TEST(testFind2);
   CPPUNIT_TEST(testFind3);
+  CPPUNIT_TEST(testFindLong);
   CPPUNIT_TEST(testRfind1);
   CPPUNIT_TEST(testRfind2);
   CPPUNIT_TEST(testRfind3);
+  CPPUNIT_TEST(testRfindLong);
   CPPUNIT_TEST(testToHex);
   CPPUNIT_TEST(testIntegerConversion);
   CPPUNIT_TEST(testFloatingPointConversion);
@@ -121,6 +123,34 @@ public:
     CPPUNIT_ASSERT_EQUAL(-1, ByteVector("....SggO."). find('S', 8));
   }
 
+  void testFindLong()
+  {
+    ByteVector v(1000, 'a');
+    v[997] = 'b';
+    v[998] = 'c';
+    v[999] = 'd';
+
+    CPPUNIT_ASSERT_EQUAL(997, v.find("bcd"));
+    CPPUNIT_ASSERT_EQUAL(997, v.find("bcd", 997));
+    CPPUNIT_ASSERT_EQUAL(-1, v.find("bcd", 998));
+    CPPUNIT_ASSERT_EQUAL(-1, v.find("bcde"));
+    CPPUNIT_ASSERT_EQUAL(998, v.find('c'));
+    CPPUNIT_ASSERT_EQUAL(-1, v.find('e'));
+
+    CPPUNIT_ASSERT_EQUAL(995, v.find("aab"));
+    CPPUNIT_ASSERT_EQUAL(-1, v.find("aab", 0, 2));
+    CPPUNIT_ASSERT_EQUAL(995, v.find("aab", 1, 2));
+    CPPUNIT_ASSERT_EQUAL(-1, v.find("aab", 0, 3));
+    CPPUNIT_ASSERT_EQUAL(995, v.find("aab", 2, 3));
+    CPPUNIT_ASSERT_EQUAL(995, v.find("aab", 5, 18));
+    CPPUNIT_ASSERT_EQUAL(-1, v.find("aab", 0, 18));
+
+    v[500] = 'b';
+    CPPUNIT_ASSERT_EQUAL(500, v.find('b'));
+    CPPUNIT_ASSERT_EQUAL(500, v.find('b', 0, 4));
+    CPPUNIT_ASSERT_EQUAL(997, v.find('b', 1, 4));
+  }
+
   void testRfind1()
   {
     CPPUNIT_ASSERT_EQUAL(1, ByteVector(".OggS....").rfind("OggS", 0));
@@ -171,6 +201,27 @@ public:
     CPPUNIT_ASSERT_EQUAL(1, ByteVector(".OggS....").rfind('O'));
   }
 
+  void testRfindLong()
+  {
+    ByteVector v(1000, 'a');
+    v[0] = 'b';
+    v[1] = 'c';
+    v[2] = 'd';
+
+    CPPUNIT_ASSERT_EQUAL(0, v.rfind("bcd"));
+    CPPUNIT_ASSERT_EQUAL(0, v.rfind("bcd", 500));
+    CPPUNIT_ASSERT_EQUAL(-1, v.rfind("bcde"));
+
+    CPPUNIT_ASSERT_EQUAL(2, v.rfind("daa"));
+    CPPUNIT_ASSERT_EQUAL(-1, v.rfind("daa", 0, 2));
+    CPPUNIT_ASSERT_EQUAL(2, v.rfind("daa", 0, 5));
+
+    v[600] = 'b';
+    CPPUNIT_ASSERT_EQUAL(600, v.rfind("ba"));
+    CPPUNIT_ASSERT_EQUAL(600, v.rfind("ba", 600));
+    CPPUNIT_ASSERT_EQUAL(-1, v.rfind("ba", 599));
+  }
+
   void testToHex()
   {
     ByteVector v("\xf0\xe1\xd2\xc3\xb4\xa5\x96\x87\x78\x69\x5a\x4b\x3c\x2d\x1e\x0f", 16);
@@ -24,6 +24,10 @@
  ***************************************************************************/
 
 #include <tfile.h>
+#include <tfilestream.h>
+#include <fileref.h>
+#include <tag.h>
+#include <audioproperties.h>
 #include <cppunit/extensions/HelperMacros.h>
 #include "plainfile.h"
 #include "utils.h"
@@ -35,8 +39,13 @@ class TestFile : public CppUnit::TestFixture
   CPPUNIT_TEST_SUITE(TestFile);
   CPPUNIT_TEST(testFindInSmallFile);
   CPPUNIT_TEST(testRFindInSmallFile);
+  CPPUNIT_TEST(testFindAcrossBuffers);
   CPPUNIT_TEST(testSeek);
   CPPUNIT_TEST(testTruncate);
+  CPPUNIT_TEST(testReadBlock);
+  CPPUNIT_TEST(testReadAfterWrite);
+  CPPUNIT_TEST(testRemoveAfterRead);
+  CPPUNIT_TEST(testFileRefSave);
   CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -97,6 +106,45 @@ public:
     }
   }
 
+  void testFindAcrossBuffers()
+  {
+    ScopedFileCopy copy("empty", ".ogg");
+    std::string name = copy.fileName();
+    {
+      PlainFile file(name.c_str());
+      ByteVector data(5000, '.');
+      data[1022] = '0';
+      data[1023] = '1';
+      data[1024] = '2';
+      data[1025] = '3';
+      data[2955] = 'x';
+      data[2956] = 'y';
+      data[2957] = 'z';
+      file.seek(0);
+      file.writeBlock(data);
+      file.truncate(5000);
+    }
+    {
+      PlainFile file(name.c_str());
+      file.seek(100);
+
+      CPPUNIT_ASSERT_EQUAL(1022L, file.find("0123"));
+      CPPUNIT_ASSERT_EQUAL(1022L, file.find("0123", 1000));
+      CPPUNIT_ASSERT_EQUAL(-1L, file.find("0123", 1023));
+      CPPUNIT_ASSERT_EQUAL(2955L, file.find("xyz"));
+      CPPUNIT_ASSERT_EQUAL(-1L, file.find("xyz", 0, "123"));
+      CPPUNIT_ASSERT_EQUAL(-1L, file.find("xyzw"));
+
+      CPPUNIT_ASSERT_EQUAL(1022L, file.rfind("0123"));
+      CPPUNIT_ASSERT_EQUAL(1022L, file.rfind("0123", 3000));
+      CPPUNIT_ASSERT_EQUAL(2955L, file.rfind("xyz"));
+      CPPUNIT_ASSERT_EQUAL(-1L, file.rfind("0123", 0, "xyz"));
+      CPPUNIT_ASSERT_EQUAL(-1L, file.rfind("xyzw"));
+
+      CPPUNIT_ASSERT_EQUAL(100L, file.tell());
+    }
+  }
+
   void testSeek()
   {
     ScopedFileCopy copy("empty", ".ogg");
@@ -139,6 +187,122 @@ public:
     }
   }
 
+  void testReadBlock()
+  {
+    ScopedFileCopy copy("empty", ".ogg");
+    std::string name = copy.fileName();
+    {
+      PlainFile file(name.c_str());
+      file.writeBlock(ByteVector("0123456789", 10));
+      file.truncate(10);
+    }
+    {
+      FileStream stream(name.c_str(), true);
+      CPPUNIT_ASSERT(stream.readOnly());
+
+      CPPUNIT_ASSERT_EQUAL(ByteVector("0123"), stream.readBlock(4));
+      CPPUNIT_ASSERT_EQUAL(4L, stream.tell());
+      CPPUNIT_ASSERT_EQUAL(ByteVector("456789"), stream.readBlock(100));
+      CPPUNIT_ASSERT_EQUAL(10L, stream.tell());
+      CPPUNIT_ASSERT(stream.readBlock(4).isEmpty());
+
+      stream.seek(-3, IOStream::End);
+      CPPUNIT_ASSERT_EQUAL(ByteVector("789"), stream.readBlock(4));
+
+      stream.seek(20);
+      CPPUNIT_ASSERT_EQUAL(20L, stream.tell());
+      CPPUNIT_ASSERT(stream.readBlock(4).isEmpty());
+    }
+  }
+
+  void testReadAfterWrite()
+  {
+    ScopedFileCopy copy("empty", ".ogg");
+    std::string name = copy.fileName();
+
+    PlainFile file(name.c_str());
+    CPPUNIT_ASSERT(!file.readOnly());
+
+    file.seek(100);
+    const ByteVector before = file.readBlock(10);
+    CPPUNIT_ASSERT_EQUAL(110L, file.tell());
+
+    file.writeBlock(ByteVector("abcd", 4));
+    CPPUNIT_ASSERT_EQUAL(114L, file.tell());
+    CPPUNIT_ASSERT_EQUAL(4328L, file.length());
+
+    file.seek(100);
+    CPPUNIT_ASSERT_EQUAL(before, file.readBlock(10));
+    CPPUNIT_ASSERT_EQUAL(ByteVector("abcd"), file.readBlock(4));
+
+    file.insert(ByteVector("xyz", 3), 0, 0);
+    CPPUNIT_ASSERT_EQUAL(4331L, file.length());
+    file.seek(0);
+    CPPUNIT_ASSERT_EQUAL(ByteVector("xyzOggS"), file.readBlock(7));
+  }
+
+  void testRemoveAfterRead()
+  {
+    ScopedFileCopy copy("empty", ".ogg");
+    std::string name = copy.fileName();
+    {
+      PlainFile file(name.c_str());
+      const ByteVector tail = file.readBlock(4328).mid(10);
+      CPPUNIT_ASSERT_EQUAL(4328L, file.tell());
+
+      file.removeBlock(0, 10);
+      CPPUNIT_ASSERT_EQUAL(4318L, file.length());
+      file.seek(0);
+      CPPUNIT_ASSERT_EQUAL(tail, file.readBlock(4318));
+
+      file.seek(4000);
+      file.readBlock(10);
+      file.truncate(100);
+      CPPUNIT_ASSERT_EQUAL(100L, file.length());
+    }
+    {
+      PlainFile file(name.c_str());
+      CPPUNIT_ASSERT_EQUAL(100L, file.length());
+    }
+  }
+
+  // FileRef(path) opens files writable, as tag editors do.  Saving through it
+  // grows the tag past the audio data, then shrinks it again.
+
+  void testFileRefSave()
+  {
+    const char *names[] = { "xing", "no-tags", "empty" };
+    const char *extensions[] = { ".mp3", ".flac", ".ogg" };
+
+    for(int i = 0; i < 3; ++i) {
+      ScopedFileCopy copy(names[i], extensions[i]);
+      std::string name = copy.fileName();
+
+      int length;
+      {
+        FileRef f(name.c_str());
+        CPPUNIT_ASSERT(!f.isNull());
+        CPPUNIT_ASSERT(!f.file()->readOnly());
+        length = f.audioProperties()->lengthInMilliseconds();
+        f.tag()->setTitle(String(std::string(20000, 'x')));
+        CPPUNIT_ASSERT(f.save());
+        CPPUNIT_ASSERT_EQUAL(String(std::string(20000, 'x')), f.tag()->title());
+      }
+      {
+        FileRef f(name.c_str());
+        CPPUNIT_ASSERT_EQUAL(String(std::string(20000, 'x')), f.tag()->title());
+        CPPUNIT_ASSERT_EQUAL(length, f.audioProperties()->lengthInMilliseconds());
+        f.tag()->setTitle("short");
+        CPPUNIT_ASSERT(f.save());
+      }
+      {
+        FileRef f(name.c_str());
+        CPPUNIT_ASSERT_EQUAL(String("short"), f.tag()->title());
+        CPPUNIT_ASSERT_EQUAL(length, f.audioProperties()->lengthInMilliseconds());
+      }
+    }
+  }
+
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestFile);
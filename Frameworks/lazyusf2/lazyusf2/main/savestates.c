@@ -22,12 +22,14 @@
  *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.          *
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "usf/usf.h"
 
 #include "usf/usf_internal.h"
+#include "usf/resampler.h"
 
 #define M64P_CORE_PROTOTYPES 1
 #include "api/m64p_types.h"
@@ -643,3 +645,118 @@ int savestates_load(usf_state_t * state, unsigned char * ptr, unsigned int size,
     else
         return savestates_load_pj64(state, ptr, size);
 }
+
+/* Checkpoints are taken between usf_render calls and only ever restored into
+ * the state they were taken from, so unlike the formats above they are a
+ * plain copy of the machine: everything in usf_state_t ahead of the block
+ * table, the output resampler, and the few fields behind the block table
+ * which aren't recompiler bookkeeping. */
+#define CHECKPOINT_MACHINE_SIZE offsetof(usf_state_t, invalid_code)
+#define CHECKPOINT_ALIGN(size) (((size) + 15) & ~(size_t)15)
+
+struct checkpoint_tail
+{
+    unsigned int pc;
+    int cycle_count;
+#ifdef DYNAREC
+    int branch_taken;
+#endif
+};
+
+static size_t checkpoint_resampler_offset(void)
+{
+    return CHECKPOINT_ALIGN(CHECKPOINT_MACHINE_SIZE);
+}
+
+static size_t checkpoint_tail_offset(void)
+{
+    return checkpoint_resampler_offset() + CHECKPOINT_ALIGN(resampler_get_size());
+}
+
+size_t savestates_get_checkpoint_size(void)
+{
+    return checkpoint_tail_offset() + sizeof(struct checkpoint_tail);
+}
+
+void savestates_save_checkpoint(usf_state_t * state, unsigned char * ptr)
+{
+    struct checkpoint_tail tail;
+
+    memcpy(ptr, state, CHECKPOINT_MACHINE_SIZE);
+    resampler_dup_inplace(ptr + checkpoint_resampler_offset(), state->resampler);
+
+    memset(&tail, 0, sizeof(tail));
+    /* The recompiler resumes from last_addr, the interpreters from PC */
+    if (state->MemoryState)
+        tail.pc = (state->r4300emu == CORE_DYNAREC) ? state->last_addr : state->PC->addr;
+    tail.cycle_count = state->cycle_count;
+#ifdef DYNAREC
+    tail.branch_taken = state->branch_taken;
+#endif
+    memcpy(ptr + checkpoint_tail_offset(), &tail, sizeof(tail));
+}
+
+int savestates_load_checkpoint(usf_state_t * state, const unsigned char * ptr)
+{
+    const usf_state_t * saved = (const usf_state_t *) ptr;
+    struct checkpoint_tail tail;
+    unsigned int skip_jump;
+    /* Allocations, which stay with the state rather than the machine */
+    unsigned char * save_state = state->save_state;
+    unsigned int save_state_size = state->save_state_size;
+    void * resampler = state->resampler;
+    unsigned char * rom = state->g_rom;
+    int rom_size = state->g_rom_size;
+    precomp_instr * PC = state->PC;
+#ifdef DYNAREC
+    unsigned long long dummy;
+#endif
+
+    /* The coverage arrays aren't part of the checkpoint */
+    if (state->enable_trimming_mode)
+        return 0;
+
+    /* Going back to before the first usf_render, which starts the machine
+     * up again and allocates a new block table */
+    if (state->MemoryState && !saved->MemoryState)
+        r4300_end(state);
+
+    memcpy(state, ptr, CHECKPOINT_MACHINE_SIZE);
+    state->save_state = save_state;
+    state->save_state_size = save_state_size;
+    state->resampler = resampler;
+    state->g_rom = rom;
+    state->g_rom_size = rom_size;
+    state->PC = PC;
+    state->sample_buffer = NULL;
+    state->sample_buffer_count = 0;
+
+    resampler_dup_inplace(state->resampler, ptr + checkpoint_resampler_offset());
+
+    memcpy(&tail, ptr + checkpoint_tail_offset(), sizeof(tail));
+    state->cycle_count = tail.cycle_count;
+#ifdef DYNAREC
+    state->branch_taken = tail.branch_taken;
+#endif
+
+    if (!state->MemoryState)
+        return 1;
+
+    /* Every block may have been translated from code which has changed
+     * since, so they are all checked again, like after loading a save
+     * state, and execution enters the checkpoint's block afresh */
+    if (state->r4300emu != CORE_PURE_INTERPRETER)
+        memset(state->invalid_code, 1, sizeof(state->invalid_code));
+    skip_jump = state->skip_jump;
+    state->skip_jump = 0;
+#ifdef DYNAREC
+    *(void **)&state->return_address = (void *)&dummy;
+#endif
+    generic_jump_to(state, tail.pc);
+#ifdef DYNAREC
+    *(void **)&state->return_address = (void *)0;
+#endif
+    state->skip_jump = skip_jump;
+
+    return 1;
+}
@@ -27,5 +27,9 @@
 
 int savestates_load(usf_state_t *, unsigned char * ptr, unsigned int size, unsigned int is_m64p);
 
+size_t savestates_get_checkpoint_size(void);
+void savestates_save_checkpoint(usf_state_t *, unsigned char * ptr);
+int savestates_load_checkpoint(usf_state_t *, const unsigned char * ptr);
+
 #endif /* __SAVESTAVES_H__ */
 
@@ -0,0 +1,576 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *   Mupen64plus - recompcheck.c                                           *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.          *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Runs random R4300 programs on the default core and on the pure interpreter
+ * in lockstep, and checks that they give the same audio output. Each program
+ * is a synthetic save state whose code is split into segments of random
+ * integer ALU, shift, immediate, multiply/divide, load/store, branch,
+ * branch-likely and COP1 instructions. After every segment the GPRs, hi and
+ * lo are stored and sent out through AI DMA, so any difference in them shows
+ * up in the output. The default core is also run with the output rendered in
+ * small chunks, again after a usf_restart, and once more going back to
+ * checkpoints, both from before the first usf_render and from partway
+ * through.
+ *
+ * The programs never feed a value that isn't sign-extended from 32 bits to a
+ * 32-bit operation, whose result MIPS III leaves unpredictable, and which
+ * the x86-64 register cache assumes doesn't happen.
+ *
+ * With DYNAREC defined, the default core is the recompiler in r4300/x86_64.
+ * r4300/new_dynarec isn't built and isn't checked here: it still works on
+ * mupen64plus globals rather than usf_state_t, and has no x86-64 backend.
+ *
+ * Not part of any target. Build it on its own, from the directory above this
+ * one, with -DDYNAREC for the recompiler or without it for the cached
+ * interpreter:
+ *
+ *   cc -O2 -DDYNAREC -I. -o recompcheck r4300/recompcheck.c \
+ *     $(find . -name '*.c' ! -path './r4300/x86/*' ! -path './r4300/new_dynarec/*' \
+ *       ! -name empty_dynarec.c ! -name instr_counters.c ! -name bench.c \
+ *       ! -name alistcheck.c ! -name recompcheck.c) -lz -lm
+ *
+ * "recompcheck [seeds]" checks that many programs. "recompcheck -bench"
+ * times the pure interpreter and the default core on the same programs.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "usf/usf.h"
+
+#define DEFAULT_SEEDS 64
+#define CHECK_SAMPLES 20000
+#define BENCH_SAMPLES 200000
+#define SEGMENTS 64
+
+#define R_TYPE(op, rs, rt, rd, sa, fn) (((uint32_t)(op) << 26) | ((rs) << 21) | ((rt) << 16) | ((rd) << 11) | ((sa) << 6) | (fn))
+#define I_TYPE(op, rs, rt, imm) (((uint32_t)(op) << 26) | ((rs) << 21) | ((rt) << 16) | ((imm) & 0xFFFF))
+
+static uint64_t random_state;
+
+static uint32_t random_u32(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+    return (uint32_t)(random_state >> 11);
+}
+
+static uint32_t* code;
+static int code_length;
+
+static void emit(uint32_t word)
+{
+    code[code_length++] = word;
+}
+
+/* Registers 26 and 27 are scratch for the dumps, 28 points at the dump
+ * area, 29 at the data area. canonical[] tracks which registers are known
+ * to hold a sign-extended 32-bit value. Inside a branch, a register only
+ * stays canonical if it is on both paths. */
+static int canonical[32], canonical_at_start[32];
+static int hi_canonical, lo_canonical;
+static int branch_level;
+
+static int any_register(void)
+{
+    static const int usable[] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 31
+    };
+    return usable[random_u32() % 27];
+}
+
+static int canonical_register(void)
+{
+    int r, tries = 0;
+    do {
+        r = any_register();
+    } while (!canonical[r] && ++tries < 64);
+    return canonical[r] ? r : 0;
+}
+
+static int written_register(void)
+{
+    int r;
+    do {
+        r = any_register();
+    } while (!r);
+    return r;
+}
+
+static int written_canonical_register(void)
+{
+    int r, tries = 0;
+    do {
+        r = written_register();
+    } while (!canonical[r] && ++tries < 64);
+    return canonical[r] ? r : 0;
+}
+
+static void set_canonical(int r, int value)
+{
+    canonical[r] = branch_level ? (canonical[r] & value) : value;
+}
+
+/* With Status.FR clear, only the even FPRs can be used for doubles */
+static int fpu_register(int fr)
+{
+    return fr ? random_u32() % 32 : (random_u32() % 16) * 2;
+}
+
+static void random_instruction(int allow_branch, int fr)
+{
+    int kind;
+    int d = written_register();
+
+    /* The register cache treats a register written by a 32-bit operation on
+     * one path as 32-bit at the join, so inside a branch only registers that
+     * already are get written, or the result is 64-bit anyway */
+    if (branch_level) {
+        int e = written_canonical_register();
+        if (e) {
+            d = e;
+        } else {
+            emit(R_TYPE(0, any_register(), any_register(), d, 0, 0x2D)); /* daddu */
+            set_canonical(d, 0);
+            return;
+        }
+    }
+
+    for (;;) {
+        int k = random_u32() % 100;
+        kind = k < 30 ? 1 : k < 40 ? 2 : k < 58 ? 4 : k < 64 ? 8 : k < 80 ? 16 : (k < 90 && allow_branch && branch_level < 2) ? 32 : 64;
+        if (allow_branch || kind != 32)
+            break;
+    }
+
+    if (kind == 1) {
+        /* Three-register ALU */
+        static const int functions[] = {
+            0x21, 0x23, 0x24, 0x25, 0x26, 0x27, 0x2A, 0x2B,
+            0x2D, 0x2F, 0x04, 0x06, 0x07, 0x14, 0x16, 0x17
+        };
+        int f = functions[random_u32() % 16], a, b;
+        switch (f) {
+        case 0x21: case 0x23: /* addu, subu */
+        case 0x04: case 0x06: case 0x07: /* sllv, srlv, srav */
+            a = canonical_register(); b = canonical_register();
+            emit(R_TYPE(0, a, b, d, 0, f)); set_canonical(d, 1);
+            break;
+        case 0x24: case 0x25: case 0x26: case 0x27: /* and, or, xor, nor */
+            a = any_register(); b = any_register();
+            emit(R_TYPE(0, a, b, d, 0, f)); set_canonical(d, canonical[a] & canonical[b]);
+            break;
+        case 0x2A: case 0x2B: /* slt, sltu */
+            a = any_register(); b = any_register();
+            emit(R_TYPE(0, a, b, d, 0, f)); set_canonical(d, 1);
+            break;
+        case 0x2D: case 0x2F: /* daddu, dsubu */
+            a = any_register(); b = any_register();
+            emit(R_TYPE(0, a, b, d, 0, f)); set_canonical(d, 0);
+            break;
+        default: /* dsllv, dsrlv, dsrav */
+            a = canonical_register(); b = any_register();
+            emit(R_TYPE(0, a, b, d, 0, f)); set_canonical(d, 0);
+            break;
+        }
+    } else if (kind == 2) {
+        /* Shifts by a constant */
+        static const int functions[] = { 0x00, 0x02, 0x03, 0x38, 0x3A, 0x3B, 0x3C, 0x3E, 0x3F };
+        int f = functions[random_u32() % 9];
+        if (f < 4) {
+            emit(R_TYPE(0, 0, canonical_register(), d, random_u32() % 32, f)); set_canonical(d, 1);
+        } else {
+            emit(R_TYPE(0, 0, any_register(), d, random_u32() % 32, f)); set_canonical(d, 0);
+        }
+    } else if (kind == 4) {
+        /* Immediates: addiu, slti, sltiu, andi, ori, xori, lui, daddiu */
+        static const int ops[] = { 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x19 };
+        int o = ops[random_u32() % 8], a;
+        uint32_t imm = random_u32();
+        if (random_u32() % 4 == 0)
+            imm = (random_u32() % 3) ? 0xFFFF : 0x8000;
+        a = (o == 0x09) ? canonical_register() : any_register();
+        if (o == 0x0F)
+            a = 0;
+        emit(I_TYPE(o, a, d, imm));
+        set_canonical(d, o == 0x19 ? 0 : (o == 0x0D || o == 0x0E) ? canonical[a] : 1);
+    } else if (kind == 8) {
+        /* Multiply, divide, and moves to and from hi/lo */
+        int o = random_u32() % 8;
+        /* 32-bit hi/lo writes only where hi/lo are already 32-bit */
+        if (branch_level && (!hi_canonical || !lo_canonical) && (o < 2 || o == 4 || o == 5))
+            o = 2;
+        if (o < 2) {
+            emit(R_TYPE(0, canonical_register(), canonical_register(), 0, 0, 0x18 + o)); /* mult, multu */
+            if (!branch_level)
+                hi_canonical = lo_canonical = 1;
+        } else if (o < 4) {
+            emit(R_TYPE(0, any_register(), any_register(), 0, 0, 0x1C + o - 2)); /* dmult, dmultu */
+            hi_canonical = lo_canonical = 0;
+        } else if (o < 6) {
+            /* div, divu, ddiv, ddivu, by a divisor made nonzero in k0 */
+            int dbl = random_u32() % 2;
+            int f = (dbl ? 0x1E : 0x1A) + random_u32() % 2;
+            int a = dbl ? any_register() : canonical_register();
+            int b = dbl ? any_register() : canonical_register();
+            emit(I_TYPE(0x0D, b, 26, 1));
+            if (dbl)
+                emit(I_TYPE(0x0D, 26, 26, 0x10));
+            emit(R_TYPE(0, a, 26, 0, 0, f));
+            if (dbl)
+                hi_canonical = lo_canonical = 0;
+            else if (!branch_level)
+                hi_canonical = lo_canonical = 1;
+        } else {
+            int w = random_u32() % 4;
+            if (w == 0) {
+                emit(R_TYPE(0, 0, 0, d, 0, 0x10)); set_canonical(d, hi_canonical); /* mfhi */
+            } else if (w == 1) {
+                emit(R_TYPE(0, 0, 0, d, 0, 0x12)); set_canonical(d, lo_canonical); /* mflo */
+            } else {
+                int a = any_register();
+                emit(R_TYPE(0, a, 0, 0, 0, w == 2 ? 0x11 : 0x13)); /* mthi, mtlo */
+                if (w == 2)
+                    hi_canonical = branch_level ? hi_canonical & canonical[a] : canonical[a];
+                else
+                    lo_canonical = branch_level ? lo_canonical & canonical[a] : canonical[a];
+            }
+        }
+    } else if (kind == 16) {
+        /* Loads and stores relative to r29 */
+        static const int ops[] = {
+            0x20, 0x24, 0x21, 0x25, 0x23, 0x27, 0x37, 0x22, 0x26, 0x1A,
+            0x1B, 0x28, 0x29, 0x2B, 0x3F, 0x2A, 0x2E, 0x2C, 0x2D
+        };
+        static const int alignments[] = { 1, 1, 2, 2, 4, 4, 8, 1, 1, 1, 1, 1, 2, 4, 8, 1, 1, 1, 1 };
+        int j = random_u32() % 19, o = ops[j];
+        int offset = (random_u32() % 0x1000) & ~(alignments[j] - 1);
+        if (o >= 0x28 && o != 0x37) {
+            /* Stores; the 32-bit ones of canonical registers */
+            int b = (o == 0x3F || o == 0x2C || o == 0x2D) ? any_register() : canonical_register();
+            emit(I_TYPE(o, 29, b, offset));
+        } else {
+            /* lwl and lwr merge into a register, which has to be canonical first */
+            if (o == 0x22 || o == 0x26) {
+                d = canonical_register();
+                if (!d)
+                    d = written_register();
+                if (!canonical[d]) {
+                    emit(R_TYPE(0, 0, d, d, 0, 0)); /* sll d, d, 0 */
+                    set_canonical(d, 1);
+                }
+            }
+            emit(I_TYPE(o, 29, d, offset));
+            set_canonical(d, (o == 0x27 || o == 0x37 || o == 0x1A || o == 0x1B) ? 0 : 1);
+        }
+    } else if (kind == 32) {
+        /* Short forward branch, likely or not, with its delay slot */
+        static const int ops[] = { 0x04, 0x05, 0x06, 0x07, 0x14, 0x15, 0x16, 0x17 };
+        int n = 1 + random_u32() % 6, j = random_u32() % 10, at, i;
+        int a = any_register(), b = any_register();
+        branch_level++;
+        if (j < 8)
+            emit(I_TYPE(ops[j], a, (ops[j] & 3) >= 2 ? 0 : b, 0));
+        else
+            emit(I_TYPE(0x01, a, (random_u32() % 2) | ((random_u32() % 2) << 1), 0)); /* bltz, bgez, bltzl, bgezl */
+        at = code_length - 1;
+        random_instruction(0, fr);
+        for (i = 0; i < n; i++)
+            random_instruction(1, fr);
+        code[at] |= (code_length - at - 1) & 0xFFFF;
+        branch_level--;
+    } else {
+        /* COP1, with operands from integer registers or memory */
+        int fs = fpu_register(fr), ft = fpu_register(fr), fd = fpu_register(fr);
+        int o = random_u32() % 10;
+        if (o < 2) {
+            emit(R_TYPE(0x11, 4, canonical_register(), fs, 0, 0)); /* mtc1 */
+        } else if (o < 3) {
+            emit(R_TYPE(0x11, 5, any_register(), fs, 0, 0)); /* dmtc1 */
+        } else if (o < 4) {
+            emit(R_TYPE(0x11, 0, d, fs, 0, 0)); set_canonical(d, 1); /* mfc1 */
+        } else if (o < 5) {
+            emit(R_TYPE(0x11, 1, d, fs, 0, 0)); set_canonical(d, 0); /* dmfc1 */
+        } else if (o < 6) {
+            emit(I_TYPE(0x35, 29, ft, (random_u32() % 0x1000) & ~7)); /* ldc1 */
+        } else if (o < 7) {
+            emit(I_TYPE(0x3D, 29, ft, (random_u32() % 0x1000) & ~7)); /* sdc1 */
+        } else {
+            /* Arithmetic on small integers converted to float, so that the
+             * results stay finite */
+            static const int functions[] = { 0, 1, 2, 5, 6, 7 };
+            int fmt = (random_u32() % 2) ? 16 : 17;
+            emit(I_TYPE(0x09, 0, 26, random_u32() % 200));
+            emit(R_TYPE(0x11, 4, 26, fs, 0, 0));
+            emit(R_TYPE(0x11, 20, 0, fs, fs, fmt == 16 ? 0x20 : 0x21));
+            emit(I_TYPE(0x09, 0, 26, 1 + random_u32() % 200));
+            emit(R_TYPE(0x11, 4, 26, ft, 0, 0));
+            emit(R_TYPE(0x11, 20, 0, ft, ft, fmt == 16 ? 0x20 : 0x21));
+            emit(R_TYPE(0x11, fmt, ft, fs, fd, functions[random_u32() % 6]));
+            if (random_u32() % 2) {
+                /* trunc.w, mfc1 */
+                emit(R_TYPE(0x11, fmt, 0, fd, fd, 0x0D));
+                emit(R_TYPE(0x11, 0, d, fd, 0, 0));
+                set_canonical(d, 1);
+            } else {
+                /* c.cond, then bc1f or bc1t over an addiu */
+                int e = canonical_register();
+                if (e) {
+                    emit(R_TYPE(0x11, fmt, ft, fs, 0, 0x30 | (random_u32() % 16)));
+                    emit(R_TYPE(0x11, 8, random_u32() % 2, 0, 0, 2));
+                    emit(0);
+                    emit(I_TYPE(0x09, e, e, 1));
+                }
+            }
+        }
+    }
+}
+
+/* Stores the registers to the dump area, then has AI DMA play them */
+static void dump_registers(int segment)
+{
+    int r, offset = segment * 0x100;
+    emit(I_TYPE(0x0F, 0, 27, 0x5E90));
+    emit(I_TYPE(0x0D, 27, 27, segment));
+    emit(I_TYPE(0x3F, 28, 27, offset));
+    for (r = 1; r < 32; r++)
+        if (r != 26 && r != 27)
+            emit(I_TYPE(0x3F, 28, r, offset + r * 8));
+    emit(R_TYPE(0, 0, 0, 1, 0, 0x10)); emit(I_TYPE(0x3F, 28, 1, offset + 26 * 8)); /* mfhi */
+    emit(R_TYPE(0, 0, 0, 1, 0, 0x12)); emit(I_TYPE(0x3F, 28, 1, offset + 27 * 8)); /* mflo */
+    canonical[1] = lo_canonical;
+    emit(I_TYPE(0x0F, 0, 26, 0xA450));   /* lui k0, 0xa450 */
+    emit(I_TYPE(0x23, 26, 27, 0xC));     /* lw k1, 0xc(k0) */
+    emit(I_TYPE(0x01, 27, 0, -2));       /* bltz k1, -2, while the FIFO is full */
+    emit(0);
+    emit(I_TYPE(0x0F, 0, 27, 0x0030));
+    emit(I_TYPE(0x0D, 27, 27, offset));
+    emit(I_TYPE(0x2B, 26, 27, 0));       /* AI_DRAM_ADDR */
+    emit(I_TYPE(0x0D, 0, 27, 0x100));
+    emit(I_TYPE(0x2B, 26, 27, 4));       /* AI_LEN */
+}
+
+static void put32(uint8_t** p, uint32_t value)
+{
+    memcpy(*p, &value, 4);
+    *p += 4;
+}
+
+static void put64(uint8_t** p, uint64_t value)
+{
+    memcpy(*p, &value, 8);
+    *p += 8;
+}
+
+#define SAVE_STATE_SIZE (8 + 0x2754 + 0x400000)
+
+/* Builds a save state of a random program for this seed */
+static uint8_t* make_save_state(int seed)
+{
+    uint8_t* save_state = calloc(1, SAVE_STATE_SIZE);
+    uint8_t* p = save_state;
+    uint32_t* ram;
+    int i, fr = seed & 1;
+
+    random_state = 0x9E3779B97F4A7C15ull ^ (uint64_t)seed;
+    branch_level = 0;
+
+    put32(&p, 0x23D8A6C8);
+    put32(&p, 0x400000);
+    p[0x3E] = 'E';                               /* ROM header, NTSC */
+    p += 0x40;
+    put32(&p, 1000);                             /* VI timer */
+    put32(&p, 0x80001000);                       /* PC */
+    for (i = 0; i < 32; i++) {
+        canonical[i] = !i || (random_u32() & 1);
+        put64(&p, i ? (uint64_t)(int64_t)(int32_t)random_u32() ^ (canonical[i] ? 0 : ((uint64_t)random_u32() << 40)) : 0);
+    }
+    canonical[26] = canonical[27] = canonical[28] = canonical[29] = canonical[30] = 1;
+    hi_canonical = lo_canonical = 1;
+    memcpy(canonical_at_start, canonical, sizeof(canonical));
+    for (i = 0; i < 32; i++)
+        put64(&p, 0);                            /* FPRs */
+    for (i = 0; i < 32; i++)                     /* COP0: Status, Compare */
+        put32(&p, i == 12 ? (fr ? 0x34000000 : 0x30000000) : i == 11 ? 0x7FFFFFFF : 0);
+    put32(&p, 0);
+    p += 30 * 4;
+    put32(&p, 0);
+    put64(&p, 0);                                /* hi, lo */
+    put64(&p, 0);
+    p += 10 * 4;                                 /* RDRAM registers */
+    p += 10 * 4;                                 /* SP */
+    p += 10 * 4;                                 /* DPC */
+    p += 4 * 4;                                  /* MI */
+    for (i = 0; i < 14; i++)
+        put32(&p, i == 6 ? 0x20D : 0);           /* VI */
+    for (i = 0; i < 6; i++)
+        put32(&p, i == 4 ? 0x3E52239 / 32000 : 0); /* AI, DACRATE */
+    p += 13 * 4 + 8 * 4 + 4 * 4;                 /* PI, RI, SI */
+    p += 32 * 5 * 4;                             /* TLB */
+    p += 0x40;                                   /* PIF */
+
+    ram = (uint32_t*)p;
+    for (i = 0x200000 / 4; i < 0x201000 / 4; i++)
+        ram[i] = random_u32();
+    code = ram + 0x1000 / 4;
+    code_length = 0;
+    emit(I_TYPE(0x0F, 0, 29, 0x8020));           /* r29 = 0x80200000 */
+    emit(I_TYPE(0x0F, 0, 28, 0x8030));           /* r28 = 0x80300000 */
+    for (i = 0; i < SEGMENTS; i++) {
+        int n = 20 + random_u32() % 60, j;
+        for (j = 0; j < n; j++)
+            random_instruction(1, fr);
+        dump_registers(i);
+    }
+    /* The next pass has to start with the same registers canonical */
+    for (i = 1; i < 32; i++)
+        if (canonical_at_start[i] && !canonical[i])
+            emit(R_TYPE(0, 0, i, i, 0, 0));
+    if (!hi_canonical)
+        emit(R_TYPE(0, 0, 0, 0, 0, 0x11));
+    if (!lo_canonical)
+        emit(R_TYPE(0, 0, 0, 0, 0, 0x13));
+    emit(0x08000000 | (((0x80001000 & 0x0FFFFFFF) >> 2) + 2)); /* j start + 8 */
+    emit(0);
+
+    return save_state;
+}
+
+enum { RUN_PURE, RUN_DEFAULT, RUN_CHUNKED, RUN_RESTARTED, RUN_CHECKPOINTED };
+
+static void start(void* state, const uint8_t* save_state, int pure)
+{
+    usf_clear(state);
+    usf_set_trimming_mode(state, pure);
+    usf_upload_save_state(state, save_state, SAVE_STATE_SIZE);
+    usf_set_compare(state, 1);
+    usf_set_fifo_full(state, 1);
+}
+
+/* Hashes the output, or returns 0 if the core reported an error */
+static uint64_t run(const uint8_t* save_state, int how, long samples, double* seconds)
+{
+    void* state = malloc(usf_get_state_size());
+    int16_t* buffer = malloc(samples * 4);
+    void* checkpoint = malloc(usf_get_checkpoint_size());
+    uint64_t hash = 1469598103934665603ull;
+    const char* error = NULL;
+    int32_t rate;
+    clock_t t;
+    long i;
+
+    start(state, save_state, how == RUN_PURE);
+    t = clock();
+    if (how == RUN_RESTARTED) {
+        usf_render(state, buffer, 3000, &rate);
+        usf_restart(state);
+        usf_set_compare(state, 1);
+        usf_set_fifo_full(state, 1);
+    }
+    if (how == RUN_CHECKPOINTED) {
+        /* Whatever is rendered after saving a checkpoint is overwritten
+           after going back to it */
+        usf_save_checkpoint(state, checkpoint);
+        usf_render(state, buffer, 3000, &rate);
+        if (usf_restore_checkpoint(state, checkpoint) < 0)
+            error = "checkpoint not restored";
+        usf_render(state, buffer, 3000, &rate);
+        usf_save_checkpoint(state, checkpoint);
+        usf_render(state, buffer + 3000 * 2, 5000, &rate);
+        if (usf_restore_checkpoint(state, checkpoint) < 0)
+            error = "checkpoint not restored";
+        if (!error)
+            error = usf_render(state, buffer + 3000 * 2, samples - 3000, &rate);
+    } else if (how == RUN_CHUNKED) {
+        for (i = 0; i < samples && !error; i += 777)
+            error = usf_render(state, buffer + i * 2, samples - i < 777 ? samples - i : 777, &rate);
+    } else {
+        error = usf_render(state, buffer, samples, &rate);
+    }
+    if (seconds)
+        *seconds = (double)(clock() - t) / CLOCKS_PER_SEC;
+
+    for (i = 0; i < samples * 4; i++) {
+        hash ^= ((uint8_t*)buffer)[i];
+        hash *= 1099511628211ull;
+    }
+    if (error) {
+        printf("error: %s\n", error);
+        hash = 0;
+    }
+
+    usf_shutdown(state);
+    free(state);
+    free(buffer);
+    free(checkpoint);
+    return hash;
+}
+
+static int bench(void)
+{
+    double pure = 0, fast = 0;
+    int seed;
+
+    for (seed = 1; seed <= 4; seed++) {
+        uint8_t* save_state = make_save_state(seed);
+        double seconds;
+        run(save_state, RUN_PURE, BENCH_SAMPLES, &seconds);
+        pure += seconds;
+        run(save_state, RUN_DEFAULT, BENCH_SAMPLES, &seconds);
+        fast += seconds;
+        free(save_state);
+    }
+
+    printf("pure interpreter %.3f s, default core %.3f s, %.2fx\n", pure, fast, pure / fast);
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int seeds = DEFAULT_SEEDS, seed, failures = 0;
+
+    if (argc > 1 && !strcmp(argv[1], "-bench"))
+        return bench();
+    if (argc > 1)
+        seeds = atoi(argv[1]);
+
+    for (seed = 1; seed <= seeds; seed++) {
+        uint8_t* save_state = make_save_state(seed);
+        uint64_t expected = run(save_state, RUN_PURE, CHECK_SAMPLES, NULL);
+        int how;
+        for (how = RUN_DEFAULT; how <= RUN_CHECKPOINTED; how++) {
+            if (!expected || run(save_state, how, CHECK_SAMPLES, NULL) != expected) {
+                printf("seed %d: %s differs from the pure interpreter\n", seed,
+                       how == RUN_DEFAULT ? "default core" : how == RUN_CHUNKED ? "chunked rendering" :
+                       how == RUN_RESTARTED ? "restart" : "checkpoints");
+                failures++;
+                break;
+            }
+        }
+        free(save_state);
+    }
+
+    printf("%d of %d programs match\n", seeds - failures, seeds);
+    return failures ? 1 : 0;
+}
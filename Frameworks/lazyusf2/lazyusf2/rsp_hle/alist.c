@@ -63,18 +63,170 @@ static int16_t* alist_s16(struct hle_t* hle, uint16_t dmem)
     return (int16_t*)(hle->alist_buffer + ((dmem ^ S16) & 0xfff));
 }
 
+/* true when none of the n buffers of count samples partially overlap another one,
+ * in which case working on blocks of samples gives the same result as going
+ * sample by sample */
+static bool buffers_independent(const int16_t* const* buffers, size_t n, size_t count)
+{
+    size_t i, j;
+
+    for(i = 0; i < n; ++i) {
+        for(j = i + 1; j < n; ++j) {
+            if (buffers[i] != buffers[j]
+             && buffers[i] < buffers[j] + count
+             && buffers[j] < buffers[i] + count)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/* 8 samples vectors, only the operations needed by the kernels below */
+#if defined(ARCH_MIN_SSE2)
+#define ALIST_SIMD
+
+typedef __m128i v16_t;
+
+static inline v16_t v16_load(const int16_t* p)    { return _mm_loadu_si128((const __m128i*)p); }
+static inline void v16_store(int16_t* p, v16_t x) { _mm_storeu_si128((__m128i*)p, x); }
+static inline v16_t v16_set1(int16_t x)           { return _mm_set1_epi16(x); }
+static inline v16_t v16_adds(v16_t a, v16_t b)    { return _mm_adds_epi16(a, b); }
+static inline v16_t v16_xor(v16_t a, v16_t b)     { return _mm_xor_si128(a, b); }
+
+/* clamp_s16(dst + ((src * gain) >> 15)) */
+static inline v16_t v16_mix(v16_t dst, v16_t src, v16_t gain)
+{
+    const __m128i lo = _mm_mullo_epi16(src, gain);
+    const __m128i hi = _mm_mulhi_epi16(src, gain);
+
+    return _mm_packs_epi32(
+            _mm_add_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(dst, dst), 16), _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 15)),
+            _mm_add_epi32(_mm_srai_epi32(_mm_unpackhi_epi16(dst, dst), 16), _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 15)));
+}
+
+/* clamp_s16((x * gain) >> 4) */
+static inline v16_t v16_mulq44(v16_t x, v16_t gain)
+{
+    const __m128i lo = _mm_mullo_epi16(x, gain);
+    const __m128i hi = _mm_mulhi_epi16(x, gain);
+
+    return _mm_packs_epi32(
+            _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 4),
+            _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 4));
+}
+
+/* (int16_t)(((int32_t)x * (uint32_t)y) >> 16), y being unsigned */
+static inline v16_t v16_mulhi_su(v16_t x, v16_t y)
+{
+    return _mm_sub_epi16(_mm_mulhi_epu16(x, y), _mm_and_si128(_mm_srai_epi16(x, 15), y));
+}
+
+/* stores l and r the way alist_interleave does, 16 samples at dst */
+static inline void v16_interleave(uint16_t* dst, v16_t l, v16_t r)
+{
+#if M64P_BIG_ENDIAN
+    _mm_storeu_si128((__m128i*)dst,     _mm_unpacklo_epi16(l, r));
+    _mm_storeu_si128((__m128i*)dst + 1, _mm_unpackhi_epi16(l, r));
+#else
+    _mm_storeu_si128((__m128i*)dst,     _mm_shuffle_epi32(_mm_unpacklo_epi16(r, l), 0xb1));
+    _mm_storeu_si128((__m128i*)dst + 1, _mm_shuffle_epi32(_mm_unpackhi_epi16(r, l), 0xb1));
+#endif
+}
+#elif defined(ARCH_MIN_ARM_NEON)
+#define ALIST_SIMD
+
+typedef int16x8_t v16_t;
+
+static inline v16_t v16_load(const int16_t* p)    { return vld1q_s16(p); }
+static inline void v16_store(int16_t* p, v16_t x) { vst1q_s16(p, x); }
+static inline v16_t v16_set1(int16_t x)           { return vdupq_n_s16(x); }
+static inline v16_t v16_adds(v16_t a, v16_t b)    { return vqaddq_s16(a, b); }
+static inline v16_t v16_xor(v16_t a, v16_t b)     { return veorq_s16(a, b); }
+
+/* clamp_s16(dst + ((src * gain) >> 15)) */
+static inline v16_t v16_mix(v16_t dst, v16_t src, v16_t gain)
+{
+    const int32x4_t lo = vshrq_n_s32(vmull_s16(vget_low_s16(src), vget_low_s16(gain)), 15);
+    const int32x4_t hi = vshrq_n_s32(vmull_s16(vget_high_s16(src), vget_high_s16(gain)), 15);
+
+    return vcombine_s16(
+            vqmovn_s32(vaddw_s16(lo, vget_low_s16(dst))),
+            vqmovn_s32(vaddw_s16(hi, vget_high_s16(dst))));
+}
+
+/* clamp_s16((x * gain) >> 4) */
+static inline v16_t v16_mulq44(v16_t x, v16_t gain)
+{
+    return vcombine_s16(
+            vqshrn_n_s32(vmull_s16(vget_low_s16(x), vget_low_s16(gain)), 4),
+            vqshrn_n_s32(vmull_s16(vget_high_s16(x), vget_high_s16(gain)), 4));
+}
+
+/* (int16_t)(((int32_t)x * (uint32_t)y) >> 16), y being unsigned */
+static inline v16_t v16_mulhi_su(v16_t x, v16_t y)
+{
+    const uint16x8_t u = vreinterpretq_u16_s16(y);
+    const int32x4_t lo = vmulq_s32(vmovl_s16(vget_low_s16(x)), vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(u))));
+    const int32x4_t hi = vmulq_s32(vmovl_s16(vget_high_s16(x)), vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(u))));
+
+    return vcombine_s16(vshrn_n_s32(lo, 16), vshrn_n_s32(hi, 16));
+}
+
+/* stores l and r the way alist_interleave does, 16 samples at dst */
+static inline void v16_interleave(uint16_t* dst, v16_t l, v16_t r)
+{
+#if M64P_BIG_ENDIAN
+    const int16x8x2_t lr = vzipq_s16(l, r);
+
+    vst1q_s16((int16_t*)dst,     lr.val[0]);
+    vst1q_s16((int16_t*)dst + 8, lr.val[1]);
+#else
+    const int16x8x2_t rl = vzipq_s16(r, l);
+
+    vst1q_s16((int16_t*)dst,     vreinterpretq_s16_s32(vrev64q_s32(vreinterpretq_s32_s16(rl.val[0]))));
+    vst1q_s16((int16_t*)dst + 8, vreinterpretq_s16_s32(vrev64q_s32(vreinterpretq_s32_s16(rl.val[1]))));
+#endif
+}
+#endif
+
 
 static void sample_mix(int16_t* dst, int16_t src, int16_t gain)
 {
     *dst = clamp_s16(*dst + ((src * gain) >> 15));
 }
 
-static void alist_envmix_mix(size_t n, int16_t** dst, const int16_t* gains, int16_t src)
+static void envmix_gains(int16_t gains[4][8], unsigned x, int16_t l_vol, int16_t r_vol, int16_t dry, int16_t wet)
+{
+    gains[0][x] = clamp_s16((l_vol * dry + 0x4000) >> 15);
+    gains[1][x] = clamp_s16((r_vol * dry + 0x4000) >> 15);
+    gains[2][x] = clamp_s16((l_vol * wet + 0x4000) >> 15);
+    gains[3][x] = clamp_s16((r_vol * wet + 0x4000) >> 15);
+}
+
+/* mix the first len samples of an 8 samples block into the n buffers, gains
+ * being in DMEM order like the samples */
+static void alist_envmix_mix(size_t n, int16_t** dst, int16_t gains[4][8], const int16_t* src, unsigned len, bool vector)
 {
     size_t i;
+    unsigned x;
+
+#ifdef ALIST_SIMD
+    if (vector && len == 8) {
+        const v16_t v = v16_load(src);
+
+        for(i = 0; i < n; ++i)
+            v16_store(dst[i], v16_mix(v16_load(dst[i]), v, v16_load(gains[i])));
+        return;
+    }
+#endif
+
+    for(x = 0; x < len; ++x) {
+        const int16_t v = src[x^S];
 
-    for(i = 0; i < n; ++i)
-        sample_mix(dst[i], src, gains[i]);
+        for(i = 0; i < n; ++i)
+            sample_mix(dst[i] + (x^S), v, gains[i][x^S]);
+    }
 }
 
 static int16_t ramp_step(struct ramp_t* ramp)
@@ -240,6 +392,15 @@ void alist_interleave(struct hle_t* hle, uint16_t dmemo, uint16_t left, uint16_t
 
     count >>= 2;
 
+#ifdef ALIST_SIMD
+    /* dst is written twice as fast as the sources are read */
+    if ((dst + 4 * count <= srcL || srcL + 2 * count <= dst)
+     && (dst + 4 * count <= srcR || srcR + 2 * count <= dst)) {
+        for(; count >= 4; count -= 4, dst += 16, srcL += 8, srcR += 8)
+            v16_interleave(dst, v16_load((const int16_t*)srcL), v16_load((const int16_t*)srcR));
+    }
+#endif
+
     while(count != 0) {
         uint16_t l1 = *(srcL++);
         uint16_t l2 = *(srcL++);
@@ -282,11 +443,16 @@ void alist_envmix_exp(
     int16_t* const dr = (int16_t*)(hle->alist_buffer + dmem_dr);
     int16_t* const wl = (int16_t*)(hle->alist_buffer + dmem_wl);
     int16_t* const wr = (int16_t*)(hle->alist_buffer + dmem_wr);
+    const int16_t* const buffers_used[5] = { in, dl, dr, wl, wr };
 
     struct ramp_t ramps[2];
     int32_t exp_seq[2];
     int32_t exp_rates[2];
 
+    int16_t  gains[4][8];
+    int16_t* buffers[4];
+    bool vector;
+
     uint32_t ptr = 0;
     int x, y;
     short save_buffer[40];
@@ -318,6 +484,8 @@ void alist_envmix_exp(
     ramps[0].step = ramps[0].target - ramps[0].value;
     ramps[1].step = ramps[1].target - ramps[1].value;
 
+    vector = buffers_independent(buffers_used, n + 1, ((count + 15) >> 4) << 3);
+
     for (y = 0; y < count; y += 16) {
 
         if (ramps[0].step != 0)
@@ -332,25 +500,20 @@ void alist_envmix_exp(
             ramps[1].step = (exp_seq[1] - ramps[1].value) >> 3;
         }
 
+        buffers[0] = dl + ptr;
+        buffers[1] = dr + ptr;
+        buffers[2] = wl + ptr;
+        buffers[3] = wr + ptr;
+
         for (x = 0; x < 8; ++x) {
-            int16_t  gains[4];
-            int16_t* buffers[4];
             int16_t l_vol = ramp_step(&ramps[0]);
             int16_t r_vol = ramp_step(&ramps[1]);
 
-            buffers[0] = dl + (ptr^S);
-            buffers[1] = dr + (ptr^S);
-            buffers[2] = wl + (ptr^S);
-            buffers[3] = wr + (ptr^S);
-
-            gains[0] = clamp_s16((l_vol * dry + 0x4000) >> 15);
-            gains[1] = clamp_s16((r_vol * dry + 0x4000) >> 15);
-            gains[2] = clamp_s16((l_vol * wet + 0x4000) >> 15);
-            gains[3] = clamp_s16((r_vol * wet + 0x4000) >> 15);
-
-            alist_envmix_mix(n, buffers, gains, in[ptr^S]);
-            ++ptr;
+            envmix_gains(gains, x^S, l_vol, r_vol, dry, wet);
         }
+
+        alist_envmix_mix(n, buffers, gains, in + ptr, 8, vector);
+        ptr += 8;
     }
 
     *(int16_t *)(save_buffer +  0) = wet;               /* 0-1 */
@@ -379,14 +542,16 @@ void alist_envmix_ge(
         const int32_t *rate,
         uint32_t address)
 {
-    unsigned k;
+    unsigned k, x;
     size_t n = (aux) ? 4 : 2;
+    bool vector;
 
     const int16_t* const in = (int16_t*)(hle->alist_buffer + dmemi);
     int16_t* const dl = (int16_t*)(hle->alist_buffer + dmem_dl);
     int16_t* const dr = (int16_t*)(hle->alist_buffer + dmem_dr);
     int16_t* const wl = (int16_t*)(hle->alist_buffer + dmem_wl);
     int16_t* const wr = (int16_t*)(hle->alist_buffer + dmem_wr);
+    const int16_t* const buffers_used[5] = { in, dl, dr, wl, wr };
 
     struct ramp_t ramps[2];
     short save_buffer[40];
@@ -413,23 +578,26 @@ void alist_envmix_ge(
     }
 
     count >>= 1;
-    for (k = 0; k < count; ++k) {
-        int16_t  gains[4];
+    vector = buffers_independent(buffers_used, n + 1, count);
+
+    for (k = 0; k < count; k += 8) {
+        int16_t  gains[4][8];
         int16_t* buffers[4];
-        int16_t l_vol = ramp_step(&ramps[0]);
-        int16_t r_vol = ramp_step(&ramps[1]);
+        unsigned len = (count - k < 8) ? count - k : 8;
 
-        buffers[0] = dl + (k^S);
-        buffers[1] = dr + (k^S);
-        buffers[2] = wl + (k^S);
-        buffers[3] = wr + (k^S);
+        buffers[0] = dl + k;
+        buffers[1] = dr + k;
+        buffers[2] = wl + k;
+        buffers[3] = wr + k;
 
-        gains[0] = clamp_s16((l_vol * dry + 0x4000) >> 15);
-        gains[1] = clamp_s16((r_vol * dry + 0x4000) >> 15);
-        gains[2] = clamp_s16((l_vol * wet + 0x4000) >> 15);
-        gains[3] = clamp_s16((r_vol * wet + 0x4000) >> 15);
+        for (x = 0; x < len; ++x) {
+            int16_t l_vol = ramp_step(&ramps[0]);
+            int16_t r_vol = ramp_step(&ramps[1]);
 
-        alist_envmix_mix(n, buffers, gains, in[k^S]);
+            envmix_gains(gains, x^S, l_vol, r_vol, dry, wet);
+        }
+
+        alist_envmix_mix(n, buffers, gains, in + k, len, vector);
     }
 
     *(int16_t *)(save_buffer +  0) = wet;               /* 0-1 */
@@ -458,6 +626,8 @@ void alist_envmix_lin(
         uint32_t address)
 {
     size_t k;
+    unsigned x;
+    bool vector;
     struct ramp_t ramps[2];
     int16_t save_buffer[40];
 
@@ -466,6 +636,7 @@ void alist_envmix_lin(
     int16_t* const dr = (int16_t*)(hle->alist_buffer + dmem_dr);
     int16_t* const wl = (int16_t*)(hle->alist_buffer + dmem_wl);
     int16_t* const wr = (int16_t*)(hle->alist_buffer + dmem_wr);
+    const int16_t* const buffers_used[5] = { in, dl, dr, wl, wr };
 
     memcpy((uint8_t *)save_buffer, hle->dram + address, 80);
     if (init) {
@@ -488,23 +659,26 @@ void alist_envmix_lin(
     }
 
     count >>= 1;
-    for(k = 0; k < count; ++k) {
-        int16_t  gains[4];
+    vector = buffers_independent(buffers_used, 5, count);
+
+    for(k = 0; k < count; k += 8) {
+        int16_t  gains[4][8];
         int16_t* buffers[4];
-        int16_t l_vol = ramp_step(&ramps[0]);
-        int16_t r_vol = ramp_step(&ramps[1]);
+        unsigned len = (count - k < 8) ? count - k : 8;
+
+        buffers[0] = dl + k;
+        buffers[1] = dr + k;
+        buffers[2] = wl + k;
+        buffers[3] = wr + k;
 
-        buffers[0] = dl + (k^S);
-        buffers[1] = dr + (k^S);
-        buffers[2] = wl + (k^S);
-        buffers[3] = wr + (k^S);
+        for (x = 0; x < len; ++x) {
+            int16_t l_vol = ramp_step(&ramps[0]);
+            int16_t r_vol = ramp_step(&ramps[1]);
 
-        gains[0] = clamp_s16((l_vol * dry + 0x4000) >> 15);
-        gains[1] = clamp_s16((r_vol * dry + 0x4000) >> 15);
-        gains[2] = clamp_s16((l_vol * wet + 0x4000) >> 15);
-        gains[3] = clamp_s16((r_vol * wet + 0x4000) >> 15);
+            envmix_gains(gains, x^S, l_vol, r_vol, dry, wet);
+        }
 
-        alist_envmix_mix(4, buffers, gains, in[k^S]);
+        alist_envmix_mix(4, buffers, gains, in + k, len, vector);
     }
 
     *(int16_t *)(save_buffer +  0) = wet;            /* 0-1 */
@@ -543,6 +717,44 @@ void alist_envmix_nead(
     if (swap_wet_LR)
         swap(&wl, &wr);
 
+#ifdef ALIST_SIMD
+    {
+        const int16_t* const buffers_used[5] = { in, dl, dr, wl, wr };
+
+        if (buffers_independent(buffers_used, 5, count)) {
+            const v16_t xl  = v16_set1(xors[0]);
+            const v16_t xr  = v16_set1(xors[1]);
+            const v16_t xl2 = v16_set1(xors[2]);
+            const v16_t xr2 = v16_set1(xors[3]);
+
+            while (count != 0) {
+                const v16_t v = v16_load(in);
+                const v16_t l  = v16_xor(v16_mulhi_su(v, v16_set1(env_values[0])), xl);
+                const v16_t r  = v16_xor(v16_mulhi_su(v, v16_set1(env_values[1])), xr);
+                const v16_t l2 = v16_xor(v16_mulhi_su(l, v16_set1(env_values[2])), xl2);
+                const v16_t r2 = v16_xor(v16_mulhi_su(r, v16_set1(env_values[2])), xr2);
+
+                v16_store(dl, v16_adds(v16_load(dl), l));
+                v16_store(dr, v16_adds(v16_load(dr), r));
+                v16_store(wl, v16_adds(v16_load(wl), l2));
+                v16_store(wr, v16_adds(v16_load(wr), r2));
+
+                env_values[0] += env_steps[0];
+                env_values[1] += env_steps[1];
+                env_values[2] += env_steps[2];
+
+                dl += 8;
+                dr += 8;
+                wl += 8;
+                wr += 8;
+                in += 8;
+                count -= 8;
+            }
+            return;
+        }
+    }
+#endif
+
     while (count != 0) {
         size_t i;
         for(i = 0; i < 8; ++i) {
@@ -578,6 +790,16 @@ void alist_mix(struct hle_t* hle, uint16_t dmemo, uint16_t dmemi, uint16_t count
 
     count >>= 1;
 
+#ifdef ALIST_SIMD
+    /* src is read ahead of dst, which is only safe if src doesn't trail it */
+    if (src >= dst || src + count <= dst) {
+        const v16_t g = v16_set1(gain);
+
+        for(; count >= 8; count -= 8, dst += 8, src += 8)
+            v16_store(dst, v16_mix(v16_load(dst), v16_load(src), g));
+    }
+#endif
+
     while(count != 0) {
         sample_mix(dst, *src, gain);
 
@@ -593,6 +815,15 @@ void alist_multQ44(struct hle_t* hle, uint16_t dmem, uint16_t count, int8_t gain
 
     count >>= 1;
 
+#ifdef ALIST_SIMD
+    {
+        const v16_t g = v16_set1(gain);
+
+        for(; count >= 8; count -= 8, dst += 8)
+            v16_store(dst, v16_mulq44(v16_load(dst), g));
+    }
+#endif
+
     while(count != 0) {
         *dst = clamp_s16(*dst * gain >> 4);
 
@@ -608,6 +839,14 @@ void alist_add(struct hle_t* hle, uint16_t dmemo, uint16_t dmemi, uint16_t count
 
     count >>= 1;
 
+#ifdef ALIST_SIMD
+    /* src is read ahead of dst, which is only safe if src doesn't trail it */
+    if (src >= dst || src + count <= dst) {
+        for(; count >= 8; count -= 8, dst += 8, src += 8)
+            v16_store(dst, v16_adds(v16_load(dst), v16_load(src)));
+    }
+#endif
+
     while(count != 0) {
         *dst = clamp_s16(*dst + *src);
 
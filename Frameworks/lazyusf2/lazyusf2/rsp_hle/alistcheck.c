@@ -0,0 +1,297 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *   Mupen64plus-rsp-hle - alistcheck.c                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.          *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Replays a random stream of audio list commands and hashes the DMEM, DRAM
+ * and envelope state after every one of them, to check the vector paths of
+ * alist.c and audio.c against the scalar code they were written from.
+ * Buffers are placed so that they often overlap, and gains, envelopes,
+ * codebooks and pitches are random, with the extremes favoured.
+ *
+ * Not part of any target. Build it on its own, from this directory:
+ *
+ *   cc -O2 alistcheck.c alist.c audio.c memory.c -o alistcheck
+ *
+ * and add -U__SSE2__ for the scalar code. Every build has to print the hash
+ * the scalar code gave before the vector paths were added, which is checked
+ * for the default command count. "alistcheck -bench" times each command on
+ * a fixed set of buffers instead.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "alist.h"
+#include "audio.h"
+#include "hle_internal.h"
+
+#define DEFAULT_COMMANDS 20000
+#define EXPECTED_HASH 0xf335253de9450ac6ull
+
+void HleWarnMessage(void* user_defined, const char* message, ...) {}
+void HleVerboseMessage(void* user_defined, const char* message, ...) {}
+
+static struct hle_t hle;
+static uint8_t dram[0x20000];
+
+static uint64_t random_state = 88172645463325252ull;
+static uint64_t hash = 1469598103934665603ull;
+
+static uint32_t random_u32(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+    return (uint32_t)random_state;
+}
+
+static void hash_bytes(const void* data, size_t size)
+{
+    const uint8_t* bytes = data;
+
+    while (size--) {
+        hash ^= *bytes++;
+        hash *= 1099511628211ull;
+    }
+}
+
+/* DMEM offset in bytes, often inside a small window so that buffers overlap */
+static uint16_t random_offset(unsigned max_length)
+{
+    unsigned base;
+
+    switch (random_u32() % 4) {
+    case 0: base = (random_u32() % 0x40) * 16; break;
+    case 1: base = 0x400 + (random_u32() % 0x20) * 2; break;
+    case 2: base = (random_u32() % 0x100) * 4; break;
+    default: base = (random_u32() % 0x800) & ~1u; break;
+    }
+
+    if (base + max_length > 0x1000)
+        base = (0x1000 - max_length) & ~15u;
+
+    return base;
+}
+
+static int16_t random_s16(void)
+{
+    switch (random_u32() % 4) {
+    case 0: return (int16_t)0x8000;
+    case 1: return 0x7fff;
+    default: return (int16_t)random_u32();
+    }
+}
+
+static void run_envmix(unsigned command)
+{
+    int16_t vol[2], target[2];
+    int32_t rate[2];
+    uint32_t address;
+    uint16_t count, in, dry_left, dry_right, wet_left, wet_right;
+    bool init;
+
+    vol[0] = random_s16();
+    vol[1] = random_s16();
+    target[0] = random_s16();
+    target[1] = random_s16();
+    rate[0] = (int32_t)random_u32() >> (random_u32() % 24);
+    rate[1] = (int32_t)random_u32() >> (random_u32() % 24);
+    address = (random_u32() % 0x1000) * 8;
+    init = random_u32() & 1;
+    count = (random_u32() % 0x100) * 2 + ((command == 4) ? 0 : (random_u32() & 1) * 2);
+
+    in = random_offset(count + 16);
+    dry_left = random_offset(count + 16);
+    dry_right = random_offset(count + 16);
+    wet_left = random_offset(count + 16);
+    wet_right = random_offset(count + 16);
+
+    if (command == 4)
+        alist_envmix_exp(&hle, init, random_u32() & 1, in, dry_left, dry_right, wet_left, wet_right, count, random_s16(), random_s16(), vol, target, rate, address);
+    else if (command == 5)
+        alist_envmix_ge(&hle, init, random_u32() & 1, in, dry_left, dry_right, wet_left, wet_right, count, random_s16(), random_s16(), vol, target, rate, address);
+    else
+        alist_envmix_lin(&hle, init, in, dry_left, dry_right, wet_left, wet_right, count, random_s16(), random_s16(), vol, target, rate, address);
+}
+
+static void run_command(void)
+{
+    unsigned command = random_u32() % 11;
+    uint16_t count;
+    int i;
+
+    if (random_u32() % 8 == 0) {
+        for (i = 0; i < 0x1000; ++i)
+            hle.alist_buffer[i] = (random_u32() & 1) ? 0x7f : random_u32();
+    }
+
+    switch (command) {
+    case 0:
+        count = (random_u32() % 0x200) * 2;
+        alist_mix(&hle, random_offset(count), random_offset(count), count, random_s16());
+        break;
+    case 1:
+        count = (random_u32() % 0x200) * 2;
+        alist_multQ44(&hle, random_offset(count), count, (int8_t)random_u32());
+        break;
+    case 2:
+        count = (random_u32() % 0x200) * 2;
+        alist_add(&hle, random_offset(count), random_offset(count), count);
+        break;
+    case 3:
+        count = (random_u32() % 0x100) * 4;
+        alist_interleave(&hle, random_offset(2 * count), random_offset(count), random_offset(count), count);
+        break;
+    case 4:
+    case 5:
+    case 6:
+        run_envmix(command);
+        break;
+    case 7: {
+        uint16_t env_values[3], env_steps[3];
+        int16_t xors[4];
+        unsigned n = (random_u32() % 0x40) * 8;
+
+        for (i = 0; i < 3; ++i) {
+            env_values[i] = random_u32();
+            env_steps[i] = random_u32() >> (random_u32() % 16);
+        }
+        for (i = 0; i < 4; ++i)
+            xors[i] = (random_u32() & 1) ? 0 : (random_u32() & 1) ? -1 : (int16_t)random_u32();
+
+        alist_envmix_nead(&hle, random_u32() & 1, random_offset(2 * n), random_offset(2 * n), random_offset(2 * n), random_offset(2 * n), random_offset(2 * n), n, env_values, env_steps, xors);
+        hash_bytes(env_values, sizeof(env_values));
+        break;
+    }
+    case 8: {
+        uint16_t dmemi = 8 + (random_u32() % 0x7fc) * 2;
+        uint16_t dmemo;
+
+        count = (random_u32() % 0x100) * 2;
+        if (random_u32() % 4 == 0)
+            dmemi = 0xfe0 + (random_u32() % 0x10) * 2;
+        dmemo = random_offset(count);
+        alist_resample(&hle, random_u32() & 1, false, dmemo, dmemi, count, random_u32() % 0x40000, (random_u32() % 0x1000) * 8);
+        break;
+    }
+    case 9: {
+        int16_t codebook[256];
+
+        for (i = 0; i < 256; ++i)
+            codebook[i] = random_s16();
+        count = (random_u32() % 16) * 32;
+        alist_adpcm(&hle, random_u32() & 1, random_u32() & 1, random_u32() & 1, random_offset(2 * count + 32), random_offset(count), count, codebook, (random_u32() % 0x1000) * 8, (random_u32() % 0x1000) * 8);
+        break;
+    }
+    case 10: {
+        int16_t dst[8], src[8], codebook[16], last[2];
+        size_t n = (random_u32() & 1) ? 8 : random_u32() % 9;
+
+        for (i = 0; i < 8; ++i)
+            src[i] = random_s16();
+        for (i = 0; i < 16; ++i)
+            codebook[i] = random_s16();
+        last[0] = random_s16();
+        last[1] = random_s16();
+        memset(dst, 0, sizeof(dst));
+        adpcm_compute_residuals(dst, src, codebook, last, n);
+        hash_bytes(dst, sizeof(dst));
+        break;
+    }
+    }
+
+    hash_bytes(hle.alist_buffer, 0x1000);
+    hash_bytes(&hle.alist_audio, sizeof(hle.alist_audio));
+    hash_bytes(dram, sizeof(dram));
+}
+
+static double now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+#define BENCH_CALLS 200000
+#define BENCH(name, call) \
+    do { \
+        double start = now(); \
+        for (i = 0; i < BENCH_CALLS; ++i) { call; } \
+        printf("%-10s %6.1f ns\n", name, (now() - start) * 1e9 / BENCH_CALLS); \
+    } while (0)
+
+static int bench(void)
+{
+    int16_t vol[2] = { 0x4000, 0x3000 }, target[2] = { 0x7000, 0x1000 };
+    int32_t rate[2] = { 0x10000, 0x8000 };
+    uint16_t env_values[3] = { 0x8000, 0x7000, 0x6000 }, env_steps[3] = { 1, 2, 3 };
+    int16_t xors[4] = { 0, -1, 0, -1 };
+    int16_t codebook[256];
+    int i;
+
+    for (i = 0; i < 256; ++i)
+        codebook[i] = i * 37 - 2000;
+    for (i = 0; i < 0x1000; ++i)
+        hle.alist_buffer[i] = i * 7;
+
+    BENCH("mix", alist_mix(&hle, 0x000, 0x200, 0x170, 0x5000));
+    BENCH("add", alist_add(&hle, 0x000, 0x200, 0x170));
+    BENCH("multQ44", alist_multQ44(&hle, 0x000, 0x170, 0x12));
+    BENCH("interleave", alist_interleave(&hle, 0x400, 0x000, 0x200, 0x170));
+    BENCH("env_ge", alist_envmix_ge(&hle, i & 1, 1, 0x000, 0x200, 0x400, 0x600, 0x800, 0x170, 0x5000, 0x3000, vol, target, rate, 0x100));
+    BENCH("env_exp", alist_envmix_exp(&hle, i & 1, 1, 0x000, 0x200, 0x400, 0x600, 0x800, 0x170, 0x5000, 0x3000, vol, target, rate, 0x100));
+    BENCH("env_nead", alist_envmix_nead(&hle, 0, 0x000, 0x200, 0x400, 0x600, 0x800, 0xb8, env_values, env_steps, xors));
+    BENCH("resample", alist_resample(&hle, 1, 0, 0x000, 0x400, 0x170, 0xc000, 0x200));
+    BENCH("adpcm", alist_adpcm(&hle, 1, 0, 0, 0x800, 0x000, 0x100, codebook, 0x300, 0x400));
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int commands = DEFAULT_COMMANDS;
+    int i;
+
+    hle.dram = dram;
+
+    if (argc > 1 && !strcmp(argv[1], "-bench"))
+        return bench();
+    if (argc > 1)
+        commands = atoi(argv[1]);
+
+    for (i = 0; i < 0x1000; ++i)
+        hle.alist_buffer[i] = random_u32();
+    for (i = 0; i < (int)sizeof(dram); ++i)
+        dram[i] = random_u32();
+
+    for (i = 0; i < commands; ++i)
+        run_command();
+
+    printf("%016llx\n", (unsigned long long)hash);
+
+    if (commands == DEFAULT_COMMANDS && hash != EXPECTED_HASH) {
+        printf("expected %016llx\n", (unsigned long long)EXPECTED_HASH);
+        return 1;
+    }
+
+    return 0;
+}
@@ -24,6 +24,17 @@
 
 #include <stdint.h>
 
+/*
+ * SIMD paths of the audio kernels, selected the same way as in rsp_lle
+ */
+#if defined(__aarch64__)
+#define ARCH_MIN_ARM_NEON 1
+#include <arm_neon.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#define ARCH_MIN_SSE2 1
+#include <emmintrin.h>
+#endif
+
 #include "common.h"
 
 static inline int16_t clamp_s16(int_fast32_t x)
@@ -106,6 +106,21 @@ int32_t rdot(size_t n, const int16_t *x, const int16_t *y)
     return accu;
 }
 
+#if defined(ARCH_MIN_SSE2)
+/* adds c0 * x[0] + c1 * x[1], x holding the same pair of samples in each lane */
+static inline void residual_taps_sse2(__m128i* lo, __m128i* hi, __m128i c0, __m128i c1, __m128i x)
+{
+    *lo = _mm_add_epi32(*lo, _mm_madd_epi16(_mm_unpacklo_epi16(c0, c1), x));
+    *hi = _mm_add_epi32(*hi, _mm_madd_epi16(_mm_unpackhi_epi16(c0, c1), x));
+}
+#elif defined(ARCH_MIN_ARM_NEON)
+static inline void residual_tap_neon(int32x4_t* lo, int32x4_t* hi, int16x8_t c, int16_t x)
+{
+    *lo = vmlal_n_s16(*lo, vget_low_s16(c), x);
+    *hi = vmlal_n_s16(*hi, vget_high_s16(c), x);
+}
+#endif
+
 void adpcm_compute_residuals(int16_t* dst, const int16_t* src,
         const int16_t* cb_entry, const int16_t* last_samples, size_t count)
 {
@@ -119,6 +134,53 @@ void adpcm_compute_residuals(int16_t* dst, const int16_t* src,
 
     assert(count <= 8);
 
+#if defined(ARCH_MIN_SSE2)
+    if (count == 8) {
+        /* accumulate in 32 bits, book2 shifted by j + 1 samples applying to src[j] */
+        const __m128i x  = _mm_loadu_si128((const __m128i*)src);
+        const __m128i b1 = _mm_loadu_si128((const __m128i*)book1);
+        const __m128i b2 = _mm_loadu_si128((const __m128i*)book2);
+        const __m128i last = _mm_set1_epi32((uint16_t)l1 | ((uint32_t)(uint16_t)l2 << 16));
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), x), 16 - 11);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(_mm_setzero_si128(), x), 16 - 11);
+
+        lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(b1, b2), last));
+        hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(b1, b2), last));
+
+        residual_taps_sse2(&lo, &hi, _mm_slli_si128(b2, 2), _mm_slli_si128(b2, 4), _mm_shuffle_epi32(x, 0x00));
+        residual_taps_sse2(&lo, &hi, _mm_slli_si128(b2, 6), _mm_slli_si128(b2, 8), _mm_shuffle_epi32(x, 0x55));
+        residual_taps_sse2(&lo, &hi, _mm_slli_si128(b2, 10), _mm_slli_si128(b2, 12), _mm_shuffle_epi32(x, 0xaa));
+        residual_taps_sse2(&lo, &hi, _mm_slli_si128(b2, 14), _mm_setzero_si128(), _mm_shuffle_epi32(x, 0xff));
+
+        _mm_storeu_si128((__m128i*)dst, _mm_packs_epi32(_mm_srai_epi32(lo, 11), _mm_srai_epi32(hi, 11)));
+        return;
+    }
+#elif defined(ARCH_MIN_ARM_NEON)
+    if (count == 8) {
+        /* accumulate in 32 bits, book2 shifted by j + 1 samples applying to src[j] */
+        const int16x8_t b1 = vld1q_s16(book1);
+        const int16x8_t b2 = vld1q_s16(book2);
+        const int16x8_t zero = vdupq_n_s16(0);
+        const int16x8_t x = vld1q_s16(src);
+        int32x4_t lo = vshll_n_s16(vget_low_s16(x), 11);
+        int32x4_t hi = vshll_n_s16(vget_high_s16(x), 11);
+
+        lo = vmlal_n_s16(vmlal_n_s16(lo, vget_low_s16(b1), l1), vget_low_s16(b2), l2);
+        hi = vmlal_n_s16(vmlal_n_s16(hi, vget_high_s16(b1), l1), vget_high_s16(b2), l2);
+
+        residual_tap_neon(&lo, &hi, vextq_s16(zero, b2, 7), src[0]);
+        residual_tap_neon(&lo, &hi, vextq_s16(zero, b2, 6), src[1]);
+        residual_tap_neon(&lo, &hi, vextq_s16(zero, b2, 5), src[2]);
+        residual_tap_neon(&lo, &hi, vextq_s16(zero, b2, 4), src[3]);
+        residual_tap_neon(&lo, &hi, vextq_s16(zero, b2, 3), src[4]);
+        residual_tap_neon(&lo, &hi, vextq_s16(zero, b2, 2), src[5]);
+        residual_tap_neon(&lo, &hi, vextq_s16(zero, b2, 1), src[6]);
+
+        vst1q_s16(dst, vcombine_s16(vqshrn_n_s32(lo, 11), vqshrn_n_s32(hi, 11)));
+        return;
+    }
+#endif
+
     for(i = 0; i < count; ++i) {
         int32_t accu = (int32_t)src[i] << 11;
         accu += book1[i]*l1 + book2[i]*l2 + rdot(i, book2, src);
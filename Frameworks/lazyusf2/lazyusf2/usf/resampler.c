@@ -62,6 +62,11 @@ void * resampler_dup(const void * _r)
     return r_out;
 }
 
+size_t resampler_get_size(void)
+{
+    return sizeof(resampler);
+}
+
 void resampler_dup_inplace(void *_d, const void *_s)
 {
     const resampler * r_in = ( const resampler * ) _s;
@@ -432,6 +432,21 @@ void usf_restart(void * state)
     resampler_clear(USF_STATE->resampler);
 }
 
+size_t usf_get_checkpoint_size(void)
+{
+    return savestates_get_checkpoint_size();
+}
+
+void usf_save_checkpoint(void * state, void * checkpoint)
+{
+    savestates_save_checkpoint(USF_STATE, (unsigned char *) checkpoint);
+}
+
+int usf_restore_checkpoint(void * state, const void * checkpoint)
+{
+    return savestates_load_checkpoint(USF_STATE, (const unsigned char *) checkpoint) ? 0 : -1;
+}
+
 void usf_shutdown(void * state)
 {
     r4300_end(USF_STATE);
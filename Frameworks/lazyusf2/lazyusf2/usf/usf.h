@@ -84,6 +84,20 @@ const char * usf_render_resampled(void * state, int16_t * buffer, size_t count,
    discards any buffered sample data. */
 void usf_restart(void * state);
 
+/* Returns the size of a checkpoint, which holds the whole running emulator,
+   including buffered sample data, at the point it was saved. */
+size_t usf_get_checkpoint_size(void);
+
+/* Saves a checkpoint between usf_render calls, or before the first one.
+   Restoring it continues emulation from that point, as if nothing had been
+   rendered since. A checkpoint can only be restored into the same state it
+   was saved from, as it contains pointers into that state, and not after
+   usf_shutdown. Not supported in trimming mode.
+   Restoring returns -1 on failure, leaving the state untouched, or 0 on
+   success. */
+void usf_save_checkpoint(void * state, void * checkpoint);
+int usf_restore_checkpoint(void * state, const void * checkpoint);
+
 /* Frees all allocated memory associated with the emulator state. Necessary
    after at least one call to usf_render, or else the memory will be leaked. */
 void usf_shutdown(void * state);
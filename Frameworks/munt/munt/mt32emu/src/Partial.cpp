@@ -40,6 +40,8 @@ Partial::Partial(Synth *useSynth, int useDebugPartialNum) :
 	ownerPart = -1;
 	poly = NULL;
 	pair = NULL;
+	deactivationDeferred = false;
+	pairUnlinkDeferred = false;
 }
 
 Partial::~Partial() {
@@ -81,23 +83,50 @@ void Partial::deactivate() {
 	}
 	ownerPart = -1;
 	if (poly != NULL) {
-		poly->partialDeactivated(this);
+		if (synth->isRenderingPartialsConcurrently()) {
+			deactivationDeferred = true;
+		} else {
+			poly->partialDeactivated(this);
+		}
 	}
 #if MT32EMU_MONITOR_PARTIALS > 2
 	synth->printDebug("[+%lu] [Partial %d] Deactivated", sampleNum, debugPartialNum);
 	synth->printPartialUsage(sampleNum);
 #endif
 	if (isRingModulatingSlave()) {
+		// The master renders this partial, so it's on the same thread and may be unlinked right away
 		pair->la32Pair.deactivate(LA32PartialPair::SLAVE);
-	} else {
-		la32Pair.deactivate(LA32PartialPair::MASTER);
-		if (hasRingModulatingSlave()) {
-			pair->deactivate();
-			pair = NULL;
-		}
+		pair->pair = NULL;
+		return;
+	}
+	la32Pair.deactivate(LA32PartialPair::MASTER);
+	if (hasRingModulatingSlave()) {
+		pair->deactivate();
+		pair = NULL;
 	}
 	if (pair != NULL) {
-		pair->pair = NULL;
+		if (synth->isRenderingPartialsConcurrently()) {
+			// An independently mixed pair partial may be rendered by another group, which reads its pair meanwhile
+			pairUnlinkDeferred = true;
+		} else {
+			pair->pair = NULL;
+		}
+	}
+}
+
+void Partial::flushDeferredDeactivation() {
+	if (pairUnlinkDeferred) {
+		pairUnlinkDeferred = false;
+		if (pair != NULL) {
+			pair->pair = NULL;
+		}
+	}
+	if (!deactivationDeferred) {
+		return;
+	}
+	deactivationDeferred = false;
+	if (poly != NULL) {
+		poly->partialDeactivated(this);
 	}
 }
 
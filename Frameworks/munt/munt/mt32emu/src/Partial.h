@@ -67,6 +67,12 @@ private:
 	const PatchCache *patchCache;
 	PatchCache cachebackup;
 
+	// Set when the partial was deactivated while partials were being rendered concurrently.
+	// The poly is informed later by flushDeferredDeactivation() on the rendering thread.
+	bool deactivationDeferred;
+	// Likewise, unlinking an independently mixed pair partial is left to flushDeferredDeactivation().
+	bool pairUnlinkDeferred;
+
 	Bit32u getAmpValue();
 	Bit32u getCutoffValue();
 
@@ -84,6 +90,7 @@ public:
 	bool isActive() const;
 	void activate(int part);
 	void deactivate(void);
+	void flushDeferredDeactivation();
 	void startPartial(const Part *part, Poly *usePoly, const PatchCache *useCache, const MemParams::RhythmTemp *rhythmTemp, Partial *pairPartial);
 	void startAbort();
 	void startDecayAll();
@@ -50,6 +50,13 @@ void PartialManager::clearAlreadyOutputed() {
 	}
 }
 
+// Informs polys about partials deactivated during concurrent rendering, in partial index order.
+void PartialManager::flushDeferredDeactivations() {
+	for (unsigned int i = 0; i < synth->getPartialCount(); i++) {
+		partialTable[i]->flushDeferredDeactivation();
+	}
+}
+
 bool PartialManager::shouldReverb(int i) {
 	return partialTable[i]->shouldReverb();
 }
@@ -46,6 +46,7 @@ public:
 	bool produceOutput(int i, Sample *leftBuf, Sample *rightBuf, Bit32u bufferLength);
 	bool shouldReverb(int i);
 	void clearAlreadyOutputed();
+	void flushDeferredDeactivations();
 	const Partial *getPartial(unsigned int partialNum) const;
 	Poly *assignPolyToPart(Part *part);
 	void polyFreed(Poly *poly);
@@ -0,0 +1,196 @@
+/* Copyright (C) 2003, 2004, 2005, 2006, 2008, 2009 Dean Beeler, Jerome Fisher
+ * Copyright (C) 2011, 2012, 2013, 2014 Dean Beeler, Jerome Fisher, Sergey V. Mikayev
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 2.1 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mt32emu.h"
+#include "internals.h"
+#include "PartialManager.h"
+#include "PartialRenderer.h"
+
+namespace MT32Emu {
+
+PartialRenderer::PartialRenderer(Synth &useSynth, PartialManager &usePartialManager, unsigned int useThreadCount) :
+	synth(useSynth), partialManager(usePartialManager), threadCount(useThreadCount),
+	jobGeneration(0), pendingGroups(0), quit(false), groupCount(0), runLength(0), rendering(false) {
+	entries.reserve(synth.getPartialCount());
+	groups = new Group[threadCount];
+	// Group 0 is rendered straight into the buses provided by the caller, the others need private buses
+	groupBuffers = new Sample[(threadCount - 1) * 4 * MAX_SAMPLES_PER_RUN];
+	for (unsigned int groupIx = 0; groupIx < threadCount; groupIx++) {
+		Group &group = groups[groupIx];
+		group.firstEntry = 0;
+		group.entryCount = 0;
+		if (groupIx == 0) {
+			group.nonReverbLeft = group.nonReverbRight = group.reverbDryLeft = group.reverbDryRight = NULL;
+			continue;
+		}
+		Sample *buffers = groupBuffers + (groupIx - 1) * 4 * MAX_SAMPLES_PER_RUN;
+		group.nonReverbLeft = buffers;
+		group.nonReverbRight = buffers + MAX_SAMPLES_PER_RUN;
+		group.reverbDryLeft = buffers + 2 * MAX_SAMPLES_PER_RUN;
+		group.reverbDryRight = buffers + 3 * MAX_SAMPLES_PER_RUN;
+	}
+	for (unsigned int groupIx = 1; groupIx < threadCount; groupIx++) {
+		workers.push_back(std::thread(&PartialRenderer::workerLoop, this, groupIx));
+	}
+}
+
+PartialRenderer::~PartialRenderer() {
+	{
+		std::lock_guard<std::mutex> lock(jobMutex);
+		quit = true;
+	}
+	jobStarted.notify_all();
+	for (size_t i = 0; i < workers.size(); i++) {
+		workers[i].join();
+	}
+	delete[] groupBuffers;
+	delete[] groups;
+}
+
+unsigned int PartialRenderer::getThreadCount() const {
+	return threadCount;
+}
+
+bool PartialRenderer::isRendering() const {
+	return rendering;
+}
+
+void PartialRenderer::workerLoop(unsigned int groupIx) {
+	Bit32u seenGeneration = 0;
+	for (;;) {
+		{
+			std::unique_lock<std::mutex> lock(jobMutex);
+			while (!quit && seenGeneration == jobGeneration) {
+				jobStarted.wait(lock);
+			}
+			if (quit) {
+				return;
+			}
+			seenGeneration = jobGeneration;
+		}
+		if (groupIx < groupCount) {
+			const Group &group = groups[groupIx];
+			Synth::muteSampleBuffer(group.nonReverbLeft, runLength);
+			Synth::muteSampleBuffer(group.nonReverbRight, runLength);
+			Synth::muteSampleBuffer(group.reverbDryLeft, runLength);
+			Synth::muteSampleBuffer(group.reverbDryRight, runLength);
+			renderGroup(group);
+		}
+		{
+			std::lock_guard<std::mutex> lock(jobMutex);
+			if (--pendingGroups == 0) {
+				jobFinished.notify_one();
+			}
+		}
+	}
+}
+
+void PartialRenderer::renderGroup(const Group &group) {
+	for (unsigned int i = group.firstEntry; i < group.firstEntry + group.entryCount; i++) {
+		const Entry &entry = entries[i];
+		if (entry.reverb) {
+			partialManager.produceOutput(entry.partialNum, group.reverbDryLeft, group.reverbDryRight, runLength);
+		} else {
+			partialManager.produceOutput(entry.partialNum, group.nonReverbLeft, group.nonReverbRight, runLength);
+		}
+	}
+}
+
+static void mixSampleBuffer(Sample *buffer, const Sample *groupBuffer, Bit32u len) {
+	while (len--) {
+		*buffer = Synth::clipSampleEx((SampleEx)*buffer + (SampleEx)*groupBuffer);
+		++buffer;
+		++groupBuffer;
+	}
+}
+
+void PartialRenderer::produceOutput(Sample *nonReverbLeft, Sample *nonReverbRight, Sample *reverbDryLeft, Sample *reverbDryRight, Bit32u len) {
+	// Partial state is only inspected here, on the rendering thread. A slave partial may be deactivated by its master
+	// while the groups are being rendered, so the workers never look at partials which aren't in their own group.
+	entries.clear();
+	for (unsigned int partialNum = 0; partialNum < synth.getPartialCount(); partialNum++) {
+		const Partial *partial = partialManager.getPartial(partialNum);
+		if (!partial->isActive() || partial->isRingModulatingSlave()) {
+			continue;
+		}
+		Entry entry;
+		entry.partialNum = partialNum;
+		entry.reverb = partialManager.shouldReverb(partialNum);
+		entries.push_back(entry);
+	}
+
+	unsigned int entryCount = (unsigned int)entries.size();
+	groupCount = len < MIN_PARALLEL_RUN_LENGTH ? 1 : entryCount / MIN_PARTIALS_PER_GROUP;
+	if (groupCount > threadCount) groupCount = threadCount;
+	if (groupCount < 2) {
+		// Not worth it, fall back to plain sequential rendering, which also doesn't defer partial deactivation.
+		groupCount = 1;
+		groups[0].firstEntry = 0;
+		groups[0].entryCount = entryCount;
+		groups[0].nonReverbLeft = nonReverbLeft;
+		groups[0].nonReverbRight = nonReverbRight;
+		groups[0].reverbDryLeft = reverbDryLeft;
+		groups[0].reverbDryRight = reverbDryRight;
+		runLength = len;
+		renderGroup(groups[0]);
+		return;
+	}
+
+	unsigned int firstEntry = 0;
+	for (unsigned int groupIx = 0; groupIx < groupCount; groupIx++) {
+		Group &group = groups[groupIx];
+		group.firstEntry = firstEntry;
+		group.entryCount = (entryCount - firstEntry) / (groupCount - groupIx);
+		firstEntry += group.entryCount;
+	}
+	groups[0].nonReverbLeft = nonReverbLeft;
+	groups[0].nonReverbRight = nonReverbRight;
+	groups[0].reverbDryLeft = reverbDryLeft;
+	groups[0].reverbDryRight = reverbDryRight;
+	runLength = len;
+	rendering = true;
+
+	{
+		std::lock_guard<std::mutex> lock(jobMutex);
+		pendingGroups = (unsigned int)workers.size();
+		jobGeneration++;
+	}
+	jobStarted.notify_all();
+
+	renderGroup(groups[0]);
+
+	{
+		std::unique_lock<std::mutex> lock(jobMutex);
+		while (pendingGroups > 0) {
+			jobFinished.wait(lock);
+		}
+	}
+	rendering = false;
+
+	// Deterministic summation order, regardless of which group finished first
+	for (unsigned int groupIx = 1; groupIx < groupCount; groupIx++) {
+		const Group &group = groups[groupIx];
+		mixSampleBuffer(nonReverbLeft, group.nonReverbLeft, len);
+		mixSampleBuffer(nonReverbRight, group.nonReverbRight, len);
+		mixSampleBuffer(reverbDryLeft, group.reverbDryLeft, len);
+		mixSampleBuffer(reverbDryRight, group.reverbDryRight, len);
+	}
+
+	partialManager.flushDeferredDeactivations();
+}
+
+}
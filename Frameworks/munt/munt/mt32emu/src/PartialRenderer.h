@@ -0,0 +1,99 @@
+/* Copyright (C) 2003, 2004, 2005, 2006, 2008, 2009 Dean Beeler, Jerome Fisher
+ * Copyright (C) 2011, 2012, 2013, 2014 Dean Beeler, Jerome Fisher, Sergey V. Mikayev
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 2.1 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MT32EMU_PARTIAL_RENDERER_H
+#define MT32EMU_PARTIAL_RENDERER_H
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MT32Emu {
+
+class Synth;
+class PartialManager;
+
+/**
+ * Renders the active partials of a synth on a pool of worker threads.
+ * Active partials are split into contiguous groups (in partial index order), each group is mixed into
+ * a private set of non-reverb and reverb-dry buses, and the buses are then summed in group order.
+ * Thus, the output only depends on the synth state, not on thread scheduling.
+ * Ring modulating slaves are always rendered by their master, so each pair stays within a single group.
+ * While groups are rendered, partial deactivation is not propagated to polys and parts, as those are shared
+ * between groups. Instead, it is deferred and performed on the calling thread in partial index order.
+ * THREAD SAFETY:
+ * produceOutput() must only be called from the rendering thread of the synth.
+ */
+class PartialRenderer {
+private:
+	// Groups with fewer active partials than this aren't worth the synchronisation overhead.
+	static const unsigned int MIN_PARTIALS_PER_GROUP = 8;
+	// Runs shorter than this are rendered on the calling thread, e.g. while a poly is aborting.
+	static const Bit32u MIN_PARALLEL_RUN_LENGTH = 16;
+
+	struct Group {
+		unsigned int firstEntry;
+		unsigned int entryCount;
+		Sample *nonReverbLeft, *nonReverbRight;
+		Sample *reverbDryLeft, *reverbDryRight;
+	};
+
+	struct Entry {
+		unsigned int partialNum;
+		bool reverb;
+	};
+
+	Synth &synth;
+	PartialManager &partialManager;
+	const unsigned int threadCount;
+
+	std::vector<std::thread> workers;
+	std::mutex jobMutex;
+	std::condition_variable jobStarted;
+	std::condition_variable jobFinished;
+	Bit32u jobGeneration;
+	unsigned int pendingGroups;
+	bool quit;
+
+	std::vector<Entry> entries;
+	Group *groups;
+	unsigned int groupCount;
+	Sample *groupBuffers;
+	Bit32u runLength;
+	bool rendering;
+
+	void workerLoop(unsigned int groupIx);
+	void renderGroup(const Group &group);
+
+public:
+	PartialRenderer(Synth &synth, PartialManager &partialManager, unsigned int threadCount);
+	~PartialRenderer();
+
+	unsigned int getThreadCount() const;
+
+	// True while groups of partials may be rendered concurrently.
+	bool isRendering() const;
+
+	// Mixes all the active partials into the provided buses (which must be muted beforehand).
+	// The semantics are equal to calling PartialManager::produceOutput() for every partial in index order.
+	void produceOutput(Sample *nonReverbLeft, Sample *nonReverbRight, Sample *reverbDryLeft, Sample *reverbDryRight, Bit32u len);
+};
+
+}
+
+#endif
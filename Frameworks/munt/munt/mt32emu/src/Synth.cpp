@@ -29,6 +29,7 @@
 #include "MemoryRegion.h"
 #include "MidiEventQueue.h"
 #include "PartialManager.h"
+#include "PartialRenderer.h"
 
 namespace MT32Emu {
 
@@ -86,6 +87,8 @@ Synth::Synth(ReportHandler *useReportHandler) : mt32ram(*new MemParams()), mt32d
 	}
 	reverbModel = NULL;
 	analog = NULL;
+	partialRenderingThreadCount = 0;
+	partialRenderer = NULL;
 	setDACInputMode(DACInputMode_NICE);
 	setMIDIDelayMode(MIDIDelayMode_DELAY_SHORT_MESSAGES_ONLY);
 	setOutputGain(1.0f);
@@ -238,6 +241,26 @@ bool Synth::isReversedStereoEnabled() {
 	return reversedStereoEnabled;
 }
 
+void Synth::setPartialRenderingThreadCount(unsigned int threadCount) {
+	if (threadCount < 2) {
+		threadCount = 0;
+	}
+	if (threadCount == partialRenderingThreadCount) {
+		return;
+	}
+	partialRenderingThreadCount = threadCount;
+	if (partialManager == NULL) {
+		// Not open yet, the renderer is created in open()
+		return;
+	}
+	delete partialRenderer;
+	partialRenderer = threadCount > 1 ? new PartialRenderer(*this, *partialManager, threadCount) : NULL;
+}
+
+unsigned int Synth::getPartialRenderingThreadCount() const {
+	return partialRenderingThreadCount;
+}
+
 bool Synth::loadControlROM(const ROMImage &controlROMImage) {
 	File *file = controlROMImage.getFile();
 	const ROMInfo *controlROMInfo = controlROMImage.getROMInfo();
@@ -466,6 +489,9 @@ bool Synth::open(const ROMImage &controlROMImage, const ROMImage &pcmROMImage, u
 	memset(&mt32ram.timbres[128], 0, sizeof(mt32ram.timbres[128]) * 64);
 
 	partialManager = new PartialManager(this, parts);
+	if (partialRenderingThreadCount > 1) {
+		partialRenderer = new PartialRenderer(*this, *partialManager, partialRenderingThreadCount);
+	}
 
 	pcmWaves = new PCMWaveEntry[controlROMMap->pcmCount];
 
@@ -579,6 +605,9 @@ void Synth::close(bool forced) {
 	delete analog;
 	analog = NULL;
 
+	delete partialRenderer;
+	partialRenderer = NULL;
+
 	delete partialManager;
 	partialManager = NULL;
 
@@ -1668,11 +1697,15 @@ void Synth::doRenderStreams(Sample *nonReverbLeft, Sample *nonReverbRight, Sampl
 		muteSampleBuffer(reverbDryLeft, len);
 		muteSampleBuffer(reverbDryRight, len);
 
-		for (unsigned int i = 0; i < getPartialCount(); i++) {
-			if (partialManager->shouldReverb(i)) {
-				partialManager->produceOutput(i, reverbDryLeft, reverbDryRight, len);
-			} else {
-				partialManager->produceOutput(i, nonReverbLeft, nonReverbRight, len);
+		if (partialRenderer != NULL) {
+			partialRenderer->produceOutput(nonReverbLeft, nonReverbRight, reverbDryLeft, reverbDryRight, len);
+		} else {
+			for (unsigned int i = 0; i < getPartialCount(); i++) {
+				if (partialManager->shouldReverb(i)) {
+					partialManager->produceOutput(i, reverbDryLeft, reverbDryRight, len);
+				} else {
+					partialManager->produceOutput(i, nonReverbLeft, nonReverbRight, len);
+				}
 			}
 		}
 
@@ -1736,6 +1769,10 @@ bool Synth::isAbortingPoly() const {
 	return abortingPoly != NULL;
 }
 
+bool Synth::isRenderingPartialsConcurrently() const {
+	return partialRenderer != NULL && partialRenderer->isRendering();
+}
+
 bool Synth::isActive() const {
 	if (hasActivePartials()) {
 		return true;
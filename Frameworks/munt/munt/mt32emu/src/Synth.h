@@ -31,6 +31,7 @@ class Part;
 class Poly;
 class Partial;
 class PartialManager;
+class PartialRenderer;
 
 class PatchTempMemoryRegion;
 class RhythmTempMemoryRegion;
@@ -237,11 +238,15 @@ private:
 
 	Analog *analog;
 
+	unsigned int partialRenderingThreadCount;
+	PartialRenderer *partialRenderer;
+
 	Bit32u addMIDIInterfaceDelay(Bit32u len, Bit32u timestamp);
 
 	void produceLA32Output(Sample *buffer, Bit32u len);
 	void convertSamplesToOutput(Sample *buffer, Bit32u len);
 	bool isAbortingPoly() const;
+	bool isRenderingPartialsConcurrently() const;
 	void doRenderStreams(Sample *nonReverbLeft, Sample *nonReverbRight, Sample *reverbDryLeft, Sample *reverbDryRight, Sample *reverbWetLeft, Sample *reverbWetRight, Bit32u len);
 
 	void readSysex(unsigned char channel, const Bit8u *sysex, Bit32u len) const;
@@ -407,6 +412,15 @@ public:
 	void setReversedStereoEnabled(bool enabled);
 	bool isReversedStereoEnabled();
 
+	// Sets the number of threads used to render the active partials, including the rendering thread itself.
+	// This is intended for sessions opened with an extended partial count, when mixing partials dominates the rendering time.
+	// Partials are rendered in groups that are summed in a fixed order, so the output is deterministic for a given thread count,
+	// though it may differ from the output of the sequential renderer by rounding.
+	// Values 0 and 1 disable the multithreaded renderer (default).
+	// Must not be called concurrently with rendering.
+	void setPartialRenderingThreadCount(unsigned int threadCount);
+	unsigned int getPartialRenderingThreadCount() const;
+
 	// Returns actual sample rate used in emulation of stereo analog circuitry of hardware units.
 	// See comment for render() below.
 	unsigned int getStereoOutputSampleRate() const;
@@ -4,6 +4,8 @@
 #include <string.h>
 #include <stdlib.h>
 
+#include <pthread.h>
+
 #include <zlib.h>
 
 /////////////////////////////////////////////////////////////////////////////
@@ -23,6 +25,7 @@ struct DIR_ENTRY {
   int block_size;
   struct SOURCE_FILE *source;
   int *offset_table;
+  int stream_offset;
   struct DIR_ENTRY *next;
 };
 
@@ -31,12 +34,51 @@ struct CACHEBLOCK {
   int   from_offset;
   char *uncompressed_data;
   int   uncompressed_size;
+  unsigned long last_used;
+};
+
+#define DEFAULT_CACHEBLOCKS (16)
+
+//
+// The read-ahead thread inflates one block at a time into its own buffer.
+// The request and the buffer belong to that thread while the state is
+// READAHEAD_BUSY, and to the reading thread otherwise. The cache itself is
+// only ever touched by the reading thread.
+//
+enum {
+  READAHEAD_IDLE,
+  READAHEAD_PENDING,
+  READAHEAD_BUSY,
+  READAHEAD_DONE,
+  READAHEAD_FAILED
+};
+
+struct READAHEAD {
+  pthread_t thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  int running;
+  int quit;
+  int state;
+  struct SOURCE_FILE *from_source;
+  int   from_offset;
+  int   from_zsize;
+  int   from_usize;
+  char *uncompressed_data;
+  int   uncompressed_size;
+  unsigned long used;
+  unsigned long discarded;
 };
 
 struct PSF2FS {
   struct SOURCE_FILE *sources;
   struct DIR_ENTRY *dir;
-  struct CACHEBLOCK cacheblock;
+  struct CACHEBLOCK *cacheblocks;
+  int cacheblock_count;
+  unsigned long cache_clock;
+  unsigned long cache_hits;
+  unsigned long cache_misses;
+  struct READAHEAD readahead;
 
   int adderror;
 };
@@ -61,9 +103,13 @@ static void dir_cleanup_free(struct DIR_ENTRY *dir) {
   }
 }
 
-static void cache_cleanup(struct CACHEBLOCK *cacheblock) {
-  if(!cacheblock) return;
-  if(cacheblock->uncompressed_data) free( cacheblock->uncompressed_data );
+static void cache_cleanup(struct CACHEBLOCK *cacheblocks, int count) {
+  int i;
+  if(!cacheblocks) return;
+  for(i = 0; i < count; i++) {
+    if(cacheblocks[i].uncompressed_data) free( cacheblocks[i].uncompressed_data );
+  }
+  free( cacheblocks );
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -73,16 +119,47 @@ void *psf2fs_create(void) {
   fs = ( struct PSF2FS * ) malloc( sizeof( struct PSF2FS ) );
   if(!fs) return NULL;
   memset(fs, 0, sizeof(struct PSF2FS));
+  if(psf2fs_set_cache_size(fs, DEFAULT_CACHEBLOCKS)) {
+    free( fs );
+    return NULL;
+  }
   return fs;
 }
 
 /////////////////////////////////////////////////////////////////////////////
 
+int psf2fs_set_cache_size(void *psf2fs, int blocks) {
+  struct PSF2FS *fs = (struct PSF2FS*)psf2fs;
+  struct CACHEBLOCK *cacheblocks;
+  if(blocks < 1) blocks = 1;
+  cacheblocks = ( struct CACHEBLOCK * ) calloc( blocks, sizeof( struct CACHEBLOCK ) );
+  if(!cacheblocks) return -1;
+  cache_cleanup(fs->cacheblocks, fs->cacheblock_count);
+  fs->cacheblocks = cacheblocks;
+  fs->cacheblock_count = blocks;
+  return 0;
+}
+
+void psf2fs_get_cache_stats(void *psf2fs, unsigned long *hits, unsigned long *misses) {
+  struct PSF2FS *fs = (struct PSF2FS*)psf2fs;
+  if(hits) *hits = fs->cache_hits;
+  if(misses) *misses = fs->cache_misses;
+}
+
+void psf2fs_get_read_ahead_stats(void *psf2fs, unsigned long *used, unsigned long *discarded) {
+  struct PSF2FS *fs = (struct PSF2FS*)psf2fs;
+  if(used) *used = fs->readahead.used;
+  if(discarded) *discarded = fs->readahead.discarded;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
 void psf2fs_delete(void *psf2fs) {
   struct PSF2FS *fs = (struct PSF2FS*)psf2fs;
+  psf2fs_set_read_ahead(fs, 0);
   if(fs->sources) source_cleanup_free(fs->sources);
   if(fs->dir) dir_cleanup_free(fs->dir);
-  cache_cleanup(&(fs->cacheblock));
+  cache_cleanup(fs->cacheblocks, fs->cacheblock_count);
   free( fs );
 }
 
@@ -346,10 +423,184 @@ int psf2fs_load_callback(void * psf2fs, const uint8_t * exe, size_t exe_size,
 //
 //
 //
-static int virtual_read(struct PSF2FS *fs, struct DIR_ENTRY *entry, int offset, char *buffer, int length) {
-  int length_read = 0;
+//
+// Inflates a block into the given buffer, which is only reallocated if its
+// size is different. Returns nonzero on failure.
+//
+static int inflateblock(char **data, int *size, struct SOURCE_FILE *source, int block_zofs, int block_zsize, int block_usize) {
   int r;
   unsigned long destlen;
+  if(*size != block_usize) {
+    *size = 0;
+    if(*data) {
+      free( *data );
+      *data = NULL;
+    }
+    *data = ( char * ) malloc( block_usize );
+    if(!*data) return -1;
+    *size = block_usize;
+  }
+  destlen = block_usize;
+  r = uncompress((unsigned char *) *data, &destlen, (const unsigned char *) source->reserved_data + block_zofs, block_zsize);
+  if(r != Z_OK || destlen != block_usize) return -1;
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Read-ahead of the block following the one last read, on its own thread.
+// Sources are never freed while the filesystem exists, so the thread can
+// inflate from them without holding the lock.
+//
+static void *readahead_thread(void *psf2fs) {
+  struct PSF2FS *fs = (struct PSF2FS*)psf2fs;
+  struct READAHEAD *ra = &fs->readahead;
+  pthread_mutex_lock(&ra->mutex);
+  for(;;) {
+    int failed;
+    while(!ra->quit && ra->state != READAHEAD_PENDING) pthread_cond_wait(&ra->cond, &ra->mutex);
+    if(ra->quit) break;
+    ra->state = READAHEAD_BUSY;
+    pthread_mutex_unlock(&ra->mutex);
+    failed = inflateblock(&ra->uncompressed_data, &ra->uncompressed_size, ra->from_source, ra->from_offset, ra->from_zsize, ra->from_usize);
+    pthread_mutex_lock(&ra->mutex);
+    ra->state = failed ? READAHEAD_FAILED : READAHEAD_DONE;
+    pthread_cond_broadcast(&ra->cond);
+  }
+  pthread_mutex_unlock(&ra->mutex);
+  return NULL;
+}
+
+int psf2fs_set_read_ahead(void *psf2fs, int enable) {
+  struct PSF2FS *fs = (struct PSF2FS*)psf2fs;
+  struct READAHEAD *ra = &fs->readahead;
+  if(enable && !ra->running) {
+    if(pthread_mutex_init(&ra->mutex, NULL)) return -1;
+    if(pthread_cond_init(&ra->cond, NULL)) {
+      pthread_mutex_destroy(&ra->mutex);
+      return -1;
+    }
+    ra->quit = 0;
+    ra->state = READAHEAD_IDLE;
+    if(pthread_create(&ra->thread, NULL, readahead_thread, fs)) {
+      pthread_cond_destroy(&ra->cond);
+      pthread_mutex_destroy(&ra->mutex);
+      return -1;
+    }
+    ra->running = 1;
+  } else if(!enable && ra->running) {
+    pthread_mutex_lock(&ra->mutex);
+    ra->quit = 1;
+    pthread_cond_broadcast(&ra->cond);
+    pthread_mutex_unlock(&ra->mutex);
+    pthread_join(ra->thread, NULL);
+    pthread_cond_destroy(&ra->cond);
+    pthread_mutex_destroy(&ra->mutex);
+    if(ra->uncompressed_data) free( ra->uncompressed_data );
+    ra->uncompressed_data = NULL;
+    ra->uncompressed_size = 0;
+    ra->running = 0;
+  }
+  return 0;
+}
+
+//
+// Queues a block for the read-ahead thread, unless it is cached already or
+// the thread is busy with another one.
+//
+static void readahead_request(struct PSF2FS *fs, struct SOURCE_FILE *source, int block_zofs, int block_zsize, int block_usize) {
+  struct READAHEAD *ra = &fs->readahead;
+  int i;
+  if(!ra->running) return;
+  for(i = 0; i < fs->cacheblock_count; i++) {
+    if(fs->cacheblocks[i].from_source == source && fs->cacheblocks[i].from_offset == block_zofs) return;
+  }
+  pthread_mutex_lock(&ra->mutex);
+  if(ra->state != READAHEAD_BUSY && !(ra->state == READAHEAD_DONE && ra->from_source == source && ra->from_offset == block_zofs)) {
+    if(ra->state == READAHEAD_DONE) ra->discarded++;
+    ra->from_source = source;
+    ra->from_offset = block_zofs;
+    ra->from_zsize = block_zsize;
+    ra->from_usize = block_usize;
+    ra->state = READAHEAD_PENDING;
+    pthread_cond_broadcast(&ra->cond);
+  }
+  pthread_mutex_unlock(&ra->mutex);
+}
+
+//
+// Moves the given block into the cache block if the read-ahead thread has
+// it, waiting for it if it is being inflated. Returns nonzero if it did.
+//
+static int readahead_take(struct PSF2FS *fs, struct CACHEBLOCK *cacheblock, struct SOURCE_FILE *source, int block_zofs) {
+  struct READAHEAD *ra = &fs->readahead;
+  int taken = 0;
+  if(!ra->running) return 0;
+  pthread_mutex_lock(&ra->mutex);
+  if(ra->state != READAHEAD_IDLE && ra->from_source == source && ra->from_offset == block_zofs) {
+    while(ra->state == READAHEAD_BUSY) pthread_cond_wait(&ra->cond, &ra->mutex);
+    if(ra->state == READAHEAD_DONE) {
+      // swap buffers, so the cache block's one is reused for the next block
+      char *data = cacheblock->uncompressed_data;
+      int size = cacheblock->uncompressed_size;
+      cacheblock->uncompressed_data = ra->uncompressed_data;
+      cacheblock->uncompressed_size = ra->uncompressed_size;
+      ra->uncompressed_data = data;
+      ra->uncompressed_size = size;
+      ra->used++;
+      taken = 1;
+    }
+    // a request that hasn't started yet is inflated here instead
+    ra->state = READAHEAD_IDLE;
+  }
+  pthread_mutex_unlock(&ra->mutex);
+  return taken;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Returns the cache block holding the given compressed block, inflating it
+// into the least recently used block if it isn't cached yet.
+//
+static struct CACHEBLOCK *getcacheblock(struct PSF2FS *fs, struct SOURCE_FILE *source, int block_zofs, int block_zsize, int block_usize) {
+  struct CACHEBLOCK *cacheblock = NULL;
+  int i;
+
+  for(i = 0; i < fs->cacheblock_count; i++) {
+    struct CACHEBLOCK *candidate = fs->cacheblocks + i;
+    if(candidate->from_source == source && candidate->from_offset == block_zofs) {
+      fs->cache_hits++;
+      candidate->last_used = ++fs->cache_clock;
+      return candidate;
+    }
+    // empty blocks have a last_used of zero, so they are picked first
+    if(!cacheblock || candidate->last_used < cacheblock->last_used) cacheblock = candidate;
+  }
+
+  fs->cache_misses++;
+
+  // invalidate the block without freeing its buffer
+  cacheblock->from_source = NULL;
+  cacheblock->last_used = 0;
+
+  if(!readahead_take(fs, cacheblock, source, block_zofs)) {
+    if(inflateblock(&cacheblock->uncompressed_data, &cacheblock->uncompressed_size, source, block_zofs, block_zsize, block_usize)) return NULL;
+  }
+
+  cacheblock->from_source = source;
+  cacheblock->from_offset = block_zofs;
+  cacheblock->last_used = ++fs->cache_clock;
+  return cacheblock;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+//
+//
+static int virtual_read(struct PSF2FS *fs, struct DIR_ENTRY *entry, int offset, char *buffer, int length) {
+  int length_read = 0;
+  int lastblock = -1;
+  int streaming = offset && offset == entry->stream_offset;
   if(offset >= entry->length) return 0;
   if((offset + length) > entry->length) length = entry->length - offset;
   while(length_read < length) {
@@ -360,6 +611,7 @@ static int virtual_read(struct PSF2FS *fs, struct DIR_ENTRY *entry, int offset,
     int block_zofs  = entry->offset_table[blocknum];
     int block_zsize = entry->offset_table[blocknum+1] - block_zofs;
     int block_usize;
+    struct CACHEBLOCK *cacheblock;
     if(block_zofs <= 0 || block_zofs >= entry->source->reserved_size) goto bounds;
     if((block_zofs+block_zsize) > entry->source->reserved_size) goto bounds;
 
@@ -367,48 +619,33 @@ static int virtual_read(struct PSF2FS *fs, struct DIR_ENTRY *entry, int offset,
     block_usize = entry->length - (blocknum * entry->block_size);
     if(block_usize > entry->block_size) block_usize = entry->block_size;
 
-    // if it's not already in the cache block, read it
-    if(
-      (fs->cacheblock.from_offset != block_zofs) ||
-      (fs->cacheblock.from_source != entry->source)
-    ) {
-      // invalidate cache without freeing buffer
-      fs->cacheblock.from_source = NULL;
-
-      // make sure there's a buffer allocated
-      // but only reallocate if the size is different
-      if(fs->cacheblock.uncompressed_size != block_usize) {
-        fs->cacheblock.uncompressed_size = 0;
-        if(fs->cacheblock.uncompressed_data) {
-          free( fs->cacheblock.uncompressed_data );
-          fs->cacheblock.uncompressed_data = NULL;
-        }
-        fs->cacheblock.uncompressed_data = ( char * ) malloc( block_usize );
-        if(!fs->cacheblock.uncompressed_data) goto outofmemory;
-        fs->cacheblock.uncompressed_size = block_usize;
-      }
-      destlen = block_usize;
-      // attempt decompress
-      r = uncompress((unsigned char *) fs->cacheblock.uncompressed_data, &destlen, (const unsigned char *) entry->source->reserved_data + block_zofs, block_zsize);
-      if(r != Z_OK || destlen != block_usize) {
-//        char s[999];
-//        sprintf(s,"zdata=%02X %02X %02X blockz=%d blocku=%d destlenout=%d", zdata[0], zdata[1], zdata[2], block_zsize, block_usize, destlen);
-//        errormessageadd(fs, s);
-        goto error;
-      }
-    }
+    cacheblock = getcacheblock(fs, entry->source, block_zofs, block_zsize, block_usize);
+    if(!cacheblock) goto error;
 
     // at this point, we can read whatever we want out of the cacheblock
-    canread = fs->cacheblock.uncompressed_size - ofs_within_block;
+    canread = cacheblock->uncompressed_size - ofs_within_block;
     if(canread > (length - length_read)) canread = length - length_read;
 
     // copy
-    memcpy(buffer, fs->cacheblock.uncompressed_data + ofs_within_block, canread);
+    memcpy(buffer, cacheblock->uncompressed_data + ofs_within_block, canread);
 
     // advance pointers/counters
     offset += canread;
     length_read += canread;
     buffer += canread;
+    lastblock = blocknum;
+  }
+
+  // a file being streamed, read where the previous read of it ended, is
+  // read on into the next block
+  entry->stream_offset = offset;
+  if(fs->readahead.running && streaming && lastblock >= 0 && (lastblock + 1) * entry->block_size < entry->length) {
+    int block_zofs  = entry->offset_table[lastblock+1];
+    int block_zsize = entry->offset_table[lastblock+2] - block_zofs;
+    int block_usize = entry->length - ((lastblock + 1) * entry->block_size);
+    if(block_usize > entry->block_size) block_usize = entry->block_size;
+    if(block_zofs > 0 && block_zsize > 0 && (block_zofs+block_zsize) <= entry->source->reserved_size)
+      readahead_request(fs, entry->source, block_zofs, block_zsize, block_usize);
   }
 
 //success:
@@ -416,17 +653,7 @@ static int virtual_read(struct PSF2FS *fs, struct DIR_ENTRY *entry, int offset,
 
 bounds:
   goto error;
-outofmemory:
-  goto error;
 error:
-  // if cacheblock was invalidated, we can free it
-  if(!fs->cacheblock.from_source) {
-    fs->cacheblock.uncompressed_size = 0;
-    if(fs->cacheblock.uncompressed_data) {
-      free( fs->cacheblock.uncompressed_data );
-      fs->cacheblock.uncompressed_data = NULL;
-    }
-  }
   return -1;
 }
 
@@ -16,6 +16,23 @@ int psf2fs_load_callback(void * psf2vfs, const uint8_t * exe, size_t exe_size,
 
 int psf2fs_virtual_readfile(void *psf2vfs, const char *path, int offset, char *buffer, int length);
 
+/* Sets how many decompressed blocks are kept, least recently used first out.
+ * Discards the current cache contents. Returns nonzero on allocation failure. */
+int psf2fs_set_cache_size(void *psf2vfs, int blocks);
+
+/* Reports block cache hits and misses since the filesystem was created. */
+void psf2fs_get_cache_stats(void *psf2vfs, unsigned long *hits, unsigned long *misses);
+
+/* Starts or stops inflating the next block of the file last read on a
+ * background thread, off by default. A miss on that block then takes it from
+ * the thread instead of inflating it. Returns nonzero if the thread can't be
+ * started. */
+int psf2fs_set_read_ahead(void *psf2vfs, int enable);
+
+/* Reports how many read-ahead blocks were used, and how many were replaced
+ * before being used. */
+void psf2fs_get_read_ahead_stats(void *psf2vfs, unsigned long *used, unsigned long *discarded);
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,6 +5,8 @@
 
 #include <zlib.h>
 
+#include <pthread.h>
+
 #ifdef _MSC_VER
 #define snprintf sprintf_s
 #define strcasecmp _stricmp
@@ -49,6 +51,158 @@ const char * strrpbrk( const char * s, const char * accept)
 
 enum { max_recursion_depth = 10 };
 
+/* Process wide cache of the decompressed program and reserved sections of
+ * library files, which are shared by every track of a set. Entries are
+ * identified by full path, file size and the 16 byte header, which holds
+ * the section sizes and the CRC of the compressed program. */
+
+typedef struct psf_cache_entry psf_cache_entry;
+
+struct psf_cache_entry {
+    psf_cache_entry * prev, * next;
+    char * path;
+    long file_size;
+    uint8_t header[16];
+    uint8_t * exe;
+    size_t exe_size;
+    uint8_t * reserved;
+    size_t reserved_size;
+    int refcount;
+    int orphaned;
+};
+
+static pthread_mutex_t cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+static psf_cache_entry * cache_head = NULL; /* most recently used */
+static psf_cache_entry * cache_tail = NULL;
+static size_t cache_used = 0;
+static size_t cache_limit = 32 * 1024 * 1024;
+
+static size_t cache_entry_size( const psf_cache_entry * entry )
+{
+    return entry->exe_size + entry->reserved_size;
+}
+
+static void cache_entry_free( psf_cache_entry * entry )
+{
+    free( entry->path );
+    free( entry->exe );
+    free( entry->reserved );
+    free( entry );
+}
+
+static void cache_unlink( psf_cache_entry * entry )
+{
+    if ( entry->prev ) entry->prev->next = entry->next;
+    else cache_head = entry->next;
+    if ( entry->next ) entry->next->prev = entry->prev;
+    else cache_tail = entry->prev;
+    entry->prev = entry->next = NULL;
+    cache_used -= cache_entry_size( entry );
+}
+
+static void cache_link_head( psf_cache_entry * entry )
+{
+    entry->prev = NULL;
+    entry->next = cache_head;
+    if ( cache_head ) cache_head->prev = entry;
+    else cache_tail = entry;
+    cache_head = entry;
+    cache_used += cache_entry_size( entry );
+}
+
+/* Entries still referenced by a load in progress are freed on release */
+static void cache_evict( psf_cache_entry * entry )
+{
+    cache_unlink( entry );
+    if ( entry->refcount ) entry->orphaned = 1;
+    else cache_entry_free( entry );
+}
+
+static void cache_trim( size_t limit )
+{
+    while ( cache_tail && cache_used > limit )
+        cache_evict( cache_tail );
+}
+
+static psf_cache_entry * cache_acquire( const char * path, long file_size, const uint8_t * header )
+{
+    psf_cache_entry * entry;
+
+    pthread_mutex_lock( &cache_mutex );
+    for ( entry = cache_head; entry; entry = entry->next )
+    {
+        if ( entry->file_size == file_size && !memcmp( entry->header, header, 16 ) && !strcmp( entry->path, path ) )
+        {
+            if ( entry != cache_head )
+            {
+                cache_unlink( entry );
+                cache_link_head( entry );
+            }
+            ++entry->refcount;
+            break;
+        }
+    }
+    pthread_mutex_unlock( &cache_mutex );
+
+    return entry;
+}
+
+static void cache_release( psf_cache_entry * entry )
+{
+    pthread_mutex_lock( &cache_mutex );
+    if ( !--entry->refcount && entry->orphaned ) cache_entry_free( entry );
+    pthread_mutex_unlock( &cache_mutex );
+}
+
+/* Takes ownership of the buffers and returns a referenced entry, or NULL
+ * if the sections don't fit in the cache, in which case the caller keeps
+ * ownership. */
+static psf_cache_entry * cache_insert( const char * path, long file_size, const uint8_t * header,
+                                       uint8_t * exe, size_t exe_size, uint8_t * reserved, size_t reserved_size )
+{
+    psf_cache_entry * entry;
+
+    pthread_mutex_lock( &cache_mutex );
+
+    if ( !cache_limit || exe_size + reserved_size > cache_limit / 2 )
+    {
+        pthread_mutex_unlock( &cache_mutex );
+        return NULL;
+    }
+
+    entry = (psf_cache_entry *) calloc( 1, sizeof(psf_cache_entry) );
+    if ( entry ) entry->path = strdup( path );
+    if ( !entry || !entry->path )
+    {
+        if ( entry ) free( entry );
+        pthread_mutex_unlock( &cache_mutex );
+        return NULL;
+    }
+
+    entry->file_size = file_size;
+    memcpy( entry->header, header, 16 );
+    entry->exe = exe;
+    entry->exe_size = exe_size;
+    entry->reserved = reserved;
+    entry->reserved_size = reserved_size;
+    entry->refcount = 1;
+
+    cache_trim( cache_limit - cache_entry_size( entry ) );
+    cache_link_head( entry );
+
+    pthread_mutex_unlock( &cache_mutex );
+
+    return entry;
+}
+
+void psf_set_cache_limit( size_t limit )
+{
+    pthread_mutex_lock( &cache_mutex );
+    cache_limit = limit;
+    cache_trim( limit );
+    pthread_mutex_unlock( &cache_mutex );
+}
+
 typedef struct psf_load_state
 {
     int                        depth;
@@ -362,6 +516,8 @@ static int psf_load_internal( psf_load_state * state, const char * file_name )
 
     void * file;
 
+    psf_cache_entry * cache_entry = NULL;
+
     long file_size, tag_size;
 
     int n;
@@ -396,9 +552,11 @@ static int psf_load_internal( psf_load_state * state, const char * file_name )
 
     file = state->file_callbacks->fopen( full_path );
 
-    free( full_path );
-
-    if ( !file ) return -1;
+    if ( !file )
+    {
+        free( full_path );
+        return -1;
+    }
 
     if ( state->file_callbacks->fread( header_buffer, 1, 16, file ) < 16 ) goto error_close_file;
 
@@ -448,6 +606,23 @@ static int psf_load_internal( psf_load_state * state, const char * file_name )
         if ( psf_load_internal( state, tag->value ) < 0 ) goto error_free_tags;
     }
 
+    /* Libraries are usually shared by a whole set, try the cache first */
+    if ( state->depth > 1 )
+        cache_entry = cache_acquire( full_path, file_size, header_buffer );
+
+    if ( cache_entry )
+    {
+        state->file_callbacks->fclose( file );
+        file = NULL;
+
+        if ( state->load_target( state->load_context, cache_entry->exe, cache_entry->exe_size, cache_entry->reserved, cache_entry->reserved_size ) ) goto error_free_tags;
+
+        cache_release( cache_entry );
+        cache_entry = NULL;
+
+        goto load_numbered_libs;
+    }
+
     reserved_buffer = (uint8_t *) malloc( reserved_size );
     if ( !reserved_buffer ) goto error_free_tags;
     exe_compressed_buffer = (uint8_t *) malloc( exe_compressed_size );
@@ -496,14 +671,42 @@ static int psf_load_internal( psf_load_state * state, const char * file_name )
     free( exe_compressed_buffer );
     exe_compressed_buffer = NULL;
 
-    if ( state->load_target( state->load_context, exe_decompressed_buffer, exe_decompressed_size, reserved_buffer, reserved_size ) ) goto error_free_tags;
+    if ( state->depth > 1 )
+    {
+        /* Drop the slack left by the inflate size guessing before caching */
+        if ( exe_decompressed_size )
+        {
+            void * shrunk_exe_decompressed_buffer = realloc( exe_decompressed_buffer, exe_decompressed_size );
+            if ( shrunk_exe_decompressed_buffer ) exe_decompressed_buffer = (uint8_t *) shrunk_exe_decompressed_buffer;
+        }
+
+        cache_entry = cache_insert( full_path, file_size, header_buffer, exe_decompressed_buffer, exe_decompressed_size, reserved_buffer, reserved_size );
+        if ( cache_entry )
+        {
+            exe_decompressed_buffer = NULL;
+            reserved_buffer = NULL;
+        }
+    }
+
+    if ( cache_entry )
+    {
+        if ( state->load_target( state->load_context, cache_entry->exe, cache_entry->exe_size, cache_entry->reserved, cache_entry->reserved_size ) ) goto error_free_tags;
+
+        cache_release( cache_entry );
+        cache_entry = NULL;
+    }
+    else
+    {
+        if ( state->load_target( state->load_context, exe_decompressed_buffer, exe_decompressed_size, reserved_buffer, reserved_size ) ) goto error_free_tags;
 
-    free( reserved_buffer );
-    reserved_buffer = NULL;
+        free( reserved_buffer );
+        reserved_buffer = NULL;
 
-    free( exe_decompressed_buffer );
-    exe_decompressed_buffer = NULL;
+        free( exe_decompressed_buffer );
+        exe_decompressed_buffer = NULL;
+    }
 
+load_numbered_libs:
     n = 2;
     snprintf( state->lib_name_temp, 31, "_lib%u", n );
     state->lib_name_temp[ 31 ] = '\0';
@@ -520,6 +723,8 @@ static int psf_load_internal( psf_load_state * state, const char * file_name )
 done:
     if ( file ) state->file_callbacks->fclose( file );
 
+    free( full_path );
+
     free_tags( tags );
 
     --state->depth;
@@ -527,6 +732,7 @@ done:
     return header_buffer[ 3 ];
 
 error_free_tags:
+    if ( cache_entry ) cache_release( cache_entry );
     free_tags( tags );
 error_free_buffers:
     if ( exe_compressed_buffer ) free( exe_compressed_buffer );
@@ -535,5 +741,6 @@ error_free_buffers:
     if ( tag_buffer ) free( tag_buffer );
 error_close_file:
     if ( file ) state->file_callbacks->fclose( file );
+    free( full_path );
     return -1;
 }
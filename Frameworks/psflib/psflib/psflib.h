@@ -64,6 +64,16 @@ typedef int (* psf_info_callback)(void * context, const char * name, const char
 int psf_load( const char * uri, const psf_file_callbacks * file_callbacks, uint8_t allowed_version,
               psf_load_callback load_target, void * load_context, psf_info_callback info_target, void * info_context, int info_want_nested_tags );
 
+/* Decompressed sections of library files (anything referenced via _lib tags) are kept in a
+ * process wide LRU cache, shared by all callers and threads, so the tracks of a set don't each
+ * inflate the same library again. The cache is identified by path, file size and header, as the
+ * file callbacks provide no modification time.
+ *
+ * Sets the size limit of the cache in bytes, evicting entries as needed. Zero disables caching.
+ * The default is 32 MiB.
+ */
+void psf_set_cache_limit( size_t limit );
+
 #ifdef __cplusplus
 }
 #endif
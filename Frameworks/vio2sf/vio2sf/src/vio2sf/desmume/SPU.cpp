@@ -293,6 +293,77 @@ extern "C" void SPU_DeInit(NDS_state *state)
 
 //////////////////////////////////////////////////////////////////////////////
 
+// Checkpoints store each channel as is, followed by room for its resampler,
+// whether or not it has one yet, then the mixing position.
+#define SPU_CHECKPOINT_ALIGN(size) (((size) + 15) & ~(size_t)15)
+
+static size_t SPU_ChannelCheckpointSize()
+{
+	return SPU_CHECKPOINT_ALIGN(sizeof(channel_struct)) + SPU_CHECKPOINT_ALIGN(resampler_get_size());
+}
+
+extern "C" size_t SPU_GetCheckpointSize(NDS_state *state)
+{
+	(void)state;
+	return SPU_ChannelCheckpointSize() * 16 + sizeof(u32) * 2;
+}
+
+extern "C" void SPU_SaveCheckpoint(NDS_state *state, void *checkpoint)
+{
+	SPU_struct *SPU = state->SPU_core;
+	u8 *ptr = (u8 *)checkpoint;
+
+	for(int i = 0; i < 16; i++)
+	{
+		channel_struct *chan = &SPU->channels[i];
+		u8 *resampler = ptr + SPU_CHECKPOINT_ALIGN(sizeof(channel_struct));
+
+		memcpy(ptr, (void *)chan, sizeof(channel_struct));
+		if(chan->resampler)
+			resampler_dup_inplace(resampler, chan->resampler);
+		else
+			memset(resampler, 0, resampler_get_size());
+		ptr += SPU_ChannelCheckpointSize();
+	}
+
+	memcpy(ptr, &SPU->bufpos, sizeof(u32));
+	memcpy(ptr + sizeof(u32), &SPU->buflength, sizeof(u32));
+}
+
+extern "C" void SPU_LoadCheckpoint(NDS_state *state, const void *checkpoint)
+{
+	SPU_struct *SPU = state->SPU_core;
+	const u8 *ptr = (const u8 *)checkpoint;
+
+	for(int i = 0; i < 16; i++)
+	{
+		channel_struct *chan = &SPU->channels[i];
+		void *resampler = chan->resampler;
+
+		// The saved pointer only tells whether the channel had a resampler
+		memcpy((void *)chan, ptr, sizeof(channel_struct));
+		bool had_resampler = chan->resampler != 0;
+		chan->resampler = resampler;
+
+		if(had_resampler)
+		{
+			chan->init_resampler();
+			resampler_dup_inplace(chan->resampler, ptr + SPU_CHECKPOINT_ALIGN(sizeof(channel_struct)));
+		}
+		else if(chan->resampler)
+		{
+			// Empty, which mixes the same as having none
+			resampler_clear(chan->resampler);
+		}
+		ptr += SPU_ChannelCheckpointSize();
+	}
+
+	memcpy(&SPU->bufpos, ptr, sizeof(u32));
+	memcpy(&SPU->buflength, ptr + sizeof(u32), sizeof(u32));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void SPU_struct::ShutUp()
 {
 	for(int i=0;i<16;i++)
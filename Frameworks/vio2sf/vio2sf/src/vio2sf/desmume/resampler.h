@@ -1,6 +1,8 @@
 #ifndef _RESAMPLER_H_
 #define _RESAMPLER_H_
 
+#include <stddef.h>
+
 // Ugglay
 #ifdef RESAMPLER_DECORATE
 #define PASTE(a,b) a ## b
@@ -10,6 +12,7 @@
 #define resampler_delete EVALUATE(RESAMPLER_DECORATE,_resampler_delete)
 #define resampler_dup EVALUATE(RESAMPLER_DECORATE,_resampler_dup)
 #define resampler_dup_inplace EVALUATE(RESAMPLER_DECORATE,_resampler_dup_inplace)
+#define resampler_get_size EVALUATE(RESAMPLER_DECORATE,_resampler_get_size)
 #define resampler_set_quality EVALUATE(RESAMPLER_DECORATE,_resampler_set_quality)
 #define resampler_get_free_count EVALUATE(RESAMPLER_DECORATE,_resampler_get_free_count)
 #define resampler_write_sample EVALUATE(RESAMPLER_DECORATE,_resampler_write_sample)
@@ -33,6 +36,8 @@ void * resampler_create(void);
 void resampler_delete(void *);
 void * resampler_dup(const void *);
 void resampler_dup_inplace(void *, const void *);
+/* Size of the buffer resampler_dup_inplace writes */
+size_t resampler_get_size(void);
 
 enum
 {
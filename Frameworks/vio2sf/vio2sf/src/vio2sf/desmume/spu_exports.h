@@ -3,6 +3,8 @@
 
 #ifndef _SPU_CPP_
 
+#include <stddef.h>
+
 #include <vio2sf/types.h>
 
 typedef struct NDS_state NDS_state;
@@ -17,6 +19,9 @@ int SPU_Init(NDS_state *, int, int);
 void SPU_DeInit(NDS_state *);
 void SPU_Pause(NDS_state *state, int pause);
 void SPU_SetVolume(NDS_state *state, int volume);
+size_t SPU_GetCheckpointSize(NDS_state *);
+void SPU_SaveCheckpoint(NDS_state *, void *checkpoint);
+void SPU_LoadCheckpoint(NDS_state *, const void *checkpoint);
 
 typedef struct SoundInterface_struct
 {
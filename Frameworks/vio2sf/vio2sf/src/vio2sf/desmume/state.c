@@ -7,6 +7,7 @@
 //
 
 #include <assert.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -472,6 +473,121 @@ void state_render(struct NDS_state *state, s16 * buffer, unsigned int sample_cou
 	}
 }
 
+/* Checkpoints are a plain copy of everything emulation touches, in this order,
+ * each block aligned to 16 bytes. The pointers in these structures all point
+ * into the same instance, so a copy restores into the state it came from. The
+ * ARM9 memory is what the save state format above covers, plus the palette
+ * and texture slot pointers the VRAM mapping sets. The screens only affect
+ * video, and the firmware and backup memory are never accessed. */
+#define CHECKPOINT_ALIGN(size) (((size) + 15) & ~(size_t)15)
+
+typedef struct checkpoint_block
+{
+    void * ptr;
+    size_t size;
+} checkpoint_block;
+
+static unsigned int checkpoint_blocks(NDS_state *state, checkpoint_block *blocks)
+{
+    unsigned int count = 0;
+    armcpu_t * cpus[2];
+    int i;
+
+#define CHECKPOINT_BLOCK(p, s) { blocks[count].ptr = (void *)(p); blocks[count].size = (s); ++count; }
+    CHECKPOINT_BLOCK(state, sizeof(NDS_state));
+    CHECKPOINT_BLOCK(state->nds, sizeof(NDSSystem));
+    cpus[0] = state->NDS_ARM7;
+    cpus[1] = state->NDS_ARM9;
+    for (i = 0; i < 2; ++i)
+    {
+        CHECKPOINT_BLOCK(cpus[i], sizeof(armcpu_t));
+        CHECKPOINT_BLOCK(cpus[i]->coproc[15], sizeof(armcp15_t));
+    }
+    CHECKPOINT_BLOCK(state->MMU, offsetof(MMU_struct, fw));
+    CHECKPOINT_BLOCK(state->MMU->dscard, sizeof(MMU_struct) - offsetof(MMU_struct, dscard));
+    CHECKPOINT_BLOCK(state->ARM9Mem->ARM9_ITCM, 0x8000);
+    CHECKPOINT_BLOCK(state->ARM9Mem->ARM9_DTCM, 0x4000);
+    CHECKPOINT_BLOCK(state->ARM9Mem->ARM9_WRAM, 0x1000000);
+    CHECKPOINT_BLOCK(state->ARM9Mem->MAIN_MEM, 0x400000);
+    CHECKPOINT_BLOCK(state->ARM9Mem->ARM9_REG, 0x10000);
+    CHECKPOINT_BLOCK(state->ARM9Mem->ARM9_VMEM, 0x800);
+    CHECKPOINT_BLOCK(state->ARM9Mem->ARM9_OAM, 0x800);
+    CHECKPOINT_BLOCK(state->ARM9Mem->ARM9_ABG, 0x80000);
+    CHECKPOINT_BLOCK(state->ARM9Mem->ARM9_BBG, 0x20000);
+    CHECKPOINT_BLOCK(state->ARM9Mem->ARM9_AOBJ, 0x40000);
+    CHECKPOINT_BLOCK(state->ARM9Mem->ARM9_BOBJ, 0x20000);
+    CHECKPOINT_BLOCK(state->ARM9Mem->ARM9_LCD, 0xA4000);
+    CHECKPOINT_BLOCK(state->ARM9Mem->ExtPal, offsetof(ARM9_struct, blank_memory) - offsetof(ARM9_struct, ExtPal));
+#undef CHECKPOINT_BLOCK
+
+    return count;
+}
+
+#define CHECKPOINT_MAX_BLOCKS 24
+
+size_t state_get_checkpoint_size(NDS_state *state)
+{
+    checkpoint_block blocks[CHECKPOINT_MAX_BLOCKS];
+    unsigned int count = checkpoint_blocks(state, blocks);
+    size_t size = 0;
+    unsigned int i;
+
+    for (i = 0; i < count; ++i)
+        size += CHECKPOINT_ALIGN(blocks[i].size);
+
+    size += CHECKPOINT_ALIGN(state->sample_size * sizeof(s16) * 2);
+    size += SPU_GetCheckpointSize(state);
+
+    return size;
+}
+
+void state_save_checkpoint(NDS_state *state, void *checkpoint)
+{
+    checkpoint_block blocks[CHECKPOINT_MAX_BLOCKS];
+    unsigned int count = checkpoint_blocks(state, blocks);
+    u8 *ptr = (u8 *) checkpoint;
+    size_t sample_bytes = state->sample_pointer * sizeof(s16) * 2;
+    unsigned int i;
+
+    for (i = 0; i < count; ++i)
+    {
+        memcpy(ptr, blocks[i].ptr, blocks[i].size);
+        ptr += CHECKPOINT_ALIGN(blocks[i].size);
+    }
+
+    /* Only the samples not yet rendered out, so the rest compresses away */
+    memcpy(ptr, state->sample_buffer, sample_bytes);
+    memset(ptr + sample_bytes, 0, state->sample_size * sizeof(s16) * 2 - sample_bytes);
+    ptr += CHECKPOINT_ALIGN(state->sample_size * sizeof(s16) * 2);
+
+    SPU_SaveCheckpoint(state, ptr);
+}
+
+void state_restore_checkpoint(NDS_state *state, const void *checkpoint)
+{
+    checkpoint_block blocks[CHECKPOINT_MAX_BLOCKS];
+    unsigned int count = checkpoint_blocks(state, blocks);
+    const u8 *ptr = (const u8 *) checkpoint;
+    unsigned long dwInterpolation = state->dwInterpolation;
+    unsigned long dwChannelMute = state->dwChannelMute;
+    unsigned int i;
+
+    for (i = 0; i < count; ++i)
+    {
+        memcpy(blocks[i].ptr, ptr, blocks[i].size);
+        ptr += CHECKPOINT_ALIGN(blocks[i].size);
+    }
+
+    /* The configuration isn't part of the emulation */
+    state->dwInterpolation = dwInterpolation;
+    state->dwChannelMute = dwChannelMute;
+
+    memcpy(state->sample_buffer, ptr, state->sample_pointer * sizeof(s16) * 2);
+    ptr += CHECKPOINT_ALIGN(state->sample_size * sizeof(s16) * 2);
+
+    SPU_LoadCheckpoint(state, ptr);
+}
+
 static int SNDStateInit(NDS_state *state, int buffersize)
 {
     state->sample_buffer = (s16 *) malloc(buffersize * sizeof(s16) * 2);
@@ -9,6 +9,8 @@
 #ifndef vio2sf_state_h
 #define vio2sf_state_h
 
+#include <stddef.h>
+
 #include <vio2sf/types.h>
 #include <vio2sf/spu_exports.h>
 
@@ -91,6 +93,15 @@ void state_loadstate(NDS_state *state, const u8 * ss, u32 ss_size);
     
 void state_render(NDS_state *state, s16 * buffer, unsigned int sample_count);
 
+/* A checkpoint holds the whole running emulator, including buffered sample
+ * data. It can be saved after state_loadstate, between state_render calls,
+ * and only restored into the same state it was saved from. */
+size_t state_get_checkpoint_size(NDS_state *state);
+
+void state_save_checkpoint(NDS_state *state, void *checkpoint);
+
+void state_restore_checkpoint(NDS_state *state, const void *checkpoint);
+
 #ifdef __cplusplus
 };
 #endif
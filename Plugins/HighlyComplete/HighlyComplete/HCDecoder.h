@@ -8,6 +8,7 @@
 
 #import "Plugin.h"
 #include "circular_buffer.h"
+#include "state_checkpoints.h"
 #import <Cocoa/Cocoa.h>
 
 @interface HCDecoder : NSObject <CogDecoder, CogMetadataReader> {
@@ -19,6 +20,11 @@
 
 	circular_buffer<int16_t> silence_test_buffer;
 
+	state_checkpoints checkpoints;
+	std::vector<uint8_t> checkpointScratch;
+	long coreFramesRendered;
+	long leadingSilenceFrames;
+
 	NSDictionary *metadataList;
 
 	int tagLengthMs;
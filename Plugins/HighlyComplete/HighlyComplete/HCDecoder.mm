@@ -616,7 +616,7 @@ struct ncsf_loader_state {
 	std::vector<uint8_t> sdatData;
 	std::unique_ptr<SDAT> sdat;
 
-	std::vector<uint8_t> outputBuffer;
+	std::vector<int16_t> outputBuffer;
 
 	ncsf_loader_state()
 	: sseq(0) {
@@ -855,6 +855,58 @@ static int usf_info(void *context, const char *name, const char *value) {
 	return 0;
 }
 
+// Checkpoints are taken for cores which keep their whole state in the
+// emulatorCore block, and for USF and 2SF, whose cores save and restore
+// theirs through checkpointScratch. GSF and NCSF keep theirs in separately
+// allocated mGBA and SSEQPlayer objects, and still seek by replaying from
+// the start.
+- (size_t)checkpointStateSize {
+	if(type == 1 || type == 2)
+		return psx_get_state_size(type);
+	else if(type == 0x11 || type == 0x12)
+		return sega_get_state_size(type - 0x10);
+	else if(type == 0x21)
+		return usf_get_checkpoint_size();
+	else if(type == 0x24)
+		return state_get_checkpoint_size((NDS_state *)emulatorCore);
+	else if(type == 0x41)
+		return qsound_get_state_size();
+	else
+		return 0;
+}
+
+- (BOOL)checkpointUsesScratch {
+	return type == 0x21 || type == 0x24;
+}
+
+- (void)coreFramesRendered:(long)frames {
+	coreFramesRendered += frames;
+
+	size_t stateSize = [self checkpointStateSize];
+	if(stateSize && coreFramesRendered >= checkpoints.next()) {
+		const void *state = emulatorCore;
+		if([self checkpointUsesScratch]) {
+			checkpointScratch.resize(stateSize);
+			if(type == 0x21)
+				usf_save_checkpoint(emulatorCore, &checkpointScratch[0]);
+			else
+				state_save_checkpoint((NDS_state *)emulatorCore, &checkpointScratch[0]);
+			state = &checkpointScratch[0];
+		}
+		checkpoints.store(coreFramesRendered, state, stateSize);
+	}
+}
+
+// Limits a fast forward step, so it stops where the next checkpoint is due
+- (long)seekStep:(long)frames {
+	if([self checkpointStateSize]) {
+		long untilCheckpoint = checkpoints.next() - coreFramesRendered;
+		if(untilCheckpoint > 0 && untilCheckpoint < frames)
+			frames = untilCheckpoint;
+	}
+	return frames;
+}
+
 - (BOOL)initializeDecoder {
 	unsigned int silence_seconds = 5;
 
@@ -880,6 +932,11 @@ static int usf_info(void *context, const char *name, const char *value) {
 		silence_seconds = 30;
 	} else if(type == 2) {
 		emulatorExtra = psf2fs_create();
+		if(!emulatorExtra)
+			return NO;
+		// Sequence and sample data streamed by the IOP is inflated ahead
+		// on another thread, the emulation carries on if that can't start
+		psf2fs_set_read_ahead(emulatorExtra, 1);
 
 		struct psf1_load_state state;
 
@@ -912,7 +969,9 @@ static int usf_info(void *context, const char *name, const char *value) {
 		sega_enable_dry(emulatorCore, 1);
 		sega_enable_dsp(emulatorCore, 1);
 
-		sega_enable_dsp_dynarec(emulatorCore, 0);
+		// Maps the dynarec's code buffer with MAP_JIT, falling back to the
+		// interpreter if that fails
+		sega_enable_dsp_dynarec(emulatorCore, 1);
 
 		uint32_t start = *(uint32_t *)state.data;
 		size_t length = state.data_size;
@@ -1083,7 +1142,7 @@ static int usf_info(void *context, const char *name, const char *value) {
 
 		Player *player = new Player;
 
-		player->interpolation = INTERPOLATION_SINC;
+		player->interpolation = INTERPOLATION_FASTSINC;
 
 		PseudoFile file;
 		file.data = &state->sdatData;
@@ -1096,7 +1155,7 @@ static int usf_info(void *context, const char *name, const char *value) {
 		player->Setup(sseqToPlay);
 		player->Timer();
 
-		state->outputBuffer.resize(1024 * sizeof(int16_t) * 2);
+		state->outputBuffer.resize(1024 * 2);
 
 		emulatorCore = (uint8_t *)player;
 		emulatorExtra = state;
@@ -1134,6 +1193,14 @@ static int usf_info(void *context, const char *name, const char *value) {
 
 	framesRead = 0;
 
+	// The initial state is the first checkpoint, so seeking backwards never
+	// needs to reload the file. Checkpoints hold pointers into this instance
+	// of the core, so they are discarded with it.
+	checkpoints.reset(sampleRate * 10, 64 * 1024 * 1024);
+	coreFramesRendered = 0;
+	leadingSilenceFrames = 0;
+	[self coreFramesRendered:0];
+
 	silence_test_buffer.resize(sampleRate * silence_seconds * 2);
 
 	if(![self fillBuffer])
@@ -1141,6 +1208,8 @@ static int usf_info(void *context, const char *name, const char *value) {
 
 	silence_test_buffer.remove_leading_silence();
 
+	leadingSilenceFrames = coreFramesRendered - silence_test_buffer.data_available() / 2;
+
 	return YES;
 }
 
@@ -1221,6 +1290,7 @@ static int usf_info(void *context, const char *name, const char *value) {
 		int16_t *buf = silence_test_buffer.get_write_ptr(samples_to_write);
 		int samples_read = [self readAudioInternal:buf frames:(UInt32)samples_to_write / 2];
 		if(!samples_read) break;
+		[self coreFramesRendered:samples_read];
 		silence_test_buffer.samples_written(samples_read * 2);
 		free_space -= samples_read;
 	}
@@ -1275,18 +1345,7 @@ static int usf_info(void *context, const char *name, const char *value) {
 		state_render(state, (s16 *)buf, frames);
 	} else if(type == 0x25) {
 		Player *player = (Player *)emulatorCore;
-		ncsf_loader_state *state = (ncsf_loader_state *)emulatorExtra;
-		std::vector<uint8_t> &buffer = state->outputBuffer;
-		unsigned long frames_to_do = frames;
-		while(frames_to_do) {
-			unsigned frames_this_run = 1024;
-			if(frames_this_run > frames_to_do)
-				frames_this_run = (unsigned int)frames_to_do;
-			player->GenerateSamples(buffer, 0, frames_this_run);
-			memcpy(buf, &buffer[0], frames_this_run * sizeof(int16_t) * 2);
-			buf = ((uint8_t *)buf) + frames_this_run * sizeof(int16_t) * 2;
-			frames_to_do -= frames_this_run;
-		}
+		player->GenerateSamples((int16_t *)buf, frames);
 	} else if(type == 0x41) {
 		uint32_t howmany = frames;
 		qsound_execute(emulatorCore, 0x7fffffff, (int16_t *)buf, &howmany);
@@ -1340,6 +1399,9 @@ static int usf_info(void *context, const char *name, const char *value) {
 }
 
 - (void)closeDecoder {
+	checkpoints.clear();
+	std::vector<uint8_t>().swap(checkpointScratch);
+
 	if(emulatorCore) {
 		if(type == 0x21) {
 			usf_shutdown(emulatorCore);
@@ -1354,6 +1416,9 @@ static int usf_info(void *context, const char *name, const char *value) {
 		} else if(type == 0x25) {
 			Player *player = (Player *)emulatorCore;
 			delete player;
+		} else if(type == 0x11 || type == 0x12) {
+			sega_enable_dsp_dynarec(emulatorCore, 0);
+			free(emulatorCore);
 		} else {
 			free(emulatorCore);
 		}
@@ -1361,6 +1426,10 @@ static int usf_info(void *context, const char *name, const char *value) {
 	}
 
 	if(type == 2 && emulatorExtra) {
+		unsigned long hits, misses, readAhead, discarded;
+		psf2fs_get_cache_stats(emulatorExtra, &hits, &misses);
+		psf2fs_get_read_ahead_stats(emulatorExtra, &readAhead, &discarded);
+		DLog(@"PSF2 block cache: %lu hits, %lu misses, %lu read ahead, %lu read ahead unused", hits, misses, readAhead, discarded);
 		psf2fs_delete(emulatorExtra);
 		emulatorExtra = nil;
 	} else if(type == 0x22 && emulatorExtra) {
@@ -1399,8 +1468,46 @@ static int usf_info(void *context, const char *name, const char *value) {
 	[self close];
 }
 
+- (BOOL)restoreCheckpoint:(long)frame {
+	size_t stateSize = [self checkpointStateSize];
+	if(!stateSize)
+		return NO;
+
+	// Checkpoints are taken at core positions, which include the leading silence
+	long target = frame + leadingSilenceFrames;
+	long position = coreFramesRendered;
+	if(frame >= framesRead) {
+		// Forwards, only worth it if a checkpoint lies beyond what is rendered already
+		if(checkpoints.find(target) <= position)
+			return NO;
+	}
+
+	BOOL scratch = [self checkpointUsesScratch];
+	if(scratch)
+		checkpointScratch.resize(stateSize);
+	long checkpointFrame = checkpoints.restore(target, scratch ? &checkpointScratch[0] : emulatorCore, stateSize);
+	if(checkpointFrame >= 0 && type == 0x21) {
+		if(usf_restore_checkpoint(emulatorCore, &checkpointScratch[0]) < 0)
+			checkpointFrame = -1;
+	} else if(checkpointFrame >= 0 && type == 0x24)
+		state_restore_checkpoint((NDS_state *)emulatorCore, &checkpointScratch[0]);
+	if(checkpointFrame < 0) {
+		// The core may be half overwritten, start over
+		[self closeDecoder];
+		return NO;
+	}
+
+	silence_test_buffer.read(NULL, silence_test_buffer.data_available());
+	coreFramesRendered = checkpointFrame;
+	framesRead = checkpointFrame - leadingSilenceFrames;
+
+	return YES;
+}
+
 - (long)seek:(long)frame {
-	if(frame < framesRead || emulatorCore == NULL) {
+	if(emulatorCore != NULL && [self restoreCheckpoint:frame]) {
+		// Resumes from the checkpoint below
+	} else if(frame < framesRead || emulatorCore == NULL) {
 		[self closeDecoder];
 		if(![self initializeDecoder])
 			return -1;
@@ -1423,23 +1530,26 @@ static int usf_info(void *context, const char *name, const char *value) {
 
 	if(type == 1 || type == 2) {
 		do {
-			uint32_t howmany = (uint32_t)(frame - framesRead);
+			uint32_t howmany = (uint32_t)[self seekStep:frame - framesRead];
 			if(psx_execute(emulatorCore, 0x7fffffff, 0, &howmany, 0) < 0) break;
 			framesRead += howmany;
+			[self coreFramesRendered:howmany];
 		} while(framesRead < frame);
 	} else if(type == 0x11 || type == 0x12) {
 		do {
-			uint32_t howmany = (uint32_t)(frame - framesRead);
+			uint32_t howmany = (uint32_t)[self seekStep:frame - framesRead];
 			if(sega_execute(emulatorCore, 0x7fffffff, 0, &howmany) < 0) break;
 			framesRead += howmany;
+			[self coreFramesRendered:howmany];
 		} while(framesRead < frame);
 	} else if(type == 0x21) {
 		do {
-			ssize_t howmany = frame - framesRead;
+			ssize_t howmany = [self seekStep:frame - framesRead];
 			if(howmany > 1024) howmany = 1024;
 			if(usf_render_resampled(emulatorCore, NULL, howmany, sampleRate) != 0)
 				return -1;
 			framesRead += howmany;
+			[self coreFramesRendered:howmany];
 		} while(framesRead < frame);
 	} else if(type == 0x22) {
 		struct mCore *core = (struct mCore *)emulatorCore;
@@ -1468,23 +1578,20 @@ static int usf_info(void *context, const char *name, const char *value) {
 		NDS_state *state = (NDS_state *)emulatorCore;
 		s16 temp[2048];
 
-		long frames_to_run = frame - framesRead;
-
-		while(frames_to_run) {
-			unsigned frames_this_run = 1024;
-			if(frames_this_run > frames_to_run)
-				frames_this_run = (unsigned)frames_to_run;
+		while(framesRead < frame) {
+			unsigned frames_this_run = (unsigned)[self seekStep:frame - framesRead];
+			if(frames_this_run > 1024)
+				frames_this_run = 1024;
 
 			state_render(state, temp, frames_this_run);
 
-			frames_to_run -= frames_this_run;
+			framesRead += frames_this_run;
+			[self coreFramesRendered:frames_this_run];
 		}
-
-		framesRead = frame;
 	} else if(type == 0x25) {
 		Player *player = (Player *)emulatorCore;
 		ncsf_loader_state *state = (ncsf_loader_state *)emulatorExtra;
-		std::vector<uint8_t> &buffer = state->outputBuffer;
+		std::vector<int16_t> &buffer = state->outputBuffer;
 
 		long frames_to_run = frame - framesRead;
 
@@ -1492,7 +1599,7 @@ static int usf_info(void *context, const char *name, const char *value) {
 			int frames_to_render = 1024;
 			if(frames_to_render > frames_to_run) frames_to_render = (int)frames_to_run;
 
-			player->GenerateSamples(buffer, 0, frames_to_render);
+			player->GenerateSamples(&buffer[0], frames_to_render);
 
 			frames_to_run -= frames_to_render;
 		}
@@ -1500,9 +1607,10 @@ static int usf_info(void *context, const char *name, const char *value) {
 		framesRead = frame;
 	} else if(type == 0x41) {
 		do {
-			uint32_t howmany = (uint32_t)(frame - framesRead);
+			uint32_t howmany = (uint32_t)[self seekStep:frame - framesRead];
 			if(qsound_execute(emulatorCore, 0x7fffffff, 0, &howmany) < 0) break;
 			framesRead += howmany;
+			[self coreFramesRendered:howmany];
 		} while(framesRead < frame);
 	}
 
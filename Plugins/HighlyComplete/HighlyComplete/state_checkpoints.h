@@ -0,0 +1,124 @@
+#ifndef _STATE_CHECKPOINTS_H_
+#define _STATE_CHECKPOINTS_H_
+
+#include <string.h>
+
+#include <utility>
+#include <vector>
+
+#include <zlib.h>
+
+// Snapshots of a flat emulator state blob, taken at regular intervals
+// during playback, so seeking can resume from the nearest one instead of
+// emulating everything from the start. Snapshots are deflated at the
+// fastest level, and when the memory budget is exceeded every other one
+// is dropped and the interval doubled, keeping the coverage uniform.
+class state_checkpoints {
+	struct checkpoint {
+		long frame;
+		bool compressed;
+		std::vector<unsigned char> data;
+	};
+
+	std::vector<checkpoint> list;
+	long interval;
+	long next_frame;
+	size_t budget;
+	size_t used;
+	std::vector<unsigned char> scratch;
+
+	void thin_out() {
+		while(used > budget && list.size() > 1) {
+			// Entry n was stored at the n-th interval, so keeping the even
+			// ones leaves one per doubled interval, plus the initial state
+			size_t keep = 0;
+			used = 0;
+			for(size_t i = 0; i < list.size(); i += 2) {
+				used += list[i].data.size();
+				if(keep != i) list[keep] = std::move(list[i]);
+				++keep;
+			}
+			list.resize(keep);
+			interval *= 2;
+			next_frame = (list.back().frame / interval + 1) * interval;
+		}
+	}
+
+	public:
+	state_checkpoints()
+	: interval(0), next_frame(0), budget(0), used(0) {
+	}
+
+	// Discards all checkpoints. interval is in frames, budget in bytes.
+	void reset(long p_interval, size_t p_budget) {
+		list.clear();
+		interval = p_interval;
+		next_frame = 0;
+		budget = p_budget;
+		used = 0;
+	}
+
+	void clear() {
+		std::vector<checkpoint>().swap(list);
+		std::vector<unsigned char>().swap(scratch);
+		used = 0;
+	}
+
+	// Frame at or after which the next checkpoint should be stored
+	long next() const {
+		return next_frame;
+	}
+
+	void store(long frame, const void* state, size_t size) {
+		if(frame < next_frame) return;
+
+		list.resize(list.size() + 1);
+		checkpoint& cp = list.back();
+		cp.frame = frame;
+		cp.compressed = false;
+
+		uLongf compressed_size = compressBound((uLong)size);
+		scratch.resize(compressed_size);
+		if(compress2(&scratch[0], &compressed_size, (const Bytef*)state, (uLong)size, Z_BEST_SPEED) == Z_OK && compressed_size < size) {
+			cp.compressed = true;
+			cp.data.assign(scratch.begin(), scratch.begin() + compressed_size);
+		} else {
+			cp.data.assign((const unsigned char*)state, (const unsigned char*)state + size);
+		}
+
+		used += cp.data.size();
+		next_frame = (frame / interval + 1) * interval;
+
+		thin_out();
+	}
+
+	// Frame of the latest checkpoint at or before frame, or -1 if there is none
+	long find(long frame) const {
+		long found = -1;
+		for(size_t i = 0; i < list.size() && list[i].frame <= frame; ++i)
+			found = list[i].frame;
+		return found;
+	}
+
+	// Restores the latest checkpoint at or before frame into state.
+	// Returns the frame of the checkpoint, or -1 if there is none.
+	long restore(long frame, void* state, size_t size) const {
+		const checkpoint* best = NULL;
+		for(size_t i = 0; i < list.size() && list[i].frame <= frame; ++i)
+			best = &list[i];
+		if(!best) return -1;
+
+		if(best->compressed) {
+			uLongf out_size = (uLongf)size;
+			if(uncompress((Bytef*)state, &out_size, &best->data[0], (uLong)best->data.size()) != Z_OK || out_size != size)
+				return -1;
+		} else {
+			if(best->data.size() != size) return -1;
+			memcpy(state, &best->data[0], size);
+		}
+
+		return best->frame;
+	}
+};
+
+#endif
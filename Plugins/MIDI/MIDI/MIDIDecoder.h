@@ -14,6 +14,7 @@
 
 class AUPlayer;
 class BMPlayer;
+class MIDIRenderCache;
 
 @interface MIDIDecoder : NSObject <CogDecoder> {
 	id<CogSource> source;
@@ -24,6 +25,9 @@ class BMPlayer;
 	MIDIPlayer* player;
 	midi_container midi_file;
 
+	MIDIRenderCache* renderCache;
+	BOOL servingCache;
+
 	NSString* globalSoundFontPath;
 	BOOL soundFontsAssigned;
 	BOOL isLooped;
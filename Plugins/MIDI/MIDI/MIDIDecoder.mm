@@ -11,6 +11,9 @@
 #import "AUPlayer.h"
 #import "BMPlayer.h"
 #import "MSPlayer.h"
+#import "MT32Player.h"
+
+#import "MIDIRenderCache.h"
 
 #import "Logging.h"
 
@@ -181,21 +184,40 @@ static OSType getOSType(const char *in_) {
 		}
 	}
 
+	// Only SoundFont and MT-32 rendering are expensive enough to be worth
+	// caching. The DLS/AU and OPL backends render live.
+	BOOL cacheable = NO;
+	NSString *mt32RomDescription = nil;
+
 	if(!plugin || [plugin isEqualToString:@"BASSMIDI"]) {
-		bmplayer = new BMPlayer;
+		bmplayer = [self newBMPlayer:soundFontPath];
 
-		bool resamplingSinc = false;
-		NSString *resampling = [[NSUserDefaults standardUserDefaults] stringForKey:@"resampling"];
-		if([resampling isEqualToString:@"sinc"])
-			resamplingSinc = true;
+		player = bmplayer;
+		cacheable = YES;
+	} else if([plugin isEqualToString:@"MT32EMU0"]) {
+		// The ROMs are looked for in Application Support/Cog/MT-32, as
+		// MT32_CONTROL.ROM and MT32_PCM.ROM, or the CM32L_ pair
+		NSArray *paths = NSSearchPathForDirectoriesInDomains(NSApplicationSupportDirectory, NSUserDomainMask, YES);
+		NSString *romPath = [[[paths firstObject] stringByAppendingPathComponent:@"Cog"] stringByAppendingPathComponent:@"MT-32"];
+		NSString *controlRomPath = [romPath stringByAppendingPathComponent:@"CM32L_CONTROL.ROM"];
+		if(![[NSFileManager defaultManager] fileExistsAtPath:controlRomPath])
+			controlRomPath = [romPath stringByAppendingPathComponent:@"MT32_CONTROL.ROM"];
+		if(![[NSFileManager defaultManager] fileExistsAtPath:controlRomPath]) {
+			ALog(@"No MT-32 control ROM in %@", romPath);
+			return NO;
+		}
+		mt32RomDescription = [MIDIDecoder soundFontDescription:controlRomPath];
 
-		bmplayer->setSincInterpolation(resamplingSinc);
-		bmplayer->setSampleRate(44100);
+		MT32Player *mt32player = new MT32Player;
+		player = mt32player;
 
-		if([soundFontPath length])
-			bmplayer->setFileSoundFont([soundFontPath UTF8String]);
+		mt32player->setBasePath([[romPath stringByAppendingString:@"/"] UTF8String]);
 
-		player = bmplayer;
+		mt32player->setSampleRate(44100);
+
+		// GM and GS resets mean nothing to it
+		mode = MIDIPlayer::filter_default;
+		cacheable = YES;
 	} else if([[plugin substringToIndex:4] isEqualToString:@"DOOM"]) {
 		MSPlayer *msplayer = new MSPlayer;
 		player = msplayer;
@@ -249,9 +271,65 @@ static OSType getOSType(const char *in_) {
 	if(!player->Load(midi_file, track_num, loop_mode, clean_flags))
 		return NO;
 
+	if(cacheable && [[NSUserDefaults standardUserDefaults] boolForKey:@"midi.renderCache"]) {
+		std::vector<uint8_t> file_data;
+
+		[source seek:0 whence:SEEK_END];
+		size_t size = [source tell];
+		[source seek:0 whence:SEEK_SET];
+		file_data.resize(size);
+		[source read:&file_data[0] amount:size];
+
+		NSString *fileDigest = [NSString stringWithUTF8String:MIDIRenderCache::makeKey(&file_data[0], size, "").c_str()];
+		NSString *config = [NSString stringWithFormat:@"%@|%d|%@|%@|%@|%@|%@|%d|%d|%u", fileDigest, track_num, plugin, flavor, [[NSUserDefaults standardUserDefaults] stringForKey:@"resampling"], [MIDIDecoder soundFontDescription:soundFontPath], [MIDIDecoder soundFontDescription:globalSoundFontPath], 44100, isLooped, clean_flags];
+		if(mt32RomDescription)
+			config = [config stringByAppendingFormat:@"|%@", mt32RomDescription];
+		NSArray *cachePaths = NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES);
+		NSString *cachePath = [[[cachePaths firstObject] stringByAppendingPathComponent:[[NSBundle mainBundle] bundleIdentifier]] stringByAppendingPathComponent:@"MIDIRenderCache"];
+		const char *configString = [config UTF8String];
+		NSString *entryPath = [cachePath stringByAppendingPathComponent:[NSString stringWithUTF8String:MIDIRenderCache::makeKey(configString, strlen(configString), "").c_str()]];
+
+		if([[NSFileManager defaultManager] createDirectoryAtPath:entryPath withIntermediateDirectories:YES attributes:nil error:nil]) {
+			uint64_t budget = (uint64_t)[[NSUserDefaults standardUserDefaults] integerForKey:@"midi.renderCacheSize"] * 1024 * 1024;
+			if(budget)
+				MIDIRenderCache::trim([cachePath fileSystemRepresentation], budget, [entryPath fileSystemRepresentation]);
+
+			renderCache = new MIDIRenderCache([entryPath fileSystemRepresentation], totalFrames);
+
+			// Only a complete entry is played from, so playback never has to
+			// move from the cache to the synth partway through. Otherwise the
+			// synth records the entry while it plays.
+			servingCache = renderCache->isComplete();
+		}
+	}
+
 	return YES;
 }
 
+- (BMPlayer *)newBMPlayer:(NSString *)soundFontPath {
+	BMPlayer *bmplayer = new BMPlayer;
+
+	bool resamplingSinc = false;
+	NSString *resampling = [[NSUserDefaults standardUserDefaults] stringForKey:@"resampling"];
+	if([resampling isEqualToString:@"sinc"])
+		resamplingSinc = true;
+
+	bmplayer->setSincInterpolation(resamplingSinc);
+	bmplayer->setSampleRate(44100);
+
+	if([soundFontPath length])
+		bmplayer->setFileSoundFont([soundFontPath UTF8String]);
+
+	return bmplayer;
+}
+
++ (NSString *)soundFontDescription:(NSString *)path {
+	if(![path length])
+		return @"";
+	NSDate *modified = [[[NSFileManager defaultManager] attributesOfItemAtPath:path error:nil] fileModificationDate];
+	return [NSString stringWithFormat:@"%@@%f", path, [modified timeIntervalSince1970]];
+}
+
 - (int)readAudio:(void *)buf frames:(UInt32)frames {
 	BOOL repeatone = IsRepeatOneSet();
 	long localFramesLength = framesLength;
@@ -278,7 +356,29 @@ static OSType getOSType(const char *in_) {
 		soundFontsAssigned = YES;
 	}
 
-	UInt32 frames_done = player->Play((float *)buf, frames);
+	UInt32 frames_done = 0;
+
+	if(servingCache) {
+		frames_done = (UInt32)renderCache->read(framesRead, (float *)buf, frames);
+		if(!frames_done) {
+			// Only repeat one looping past the end, or a damaged chunk, gets
+			// here. The synth sat idle all along, so it has to catch up.
+			player->Seek(framesRead);
+			servingCache = NO;
+		}
+	}
+
+	if(!frames_done) {
+		frames_done = player->Play((float *)buf, frames);
+
+		if(renderCache) {
+			// Repeat one changes how the end of the song is rendered
+			if(repeatone)
+				renderCache->stopRecording();
+			else
+				renderCache->record(framesRead, (const float *)buf, frames_done);
+		}
+	}
 
 	if(!frames_done)
 		return 0;
@@ -323,7 +423,12 @@ static OSType getOSType(const char *in_) {
 			return -1;
 	}
 
-	player->Seek(frame);
+	// Played from the cache, the synth is left where it is
+	if(!servingCache) {
+		player->Seek(frame);
+		if(renderCache)
+			renderCache->stopRecording();
+	}
 
 	framesRead = frame;
 
@@ -331,6 +436,9 @@ static OSType getOSType(const char *in_) {
 }
 
 - (void)close {
+	delete renderCache;
+	renderCache = NULL;
+	servingCache = NO;
 	delete player;
 	player = NULL;
 }
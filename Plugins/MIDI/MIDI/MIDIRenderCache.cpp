@@ -0,0 +1,260 @@
+#include "MIDIRenderCache.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include <CommonCrypto/CommonDigest.h>
+
+#include <zlib.h>
+
+// Chunk file layout: header, then the deflated sample data. The samples are
+// split into byte planes before compression, which lets deflate find the
+// redundancy in the sign/exponent bytes of neighboring float samples.
+typedef struct {
+	char magic[4];
+	uint32_t frames;
+	uint32_t compressed_size;
+} chunk_header;
+
+static const char chunk_magic[4] = { 'M', 'R', 'C', '1' };
+
+MIDIRenderCache::MIDIRenderCache(const char* path, unsigned long totalFrames)
+: sPath(path), uTotalFrames(totalFrames), uCurrentChunk(~(size_t)0), uCurrentFrames(0), uRecordFrame(0), bRecording(true) {
+	uChunkCount = (totalFrames + chunk_frames - 1) / chunk_frames;
+	bChunkPresent.resize(uChunkCount, false);
+	for(size_t i = 0; i < uChunkCount; ++i) {
+		bChunkPresent[i] = access(chunkPath(i).c_str(), R_OK) == 0;
+	}
+
+	// The modification time of the entry is its last use, for trim()
+	utimes(sPath.c_str(), NULL);
+
+	if(isComplete()) bRecording = false;
+}
+
+std::string MIDIRenderCache::makeKey(const void* fileData, size_t fileSize, const char* config) {
+	uint8_t digest[CC_SHA256_DIGEST_LENGTH];
+	CC_SHA256_CTX ctx;
+	CC_SHA256_Init(&ctx);
+	CC_SHA256_Update(&ctx, fileData, (CC_LONG)fileSize);
+	CC_SHA256_Update(&ctx, config, (CC_LONG)strlen(config));
+	CC_SHA256_Final(&digest[0], &ctx);
+
+	std::string key;
+	char hex[3];
+	for(size_t i = 0; i < sizeof(digest); ++i) {
+		snprintf(hex, sizeof(hex), "%02x", digest[i]);
+		key += hex;
+	}
+	return key;
+}
+
+std::string MIDIRenderCache::chunkPath(size_t index) const {
+	char name[32];
+	snprintf(name, sizeof(name), "/%06zu.chunk", index);
+	return sPath + name;
+}
+
+bool MIDIRenderCache::isComplete() const {
+	for(size_t i = 0; i < uChunkCount; ++i) {
+		if(!bChunkPresent[i]) return false;
+	}
+	return true;
+}
+
+unsigned long MIDIRenderCache::read(unsigned long frame, float* out, unsigned long count) {
+	if(frame >= uTotalFrames) return 0;
+
+	size_t index = frame / chunk_frames;
+	if(!bChunkPresent[index]) return 0;
+	if(index != uCurrentChunk && !loadChunk(index)) {
+		// Unreadable or damaged, render it live instead
+		bChunkPresent[index] = false;
+		return 0;
+	}
+
+	unsigned long offset = frame - index * chunk_frames;
+	if(offset >= uCurrentFrames) return 0;
+	if(count > uCurrentFrames - offset) count = uCurrentFrames - offset;
+	memcpy(out, &fCurrentChunk[offset * 2], count * 2 * sizeof(float));
+	return count;
+}
+
+bool MIDIRenderCache::loadChunk(size_t index) {
+	uCurrentChunk = ~(size_t)0;
+
+	FILE* f = fopen(chunkPath(index).c_str(), "rb");
+	if(!f) return false;
+
+	chunk_header header;
+	std::vector<uint8_t> compressed;
+	bool ok = fread(&header, sizeof(header), 1, f) == 1 && memcmp(header.magic, chunk_magic, 4) == 0 && header.frames <= chunk_frames;
+	if(ok) {
+		compressed.resize(header.compressed_size);
+		ok = fread(&compressed[0], 1, header.compressed_size, f) == header.compressed_size;
+	}
+	fclose(f);
+	if(!ok) return false;
+
+	const size_t samples = header.frames * 2;
+	std::vector<uint8_t> planes(samples * sizeof(float));
+	uLongf planesSize = (uLongf)planes.size();
+	if(uncompress(&planes[0], &planesSize, &compressed[0], header.compressed_size) != Z_OK || planesSize != planes.size())
+		return false;
+
+	fCurrentChunk.resize(samples);
+	uint8_t* dest = (uint8_t*)&fCurrentChunk[0];
+	for(size_t i = 0; i < samples; ++i) {
+		for(size_t j = 0; j < sizeof(float); ++j) {
+			dest[i * sizeof(float) + j] = planes[j * samples + i];
+		}
+	}
+
+	uCurrentChunk = index;
+	uCurrentFrames = header.frames;
+	return true;
+}
+
+bool MIDIRenderCache::storeChunk(size_t index, const float* data, unsigned long frames) {
+	const size_t samples = frames * 2;
+	std::vector<uint8_t> planes(samples * sizeof(float));
+	const uint8_t* src = (const uint8_t*)data;
+	for(size_t i = 0; i < samples; ++i) {
+		for(size_t j = 0; j < sizeof(float); ++j) {
+			planes[j * samples + i] = src[i * sizeof(float) + j];
+		}
+	}
+
+	uLongf compressedSize = compressBound((uLong)planes.size());
+	std::vector<uint8_t> compressed(compressedSize);
+	if(compress2(&compressed[0], &compressedSize, &planes[0], (uLong)planes.size(), 6) != Z_OK)
+		return false;
+
+	chunk_header header;
+	memcpy(header.magic, chunk_magic, 4);
+	header.frames = (uint32_t)frames;
+	header.compressed_size = (uint32_t)compressedSize;
+
+	// Write under a temporary name, so a chunk is either complete or absent
+	std::string path = chunkPath(index);
+	std::string tempPath = path + ".tmp";
+	FILE* f = fopen(tempPath.c_str(), "wb");
+	if(!f) return false;
+	bool ok = fwrite(&header, sizeof(header), 1, f) == 1 && fwrite(&compressed[0], 1, compressedSize, f) == compressedSize;
+	ok = (fclose(f) == 0) && ok;
+	if(!ok || rename(tempPath.c_str(), path.c_str()) != 0) {
+		unlink(tempPath.c_str());
+		return false;
+	}
+
+	bChunkPresent[index] = true;
+	return true;
+}
+
+void MIDIRenderCache::record(unsigned long frame, const float* data, unsigned long count) {
+	if(!bRecording) return;
+
+	// Anything but the frames following the last ones means the synth was
+	// seeked, and its output may no longer match a continuous render
+	if(frame != uRecordFrame) {
+		stopRecording();
+		return;
+	}
+
+	if(count > uTotalFrames - frame) count = uTotalFrames - frame;
+	if(fRecordChunk.empty()) fRecordChunk.resize(chunk_frames * 2);
+
+	while(count) {
+		size_t index = frame / chunk_frames;
+		unsigned long offset = frame - index * chunk_frames;
+		unsigned long todo = chunk_frames - offset;
+		if(todo > count) todo = count;
+
+		memcpy(&fRecordChunk[offset * 2], data, todo * 2 * sizeof(float));
+		frame += todo;
+		data += todo * 2;
+		count -= todo;
+
+		if(offset + todo == chunk_frames || frame == uTotalFrames) {
+			if(!bChunkPresent[index] && !storeChunk(index, &fRecordChunk[0], offset + todo)) {
+				// Out of space or the entry was trimmed, leave it at that
+				stopRecording();
+				return;
+			}
+		}
+	}
+
+	uRecordFrame = frame;
+	if(uRecordFrame >= uTotalFrames) stopRecording();
+}
+
+void MIDIRenderCache::stopRecording() {
+	bRecording = false;
+	std::vector<float>().swap(fRecordChunk);
+}
+
+void MIDIRenderCache::trim(const char* root, uint64_t budget, const char* keep) {
+	struct entry {
+		std::string path;
+		uint64_t size;
+		time_t used;
+
+		bool operator<(const entry& other) const {
+			return used < other.used;
+		}
+	};
+
+	DIR* dir = opendir(root);
+	if(!dir) return;
+
+	std::vector<entry> entries;
+	uint64_t total = 0;
+	struct dirent* de;
+	while((de = readdir(dir)) != NULL) {
+		if(de->d_name[0] == '.') continue;
+
+		entry e;
+		e.path = std::string(root) + "/" + de->d_name;
+		struct stat st;
+		if(stat(e.path.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)) continue;
+		e.used = st.st_mtime;
+		e.size = 0;
+
+		DIR* chunks = opendir(e.path.c_str());
+		if(!chunks) continue;
+		struct dirent* ce;
+		while((ce = readdir(chunks)) != NULL) {
+			if(ce->d_name[0] == '.') continue;
+			if(stat((e.path + "/" + ce->d_name).c_str(), &st) == 0)
+				e.size += st.st_size;
+		}
+		closedir(chunks);
+
+		total += e.size;
+		if(!keep || e.path != keep) entries.push_back(e);
+	}
+	closedir(dir);
+
+	std::sort(entries.begin(), entries.end());
+
+	for(size_t i = 0; i < entries.size(); ++i) {
+		if(budget && total <= budget) break;
+
+		DIR* chunks = opendir(entries[i].path.c_str());
+		if(!chunks) continue;
+		struct dirent* ce;
+		while((ce = readdir(chunks)) != NULL) {
+			if(ce->d_name[0] == '.') continue;
+			unlink((entries[i].path + "/" + ce->d_name).c_str());
+		}
+		closedir(chunks);
+		rmdir(entries[i].path.c_str());
+		total -= entries[i].size;
+	}
+}
@@ -0,0 +1,67 @@
+#ifndef __MIDIRenderCache_h__
+#define __MIDIRenderCache_h__
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+// On-disk cache of rendered stereo float PCM for one (file, subsong, synth
+// configuration) combination, stored as losslessly compressed fixed-size
+// chunks. Chunks are recorded from the output of the playback synth while it
+// plays from frame zero without seeking, so cached audio is identical to what
+// a continuous live render produces, and no second synth is ever run.
+class MIDIRenderCache {
+	public:
+	enum {
+		chunk_frames = 65536
+	};
+
+	// path is the directory holding the chunks of this cache entry
+	MIDIRenderCache(const char* path, unsigned long totalFrames);
+
+	// Builds the directory name for an entry from the file contents and a
+	// description of everything else that affects the rendered audio.
+	static std::string makeKey(const void* fileData, size_t fileSize, const char* config);
+
+	// Removes the least recently used entries below root until the entries
+	// take up no more than budget bytes. The entry at keep, if any, is left
+	// alone. A budget of 0 purges everything else.
+	static void trim(const char* root, uint64_t budget, const char* keep);
+
+	// True if every chunk of the entry is on disk, in which case the whole
+	// range can be played from the cache.
+	bool isComplete() const;
+
+	// Copies up to count cached frames starting at frame into out.
+	// Returns the number of frames copied, 0 if frame isn't cached or its
+	// chunk can't be read.
+	unsigned long read(unsigned long frame, float* out, unsigned long count);
+
+	// Hands the cache the frames the synth rendered starting at frame.
+	// Chunks that are missing are written as they fill up, for as long as
+	// the frames follow on from frame zero without a gap.
+	void record(unsigned long frame, const float* data, unsigned long count);
+	void stopRecording();
+
+	private:
+	std::string chunkPath(size_t index) const;
+	bool loadChunk(size_t index);
+	bool storeChunk(size_t index, const float* data, unsigned long frames);
+
+	std::string sPath;
+	unsigned long uTotalFrames;
+	size_t uChunkCount;
+
+	std::vector<bool> bChunkPresent;
+
+	std::vector<float> fCurrentChunk;
+	size_t uCurrentChunk;
+	unsigned long uCurrentFrames;
+
+	std::vector<float> fRecordChunk;
+	unsigned long uRecordFrame;
+	bool bRecording;
+};
+
+#endif
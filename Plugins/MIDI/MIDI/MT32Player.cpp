@@ -2,9 +2,15 @@
 
 #include <stdio.h>
 
+#include "resampler.h"
+
+// The resampler works on integers, this keeps 24 bits of the float output
+static const float resampler_scale = 8388608.0f;
+
 MT32Player::MT32Player(bool gm, unsigned gm_set)
-: bGM(gm), uGMSet(gm_set), MIDIPlayer() {
+: bGM(gm), uGMSet(gm_set), uRenderThreads(0), MIDIPlayer() {
 	_synth = NULL;
+	resampler = NULL;
 	controlRom = NULL;
 	pcmRom = NULL;
 	controlRomFile = NULL;
@@ -12,34 +18,47 @@ MT32Player::MT32Player(bool gm, unsigned gm_set)
 }
 
 MT32Player::~MT32Player() {
-	if(_synth) {
-		_synth->close();
-		delete _synth;
-	}
-	if(controlRom) {
-		MT32Emu::ROMImage::freeROMImage(controlRom);
-	}
-	if(pcmRom) {
-		MT32Emu::ROMImage::freeROMImage(pcmRom);
-	}
-	delete controlRomFile;
-	delete pcmRomFile;
+	shutdown();
 }
 
 void MT32Player::send_event(uint32_t b) {
-	if(!(b & 0x80000000)) {
-		_synth->playMsg(b);
-	} else {
-		uint32_t n = b & 0xffffff;
-		const uint8_t *data;
-		size_t size, port;
-		mSysexMap.get_entry(n, data, size, port);
-		_synth->playSysex(data, (MT32Emu::Bit32u)size);
-	}
+	_synth->playMsg(b);
+}
+
+void MT32Player::send_sysex(const uint8_t *data, size_t size, size_t port) {
+	_synth->playSysex(data, (MT32Emu::Bit32u)size);
 }
 
 void MT32Player::render(float *out, unsigned long count) {
-	_synth->render(out, (MT32Emu::Bit32u)count);
+	if(!resampler) {
+		_synth->render(out, (MT32Emu::Bit32u)count);
+		return;
+	}
+
+	// Below half of the resampler input buffer, so the silence it pads the
+	// very first write with always fits
+	float buffer[64 * 2];
+	while(count) {
+		unsigned long avail = resampler_get_avail(resampler) / 2;
+		if(avail) {
+			if(avail > count) avail = count;
+			count -= avail;
+			while(avail--) {
+				sample_t ls, rs;
+				resampler_read_pair(resampler, &ls, &rs);
+				*out++ = ls * (1.0f / resampler_scale);
+				*out++ = rs * (1.0f / resampler_scale);
+			}
+			continue;
+		}
+
+		unsigned int todo = resampler_get_free(resampler) / 2;
+		if(todo > 64) todo = 64;
+		_synth->render(buffer, todo);
+		for(unsigned int i = 0; i < todo; ++i) {
+			resampler_write_pair(resampler, (sample_t)(buffer[i * 2 + 0] * resampler_scale), (sample_t)(buffer[i * 2 + 1] * resampler_scale));
+		}
+	}
 }
 
 void MT32Player::setBasePath(const char *in) {
@@ -47,6 +66,11 @@ void MT32Player::setBasePath(const char *in) {
 	shutdown();
 }
 
+void MT32Player::setRenderThreads(unsigned threads) {
+	uRenderThreads = threads;
+	if(_synth) _synth->setPartialRenderingThreadCount(threads);
+}
+
 void MT32Player::shutdown() {
 	if(_synth) {
 		_synth->close();
@@ -60,7 +84,11 @@ void MT32Player::shutdown() {
 	}
 	delete controlRomFile;
 	delete pcmRomFile;
+	if(resampler) {
+		resampler_destroy(resampler);
+	}
 	_synth = 0;
+	resampler = 0;
 	controlRom = 0;
 	pcmRom = 0;
 	controlRomFile = 0;
@@ -87,11 +115,19 @@ bool MT32Player::startup() {
 	pcmRom = MT32Emu::ROMImage::makeROMImage(pcmRomFile);
 	if(!pcmRom) return false;
 	_synth = new MT32Emu::Synth;
+	// Only pays off with the 256 partials of the GM mode
+	_synth->setPartialRenderingThreadCount(uRenderThreads);
 	if(!_synth->open(*controlRom, *pcmRom, bGM ? 256 : 32, MT32Emu::AnalogOutputMode_COARSE, bGM)) {
 		delete _synth;
 		_synth = 0;
 		return false;
 	}
+	unsigned rate = _synth->getStereoOutputSampleRate();
+	if(rate != uSampleRate) {
+		resampler = resampler_create();
+		if(!resampler) return false;
+		resampler_set_rate(resampler, (double)rate / (double)uSampleRate);
+	}
 	reset();
 	return true;
 }
@@ -17,9 +17,11 @@ class MT32Player : public MIDIPlayer {
 
 	// configuration
 	void setBasePath(const char *in);
+	void setRenderThreads(unsigned threads);
 
 	protected:
 	virtual void send_event(uint32_t b);
+	virtual void send_sysex(const uint8_t *data, size_t size, size_t port);
 	virtual void render(float *out, unsigned long count);
 
 	virtual void shutdown();
@@ -34,6 +36,10 @@ class MT32Player : public MIDIPlayer {
 
 	bool bGM;
 	unsigned uGMSet;
+	unsigned uRenderThreads;
+
+	// Takes the synth's own output rate to the player's, when they differ
+	void *resampler;
 
 	void reset();
 
@@ -464,7 +464,7 @@ static void OPL3_EnvelopeKeyOff(opl3_slot *slot, Bit8u type) {
 // Phase Generator
 //
 
-static void OPL3_PhaseGenerate(opl3_slot *slot) {
+static Bit32u OPL3_PhaseIncrement(opl3_slot *slot) {
 	Bit16u f_num;
 	Bit32u basefreq;
 
@@ -489,7 +489,11 @@ static void OPL3_PhaseGenerate(opl3_slot *slot) {
 		f_num += range;
 	}
 	basefreq = (f_num << slot->channel->block) >> 1;
-	slot->pg_phase += (basefreq * mt[slot->reg_mult]) >> 1;
+	return (basefreq * mt[slot->reg_mult]) >> 1;
+}
+
+static void OPL3_PhaseGenerate(opl3_slot *slot) {
+	slot->pg_phase += OPL3_PhaseIncrement(slot);
 }
 
 //
@@ -1034,6 +1038,347 @@ void OPL3_GenerateResampled(opl3_chip *chip, Bit16s *buf) {
 	chip->samplecnt += 1 << RSM_FRAC;
 }
 
+//
+// Block generation
+//
+// Registers are only written between blocks, and within a frame the phase
+// and envelope of a slot don't depend on any other slot. So for a block the
+// phase and envelope state of all 36 slots is moved into the arrays below,
+// and at the start of each frame it is advanced for all of them in one pass,
+// as straight loops over those arrays. Only the operator outputs, which feed
+// each other through the modulation inputs, are then generated one by one,
+// in the order OPL3_Generate uses, so the output is identical.
+//
+// Whatever follows from the registers alone is worked out once per block:
+// the phase increment of every slot, the envelope rate of each stage, the
+// total level and KSL part of the envelope level, and for each side the
+// channel outputs that are routed to it and aren't tied to zeromod.
+//
+
+typedef struct {
+	Bit32u pg_phase[36];
+	Bit32u pg_inc[36];
+	Bit16s eg_rout[36];
+	Bit16s eg_out[36];
+	Bit16s eg_base[36];
+	Bit16s eg_sl[36];
+	Bit8u eg_gen[36];
+	Bit8u eg_rate[36];
+	Bit8u eg_inc[36];
+	Bit8u eg_stage_rate[5][36];
+	Bit8u trem_mask[36];
+	Bit8u sustain[36];
+	Bit8u vib_slots[36];
+	Bit8u vib_count;
+	Bit8u vibpos;
+	Bit16s *mix_out[2][72];
+	Bit8u mix_count[2][18];
+	Bit16u mix_gain[2][18];
+	Bit8u mix_channels[2];
+} opl3_block;
+
+static void OPL3_BlockSetup(opl3_chip *chip, opl3_block *block) {
+	Bit8u ii;
+	Bit8u jj;
+	Bit8u side;
+
+	block->vib_count = 0;
+	block->vibpos = chip->vibpos;
+	for(ii = 0; ii < 36; ii++) {
+		opl3_slot *slot = &chip->slot[ii];
+		block->pg_phase[ii] = slot->pg_phase;
+		block->pg_inc[ii] = OPL3_PhaseIncrement(slot);
+		if(slot->reg_vib) {
+			block->vib_slots[block->vib_count++] = ii;
+		}
+		block->eg_rout[ii] = slot->eg_rout;
+		block->eg_out[ii] = slot->eg_out;
+		block->eg_base[ii] = (slot->reg_tl << 2) + (slot->eg_ksl >> kslshift[slot->reg_ksl]);
+		block->eg_sl[ii] = slot->reg_sl << 4;
+		block->eg_gen[ii] = slot->eg_gen;
+		block->eg_rate[ii] = slot->eg_rate;
+		block->eg_inc[ii] = slot->eg_inc;
+		block->eg_stage_rate[envelope_gen_num_off][ii] = OPL3_EnvelopeCalcRate(slot, slot->reg_ar);
+		block->eg_stage_rate[envelope_gen_num_attack][ii] = OPL3_EnvelopeCalcRate(slot, slot->reg_ar);
+		block->eg_stage_rate[envelope_gen_num_decay][ii] = OPL3_EnvelopeCalcRate(slot, slot->reg_dr);
+		block->eg_stage_rate[envelope_gen_num_sustain][ii] = OPL3_EnvelopeCalcRate(slot, slot->reg_rr);
+		block->eg_stage_rate[envelope_gen_num_release][ii] = OPL3_EnvelopeCalcRate(slot, slot->reg_rr);
+		block->trem_mask[ii] = (slot->trem == &chip->tremolo) ? 0xff : 0x00;
+		block->sustain[ii] = slot->reg_type;
+	}
+
+	for(side = 0; side < 2; side++) {
+		Bit16s **out = block->mix_out[side];
+		Bit8u channels = 0;
+		for(ii = 0; ii < 18; ii++) {
+			opl3_channel *channel = &chip->channel[ii];
+			Bit16u gain = side ? channel->chb : channel->cha;
+			Bit8u count = 0;
+			if(!gain) {
+				continue;
+			}
+			for(jj = 0; jj < 4; jj++) {
+				if(channel->out[jj] != &chip->zeromod) {
+					out[count++] = channel->out[jj];
+				}
+			}
+			if(count) {
+				block->mix_count[side][channels] = count;
+				block->mix_gain[side][channels] = gain;
+				channels++;
+				out += count;
+			}
+		}
+		block->mix_channels[side] = channels;
+	}
+}
+
+// Puts the phase and envelope state back, for register writes and
+// OPL3_Generate
+static void OPL3_BlockFinish(opl3_chip *chip, opl3_block *block) {
+	Bit8u ii;
+
+	for(ii = 0; ii < 36; ii++) {
+		opl3_slot *slot = &chip->slot[ii];
+		slot->pg_phase = block->pg_phase[ii];
+		slot->eg_rout = block->eg_rout[ii];
+		slot->eg_out = block->eg_out[ii];
+		slot->eg_gen = block->eg_gen[ii];
+		slot->eg_rate = block->eg_rate[ii];
+		slot->eg_inc = block->eg_inc[ii];
+	}
+}
+
+// OPL3_SlotCalcFB, OPL3_PhaseGenerate and OPL3_EnvelopeCalc for every slot
+static void OPL3_BlockSlotsCalc(opl3_chip *chip, opl3_block *block) {
+	Bit8u ii;
+	Bit16u timer = chip->timer;
+	Bit8u tremolo = chip->tremolo;
+
+	for(ii = 0; ii < 36; ii++) {
+		OPL3_SlotCalcFB(&chip->slot[ii]);
+	}
+
+	// Vibrato only changes the increment when vibpos moves on
+	if(block->vib_count && block->vibpos != chip->vibpos) {
+		block->vibpos = chip->vibpos;
+		for(ii = 0; ii < block->vib_count; ii++) {
+			Bit8u jj = block->vib_slots[ii];
+			block->pg_inc[jj] = OPL3_PhaseIncrement(&chip->slot[jj]);
+		}
+	}
+	for(ii = 0; ii < 36; ii++) {
+		block->pg_phase[ii] += block->pg_inc[ii];
+	}
+
+	for(ii = 0; ii < 36; ii++) {
+		block->eg_out[ii] = block->eg_rout[ii] + block->eg_base[ii] + (tremolo & block->trem_mask[ii]);
+	}
+
+	for(ii = 0; ii < 36; ii++) {
+		Bit8u rate_h, rate_l;
+		Bit8u inc = 0;
+		Bit16s rout = block->eg_rout[ii];
+		Bit8u gen = block->eg_gen[ii];
+		rate_h = block->eg_rate[ii] >> 2;
+		rate_l = block->eg_rate[ii] & 3;
+		if(eg_incsh[rate_h] > 0) {
+			if((timer & ((1 << eg_incsh[rate_h]) - 1)) == 0) {
+				inc = eg_incstep[eg_incdesc[rate_h]][rate_l]
+				                [(timer >> eg_incsh[rate_h]) & 0x07];
+			}
+		} else {
+			inc = eg_incstep[eg_incdesc[rate_h]][rate_l]
+			                [timer & 0x07]
+			      << (-eg_incsh[rate_h]);
+		}
+		block->eg_inc[ii] = inc;
+
+		// The envelope_gen stages, with the rates taken from the block
+		switch(gen) {
+			case envelope_gen_num_off:
+				rout = 0x1ff;
+				break;
+			case envelope_gen_num_attack:
+				if(rout == 0x00) {
+					gen = envelope_gen_num_decay;
+				} else {
+					rout += ((~rout) * inc) >> 3;
+					if(rout < 0x00) {
+						rout = 0x00;
+					}
+				}
+				break;
+			case envelope_gen_num_decay:
+				if(rout >= block->eg_sl[ii]) {
+					gen = envelope_gen_num_sustain;
+				} else {
+					rout += inc;
+				}
+				break;
+			case envelope_gen_num_sustain:
+			case envelope_gen_num_release:
+				if(gen == envelope_gen_num_sustain && block->sustain[ii]) {
+					break;
+				}
+				if(rout >= 0x1ff) {
+					gen = envelope_gen_num_off;
+					rout = 0x1ff;
+				} else {
+					rout += inc;
+				}
+				break;
+		}
+		if(gen != block->eg_gen[ii]) {
+			block->eg_gen[ii] = gen;
+			block->eg_rate[ii] = block->eg_stage_rate[gen][ii];
+		}
+		block->eg_rout[ii] = rout;
+	}
+}
+
+static void OPL3_BlockSlotGeneratePhase(opl3_chip *chip, opl3_block *block, Bit8u ii, Bit16u phase) {
+	opl3_slot *slot = &chip->slot[ii];
+	slot->out = envelope_sin[slot->reg_wf](phase, block->eg_out[ii]);
+}
+
+static void OPL3_BlockSlotGenerate(opl3_chip *chip, opl3_block *block, Bit8u ii) {
+	OPL3_BlockSlotGeneratePhase(chip, block, ii, (Bit16u)(block->pg_phase[ii] >> 9) + *chip->slot[ii].mod);
+}
+
+// OPL3_GenerateRhythm1 and 2 on the block state. Slots 12 to 17 belong to
+// channels 6 to 8. The first half runs before OPL3_Generate has advanced
+// the phase of slot 17, so it is given the phase from before the frame.
+static void OPL3_BlockRhythm1(opl3_chip *chip, opl3_block *block, Bit32u pg_phase17) {
+	Bit16u phase14;
+	Bit16u phase17;
+	Bit16u phase;
+	Bit16u phasebit;
+
+	OPL3_BlockSlotGenerate(chip, block, 12);
+	phase14 = (block->pg_phase[13] >> 9) & 0x3ff;
+	phase17 = (pg_phase17 >> 9) & 0x3ff;
+	// hh tc phase bit
+	phasebit = ((phase14 & 0x08) | (((phase14 >> 5) ^ phase14) & 0x04) | (((phase17 >> 2) ^ phase17) & 0x08)) ? 0x01 : 0x00;
+	// hh
+	phase = (phasebit << 9) | (0x34 << ((phasebit ^ (chip->noise & 0x01) << 1)));
+	OPL3_BlockSlotGeneratePhase(chip, block, 13, phase);
+	// tt
+	OPL3_BlockSlotGeneratePhase(chip, block, 14, (Bit16u)(block->pg_phase[14] >> 9));
+}
+
+static void OPL3_BlockRhythm2(opl3_chip *chip, opl3_block *block) {
+	Bit16u phase14;
+	Bit16u phase17;
+	Bit16u phase;
+	Bit16u phasebit;
+
+	OPL3_BlockSlotGenerate(chip, block, 15);
+	phase14 = (block->pg_phase[13] >> 9) & 0x3ff;
+	phase17 = (block->pg_phase[17] >> 9) & 0x3ff;
+	// hh tc phase bit
+	phasebit = ((phase14 & 0x08) | (((phase14 >> 5) ^ phase14) & 0x04) | (((phase17 >> 2) ^ phase17) & 0x08)) ? 0x01 : 0x00;
+	// sd
+	phase = (0x100 << ((phase14 >> 8) & 0x01)) ^ ((chip->noise & 0x01) << 8);
+	OPL3_BlockSlotGeneratePhase(chip, block, 16, phase);
+	// tc
+	phase = 0x100 | (phasebit << 9);
+	OPL3_BlockSlotGeneratePhase(chip, block, 17, phase);
+}
+
+static Bit32s OPL3_BlockMix(opl3_chip *chip, opl3_block *block, Bit8u side) {
+	Bit16s **out = block->mix_out[side];
+	Bit32s mix = 0;
+	Bit8u ii;
+	Bit8u jj;
+	Bit16s accm;
+
+	for(ii = 0; ii < block->mix_channels[side]; ii++) {
+		accm = 0;
+		for(jj = 0; jj < block->mix_count[side][ii]; jj++) {
+			accm += **out++;
+		}
+		if(chip->extp) {
+			mix += (Bit16s)(accm * block->mix_gain[side][ii] / 65535);
+		} else {
+			mix += (Bit16s)(accm & block->mix_gain[side][ii]);
+		}
+	}
+	return mix;
+}
+
+void OPL3_GenerateBlock(opl3_chip *chip, Bit16s *sndptr, Bit32u numsamples) {
+	opl3_block block;
+	Bit32u i;
+	Bit32u pg_phase17;
+	Bit8u ii;
+	Bit8u rhy = chip->rhy & 0x20;
+
+	OPL3_BlockSetup(chip, &block);
+
+	for(i = 0; i < numsamples; i++) {
+		sndptr[1] = OPL3_ClipSample(chip->mixbuff[1]);
+
+		pg_phase17 = block.pg_phase[17];
+		OPL3_BlockSlotsCalc(chip, &block);
+
+		for(ii = 0; ii < 12; ii++) {
+			OPL3_BlockSlotGenerate(chip, &block, ii);
+		}
+
+		if(rhy) {
+			OPL3_BlockRhythm1(chip, &block, pg_phase17);
+		} else {
+			OPL3_BlockSlotGenerate(chip, &block, 12);
+			OPL3_BlockSlotGenerate(chip, &block, 13);
+			OPL3_BlockSlotGenerate(chip, &block, 14);
+		}
+
+		chip->mixbuff[0] = OPL3_BlockMix(chip, &block, 0);
+
+		if(rhy) {
+			OPL3_BlockRhythm2(chip, &block);
+		} else {
+			OPL3_BlockSlotGenerate(chip, &block, 15);
+			OPL3_BlockSlotGenerate(chip, &block, 16);
+			OPL3_BlockSlotGenerate(chip, &block, 17);
+		}
+
+		sndptr[0] = OPL3_ClipSample(chip->mixbuff[0]);
+
+		for(ii = 18; ii < 33; ii++) {
+			OPL3_BlockSlotGenerate(chip, &block, ii);
+		}
+
+		chip->mixbuff[1] = OPL3_BlockMix(chip, &block, 1);
+
+		for(ii = 33; ii < 36; ii++) {
+			OPL3_BlockSlotGenerate(chip, &block, ii);
+		}
+
+		OPL3_NoiseGenerate(chip);
+
+		if((chip->timer & 0x3f) == 0x3f) {
+			chip->tremolopos = (chip->tremolopos + 1) % 210;
+			if(chip->tremolopos < 105) {
+				chip->tremolo = chip->tremolopos >> chip->tremoloshift;
+			} else {
+				chip->tremolo = (210 - chip->tremolopos) >> chip->tremoloshift;
+			}
+		}
+
+		if((chip->timer & 0x3ff) == 0x3ff) {
+			chip->vibpos = (chip->vibpos + 1) & 7;
+		}
+
+		chip->timer++;
+
+		sndptr += 2;
+	}
+
+	OPL3_BlockFinish(chip, &block);
+}
+
 void OPL3_Reset(opl3_chip *chip, Bit32u samplerate) {
 	Bit8u slotnum;
 	Bit8u channum;
@@ -13,25 +13,32 @@
 //
 
 #include "opl3class.h"
+#include <assert.h>
 #include <string.h>
 
 #include "../resampler.h"
 
 const Bit64u lat = (50 * 49716) / 1000;
 
+// Native frames generated per batch. Kept below half of the resampler input
+// buffer, so the silence it pads the very first write with always fits.
+const unsigned int max_block = 64;
+
 int opl3class::fm_init(unsigned int rate) {
 	OPL3_Reset(&chip, rate);
 
 	memset(command, 0, sizeof(command));
 	memset(time, 0, sizeof(time));
-	memset(samples, 0, sizeof(samples));
 	counter = 0;
 	lastwrite = 0;
 	strpos = 0;
 	endpos = 0;
+	// Native frames go through the windowed sinc polyphase resampler in
+	// ../resampler.c, not the linear interpolation of OPL3_GenerateResampled
 	resampler = resampler_create();
 	if(!resampler) return 0;
-	resampler_set_rate(resampler, 49716.0 / (double)rate);
+	ratio = 49716.0 / (double)rate;
+	resampler_set_rate(resampler, ratio);
 
 	return 1;
 }
@@ -49,31 +56,58 @@ void opl3class::fm_writereg(unsigned short reg, unsigned char data) {
 	endpos = (endpos + 1) % 8192;
 }
 
-void opl3class::fm_generate_one(signed short *buffer) {
-	while(strpos != endpos && time[strpos] < counter) {
-		OPL3_WriteReg(&chip, command[strpos][0], command[strpos][1]);
-		strpos = (strpos + 1) % 8192;
+// Runs the chip at its native rate, splitting the block wherever a queued
+// register write becomes due, so writes land on the same frame as before.
+void opl3class::fm_generate_block(signed short *buffer, unsigned int length) {
+	while(length) {
+		while(strpos != endpos && time[strpos] < counter) {
+			OPL3_WriteReg(&chip, command[strpos][0], command[strpos][1]);
+			strpos = (strpos + 1) % 8192;
+		}
+		unsigned int todo = length;
+		if(strpos != endpos && time[strpos] - counter + 1 < todo) {
+			todo = (unsigned int)(time[strpos] - counter + 1);
+		}
+		OPL3_GenerateBlock(&chip, (Bit16s *)buffer, todo);
+		buffer += todo * 2;
+		counter += todo;
+		length -= todo;
 	}
-	OPL3_Generate(&chip, (Bit16s *)buffer);
-	buffer += 2;
-	counter++;
 }
 
 void opl3class::fm_generate(signed short *buffer, unsigned int length) {
-	for(; length--;) {
-		sample_t ls, rs;
-		unsigned int to_write = resampler_get_min_fill(resampler);
-		while(to_write) {
-			fm_generate_one(samples);
-			resampler_write_pair(resampler, samples[0], samples[1]);
-			--to_write;
+	signed short samples[max_block * 2];
+	while(length) {
+		unsigned int avail = resampler_get_avail(resampler) / 2;
+		if(avail) {
+			if(avail > length) avail = length;
+			length -= avail;
+			while(avail--) {
+				sample_t ls, rs;
+				resampler_read_pair(resampler, &ls, &rs);
+				if((ls + 0x8000) & 0xFFFF0000) ls = (ls >> 31) ^ 0x7FFF;
+				if((rs + 0x8000) & 0xFFFF0000) rs = (rs >> 31) ^ 0x7FFF;
+				buffer[0] = (short)ls;
+				buffer[1] = (short)rs;
+				buffer += 2;
+			}
+			continue;
+		}
+
+		// Only run ahead by what this call is going to consume, so queued
+		// register writes keep their timing relative to the output.
+		unsigned int to_write = (unsigned int)(length * ratio) + 1 + (resampler_get_min_fill(resampler) + 1) / 2;
+		unsigned int free = resampler_get_free(resampler) / 2;
+		if(to_write > free) to_write = free;
+		if(to_write > max_block) to_write = max_block;
+		// A full input buffer is always enough for the resampler to produce
+		// output, so with none available there has to be room for more
+		assert(to_write);
+
+		fm_generate_block(samples, to_write);
+		for(unsigned int i = 0; i < to_write; ++i) {
+			resampler_write_pair(resampler, samples[i * 2 + 0], samples[i * 2 + 1]);
 		}
-		resampler_read_pair(resampler, &ls, &rs);
-		if((ls + 0x8000) & 0xFFFF0000) ls = (ls >> 31) ^ 0x7FFF;
-		if((rs + 0x8000) & 0xFFFF0000) rs = (rs >> 31) ^ 0x7FFF;
-		buffer[0] = (short)ls;
-		buffer[1] = (short)rs;
-		buffer += 2;
 	}
 }
 
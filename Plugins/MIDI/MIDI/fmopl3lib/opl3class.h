@@ -25,8 +25,8 @@ class opl3class : public fm_chip {
 	Bit16u strpos;
 	Bit16s endpos;
 	void *resampler;
-	Bit16s samples[2];
-	void fm_generate_one(signed short *buffer);
+	double ratio;
+	void fm_generate_block(signed short *buffer, unsigned int length);
 
 	public:
 	int fm_init(unsigned int rate);
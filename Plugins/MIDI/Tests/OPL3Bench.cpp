@@ -0,0 +1,117 @@
+//
+//  OPL3Bench.cpp
+//  MIDI
+//
+//  Times OPL3 generation, frame by frame against in blocks, and the Doom
+//  and OPL3W synths end to end.
+//
+
+#include "interface.h"
+#include "opl3.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static const unsigned int bench_seconds = 20;
+
+// Keys on all 18 two-operator channels with assorted patches, vibrato and
+// tremolo on some, and both stereo sides
+static void bench_setup(opl3_chip *chip) {
+	OPL3_Reset(chip, 49716);
+	OPL3_WriteReg(chip, 0x105, 0x01);
+	OPL3_WriteReg(chip, 0xbd, 0xc0);
+	for(unsigned int ch = 0; ch < 18; ++ch) {
+		static const Bit8u slot_of[9] = { 0, 1, 2, 8, 9, 10, 16, 17, 18 };
+		Bit16u bank = (ch >= 9) ? 0x100 : 0x000;
+		Bit8u c = ch % 9;
+		for(unsigned int op = 0; op < 2; ++op) {
+			Bit8u slot = slot_of[c] + op * 3;
+			OPL3_WriteReg(chip, bank | (0x20 + slot), (Bit8u)(0x21 + ((ch & 1) ? 0x40 : 0) + ((ch & 2) ? 0x80 : 0) + op));
+			OPL3_WriteReg(chip, bank | (0x40 + slot), op ? 0x00 : (Bit8u)(0x10 + ch));
+			OPL3_WriteReg(chip, bank | (0x60 + slot), 0xf3);
+			OPL3_WriteReg(chip, bank | (0x80 + slot), 0x24);
+			OPL3_WriteReg(chip, bank | (0xe0 + slot), (Bit8u)((ch + op) & 7));
+		}
+		Bit16u fnum = (Bit16u)(0x200 + ch * 23);
+		OPL3_WriteReg(chip, bank | (0xc0 + c), (Bit8u)(((ch & 1) ? 0x10 : 0x20) | ((ch % 7) << 1)));
+		OPL3_WriteReg(chip, bank | (0xa0 + c), fnum & 0xff);
+		OPL3_WriteReg(chip, bank | (0xb0 + c), (Bit8u)(0x20 | (4 << 2) | (fnum >> 8)));
+	}
+}
+
+static double bench_chip(unsigned int block) {
+	static opl3_chip chip;
+	static Bit16s buffer[64 * 2];
+	const unsigned long frames = 49716UL * bench_seconds;
+
+	bench_setup(&chip);
+
+	clock_t t1 = clock();
+	for(unsigned long done = 0; done < frames; done += 64) {
+		if(block) {
+			OPL3_GenerateBlock(&chip, buffer, 64);
+		} else {
+			for(unsigned int i = 0; i < 64; ++i) {
+				OPL3_Generate(&chip, buffer + i * 2);
+			}
+		}
+	}
+	clock_t t2 = clock();
+
+	return (double)(t2 - t1) / CLOCKS_PER_SEC;
+}
+
+// Sixteen channels playing four-note chords, changed every quarter second,
+// pulled in the 256 frame blocks MSPlayer renders
+static double bench_synth(midisynth *synth) {
+	static signed short buffer[256 * 2];
+	const unsigned long frames = 44100UL * bench_seconds;
+	unsigned int chord = 0;
+
+	if(!synth->midi_init(44100, 0, 0)) {
+		delete synth;
+		return 0;
+	}
+
+	clock_t t1 = clock();
+	for(unsigned long done = 0; done < frames; done += 256) {
+		if((done % 11025) < 256) {
+			for(unsigned int ch = 0; ch < 16; ++ch) {
+				if(ch == 9) continue;
+				for(unsigned int n = 0; n < 4; ++n) {
+					unsigned int note = 36 + ((chord + ch * 5 + n * 4) % 48);
+					synth->midi_write(0x80 | ch | ((note - 1) << 8));
+					synth->midi_write(0x90 | ch | (note << 8) | (100 << 16));
+				}
+			}
+			++chord;
+		}
+		synth->midi_generate(buffer, 256);
+	}
+	clock_t t2 = clock();
+
+	delete synth;
+	return (double)(t2 - t1) / CLOCKS_PER_SEC;
+}
+
+int main(void) {
+	// Best of several runs, taken in turns, to keep other load out of it
+	double frame = 0, block = 0, synth = 0;
+	for(unsigned int i = 0; i < 9; ++i) {
+		double t = bench_chip(0);
+		if(!i || t < frame) frame = t;
+		t = bench_chip(1);
+		if(!i || t < block) block = t;
+	}
+	printf("chip, %u s at 49716 Hz: per frame %.3f s, in blocks %.3f s (%.2fx)\n", bench_seconds, frame, block, frame / block);
+
+	for(unsigned int s = 0; s < 2; ++s) {
+		for(unsigned int i = 0; i < 5; ++i) {
+			double t = bench_synth(s ? getsynth_opl3w() : getsynth_doom());
+			if(!i || t < synth) synth = t;
+		}
+		printf("%s synth, %u s at 44100 Hz: %.3f s (%.0fx real time)\n", s ? "OPL3W" : "Doom", bench_seconds, synth, bench_seconds / synth);
+	}
+	return 0;
+}
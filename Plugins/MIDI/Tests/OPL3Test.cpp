@@ -0,0 +1,83 @@
+//
+//  OPL3Test.cpp
+//  MIDI
+//
+//  Checks OPL3_GenerateBlock against OPL3_Generate frame by frame. Two chips
+//  get the same random register writes, including rhythm mode, 4-op and
+//  extended panning, between blocks of random length. The output and the
+//  state of every slot have to stay identical.
+//
+
+#include "opl3.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static opl3_chip frameChip, blockChip;
+
+static void writeBoth(Bit16u reg, Bit8u value) {
+	OPL3_WriteReg(&frameChip, reg, value);
+	OPL3_WriteReg(&blockChip, reg, value);
+}
+
+static void writeRandom() {
+	Bit16u bank = (rand() & 1) << 8;
+	switch(rand() % 10) {
+		case 0: writeBoth(bank | (0x20 + rand() % 0x16), (Bit8u)rand()); break;
+		case 1: writeBoth(bank | (0x40 + rand() % 0x16), (Bit8u)(rand() & 0x3f)); break;
+		case 2: writeBoth(bank | (0x60 + rand() % 0x16), (Bit8u)rand()); break;
+		case 3: writeBoth(bank | (0x80 + rand() % 0x16), (Bit8u)rand()); break;
+		case 4: writeBoth(bank | (0xa0 + rand() % 9), (Bit8u)rand()); break;
+		case 5: writeBoth(bank | (0xb0 + rand() % 9), (Bit8u)(rand() & 0x3f)); break;
+		case 6: writeBoth(bank | (0xc0 + rand() % 9), (Bit8u)rand()); break;
+		case 7: writeBoth(bank | (0xe0 + rand() % 0x16), (Bit8u)rand()); break;
+		case 8: writeBoth(0xbd, (Bit8u)rand()); break;
+		case 9: writeBoth(0x104, (Bit8u)(rand() & 0x3f)); break;
+	}
+}
+
+static bool slotsEqual() {
+	for(int i = 0; i < 36; ++i) {
+		const opl3_slot &a = frameChip.slot[i], &b = blockChip.slot[i];
+		if(a.out != b.out || a.fbmod != b.fbmod || a.prout != b.prout || a.eg_rout != b.eg_rout ||
+		   a.eg_out != b.eg_out || a.eg_inc != b.eg_inc || a.eg_gen != b.eg_gen || a.eg_rate != b.eg_rate ||
+		   a.key != b.key || a.pg_phase != b.pg_phase)
+			return false;
+	}
+	return frameChip.timer == blockChip.timer && frameChip.noise == blockChip.noise &&
+	       frameChip.mixbuff[0] == blockChip.mixbuff[0] && frameChip.mixbuff[1] == blockChip.mixbuff[1];
+}
+
+int main() {
+	static Bit16s frameOutput[512 * 2], blockOutput[512 * 2];
+	const int blocks = 20000;
+	int failures = 0;
+
+	OPL3_Reset(&frameChip, 49716);
+	OPL3_Reset(&blockChip, 49716);
+	writeBoth(0x105, 0x01);
+	writeBoth(0x104, 0x3f);
+
+	srand(3);
+	for(int n = 0; n < blocks && failures < 10; ++n) {
+		for(int w = rand() % 6; w > 0; --w)
+			writeRandom();
+		if(n % 5000 == 0)
+			frameChip.extp = blockChip.extp = (n / 5000) & 1;
+
+		unsigned int frames = 1 + rand() % 512;
+		for(unsigned int i = 0; i < frames; ++i)
+			OPL3_Generate(&frameChip, frameOutput + i * 2);
+		OPL3_GenerateBlock(&blockChip, blockOutput, frames);
+
+		if(memcmp(frameOutput, blockOutput, frames * 4) != 0 || !slotsEqual()) {
+			printf("FAIL: block %d of %u frames differs\n", n, frames);
+			++failures;
+		}
+	}
+
+	if(failures)
+		printf("%d failures\n", failures);
+	return failures ? 1 : 0;
+}
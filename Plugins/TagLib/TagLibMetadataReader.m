@@ -16,6 +16,7 @@
 #import <taglib/mpeg/id3v2/id3v2tag.h>
 #import <taglib/mpeg/mpegfile.h>
 #import <taglib/tag.h>
+#import <taglib/toolkit/tboundedfilestream.h>
 #import <taglib/vorbisfile.h>
 #import <taglib/xiphcomment.h>
 
@@ -62,7 +63,9 @@
 	//
 	//	}
 
-	TagLib::FileRef f((const char *)[[url path] UTF8String], false);
+	// Only the tags are read, so the reads are kept to where they are stored
+	TagLib::BoundedFileStream stream((const char *)[[url path] UTF8String]);
+	TagLib::FileRef f(&stream, false);
 	if(!f.isNull()) {
 		const TagLib::Tag *tag = f.tag();
 
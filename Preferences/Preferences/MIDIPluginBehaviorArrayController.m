@@ -77,6 +77,8 @@ static void enumCallback(void *context, OSType uSubType, OSType uManufacturer, c
 
 	[self addObject:@{@"name": @"OPL3Windows", @"preference": @"OPL3W000"}];
 
+	[self addObject:@{@"name": @"Roland MT-32 (munt)", @"preference": @"MT32EMU0"}];
+
 	enumComponents(enumCallback, (__bridge void *)(self));
 }
 